@@ -1457,6 +1457,13 @@ declare global {
         getAllEntitiesOnTile(type: "staff", tilePos: CoordsXY): Staff[];
         getAllEntitiesOnTile(type: "car", tilePos: CoordsXY): Car[];
         getAllEntitiesOnTile(type: "litter", tilePos: CoordsXY): Litter[];
+        /**
+         * Gets the number of guests in the 8x8 tile cell containing the given
+         * position. The count is maintained as entities move, so this is far
+         * cheaper than enumerating entities.
+         * @param tilePos The position in world coordinates, as used by entities.
+         */
+        getGuestDensity(tilePos: CoordsXY): number;
         createEntity(type: EntityType, initializer: object): Entity;
 
         /**
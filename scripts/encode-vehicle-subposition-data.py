@@ -0,0 +1,433 @@
+#!/usr/bin/env python3
+"""Re-encodes src/openrct2/ride/VehicleSubpositionData.cpp as delta-compressed
+byte streams.
+
+The original expanded table (one VehicleInfo struct per subposition step, see
+git history) weighs several megabytes in the binary. Consecutive steps differ
+by a pixel or two in at most a couple of fields, so each list is stored as a
+raw first entry followed by per-entry change masks and small deltas, and is
+decoded once at runtime. This script parses an expanded table, encodes it,
+verifies the encoding round-trips bit-exactly and emits the replacement
+translation unit.
+
+Usage: encode-vehicle-subposition-data.py <expanded table.cpp> <output.cpp>
+
+Encoding, per list:
+  entry 0:    x, y, z as little-endian int16, then direction, pitch and
+              bank_rotation as uint8.
+  entry n>0:  one change-mask byte; bits 0-5 flag x, y, z, direction, pitch
+              and bank_rotation in that order. Each flagged x/y/z field is an
+              int8 delta, with -128 escaping to a little-endian int16 absolute
+              value. Each flagged direction/pitch/bank field is a uint8
+              absolute value.
+"""
+import re
+import struct
+import sys
+
+LOCATION_NULL = -32768
+MINI_GOLF_STATE = {f"Unk{i}": i for i in range(7)}
+MINI_GOLF_ANIMATION = {
+    name: i
+    for i, name in enumerate(
+        [
+            "Walk",
+            "PlaceBallDown",
+            "SwingLeft",
+            "PickupBall",
+            "Jump",
+            "PlaceBallUp",
+            "PuttLeft",
+            "Swing",
+            "Putt",
+        ]
+    )
+}
+
+SUBPOSITION_COMMENTS = [
+    "VehicleTrackSubposition::Default",
+    "VehicleTrackSubposition::ChairliftGoingOut",
+    "VehicleTrackSubposition::ChairliftGoingBack",
+    "VehicleTrackSubposition::ChairliftEndBullwheel",
+    "VehicleTrackSubposition::ChairliftStartBullwheel",
+    "VehicleTrackSubposition::GoKartsLeftLane",
+    "VehicleTrackSubposition::GoKartsRightLane",
+    "VehicleTrackSubposition::GoKartsMovingToRightLane",
+    "VehicleTrackSubposition::GoKartsMovingToLeftLane",
+    "VehicleTrackSubposition::MiniGolfStart9, VehicleTrackSubposition::MiniGolfPathA9",
+    "VehicleTrackSubposition::MiniGolfBallPathA10",
+    "VehicleTrackSubposition::MiniGolfPathB11",
+    "VehicleTrackSubposition::MiniGolfBallPathB12",
+    "VehicleTrackSubposition::MiniGolfPathC13",
+    "VehicleTrackSubposition::MiniGolfBallPathC14",
+    "VehicleTrackSubposition::ReverserRCFrontBogie",
+    "VehicleTrackSubposition::ReverserRCRearBogie",
+]
+
+LICENCE = """\
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+"""
+
+
+def parse_namespace_spans(source):
+    spans = []
+    for match in re.finditer(r"namespace (\w+)\s*\{", source):
+        depth = 1
+        position = match.end()
+        while depth > 0:
+            character = source[position]
+            if character == "{":
+                depth += 1
+            elif character == "}":
+                depth -= 1
+            position += 1
+        spans.append((match.start(), position, match.group(1)))
+    return spans
+
+
+def qualify(spans, position, name):
+    for start, end, namespace in spans:
+        if start <= position < end:
+            return f"{namespace}::{name}"
+    return name
+
+
+def parse_lists(source):
+    spans = parse_namespace_spans(source)
+    lists = {}
+    order = []
+    entry_pattern = re.compile(
+        r"\{([^{}]*)\}|MINI_GOLF_STATE\((\w+)\)|MINI_GOLF_ANIMATION\((\w+)\)"
+    )
+    for match in re.finditer(
+        r"CREATE_VEHICLE_INFO\((\w+),\s*\{(.*?)\}\s*\)", source, re.DOTALL
+    ):
+        name, body = match.groups()
+        name = qualify(spans, match.start(), name)
+        entries = []
+        for entry in entry_pattern.finditer(body):
+            if entry.group(1) is not None:
+                values = [int(v) for v in entry.group(1).split(",")]
+                assert len(values) == 6, name
+                entries.append(tuple(values))
+            elif entry.group(2) is not None:
+                entries.append((LOCATION_NULL, MINI_GOLF_STATE[entry.group(2)], 0, 0, 0, 0))
+            else:
+                entries.append(
+                    (LOCATION_NULL, MINI_GOLF_STATE["Unk4"], MINI_GOLF_ANIMATION[entry.group(3)], 0, 0, 0)
+                )
+        assert name not in lists, name
+        lists[name] = entries
+        order.append(name)
+    return lists, order
+
+
+def parse_directories(source):
+    directories = {}
+    for match in re.finditer(
+        r"static constexpr const VehicleInfoList \*(\w+)\[\] = \{(.*?)\};",
+        source,
+        re.DOTALL,
+    ):
+        name, body = match.groups()
+        directories[name] = re.findall(r"&([\w:]+)", body)
+    subpositions = re.search(r"gTrackVehicleInfo\[[^\]]*\] = \{(.*?)\};", source, re.DOTALL)
+    directory_order = re.findall(r"(TrackVehicleInfoList\w+)", subpositions.group(1))
+    return directories, directory_order
+
+
+def encode_s16(value):
+    return struct.pack("<h", value)
+
+
+def encode_list(entries):
+    data = bytearray()
+    previous = None
+    for entry in entries:
+        x, y, z, direction, pitch, bank = entry
+        if previous is None:
+            data += encode_s16(x) + encode_s16(y) + encode_s16(z)
+            data += bytes([direction, pitch, bank])
+        else:
+            flags = 0
+            fields = bytearray()
+            for bit, (value, previous_value) in enumerate(zip(entry[:3], previous[:3])):
+                if value != previous_value:
+                    flags |= 1 << bit
+                    delta = value - previous_value
+                    if -127 <= delta <= 127:
+                        fields += struct.pack("<b", delta)
+                    else:
+                        fields += b"\x80" + encode_s16(value)
+            for bit, (value, previous_value) in enumerate(zip(entry[3:], previous[3:])):
+                if value != previous_value:
+                    flags |= 1 << (3 + bit)
+                    fields.append(value)
+            data.append(flags)
+            data += fields
+        previous = entry
+    return bytes(data)
+
+
+def decode_list(data, count):
+    entries = []
+    offset = 0
+
+    def read_s16():
+        nonlocal offset
+        value = struct.unpack_from("<h", data, offset)[0]
+        offset += 2
+        return value
+
+    current = None
+    for i in range(count):
+        if i == 0:
+            x, y, z = read_s16(), read_s16(), read_s16()
+            direction, pitch, bank = data[offset : offset + 3]
+            offset += 3
+            current = [x, y, z, direction, pitch, bank]
+        else:
+            flags = data[offset]
+            offset += 1
+            for bit in range(3):
+                if flags & (1 << bit):
+                    delta = struct.unpack_from("<b", data, offset)[0]
+                    offset += 1
+                    if delta == -128:
+                        current[bit] = read_s16()
+                    else:
+                        current[bit] += delta
+            for bit in range(3):
+                if flags & (1 << (3 + bit)):
+                    current[3 + bit] = data[offset]
+                    offset += 1
+        entries.append(tuple(current))
+    assert offset == len(data)
+    return entries
+
+
+def format_byte_array(data, indent="    "):
+    lines = []
+    for i in range(0, len(data), 24):
+        chunk = data[i : i + 24]
+        lines.append(indent + " ".join(f"0x{b:02X}," for b in chunk))
+    return "\n".join(lines)
+
+
+def main():
+    if len(sys.argv) != 3:
+        print(__doc__.strip().splitlines()[0])
+        print(f"Usage: {sys.argv[0]} <expanded table.cpp> <output.cpp>")
+        return 1
+
+    with open(sys.argv[1]) as f:
+        source = f.read()
+
+    lists, list_order = parse_lists(source)
+    directories, directory_order = parse_directories(source)
+    assert len(directory_order) == len(SUBPOSITION_COMMENTS)
+
+    blob = bytearray()
+    list_table = []
+    list_indices = {}
+    for name in list_order:
+        entries = lists[name]
+        encoded = encode_list(entries)
+        assert decode_list(encoded, len(entries)) == entries, name
+        list_indices[name] = len(list_table)
+        list_table.append((len(blob), len(entries)))
+        blob += encoded
+
+    directory_rows = []
+    flat_indices = []
+    for directory_name in directory_order:
+        members = directories[directory_name]
+        directory_rows.append((len(flat_indices), len(members)))
+        flat_indices += [list_indices[member] for member in members]
+
+    expanded_size = sum(count * 10 for _, count in list_table)
+    print(f"lists: {len(list_table)}, encoded bytes: {len(blob)}, expanded bytes: {expanded_size}")
+    for comment, (offset, count) in zip(SUBPOSITION_COMMENTS, directory_rows):
+        print(f"  {comment}: {count} lists")
+
+    out = [LICENCE]
+    out.append('\n#include "VehicleSubpositionData.h"\n')
+    out.append('\n#include "Vehicle.h"\n')
+    out.append("\n#include <memory>\n#include <vector>\n")
+    out.append(
+        """
+// The subposition tables are stored delta-compressed and decoded on first
+// use; see scripts/encode-vehicle-subposition-data.py for the encoding and
+// the git history of this file for the expanded form. Each list starts with
+// a raw entry (x, y, z as little-endian int16, then direction, pitch and
+// bank_rotation bytes) followed by one change-mask byte per entry; mask bits
+// 0-5 flag x, y, z, direction, pitch and bank_rotation. Flagged x/y/z fields
+// are int8 deltas, with -128 escaping to a little-endian int16 absolute
+// value; flagged direction/pitch/bank fields are uint8 absolute values.
+"""
+    )
+    out.append("\n// clang-format off\n")
+    out.append("static constexpr uint8_t kVehicleInfoEncodedData[] = {\n")
+    out.append(format_byte_array(blob))
+    out.append("\n};\n")
+
+    out.append(
+        "\nstruct EncodedVehicleInfoList\n{\n    uint32_t Offset;\n    uint16_t Size;\n};\n"
+    )
+    out.append("\nstatic constexpr EncodedVehicleInfoList kEncodedVehicleInfoLists[] = {\n")
+    for i in range(0, len(list_table), 6):
+        row = list_table[i : i + 6]
+        out.append("    " + " ".join(f"{{ {offset}, {count} }}," for offset, count in row) + "\n")
+    out.append("};\n")
+
+    out.append("\nstatic constexpr uint16_t kSubpositionListIndices[] = {\n")
+    for i in range(0, len(flat_indices), 20):
+        row = flat_indices[i : i + 20]
+        out.append("    " + " ".join(f"{index}," for index in row) + "\n")
+    out.append("};\n")
+
+    out.append(
+        "\nstruct SubpositionDirectoryRange\n{\n    uint32_t Offset;\n    uint16_t Count;\n};\n"
+    )
+    out.append(
+        "\nstatic constexpr SubpositionDirectoryRange kSubpositionDirectories[EnumValue(VehicleTrackSubposition::Count)] = {\n"
+    )
+    for comment, (offset, count) in zip(SUBPOSITION_COMMENTS, directory_rows):
+        out.append(f"    {{ {offset}, {count} }}, // {comment}\n")
+    out.append("};\n")
+    out.append(
+        "\nstatic_assert(kSubpositionDirectories[0].Count == VehicleTrackSubpositionSizeDefault);\n"
+    )
+    out.append("// clang-format on\n")
+
+    out.append(
+        """
+namespace
+{
+    struct DecodedSubpositionData
+    {
+        // Every decoded step, all lists back to back.
+        std::unique_ptr<VehicleInfo[]> entries;
+        // One VehicleInfoList per encoded list, pointing into entries.
+        std::vector<VehicleInfoList> lists;
+        // Per subposition, the lists indexed by (trackType << 2) | direction.
+        std::vector<VehicleInfoList> directories[EnumValue(VehicleTrackSubposition::Count)];
+    };
+} // namespace
+
+static int16_t DecodeS16(const uint8_t*& src)
+{
+    int16_t value = static_cast<int16_t>(src[0] | (src[1] << 8));
+    src += 2;
+    return value;
+}
+
+static void DecodeVehicleInfoList(const uint8_t* src, VehicleInfo* dst, uint16_t count)
+{
+    VehicleInfo current{};
+    for (uint16_t i = 0; i < count; i++)
+    {
+        if (i == 0)
+        {
+            current.x = DecodeS16(src);
+            current.y = DecodeS16(src);
+            current.z = DecodeS16(src);
+            current.direction = *src++;
+            current.Pitch = *src++;
+            current.bank_rotation = *src++;
+        }
+        else
+        {
+            const uint8_t flags = *src++;
+            int16_t* const coords[] = { &current.x, &current.y, &current.z };
+            for (uint8_t bit = 0; bit < 3; bit++)
+            {
+                if (flags & (1 << bit))
+                {
+                    const auto delta = static_cast<int8_t>(*src++);
+                    *coords[bit] = delta == -128 ? DecodeS16(src) : static_cast<int16_t>(*coords[bit] + delta);
+                }
+            }
+            uint8_t* const fields[] = { &current.direction, &current.Pitch, &current.bank_rotation };
+            for (uint8_t bit = 0; bit < 3; bit++)
+            {
+                if (flags & (1 << (3 + bit)))
+                {
+                    *fields[bit] = *src++;
+                }
+            }
+        }
+        dst[i] = current;
+    }
+}
+
+static DecodedSubpositionData DecodeSubpositionData()
+{
+    DecodedSubpositionData data;
+
+    size_t totalEntries = 0;
+    for (const auto& list : kEncodedVehicleInfoLists)
+    {
+        totalEntries += list.Size;
+    }
+    data.entries = std::make_unique<VehicleInfo[]>(totalEntries);
+
+    data.lists.reserve(std::size(kEncodedVehicleInfoLists));
+    size_t entryOffset = 0;
+    for (const auto& list : kEncodedVehicleInfoLists)
+    {
+        auto* dst = data.entries.get() + entryOffset;
+        DecodeVehicleInfoList(kVehicleInfoEncodedData + list.Offset, dst, list.Size);
+        data.lists.push_back({ list.Size, dst });
+        entryOffset += list.Size;
+    }
+
+    for (size_t i = 0; i < EnumValue(VehicleTrackSubposition::Count); i++)
+    {
+        const auto& range = kSubpositionDirectories[i];
+        auto& directory = data.directories[i];
+        directory.reserve(range.Count);
+        for (uint16_t j = 0; j < range.Count; j++)
+        {
+            directory.push_back(data.lists[kSubpositionListIndices[range.Offset + j]]);
+        }
+    }
+    return data;
+}
+
+static const DecodedSubpositionData& GetDecodedSubpositionData()
+{
+    static const DecodedSubpositionData instance = DecodeSubpositionData();
+    return instance;
+}
+
+const VehicleInfoList* VehicleGetTrackSubpositionInfoList(VehicleTrackSubposition subposition, uint16_t typeAndDirection)
+{
+    if (subposition >= VehicleTrackSubposition::Count)
+    {
+        return nullptr;
+    }
+    const auto& directory = GetDecodedSubpositionData().directories[EnumValue(subposition)];
+    if (typeAndDirection >= directory.size())
+    {
+        return nullptr;
+    }
+    return &directory[typeAndDirection];
+}
+"""
+    )
+
+    with open(sys.argv[2], "w") as f:
+        f.write("".join(out))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -464,7 +464,14 @@ public:
                 break;
 
             case INTENT_ACTION_REFRESH_GUEST_LIST:
-                WindowGuestListRefreshList();
+                if (intent.HasExtra(INTENT_EXTRA_PEEP_ID))
+                {
+                    WindowGuestListRefreshGuest(EntityId::FromUnderlying(intent.GetUIntExtra(INTENT_EXTRA_PEEP_ID)));
+                }
+                else
+                {
+                    WindowGuestListRefreshList();
+                }
                 break;
 
             case INTENT_ACTION_REFRESH_STAFF_LIST:
@@ -503,7 +510,14 @@ public:
                 gToolbarDirtyFlags |= BTM_TB_DIRTY_FLAG_PEEP_COUNT;
                 WindowInvalidateByClass(WindowClass::GuestList);
                 WindowInvalidateByClass(WindowClass::ParkInformation);
-                WindowGuestListRefreshList();
+                if (intent.HasExtra(INTENT_EXTRA_PEEP_ID))
+                {
+                    WindowGuestListRefreshGuest(EntityId::FromUnderlying(intent.GetUIntExtra(INTENT_EXTRA_PEEP_ID)));
+                }
+                else
+                {
+                    WindowGuestListRefreshList();
+                }
                 break;
 
             case INTENT_ACTION_UPDATE_PARK_RATING:
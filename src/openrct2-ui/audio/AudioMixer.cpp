@@ -345,35 +345,41 @@ int32_t AudioMixer::ApplyVolume(const IAudioChannel* channel, void* buffer, size
     return mixVolume;
 }
 
+// The effect kernels compute each sample's gain from its index rather than
+// carrying it across iterations or dividing per sample, so the loops have no
+// loop-carried dependency and the compiler vectorises them.
+
 void AudioMixer::EffectPanS16(const IAudioChannel* channel, int16_t* data, int32_t length)
 {
     const float dt = 1.0f / static_cast<float>(length * 2.0f);
-    float volumeL = channel->GetOldVolumeL();
-    float volumeR = channel->GetOldVolumeR();
-    const float d_left = dt * (channel->GetVolumeL() - channel->GetOldVolumeL());
-    const float d_right = dt * (channel->GetVolumeR() - channel->GetOldVolumeR());
+    const float startL = channel->GetOldVolumeL();
+    const float startR = channel->GetOldVolumeR();
+    const float d_left = dt * (channel->GetVolumeL() - startL);
+    const float d_right = dt * (channel->GetVolumeR() - startR);
 
-    for (int32_t i = 0; i < length * 2; i += 2)
+    for (int32_t i = 0; i < length; i++)
     {
-        data[i + 0] = static_cast<int16_t>(volumeL * static_cast<float>(data[i + 0]));
-        data[i + 1] = static_cast<int16_t>(volumeR * static_cast<float>(data[i + 1]));
-        volumeL += d_left;
-        volumeR += d_right;
+        const float volumeL = startL + d_left * static_cast<float>(i);
+        const float volumeR = startR + d_right * static_cast<float>(i);
+        data[i * 2 + 0] = static_cast<int16_t>(volumeL * static_cast<float>(data[i * 2 + 0]));
+        data[i * 2 + 1] = static_cast<int16_t>(volumeR * static_cast<float>(data[i * 2 + 1]));
     }
 }
 
 void AudioMixer::EffectPanU8(const IAudioChannel* channel, uint8_t* data, int32_t length)
 {
-    float volumeL = channel->GetVolumeL();
-    float volumeR = channel->GetVolumeR();
-    float oldVolumeL = channel->GetOldVolumeL();
-    float oldVolumeR = channel->GetOldVolumeR();
+    const float dt = 1.0f / static_cast<float>(length);
+    const float startL = channel->GetOldVolumeL();
+    const float startR = channel->GetOldVolumeR();
+    const float d_left = dt * (channel->GetVolumeL() - startL);
+    const float d_right = dt * (channel->GetVolumeR() - startR);
 
-    for (int32_t i = 0; i < length * 2; i += 2)
+    for (int32_t i = 0; i < length; i++)
     {
-        float t = static_cast<float>(i) / static_cast<float>(length * 2.0f);
-        data[i] = static_cast<uint8_t>(data[i] * ((1.0 - t) * oldVolumeL + t * volumeL));
-        data[i + 1] = static_cast<uint8_t>(data[i + 1] * ((1.0 - t) * oldVolumeR + t * volumeR));
+        const float volumeL = startL + d_left * static_cast<float>(i);
+        const float volumeR = startR + d_right * static_cast<float>(i);
+        data[i * 2 + 0] = static_cast<uint8_t>(data[i * 2 + 0] * volumeL);
+        data[i * 2 + 1] = static_cast<uint8_t>(data[i * 2 + 1] * volumeR);
     }
 }
 
@@ -381,12 +387,12 @@ void AudioMixer::EffectFadeS16(int16_t* data, int32_t length, int32_t startvolum
 {
     static_assert(SDL_MIX_MAXVOLUME == kMixerVolumeMax, "Max volume differs between OpenRCT2 and SDL2");
 
-    float startvolume_f = static_cast<float>(startvolume) / SDL_MIX_MAXVOLUME;
-    float endvolume_f = static_cast<float>(endvolume) / SDL_MIX_MAXVOLUME;
+    const float startvolume_f = static_cast<float>(startvolume) / SDL_MIX_MAXVOLUME;
+    const float endvolume_f = static_cast<float>(endvolume) / SDL_MIX_MAXVOLUME;
+    const float step = (endvolume_f - startvolume_f) / static_cast<float>(length);
     for (int32_t i = 0; i < length; i++)
     {
-        float t = static_cast<float>(i) / length;
-        data[i] = static_cast<int16_t>(data[i] * ((1.0f - t) * startvolume_f + t * endvolume_f));
+        data[i] = static_cast<int16_t>(data[i] * (startvolume_f + step * static_cast<float>(i)));
     }
 }
 
@@ -394,12 +400,12 @@ void AudioMixer::EffectFadeU8(uint8_t* data, int32_t length, int32_t startvolume
 {
     static_assert(SDL_MIX_MAXVOLUME == kMixerVolumeMax, "Max volume differs between OpenRCT2 and SDL2");
 
-    float startvolume_f = static_cast<float>(startvolume) / SDL_MIX_MAXVOLUME;
-    float endvolume_f = static_cast<float>(endvolume) / SDL_MIX_MAXVOLUME;
+    const float startvolume_f = static_cast<float>(startvolume) / SDL_MIX_MAXVOLUME;
+    const float endvolume_f = static_cast<float>(endvolume) / SDL_MIX_MAXVOLUME;
+    const float step = (endvolume_f - startvolume_f) / static_cast<float>(length);
     for (int32_t i = 0; i < length; i++)
     {
-        float t = static_cast<float>(i) / length;
-        data[i] = static_cast<uint8_t>(data[i] * ((1.0f - t) * startvolume_f + t * endvolume_f));
+        data[i] = static_cast<uint8_t>(data[i] * (startvolume_f + step * static_cast<float>(i)));
     }
 }
 
@@ -10,6 +10,7 @@
 #include "DrawingEngineFactory.hpp"
 
 #include <SDL.h>
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <openrct2/Diagnostic.h>
@@ -31,6 +32,10 @@ class HardwareDisplayDrawingEngine final : public X8DrawingEngine
 private:
     constexpr static uint32_t DIRTY_VISUAL_TIME = 32;
 
+    // With more damage rectangles than this the per-call overhead outweighs
+    // the saved upload bandwidth, so fall back to a full texture update.
+    constexpr static size_t kMaxDamageRects = 64;
+
     std::shared_ptr<IUiContext> const _uiContext;
     SDL_Window* _window = nullptr;
     SDL_Renderer* _sdlRenderer = nullptr;
@@ -49,6 +54,12 @@ private:
 
     std::vector<uint32_t> _dirtyVisualsTime;
 
+    // Damage rectangles collected from the dirty grid for the current frame
+    // and a persistent conversion buffer for partial texture updates.
+    std::vector<SDL_Rect> _damageRects;
+    std::vector<uint32_t> _damageBuffer;
+    bool _forceFullUpload = true;
+
     bool smoothNN = false;
 
 public:
@@ -157,6 +168,10 @@ public:
         SDL_QueryTexture(_screenTexture, &format, nullptr, nullptr, nullptr);
         _screenTextureFormat = SDL_AllocFormat(format);
 
+        // The texture was recreated, any collected damage no longer applies
+        _damageRects.clear();
+        _forceFullUpload = true;
+
         ConfigureBits(width, height, width);
     }
 
@@ -166,7 +181,14 @@ public:
         {
             for (int32_t i = 0; i < 256; i++)
             {
-                _paletteHWMapped[i] = SDL_MapRGB(_screenTextureFormat, palette[i].Red, palette[i].Green, palette[i].Blue);
+                auto mapped = SDL_MapRGB(_screenTextureFormat, palette[i].Red, palette[i].Green, palette[i].Blue);
+                if (_paletteHWMapped[i] != mapped)
+                {
+                    // Palette animation recolours pixels that are not marked
+                    // dirty, so the whole texture has to be refreshed
+                    _paletteHWMapped[i] = mapped;
+                    _forceFullUpload = true;
+                }
             }
 
             if (Config::Get().general.EnableLightFx)
@@ -193,6 +215,7 @@ public:
 protected:
     void OnDrawDirtyBlock(uint32_t left, uint32_t top, uint32_t columns, uint32_t rows) override
     {
+        AddDamageRect(left, top, columns, rows);
         if (gShowDirtyVisuals)
         {
             uint32_t right = left + columns;
@@ -208,6 +231,79 @@ protected:
     }
 
 private:
+    void AddDamageRect(uint32_t left, uint32_t top, uint32_t columns, uint32_t rows)
+    {
+        const uint32_t x = std::min(left * _dirtyGrid.BlockWidth, _width);
+        const uint32_t y = std::min(top * _dirtyGrid.BlockHeight, _height);
+        const uint32_t w = std::min(columns * _dirtyGrid.BlockWidth, _width - x);
+        const uint32_t h = std::min(rows * _dirtyGrid.BlockHeight, _height - y);
+        if (w == 0 || h == 0)
+        {
+            return;
+        }
+        _damageRects.push_back({ static_cast<int32_t>(x), static_cast<int32_t>(y), static_cast<int32_t>(w),
+                                 static_cast<int32_t>(h) });
+    }
+
+    bool CanUsePartialUpdates() const
+    {
+        // Partial conversion is only implemented for 32 bpp texture formats;
+        // the other CopyBitsToTexture fallbacks are rare enough not to bother.
+        if (_forceFullUpload || _screenTextureFormat == nullptr || _screenTextureFormat->BytesPerPixel != 4)
+        {
+            return false;
+        }
+        if (_damageRects.empty() || _damageRects.size() > kMaxDamageRects)
+        {
+            return false;
+        }
+        uint64_t damagedArea = 0;
+        for (const auto& rect : _damageRects)
+        {
+            damagedArea += static_cast<uint64_t>(rect.w) * rect.h;
+        }
+        return damagedArea < (static_cast<uint64_t>(_width) * _height * 3) / 4;
+    }
+
+    void UpdateScreenTexture()
+    {
+        if (!_forceFullUpload && _damageRects.empty())
+        {
+            // Nothing changed since the last frame, keep the texture as is
+            return;
+        }
+        if (!CanUsePartialUpdates())
+        {
+            CopyBitsToTexture(
+                _screenTexture, _bits, static_cast<int32_t>(_width), static_cast<int32_t>(_height), _paletteHWMapped);
+            _forceFullUpload = false;
+            return;
+        }
+
+        // Convert only the damaged pixels and upload each rectangle with a
+        // partial texture update; the rest of the texture keeps last frame
+        _damageBuffer.resize(static_cast<size_t>(_width) * _height);
+        const int32_t texturePitch = static_cast<int32_t>(_width) * 4;
+        for (const auto& rect : _damageRects)
+        {
+            const uint8_t* src = _bits + static_cast<size_t>(rect.y) * _pitch + rect.x;
+            uint32_t* dst = _damageBuffer.data() + static_cast<size_t>(rect.y) * _width + rect.x;
+            for (int32_t yy = 0; yy < rect.h; yy++)
+            {
+                const uint8_t* nextSrc = src;
+                uint32_t* nextDst = dst;
+                for (int32_t xx = 0; xx < rect.w; xx++)
+                {
+                    *nextDst++ = _paletteHWMapped[*nextSrc++];
+                }
+                src += _pitch;
+                dst += _width;
+            }
+            SDL_UpdateTexture(
+                _screenTexture, &rect, _damageBuffer.data() + static_cast<size_t>(rect.y) * _width + rect.x, texturePitch);
+        }
+    }
+
     void Display()
     {
         if (Config::Get().general.EnableLightFx)
@@ -219,12 +315,14 @@ private:
                 LightFXRenderToTexture(pixels, pitch, _bits, _width, _height, _paletteHWMapped, _lightPaletteHWMapped);
                 SDL_UnlockTexture(_screenTexture);
             }
+            // The lock rewrote the whole texture with light-composited pixels
+            _forceFullUpload = true;
         }
         else
         {
-            CopyBitsToTexture(
-                _screenTexture, _bits, static_cast<int32_t>(_width), static_cast<int32_t>(_height), _paletteHWMapped);
+            UpdateScreenTexture();
         }
+        _damageRects.clear();
         if (smoothNN)
         {
             SDL_SetRenderTarget(_sdlRenderer, _scaledScreenTexture);
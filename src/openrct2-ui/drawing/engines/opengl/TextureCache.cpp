@@ -87,12 +87,29 @@ BasicTextureInfo TextureCache::GetOrLoadImageTexture(const ImageId imageId)
         }
     }
 
+    // Rasterise the image outside of the exclusive lock; it only reads the
+    // g1 elements and is by far the most expensive part of a cache miss.
+    DrawPixelInfo dpi = GetImageAsDPI(ImageId(imageId.GetIndex()));
+
     // Load new texture.
     unique_lock lock(_mutex);
 
+    // Another thread may have loaded the image while it was being rasterised.
+    index = _indexMap[imageId.GetIndex()];
+    if (index != kUnusedIndex)
+    {
+        DeleteDPI(dpi);
+        const auto& info = _textureCache[index];
+        return {
+            info.index,
+            info.normalizedBounds,
+        };
+    }
+
     index = static_cast<uint32_t>(_textureCache.size());
 
-    AtlasTextureInfo info = LoadImageTexture(imageId);
+    AtlasTextureInfo info = LoadImageTexture(imageId, dpi);
+    DeleteDPI(dpi);
 
     _textureCache.push_back(info);
     _indexMap[imageId.GetIndex()] = index;
@@ -127,10 +144,25 @@ BasicTextureInfo TextureCache::GetOrLoadGlyphTexture(const ImageId imageId, cons
         }
     }
 
+    // Rasterise the glyph outside of the exclusive lock.
+    DrawPixelInfo dpi = GetGlyphAsDPI(imageId, paletteMap);
+
     // Load new texture.
     unique_lock lock(_mutex);
 
-    auto cacheInfo = LoadGlyphTexture(imageId, paletteMap);
+    auto kvp = _glyphTextureMap.find(glyphId);
+    if (kvp != _glyphTextureMap.end())
+    {
+        DeleteDPI(dpi);
+        const auto& info = kvp->second;
+        return {
+            info.index,
+            info.normalizedBounds,
+        };
+    }
+
+    auto cacheInfo = LoadGlyphTexture(imageId, dpi);
+    DeleteDPI(dpi);
     auto it = _glyphTextureMap.insert(std::make_pair(glyphId, cacheInfo));
 
     return (*it.first).second;
@@ -209,6 +241,8 @@ void TextureCache::CreateTextures()
                 GL_TEXTURE_2D, 0, GL_R8UI, PALETTE_SIZE, PALETTE_SIZE, 0, GL_RED_INTEGER, GL_UNSIGNED_BYTE, blendArray);
         }
 
+        glGenBuffers(1, &_uploadPBO);
+
         _initialized = true;
         _atlasesTextureIndices = 0;
         _atlasesTextureCapacity = 0;
@@ -285,36 +319,22 @@ void TextureCache::EnlargeAtlasesTexture(GLuint newEntries)
     _atlasesTextureIndices = newIndices;
 }
 
-AtlasTextureInfo TextureCache::LoadImageTexture(const ImageId imageId)
+AtlasTextureInfo TextureCache::LoadImageTexture(const ImageId imageId, const DrawPixelInfo& dpi)
 {
-    DrawPixelInfo dpi = GetImageAsDPI(ImageId(imageId.GetIndex()));
-
     auto cacheInfo = AllocateImage(dpi.width, dpi.height);
     cacheInfo.image = imageId.GetIndex();
 
-    glBindTexture(GL_TEXTURE_2D_ARRAY, _atlasesTexture);
-    glTexSubImage3D(
-        GL_TEXTURE_2D_ARRAY, 0, cacheInfo.bounds.x, cacheInfo.bounds.y, cacheInfo.index, dpi.width, dpi.height, 1,
-        GL_RED_INTEGER, GL_UNSIGNED_BYTE, dpi.bits);
-
-    DeleteDPI(dpi);
+    UploadAtlasImage(cacheInfo, dpi.bits, dpi.width, dpi.height);
 
     return cacheInfo;
 }
 
-AtlasTextureInfo TextureCache::LoadGlyphTexture(const ImageId imageId, const PaletteMap& paletteMap)
+AtlasTextureInfo TextureCache::LoadGlyphTexture(const ImageId imageId, const DrawPixelInfo& dpi)
 {
-    DrawPixelInfo dpi = GetGlyphAsDPI(imageId, paletteMap);
-
     auto cacheInfo = AllocateImage(dpi.width, dpi.height);
     cacheInfo.image = imageId.GetIndex();
 
-    glBindTexture(GL_TEXTURE_2D_ARRAY, _atlasesTexture);
-    glTexSubImage3D(
-        GL_TEXTURE_2D_ARRAY, 0, cacheInfo.bounds.x, cacheInfo.bounds.y, cacheInfo.index, dpi.width, dpi.height, 1,
-        GL_RED_INTEGER, GL_UNSIGNED_BYTE, dpi.bits);
-
-    DeleteDPI(dpi);
+    UploadAtlasImage(cacheInfo, dpi.bits, dpi.width, dpi.height);
 
     return cacheInfo;
 }
@@ -323,11 +343,29 @@ AtlasTextureInfo TextureCache::LoadBitmapTexture(ImageIndex image, const void* p
 {
     auto cacheInfo = AllocateImage(int32_t(width), int32_t(height));
     cacheInfo.image = image;
+    UploadAtlasImage(cacheInfo, pixels, width, height);
+    return cacheInfo;
+}
+
+void TextureCache::UploadAtlasImage(const AtlasTextureInfo& cacheInfo, const void* pixels, size_t width, size_t height)
+{
+    // Stage the pixels through a pixel buffer object so the driver can copy
+    // them to the texture asynchronously instead of stalling the render
+    // thread on the upload. The buffer is orphaned each time so uploads never
+    // synchronise with one another.
+    const size_t numBytes = width * height;
+    _uploadPBOCapacity = std::max(_uploadPBOCapacity, numBytes);
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, _uploadPBO);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, _uploadPBOCapacity, nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_PIXEL_UNPACK_BUFFER, 0, numBytes, pixels);
+
     glBindTexture(GL_TEXTURE_2D_ARRAY, _atlasesTexture);
     glTexSubImage3D(
         GL_TEXTURE_2D_ARRAY, 0, cacheInfo.bounds.x, cacheInfo.bounds.y, cacheInfo.index, GLsizei(width), GLsizei(height), 1,
-        GL_RED_INTEGER, GL_UNSIGNED_BYTE, reinterpret_cast<const GLvoid*>(pixels));
-    return cacheInfo;
+        GL_RED_INTEGER, GL_UNSIGNED_BYTE, nullptr);
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 }
 
 AtlasTextureInfo TextureCache::AllocateImage(int32_t imageWidth, int32_t imageHeight)
@@ -392,7 +430,10 @@ DrawPixelInfo TextureCache::GetGlyphAsDPI(const ImageId imageId, const PaletteMa
 
 void TextureCache::FreeTextures()
 {
-    // Free array texture
+    // Free upload buffer and array texture
+    glDeleteBuffers(1, &_uploadPBO);
+    _uploadPBO = 0;
+    _uploadPBOCapacity = 0;
     glDeleteTextures(1, &_atlasesTexture);
     _textureCache.clear();
     std::fill(_indexMap.begin(), _indexMap.end(), kUnusedIndex);
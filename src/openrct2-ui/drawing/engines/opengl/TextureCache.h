@@ -206,6 +206,9 @@ namespace OpenRCT2::Ui
         GLuint _paletteTexture = 0;
         GLuint _blendPaletteTexture = 0;
 
+        GLuint _uploadPBO = 0;
+        size_t _uploadPBOCapacity = 0;
+
         std::shared_mutex _mutex;
         using shared_lock = DrawingSharedLock<std::shared_mutex>;
         using unique_lock = DrawingUniqueLock<std::shared_mutex>;
@@ -227,10 +230,11 @@ namespace OpenRCT2::Ui
         void CreateTextures();
         void GeneratePaletteTexture();
         void EnlargeAtlasesTexture(GLuint newEntries);
-        AtlasTextureInfo LoadImageTexture(const ImageId image);
-        AtlasTextureInfo LoadGlyphTexture(const ImageId image, const PaletteMap& paletteMap);
+        AtlasTextureInfo LoadImageTexture(const ImageId image, const DrawPixelInfo& dpi);
+        AtlasTextureInfo LoadGlyphTexture(const ImageId image, const DrawPixelInfo& dpi);
         AtlasTextureInfo AllocateImage(int32_t imageWidth, int32_t imageHeight);
         AtlasTextureInfo LoadBitmapTexture(ImageIndex image, const void* pixels, size_t width, size_t height);
+        void UploadAtlasImage(const AtlasTextureInfo& cacheInfo, const void* pixels, size_t width, size_t height);
         static DrawPixelInfo GetImageAsDPI(const ImageId imageId);
         static DrawPixelInfo GetGlyphAsDPI(const ImageId imageId, const PaletteMap& paletteMap);
         void FreeTextures();
@@ -26,6 +26,27 @@ constexpr auto kBarBlink = (1u << 31);
 constexpr uint8_t kScrollBarWidth = 10;
 constexpr ScreenSize kTabSize = { 31, 27 };
 
+/**
+ * Half-open range of fixed-height scroll list rows that intersect the clipped
+ * drawing area, so scroll paint functions only materialise the rows that are
+ * actually on screen.
+ */
+struct VisibleRowRange
+{
+    size_t First{};
+    size_t End{};
+};
+
+constexpr VisibleRowRange GetVisibleScrollRows(const DrawPixelInfo& dpi, int32_t rowHeight, size_t numRows)
+{
+    // A row is visible when its bottom reaches the top of the clip area and
+    // its top does not pass the bottom of it.
+    auto first = dpi.y > 0 ? static_cast<size_t>((dpi.y - 1) / rowHeight) : 0;
+    auto clipBottom = dpi.y + dpi.height;
+    auto end = clipBottom >= 0 ? static_cast<size_t>(clipBottom / rowHeight) + 1 : 0;
+    return { first < numRows ? first : numRows, end < numRows ? end : numRows };
+}
+
 constexpr const char* kBlackUpArrowString = u8"{BLACK}▲";
 constexpr const char* kBlackDownArrowString = u8"{BLACK}▼";
 constexpr const char* kBlackLeftArrowString = u8"{BLACK}◀";
@@ -20,6 +20,7 @@
 #include <openrct2/ParkImporter.h>
 #include <openrct2/core/Console.hpp>
 #include <openrct2/core/Guard.hpp>
+#include <openrct2/core/JobPool.h>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
 #include <openrct2/entity/EntityRegistry.h>
@@ -55,6 +56,19 @@ namespace OpenRCT2::Title
         int32_t _previousWindowHeight = 0;
         ScreenCoordsXY _previousViewPosition = {};
 
+        // The next park of the sequence is parsed on a background worker
+        // while the current one plays, so the freeze at a transition shrinks
+        // to loading objects and importing. The slot is only touched by the
+        // worker between Join() calls on this thread.
+        struct PreloadedPark
+        {
+            std::string Key;
+            std::unique_ptr<IParkImporter> Importer;
+            std::unique_ptr<ParkLoadResult> Result;
+        };
+        JobPool _preloadJobs{ 1 };
+        PreloadedPark _preloadedPark;
+
     public:
         explicit TitleSequencePlayer()
         {
@@ -72,6 +86,8 @@ namespace OpenRCT2::Title
 
         void Eject() override
         {
+            _preloadJobs.Join();
+            _preloadedPark = {};
             _sequence = nullptr;
         }
 
@@ -171,7 +187,12 @@ namespace OpenRCT2::Title
                         GameNotifyMapChanged();
                     }
 
+                    const bool wasLoadCommand = TitleSequenceIsLoadCommand(currentCommand);
                     IncrementPosition();
+                    if (wasLoadCommand && !gPreviewingTitleSequenceInGame)
+                    {
+                        PreloadNextPark();
+                    }
                 }
                 catch (std::exception& e)
                 {
@@ -283,6 +304,99 @@ namespace OpenRCT2::Title
             return _position != entryPosition;
         }
 
+        /**
+         * Starts parsing the next park load of the sequence on the background
+         * worker. Only the file read and parse happen there; loading objects
+         * and importing stay on this thread at the transition.
+         */
+        void PreloadNextPark()
+        {
+            _preloadJobs.Join();
+            _preloadedPark = {};
+
+            const auto numCommands = static_cast<int32_t>(_sequence->Commands.size());
+            for (int32_t offset = 0; offset < numCommands; offset++)
+            {
+                const auto& command = _sequence->Commands[(_position + offset) % numCommands];
+                if (std::holds_alternative<LoadParkCommand>(command))
+                {
+                    const auto saveIndex = std::get<LoadParkCommand>(command).SaveIndex;
+                    if (saveIndex < _sequence->Saves.size())
+                    {
+                        _preloadedPark.Key = _sequence->Saves[saveIndex];
+                        _preloadJobs.AddTask([this, saveIndex]() { PreloadParkFromSequence(saveIndex); });
+                    }
+                    return;
+                }
+                if (std::holds_alternative<LoadScenarioCommand>(command))
+                {
+                    auto scenario = GetScenarioRepository()->GetByInternalName(
+                        std::get<LoadScenarioCommand>(command).Scenario);
+                    if (scenario != nullptr)
+                    {
+                        const std::string path = scenario->Path;
+                        _preloadedPark.Key = path;
+                        _preloadJobs.AddTask([this, path]() { PreloadParkFromFile(path); });
+                    }
+                    return;
+                }
+            }
+        }
+
+        void PreloadParkFromSequence(size_t saveIndex)
+        {
+            try
+            {
+                auto parkHandle = TitleSequenceGetParkHandle(*_sequence, saveIndex);
+                if (parkHandle == nullptr)
+                    return;
+
+                bool isScenario = ParkImporter::ExtensionIsScenario(parkHandle->HintPath);
+                auto parkImporter = ParkImporter::Create(parkHandle->HintPath);
+                auto result = std::make_unique<ParkLoadResult>(
+                    parkImporter->LoadFromStream(parkHandle->Stream.get(), isScenario));
+                _preloadedPark.Importer = std::move(parkImporter);
+                _preloadedPark.Result = std::move(result);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_VERBOSE("Failed to preload title sequence park: %s", e.what());
+            }
+        }
+
+        void PreloadParkFromFile(const std::string& path)
+        {
+            try
+            {
+                auto parkImporter = ParkImporter::Create(path);
+                auto result = std::make_unique<ParkLoadResult>(parkImporter->Load(path));
+                _preloadedPark.Importer = std::move(parkImporter);
+                _preloadedPark.Result = std::move(result);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_VERBOSE("Failed to preload title sequence park: %s", e.what());
+            }
+        }
+
+        /**
+         * Hands over the importer with the park already parsed when it was
+         * preloaded for the given source, otherwise returns nullptr and the
+         * caller parses synchronously.
+         */
+        std::unique_ptr<IParkImporter> TakePreloadedPark(const std::string& key, std::unique_ptr<ParkLoadResult>& result)
+        {
+            _preloadJobs.Join();
+            if (_preloadedPark.Key != key || _preloadedPark.Importer == nullptr)
+            {
+                return nullptr;
+            }
+            result = std::move(_preloadedPark.Result);
+            auto parkImporter = std::move(_preloadedPark.Importer);
+            _preloadedPark = {};
+            return parkImporter;
+        }
+
         void ReportProgress(uint8_t progress)
         {
             if (!_initialLoadCommand)
@@ -315,13 +429,17 @@ namespace OpenRCT2::Title
                     WindowSetFlagForAllViewports(VIEWPORT_FLAG_RENDERING_INHIBITED, true);
 
                     ReportProgress(0);
-                    auto parkImporter = ParkImporter::Create(path);
-
-                    auto result = parkImporter->Load(path);
+                    std::unique_ptr<ParkLoadResult> result;
+                    auto parkImporter = TakePreloadedPark(path, result);
+                    if (parkImporter == nullptr)
+                    {
+                        parkImporter = ParkImporter::Create(path);
+                        result = std::make_unique<ParkLoadResult>(parkImporter->Load(path));
+                    }
                     ReportProgress(10);
 
                     auto& objectManager = GetContext()->GetObjectManager();
-                    objectManager.LoadObjects(result.RequiredObjects, true);
+                    objectManager.LoadObjects(result->RequiredObjects, true);
                     ReportProgress(90);
 
                     // TODO: Have a separate GameState and exchange once loaded.
@@ -370,14 +488,18 @@ namespace OpenRCT2::Title
                     WindowSetFlagForAllViewports(VIEWPORT_FLAG_RENDERING_INHIBITED, true);
 
                     ReportProgress(0);
-                    bool isScenario = ParkImporter::ExtensionIsScenario(hintPath);
-                    auto parkImporter = ParkImporter::Create(hintPath);
-
-                    auto result = parkImporter->LoadFromStream(stream, isScenario);
+                    std::unique_ptr<ParkLoadResult> result;
+                    auto parkImporter = TakePreloadedPark(hintPath, result);
+                    if (parkImporter == nullptr)
+                    {
+                        bool isScenario = ParkImporter::ExtensionIsScenario(hintPath);
+                        parkImporter = ParkImporter::Create(hintPath);
+                        result = std::make_unique<ParkLoadResult>(parkImporter->LoadFromStream(stream, isScenario));
+                    }
                     ReportProgress(30);
 
                     auto& objectManager = GetContext()->GetObjectManager();
-                    objectManager.LoadObjects(result.RequiredObjects, true);
+                    objectManager.LoadObjects(result->RequiredObjects, true);
                     ReportProgress(70);
 
                     // TODO: Have a separate GameState and exchange once loaded.
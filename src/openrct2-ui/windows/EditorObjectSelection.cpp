@@ -725,80 +725,80 @@ static std::vector<Widget> _window_editor_object_selection_widgets = {
             uint8_t paletteIndex = ColourMapA[colours[1].colour].mid_light;
             GfxClear(dpi, paletteIndex);
 
-            screenCoords.y = 0;
-            for (size_t i = 0; i < _listItems.size(); i++)
+            // Only materialise the rows that intersect the clip area; with
+            // thousands of objects in the list the rest is skipped entirely.
+            const auto range = GetVisibleScrollRows(dpi, kScrollableRowHeight, _listItems.size());
+            screenCoords.y = static_cast<int32_t>(range.First) * kScrollableRowHeight;
+            for (size_t i = range.First; i < range.End; i++)
             {
                 const auto& listItem = _listItems[i];
-                if (screenCoords.y + kScrollableRowHeight >= dpi.y && screenCoords.y <= dpi.y + dpi.height)
+                // Draw checkbox
+                if (!(gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER) && !(*listItem.flags & 0x20))
+                    GfxFillRectInset(
+                        dpi, { { 2, screenCoords.y }, { 11, screenCoords.y + 10 } }, colours[1], INSET_RECT_F_E0);
+
+                // Highlight background
+                auto highlighted = i == static_cast<size_t>(selected_list_item)
+                    && !(*listItem.flags & ObjectSelectionFlags::Flag6);
+                if (highlighted)
                 {
-                    // Draw checkbox
-                    if (!(gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER) && !(*listItem.flags & 0x20))
-                        GfxFillRectInset(
-                            dpi, { { 2, screenCoords.y }, { 11, screenCoords.y + 10 } }, colours[1], INSET_RECT_F_E0);
-
-                    // Highlight background
-                    auto highlighted = i == static_cast<size_t>(selected_list_item)
-                        && !(*listItem.flags & ObjectSelectionFlags::Flag6);
-                    if (highlighted)
-                    {
-                        auto bottom = screenCoords.y + (kScrollableRowHeight - 1);
-                        GfxFilterRect(dpi, { 0, screenCoords.y, width, bottom }, FilterPaletteID::PaletteDarken1);
-                    }
-
-                    // Draw checkmark
-                    if (!(gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER) && (*listItem.flags & ObjectSelectionFlags::Selected))
-                    {
-                        screenCoords.x = 2;
-                        auto darkness = highlighted ? TextDarkness::ExtraDark : TextDarkness::Dark;
-                        auto colour2 = colours[1].withFlag(ColourFlag::translucent, false);
-                        if (*listItem.flags & (ObjectSelectionFlags::InUse | ObjectSelectionFlags::AlwaysRequired))
-                            colour2.setFlag(ColourFlag::inset, true);
-
-                        DrawText(dpi, screenCoords, { colour2, FontStyle::Medium, darkness }, kCheckMarkString);
-                    }
+                    auto bottom = screenCoords.y + (kScrollableRowHeight - 1);
+                    GfxFilterRect(dpi, { 0, screenCoords.y, width, bottom }, FilterPaletteID::PaletteDarken1);
+                }
 
-                    screenCoords.x = gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER ? 0 : 15;
+                // Draw checkmark
+                if (!(gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER) && (*listItem.flags & ObjectSelectionFlags::Selected))
+                {
+                    screenCoords.x = 2;
+                    auto darkness = highlighted ? TextDarkness::ExtraDark : TextDarkness::Dark;
+                    auto colour2 = colours[1].withFlag(ColourFlag::translucent, false);
+                    if (*listItem.flags & (ObjectSelectionFlags::InUse | ObjectSelectionFlags::AlwaysRequired))
+                        colour2.setFlag(ColourFlag::inset, true);
 
-                    utf8 itemBuffer[512]{};
-                    auto bufferWithColour = strcpy(itemBuffer, highlighted ? "{WINDOW_COLOUR_2}" : "{BLACK}");
-                    auto buffer = strchr(bufferWithColour, '\0');
+                    DrawText(dpi, screenCoords, { colour2, FontStyle::Medium, darkness }, kCheckMarkString);
+                }
 
-                    colour_t colour = COLOUR_BLACK;
-                    auto darkness = TextDarkness::Regular;
-                    if (*listItem.flags & ObjectSelectionFlags::Flag6)
-                    {
-                        colour = colours[1].colour;
-                        darkness = TextDarkness::Dark;
-                    }
+                screenCoords.x = gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER ? 0 : 15;
 
-                    int32_t width_limit = widgets[WIDX_LIST].width() - screenCoords.x;
+                utf8 itemBuffer[512]{};
+                auto bufferWithColour = strcpy(itemBuffer, highlighted ? "{WINDOW_COLOUR_2}" : "{BLACK}");
+                auto buffer = strchr(bufferWithColour, '\0');
 
-                    if (ridePage)
-                    {
-                        width_limit /= 2;
-                        // Draw ride type
-                        StringId rideTypeStringId = GetRideTypeStringId(listItem.repositoryItem);
-                        SafeStrCpy(buffer, LanguageGetString(rideTypeStringId), 256 - (buffer - bufferWithColour));
-                        auto ft = Formatter();
-                        ft.Add<const char*>(itemBuffer);
-                        DrawTextEllipsised(
-                            dpi, screenCoords, width_limit - 15, STR_STRING, ft, { colour, FontStyle::Medium, darkness });
-                        screenCoords.x = widgets[WIDX_LIST_SORT_RIDE].left - widgets[WIDX_LIST].left;
-                    }
+                colour_t colour = COLOUR_BLACK;
+                auto darkness = TextDarkness::Regular;
+                if (*listItem.flags & ObjectSelectionFlags::Flag6)
+                {
+                    colour = colours[1].colour;
+                    darkness = TextDarkness::Dark;
+                }
 
-                    // Draw text
-                    SafeStrCpy(buffer, listItem.repositoryItem->Name.c_str(), 256 - (buffer - bufferWithColour));
-                    if (gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER)
-                    {
-                        while (*buffer != 0 && *buffer != 9)
-                            buffer++;
+                int32_t width_limit = widgets[WIDX_LIST].width() - screenCoords.x;
 
-                        *buffer = 0;
-                    }
+                if (ridePage)
+                {
+                    width_limit /= 2;
+                    // Draw ride type
+                    StringId rideTypeStringId = GetRideTypeStringId(listItem.repositoryItem);
+                    SafeStrCpy(buffer, LanguageGetString(rideTypeStringId), 256 - (buffer - bufferWithColour));
                     auto ft = Formatter();
                     ft.Add<const char*>(itemBuffer);
-                    DrawTextEllipsised(dpi, screenCoords, width_limit, STR_STRING, ft, { colour, FontStyle::Medium, darkness });
+                    DrawTextEllipsised(
+                        dpi, screenCoords, width_limit - 15, STR_STRING, ft, { colour, FontStyle::Medium, darkness });
+                    screenCoords.x = widgets[WIDX_LIST_SORT_RIDE].left - widgets[WIDX_LIST].left;
+                }
+
+                // Draw text
+                SafeStrCpy(buffer, listItem.repositoryItem->Name.c_str(), 256 - (buffer - bufferWithColour));
+                if (gScreenFlags & SCREEN_FLAGS_TRACK_MANAGER)
+                {
+                    while (*buffer != 0 && *buffer != 9)
+                        buffer++;
+
+                    *buffer = 0;
                 }
+                auto ft = Formatter();
+                ft.Add<const char*>(itemBuffer);
+                DrawTextEllipsised(dpi, screenCoords, width_limit, STR_STRING, ft, { colour, FontStyle::Medium, darkness });
                 screenCoords.y += kScrollableRowHeight;
             }
         }
@@ -404,13 +404,11 @@ static Widget _windowFinancesResearchWidgets[] =
                 screenCoords.y += 14;
 
                 // Month expenditures
-                money64 profit = 0;
                 for (int32_t j = 0; j < static_cast<int32_t>(ExpenditureType::Count); j++)
                 {
                     auto expenditure = gameState.ExpenditureTable[i][j];
                     if (expenditure != 0)
                     {
-                        profit += expenditure;
                         const StringId format = expenditure >= 0 ? STR_FINANCES_SUMMARY_INCOME_VALUE
                                                                  : STR_FINANCES_SUMMARY_EXPENDITURE_VALUE;
                         ft = Formatter();
@@ -423,7 +421,8 @@ static Widget _windowFinancesResearchWidgets[] =
                 }
                 screenCoords.y += 4;
 
-                // Month profit
+                // Month profit, from the maintained rollup
+                const auto profit = FinanceGetExpenditureMonthSum(static_cast<uint8_t>(i));
                 const StringId format = profit >= 0 ? STR_FINANCES_SUMMARY_INCOME_VALUE : STR_FINANCES_SUMMARY_LOSS_VALUE;
                 ft = Formatter();
                 ft.Add<money64>(profit);
@@ -7,6 +7,7 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include <algorithm>
 #include <cmath>
 #include <openrct2-ui/interface/Dropdown.h>
 #include <openrct2-ui/interface/Widget.h>
@@ -123,8 +124,6 @@ static Widget window_guest_list_widgets[] = {
 
         struct GuestItem
         {
-            using CompareFunc = bool (*)(const GuestItem&, const GuestItem&);
-
             EntityId Id;
             char Name[256];
         };
@@ -151,6 +150,7 @@ static Widget window_guest_list_widgets[] = {
 
         std::vector<GuestItem> _guestList;
         std::optional<size_t> _highlightedIndex;
+        bool _refreshQueued{};
 
         uint32_t _tabAnimationIndex{};
 
@@ -447,6 +447,8 @@ static Widget window_guest_list_widgets[] = {
 
         void OnDraw(DrawPixelInfo& dpi) override
         {
+            FlushQueuedRefresh();
+
             DrawWidgets(dpi);
             DrawTabImages(dpi);
 
@@ -495,6 +497,8 @@ static Widget window_guest_list_widgets[] = {
 
         ScreenSize OnScrollGetSize(int32_t scrollIndex) override
         {
+            FlushQueuedRefresh();
+
             int32_t y = 0;
             switch (_selectedTab)
             {
@@ -539,6 +543,8 @@ static Widget window_guest_list_widgets[] = {
 
         void OnScrollMouseOver(int32_t scrollIndex, const ScreenCoordsXY& screenCoords) override
         {
+            FlushQueuedRefresh();
+
             auto i = screenCoords.y / (_selectedTab == TabId::Individual ? kScrollableRowHeight : SUMMARISED_GUEST_ROW_HEIGHT);
             i += static_cast<int32_t>(_selectedPage * GUESTS_PER_PAGE);
             if (static_cast<size_t>(i) != _highlightedIndex)
@@ -550,6 +556,8 @@ static Widget window_guest_list_widgets[] = {
 
         void OnScrollMouseDown(int32_t scrollIndex, const ScreenCoordsXY& screenCoords) override
         {
+            FlushQueuedRefresh();
+
             switch (_selectedTab)
             {
                 case TabId::Individual:
@@ -593,6 +601,8 @@ static Widget window_guest_list_widgets[] = {
 
         void OnScrollDraw(int32_t scrollIndex, DrawPixelInfo& dpi) override
         {
+            FlushQueuedRefresh();
+
             GfxFillRect(
                 dpi, { { dpi.x, dpi.y }, { dpi.x + dpi.width - 1, dpi.y + dpi.height - 1 } },
                 ColourMapA[colours[1].colour].mid_light);
@@ -609,6 +619,29 @@ static Widget window_guest_list_widgets[] = {
 
         void RefreshList()
         {
+            // Several guests can change in one tick; the rebuild happens once,
+            // the next time the list is used.
+            _refreshQueued = true;
+        }
+
+        void RefreshGuest(EntityId guestId)
+        {
+            // A single guest changed; update its entry in the sorted list
+            // rather than rebuilding and re-sorting the whole list.
+            if (_refreshQueued || _selectedTab != TabId::Individual)
+                return;
+
+            RemoveGuestItem(guestId);
+            InsertGuestItem(guestId);
+        }
+
+    private:
+        void FlushQueuedRefresh()
+        {
+            if (!_refreshQueued)
+                return;
+            _refreshQueued = false;
+
             // Only the individual tab uses the GuestList so no point calculating it
             if (_selectedTab != TabId::Individual)
             {
@@ -640,11 +673,48 @@ static Widget window_guest_list_widgets[] = {
                     OpenRCT2::FormatStringLegacy(item.Name, sizeof(item.Name), STR_STRINGID, ft.Data());
                 }
 
-                std::sort(_guestList.begin(), _guestList.end(), GetGuestCompareFunc());
+                std::sort(_guestList.begin(), _guestList.end(), CompareGuestItem);
             }
         }
 
-    private:
+        void RemoveGuestItem(EntityId guestId)
+        {
+            auto it = std::find_if(
+                _guestList.begin(), _guestList.end(), [guestId](const GuestItem& item) { return item.Id == guestId; });
+            if (it != _guestList.end())
+            {
+                _guestList.erase(it);
+            }
+        }
+
+        void InsertGuestItem(EntityId guestId)
+        {
+            auto peep = GetEntity<Guest>(guestId);
+            if (peep == nullptr)
+                return;
+
+            EntitySetFlashing(peep, false);
+            if (peep->OutsideOfPark)
+                return;
+            if (_selectedFilter)
+            {
+                if (!IsPeepInFilter(*peep))
+                    return;
+                EntitySetFlashing(peep, true);
+            }
+            if (!GuestShouldBeVisible(*peep))
+                return;
+
+            GuestItem item;
+            item.Id = peep->Id;
+
+            Formatter ft;
+            peep->FormatNameTo(ft);
+            OpenRCT2::FormatStringLegacy(item.Name, sizeof(item.Name), STR_STRINGID, ft.Data());
+
+            auto pos = std::lower_bound(_guestList.begin(), _guestList.end(), item, CompareGuestItem);
+            _guestList.insert(pos, item);
+        }
         void DrawTabImages(DrawPixelInfo& dpi)
         {
             // Tab 1 image
@@ -663,120 +733,115 @@ static Widget window_guest_list_widgets[] = {
 
         void DrawScrollIndividual(DrawPixelInfo& dpi)
         {
-            size_t index = 0;
-            auto y = static_cast<int32_t>(_selectedPage) * -GUEST_PAGE_HEIGHT;
-            for (const auto& guestItem : _guestList)
+            // Only materialise the rows that intersect the clip area; the rest
+            // of the list is skipped entirely.
+            const auto baseIndex = static_cast<size_t>(_selectedPage) * GUESTS_PER_PAGE;
+            if (baseIndex >= _guestList.size())
+                return;
+
+            const auto range = GetVisibleScrollRows(dpi, kScrollableRowHeight, _guestList.size() - baseIndex);
+            for (auto row = range.First; row < range.End; row++)
             {
-                // Check if y is beyond the scroll control
-                if (y + kScrollableRowHeight + 1 >= -0x7FFF && y + kScrollableRowHeight + 1 > dpi.y && y < 0x7FFF
-                    && y < dpi.y + dpi.height)
-                {
-                    // Highlight backcolour and text colour (format)
-                    StringId format = STR_BLACK_STRING;
-                    if (index == _highlightedIndex)
-                    {
-                        GfxFilterRect(dpi, { 0, y, 800, y + kScrollableRowHeight - 1 }, FilterPaletteID::PaletteDarken1);
-                        format = STR_WINDOW_COLOUR_2_STRINGID;
-                    }
+                const auto index = baseIndex + row;
+                const auto& guestItem = _guestList[index];
+                auto y = static_cast<int32_t>(row) * kScrollableRowHeight;
 
-                    // Guest name
-                    auto peep = GetEntity<Guest>(guestItem.Id);
-                    if (peep == nullptr)
-                    {
-                        continue;
-                    }
-                    auto ft = Formatter();
-                    peep->FormatNameTo(ft);
-                    DrawTextEllipsised(dpi, { 0, y }, 113, format, ft);
+                // Highlight backcolour and text colour (format)
+                StringId format = STR_BLACK_STRING;
+                if (index == _highlightedIndex)
+                {
+                    GfxFilterRect(dpi, { 0, y, 800, y + kScrollableRowHeight - 1 }, FilterPaletteID::PaletteDarken1);
+                    format = STR_WINDOW_COLOUR_2_STRINGID;
+                }
 
-                    switch (_selectedView)
-                    {
-                        case GuestViewType::Actions:
-                            // Guest face
-                            GfxDrawSprite(dpi, ImageId(GetPeepFaceSpriteSmall(peep)), { 118, y + 1 });
+                // Guest name
+                auto peep = GetEntity<Guest>(guestItem.Id);
+                if (peep == nullptr)
+                {
+                    continue;
+                }
+                auto ft = Formatter();
+                peep->FormatNameTo(ft);
+                DrawTextEllipsised(dpi, { 0, y }, 113, format, ft);
 
-                            // Tracking icon
-                            if (peep->PeepFlags & PEEP_FLAGS_TRACKING)
-                                GfxDrawSprite(dpi, ImageId(STR_ENTER_SELECTION_SIZE), { 112, y + 1 });
+                switch (_selectedView)
+                {
+                    case GuestViewType::Actions:
+                        // Guest face
+                        GfxDrawSprite(dpi, ImageId(GetPeepFaceSpriteSmall(peep)), { 118, y + 1 });
+
+                        // Tracking icon
+                        if (peep->PeepFlags & PEEP_FLAGS_TRACKING)
+                            GfxDrawSprite(dpi, ImageId(STR_ENTER_SELECTION_SIZE), { 112, y + 1 });
+
+                        // Action
+                        ft = Formatter();
+                        peep->FormatActionTo(ft);
+                        DrawTextEllipsised(dpi, { 133, y }, 314, format, ft);
+                        break;
+                    case GuestViewType::Thoughts:
+                        // For each thought
+                        for (const auto& thought : peep->Thoughts)
+                        {
+                            if (thought.type == PeepThoughtType::None)
+                                break;
+                            if (thought.freshness == 0)
+                                continue;
+                            if (thought.freshness > 5)
+                                break;
 
-                            // Action
                             ft = Formatter();
-                            peep->FormatActionTo(ft);
-                            DrawTextEllipsised(dpi, { 133, y }, 314, format, ft);
+                            PeepThoughtSetFormatArgs(&thought, ft);
+                            DrawTextEllipsised(dpi, { 118, y }, 329, format, ft, { FontStyle::Small });
                             break;
-                        case GuestViewType::Thoughts:
-                            // For each thought
-                            for (const auto& thought : peep->Thoughts)
-                            {
-                                if (thought.type == PeepThoughtType::None)
-                                    break;
-                                if (thought.freshness == 0)
-                                    continue;
-                                if (thought.freshness > 5)
-                                    break;
-
-                                ft = Formatter();
-                                PeepThoughtSetFormatArgs(&thought, ft);
-                                DrawTextEllipsised(dpi, { 118, y }, 329, format, ft, { FontStyle::Small });
-                                break;
-                            }
-                            break;
-                    }
+                        }
+                        break;
                 }
-                y += kScrollableRowHeight;
-                index++;
             }
         }
 
         void DrawScrollSummarised(DrawPixelInfo& dpi)
         {
-            size_t index = 0;
-            auto y = 0;
-            for (auto& group : _groups)
+            // Only materialise the rows that intersect the clip area.
+            const auto range = GetVisibleScrollRows(dpi, SUMMARISED_GUEST_ROW_HEIGHT, _groups.size());
+            for (auto index = range.First; index < range.End; index++)
             {
-                // Check if y is beyond the scroll control
-                if (y + SUMMARISED_GUEST_ROW_HEIGHT + 1 >= dpi.y)
-                {
-                    // Check if y is beyond the scroll control
-                    if (y >= dpi.y + dpi.height)
-                        break;
-
-                    // Highlight backcolour and text colour (format)
-                    StringId format = STR_BLACK_STRING;
-                    if (index == _highlightedIndex)
-                    {
-                        GfxFilterRect(dpi, { 0, y, 800, y + SUMMARISED_GUEST_ROW_HEIGHT }, FilterPaletteID::PaletteDarken1);
-                        format = STR_WINDOW_COLOUR_2_STRINGID;
-                    }
+                auto& group = _groups[index];
+                auto y = static_cast<int32_t>(index) * SUMMARISED_GUEST_ROW_HEIGHT;
 
-                    // Draw guest faces
-                    for (uint32_t j = 0; j < std::size(group.Faces) && j < group.NumGuests; j++)
-                    {
-                        GfxDrawSprite(
-                            dpi, ImageId(group.Faces[j] + SPR_PEEP_SMALL_FACE_VERY_VERY_UNHAPPY),
-                            { static_cast<int32_t>(j) * 8, y + 12 });
-                    }
+                // Highlight backcolour and text colour (format)
+                StringId format = STR_BLACK_STRING;
+                if (index == _highlightedIndex)
+                {
+                    GfxFilterRect(dpi, { 0, y, 800, y + SUMMARISED_GUEST_ROW_HEIGHT }, FilterPaletteID::PaletteDarken1);
+                    format = STR_WINDOW_COLOUR_2_STRINGID;
+                }
 
-                    // Draw action/thoughts
-                    Formatter ft(group.Arguments.args);
-                    // Draw small font if displaying guests
-                    if (_selectedView == GuestViewType::Thoughts)
-                    {
-                        DrawTextEllipsised(dpi, { 0, y }, 414, format, ft, { FontStyle::Small });
-                    }
-                    else
-                    {
-                        DrawTextEllipsised(dpi, { 0, y }, 414, format, ft);
-                    }
+                // Draw guest faces
+                for (uint32_t j = 0; j < std::size(group.Faces) && j < group.NumGuests; j++)
+                {
+                    GfxDrawSprite(
+                        dpi, ImageId(group.Faces[j] + SPR_PEEP_SMALL_FACE_VERY_VERY_UNHAPPY),
+                        { static_cast<int32_t>(j) * 8, y + 12 });
+                }
 
-                    // Draw guest count
-                    ft = Formatter();
-                    ft.Add<StringId>(STR_GUESTS_COUNT_COMMA_SEP);
-                    ft.Add<uint32_t>(group.NumGuests);
-                    DrawTextBasic(dpi, { 326, y }, format, ft, { TextAlignment::RIGHT });
+                // Draw action/thoughts
+                Formatter ft(group.Arguments.args);
+                // Draw small font if displaying guests
+                if (_selectedView == GuestViewType::Thoughts)
+                {
+                    DrawTextEllipsised(dpi, { 0, y }, 414, format, ft, { FontStyle::Small });
+                }
+                else
+                {
+                    DrawTextEllipsised(dpi, { 0, y }, 414, format, ft);
                 }
-                y += SUMMARISED_GUEST_ROW_HEIGHT;
-                index++;
+
+                // Draw guest count
+                ft = Formatter();
+                ft.Add<StringId>(STR_GUESTS_COUNT_COMMA_SEP);
+                ft.Add<uint32_t>(group.NumGuests);
+                DrawTextBasic(dpi, { 326, y }, format, ft, { TextAlignment::RIGHT });
             }
         }
 
@@ -932,35 +997,17 @@ static Widget window_guest_list_widgets[] = {
             }
         }
 
-        template<bool TRealNames> static bool CompareGuestItem(const GuestItem& a, const GuestItem& b)
+        static bool CompareGuestItem(const GuestItem& a, const GuestItem& b)
         {
-            const auto* peepA = GetEntity<Peep>(a.Id);
-            const auto* peepB = GetEntity<Peep>(b.Id);
-            if (peepA != nullptr && peepB != nullptr)
+            // Names are formatted once when an item is created, so the sort
+            // compares the cached keys instead of looking up the entities.
+            // The logical comparison keeps numbered guests in numeric order.
+            auto result = StrLogicalCmp(a.Name, b.Name);
+            if (result != 0)
             {
-                // Compare types
-                if (peepA->Type != peepB->Type)
-                {
-                    return static_cast<int32_t>(peepA->Type) < static_cast<int32_t>(peepB->Type);
-                }
-
-                // Compare name
-                if constexpr (!TRealNames)
-                {
-                    if (peepA->Name == nullptr && peepB->Name == nullptr)
-                    {
-                        // Simple ID comparison for when both peeps use a number or a generated name
-                        return peepA->PeepId < peepB->PeepId;
-                    }
-                }
+                return result < 0;
             }
-            return StrLogicalCmp(a.Name, b.Name) < 0;
-        }
-
-        static GuestItem::CompareFunc GetGuestCompareFunc()
-        {
-            return GetGameState().Park.Flags & PARK_FLAGS_SHOW_REAL_GUEST_NAMES ? CompareGuestItem<true>
-                                                                                : CompareGuestItem<false>;
+            return a.Id.ToUnderlying() < b.Id.ToUnderlying();
         }
     };
 
@@ -995,4 +1042,13 @@ static Widget window_guest_list_widgets[] = {
             static_cast<GuestListWindow*>(w)->RefreshList();
         }
     }
+
+    void WindowGuestListRefreshGuest(EntityId guestId)
+    {
+        auto* w = WindowFindByClass(WindowClass::GuestList);
+        if (w != nullptr)
+        {
+            static_cast<GuestListWindow*>(w)->RefreshGuest(guestId);
+        }
+    }
 } // namespace OpenRCT2::Ui::Windows
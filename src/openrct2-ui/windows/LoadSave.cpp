@@ -21,8 +21,10 @@
 #include <openrct2/PlatformEnvironment.h>
 #include <openrct2/audio/audio.h>
 #include <openrct2/config/Config.h>
+#include <atomic>
 #include <openrct2/core/File.h>
 #include <openrct2/core/FileScanner.h>
+#include <openrct2/core/FileWatcher.h>
 #include <openrct2/core/Guard.hpp>
 #include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
@@ -114,6 +116,37 @@ static Widget window_loadsave_widgets[] =
     static u8string _defaultPath;
     static int32_t _type;
 
+    // Listing of the most recently scanned directory, kept between window
+    // opens so browsing back into a large save directory does not rescan and
+    // re-stat every file. A watcher flags the cache stale when the directory
+    // contents change underneath it.
+    static u8string _cachedDirectory;
+    static u8string _cachedPattern;
+    static std::vector<LoadSaveListItem> _cachedListItems;
+    static std::unique_ptr<FileWatcher> _fileWatcher;
+    static u8string _watchedDirectory;
+    static std::atomic_bool _watchedDirectoryChanged;
+
+    static void WatchDirectory(const u8string& directory)
+    {
+        if (_fileWatcher != nullptr && _watchedDirectory == directory)
+            return;
+
+        _fileWatcher = nullptr;
+        _watchedDirectory.clear();
+        try
+        {
+            _fileWatcher = std::make_unique<FileWatcher>(directory);
+            _fileWatcher->OnFileChanged = [](u8string_view) { _watchedDirectoryChanged = true; };
+            _watchedDirectory = directory;
+        }
+        catch (const std::exception&)
+        {
+            // Not every platform or filesystem supports watches; the cached
+            // listing is then only refreshed by navigating.
+        }
+    }
+
     static bool ListItemSort(LoadSaveListItem& a, LoadSaveListItem& b)
     {
         if (a.type != b.type)
@@ -564,6 +597,23 @@ static Widget window_loadsave_widgets[] =
                 disabled_widgets &= ~(1uLL << WIDX_NEW_FILE);
                 disabled_widgets &= ~(1uLL << WIDX_NEW_FOLDER);
 
+                const bool cacheValid = absoluteDirectory == _cachedDirectory && extensionPattern == _cachedPattern
+                    && !_watchedDirectoryChanged;
+                if (cacheValid)
+                {
+                    // Reuse the listing from the previous scan of this
+                    // directory; only the loaded marker can have changed.
+                    _listItems = _cachedListItems;
+                    for (auto& item : _listItems)
+                    {
+                        item.loaded = item.path.compare(gCurrentLoadedPath) == 0;
+                    }
+                    SortList();
+                    Invalidate();
+                    return;
+                }
+                _watchedDirectoryChanged = false;
+
                 // List all directories
                 auto subDirectories = Path::GetDirectories(absoluteDirectory);
                 for (const auto& sdName : subDirectories)
@@ -615,6 +665,11 @@ static Widget window_loadsave_widgets[] =
                     showExtension = true; // Show any extension after the first iteration
                 }
 
+                _cachedDirectory = absoluteDirectory;
+                _cachedPattern = u8string(extensionPattern);
+                _cachedListItems = _listItems;
+                WatchDirectory(absoluteDirectory);
+
                 SortList();
             }
 
@@ -711,6 +766,17 @@ static Widget window_loadsave_widgets[] =
             }
         }
 
+        void OnUpdate() override
+        {
+            // The watcher flags the directory when files appear, change or
+            // disappear underneath the window, so the listing refreshes
+            // without rescanning on a timer.
+            if (_watchedDirectoryChanged)
+            {
+                PopulateList((type & 1) == LOADSAVETYPE_SAVE, _directory, _extensionPattern);
+            }
+        }
+
         void OnResize() override
         {
             if (width < min_width)
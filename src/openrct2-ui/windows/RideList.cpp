@@ -167,6 +167,10 @@ static Widget _rideListWidgets[] = {
         {
             RideId Id;
             u8string Name;
+            // Sort column captured when the list is refreshed, so sorting does
+            // not have to chase the ride and re-derive the value per
+            // comparison.
+            int64_t SortValue{};
         };
         std::vector<RideListEntry> _rideList;
 
@@ -545,9 +549,12 @@ static Widget _rideListWidgets[] = {
                 dpi, { dpiCoords, dpiCoords + ScreenCoordsXY{ dpi.width, dpi.height } },
                 ColourMapA[colours[1].colour].mid_light);
 
-            auto y = 0;
-            for (size_t i = 0; i < _rideList.size(); i++)
+            // Only materialise the rows that intersect the clip area; with the
+            // window open permanently the rest of the list is skipped.
+            const auto range = GetVisibleScrollRows(dpi, kScrollableRowHeight, _rideList.size());
+            for (size_t i = range.First; i < range.End; i++)
             {
+                auto y = static_cast<int32_t>(i) * kScrollableRowHeight;
                 StringId format = STR_BLACK_STRING;
                 if (_quickDemolishMode)
                     format = STR_RED_STRINGID;
@@ -747,7 +754,6 @@ static Widget _rideListWidgets[] = {
                     ft.Add<StringId>(formatSecondary);
                 }
                 DrawTextEllipsised(dpi, { 160, y - 1 }, 157, format, ft);
-                y += kScrollableRowHeight;
             }
         }
 
@@ -788,20 +794,51 @@ static Widget _rideListWidgets[] = {
         }
 
         /**
-         * Used in RefreshList() to handle the sorting of the list.
-         * Uses a lambda function (predicate) as exit criteria for the algorithm.
+         * Returns the value the list is ordered by for the given information
+         * type. Captured per ride when the list is refreshed; the sort itself
+         * then only compares the stored column.
          */
-        template<typename TSortPred> void SortListByPredicate(const TSortPred& pred)
+        static int64_t GetSortValue(const Ride& ride, int32_t informationType)
         {
-            std::sort(_rideList.begin(), _rideList.end(), [&pred](const auto& lhs, const auto& rhs) {
-                const Ride* rideLhs = GetRide(lhs.Id);
-                const Ride* rideRhs = GetRide(rhs.Id);
-                if (rideLhs == nullptr || rideRhs == nullptr)
-                {
-                    return false;
-                }
-                return !pred(*rideLhs, *rideRhs);
-            });
+            switch (informationType)
+            {
+                case INFORMATION_TYPE_POPULARITY:
+                    return ride.popularity;
+                case INFORMATION_TYPE_SATISFACTION:
+                    return ride.satisfaction;
+                case INFORMATION_TYPE_PROFIT:
+                    return ride.profit;
+                case INFORMATION_TYPE_TOTAL_CUSTOMERS:
+                    return ride.total_customers;
+                case INFORMATION_TYPE_TOTAL_PROFIT:
+                    return ride.total_profit;
+                case INFORMATION_TYPE_CUSTOMERS:
+                    return RideCustomersPerHour(ride);
+                case INFORMATION_TYPE_AGE:
+                    return ride.build_date;
+                case INFORMATION_TYPE_INCOME:
+                    return ride.income_per_hour;
+                case INFORMATION_TYPE_RUNNING_COST:
+                    return ride.upkeep_cost;
+                case INFORMATION_TYPE_QUEUE_LENGTH:
+                    return ride.GetTotalQueueLength();
+                case INFORMATION_TYPE_QUEUE_TIME:
+                    return ride.GetMaxQueueTime();
+                case INFORMATION_TYPE_RELIABILITY:
+                    return ride.reliability_percentage;
+                case INFORMATION_TYPE_DOWN_TIME:
+                    return ride.downtime;
+                case INFORMATION_TYPE_GUESTS_FAVOURITE:
+                    return ride.guests_favourite;
+                case INFORMATION_TYPE_EXCITEMENT:
+                    return ride.ratings.isNull() ? kRideRatingUndefined : ride.ratings.excitement;
+                case INFORMATION_TYPE_INTENSITY:
+                    return ride.ratings.isNull() ? kRideRatingUndefined : ride.ratings.intensity;
+                case INFORMATION_TYPE_NAUSEA:
+                    return ride.ratings.isNull() ? kRideRatingUndefined : ride.ratings.nausea;
+                default:
+                    return 0;
+            }
         }
 
         void SortListByName()
@@ -834,107 +871,20 @@ static Widget _rideListWidgets[] = {
                 RideListEntry entry{};
                 entry.Id = rideRef.id;
                 entry.Name = rideRef.GetName();
+                entry.SortValue = GetSortValue(rideRef, list_information_type);
 
                 _rideList.push_back(std::move(entry));
             }
 
-            switch (list_information_type)
+            if (list_information_type == INFORMATION_TYPE_STATUS)
             {
-                case INFORMATION_TYPE_STATUS:
-                    SortListByName();
-                    break;
-                case INFORMATION_TYPE_POPULARITY:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.popularity * 4 <= otherRide.popularity * 4;
-                    });
-                    break;
-                case INFORMATION_TYPE_SATISFACTION:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.satisfaction * 5 <= otherRide.satisfaction * 5;
-                    });
-                    break;
-                case INFORMATION_TYPE_PROFIT:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.profit <= otherRide.profit;
-                    });
-                    break;
-                case INFORMATION_TYPE_TOTAL_CUSTOMERS:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.total_customers <= otherRide.total_customers;
-                    });
-                    break;
-                case INFORMATION_TYPE_TOTAL_PROFIT:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.total_profit <= otherRide.total_profit;
-                    });
-                    break;
-                case INFORMATION_TYPE_CUSTOMERS:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return RideCustomersPerHour(thisRide) <= RideCustomersPerHour(otherRide);
-                    });
-                    break;
-                case INFORMATION_TYPE_AGE:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.build_date <= otherRide.build_date;
-                    });
-                    break;
-                case INFORMATION_TYPE_INCOME:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.income_per_hour <= otherRide.income_per_hour;
-                    });
-                    break;
-                case INFORMATION_TYPE_RUNNING_COST:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.upkeep_cost <= otherRide.upkeep_cost;
-                    });
-                    break;
-                case INFORMATION_TYPE_QUEUE_LENGTH:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.GetTotalQueueLength() <= otherRide.GetTotalQueueLength();
-                    });
-                    break;
-                case INFORMATION_TYPE_QUEUE_TIME:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.GetMaxQueueTime() <= otherRide.GetMaxQueueTime();
-                    });
-                    break;
-                case INFORMATION_TYPE_RELIABILITY:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.reliability_percentage <= otherRide.reliability_percentage;
-                    });
-                    break;
-                case INFORMATION_TYPE_DOWN_TIME:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.downtime <= otherRide.downtime;
-                    });
-                    break;
-                case INFORMATION_TYPE_GUESTS_FAVOURITE:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        return thisRide.guests_favourite <= otherRide.guests_favourite;
-                    });
-                    break;
-                case INFORMATION_TYPE_EXCITEMENT:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        const auto leftValue = thisRide.ratings.isNull() ? kRideRatingUndefined : thisRide.ratings.excitement;
-                        const auto rightValue = otherRide.ratings.isNull() ? kRideRatingUndefined
-                                                                           : otherRide.ratings.excitement;
-                        return leftValue <= rightValue;
-                    });
-                    break;
-                case INFORMATION_TYPE_INTENSITY:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        const auto leftValue = thisRide.ratings.isNull() ? kRideRatingUndefined : thisRide.ratings.intensity;
-                        const auto rightValue = otherRide.ratings.isNull() ? kRideRatingUndefined : otherRide.ratings.intensity;
-                        return leftValue <= rightValue;
-                    });
-                    break;
-                case INFORMATION_TYPE_NAUSEA:
-                    SortListByPredicate([](const Ride& thisRide, const Ride& otherRide) -> bool {
-                        const auto leftValue = thisRide.ratings.isNull() ? kRideRatingUndefined : thisRide.ratings.nausea;
-                        const auto rightValue = otherRide.ratings.isNull() ? kRideRatingUndefined : otherRide.ratings.nausea;
-                        return leftValue <= rightValue;
-                    });
-                    break;
+                SortListByName();
+            }
+            else
+            {
+                std::sort(_rideList.begin(), _rideList.end(), [](const auto& lhs, const auto& rhs) {
+                    return lhs.SortValue > rhs.SortValue;
+                });
             }
 
             selected_list_item = -1;
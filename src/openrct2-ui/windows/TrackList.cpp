@@ -11,19 +11,27 @@
 #include <openrct2-ui/ride/Construction.h>
 #include <openrct2-ui/windows/Window.h>
 #include <openrct2/Context.h>
+#include <openrct2/Diagnostic.h>
 #include <openrct2/Editor.h>
 #include <openrct2/OpenRCT2.h>
+#include <openrct2/PlatformEnvironment.h>
 #include <openrct2/audio/audio.h>
 #include <openrct2/config/Config.h>
+#include <openrct2/core/Crypt.h>
+#include <openrct2/core/File.h>
+#include <openrct2/core/Path.hpp>
 #include <openrct2/core/String.hpp>
 #include <openrct2/drawing/IDrawingEngine.h>
 #include <openrct2/localisation/Formatting.h>
+#include <openrct2/object/ObjectList.h>
+#include <openrct2/object/ObjectManager.h>
 #include <openrct2/ride/RideConstruction.h>
 #include <openrct2/ride/RideData.h>
 #include <openrct2/ride/TrackDesign.h>
 #include <openrct2/ride/TrackDesignRepository.h>
 #include <openrct2/sprites.h>
 #include <openrct2/windows/Intent.h>
+#include <cstring>
 #include <vector>
 
 namespace OpenRCT2::Ui::Windows
@@ -67,6 +75,22 @@ static Widget _trackListWidgets[] = {
 
     constexpr uint16_t TRACK_DESIGN_INDEX_UNLOADED = UINT16_MAX;
 
+    // Rendered previews are cached on disk so that browsing the track list only pays
+    // the preview placement cost once per design. Entries are keyed by the design file
+    // contents, the loaded object set and the scenery toggle, all of which influence
+    // the rendered image and the availability flags stored alongside it.
+    constexpr uint32_t kPreviewCacheMagic = 0x56505254; // TRPV
+    constexpr uint16_t kPreviewCacheVersion = 1;
+
+    struct TrackPreviewCacheHeader
+    {
+        uint32_t Magic;
+        uint16_t Version;
+        uint8_t GameStateFlags;
+        uint8_t Pad07;
+        money64 Cost;
+    };
+
     RideSelection _window_track_list_item;
 
     class TrackListWindow final : public Window
@@ -80,6 +104,7 @@ static Widget _trackListWidgets[] = {
         std::vector<uint8_t> _trackDesignPreviewPixels;
         bool _selectedItemIsBeingUpdated;
         bool _reloadTrackDesigns;
+        Crypt::Sha1Algorithm::Result _objectListHash{};
 
         void FilterList()
         {
@@ -198,12 +223,101 @@ static Widget _trackListWidgets[] = {
         bool LoadDesignPreview(const u8string& path)
         {
             _loadedTrackDesign = TrackDesignImport(path.c_str());
-            if (_loadedTrackDesign != nullptr)
+            if (_loadedTrackDesign == nullptr)
+            {
+                return false;
+            }
+
+            // Preview rendering places the design on the (stashed) map, which is by far
+            // the most expensive part of browsing the list, so cached images are reused
+            // whenever the design and the loaded objects are unchanged.
+            const auto cachePath = GetPreviewCachePath(path);
+            if (!ReadPreviewCache(cachePath))
             {
                 TrackDesignDrawPreview(*_loadedTrackDesign, _trackDesignPreviewPixels.data());
+                WritePreviewCache(cachePath);
+            }
+            return true;
+        }
+
+        u8string GetPreviewCachePath(const u8string& trackPath) const
+        {
+            auto hash = Crypt::CreateSHA1();
+            auto fileData = File::ReadAllBytes(trackPath);
+            hash->Update(fileData.data(), fileData.size());
+            hash->Update(_objectListHash.data(), _objectListHash.size());
+            const uint8_t sceneryToggle = gTrackDesignSceneryToggle ? 1 : 0;
+            hash->Update(&sceneryToggle, sizeof(sceneryToggle));
+            const auto digest = hash->Finish();
+
+            u8string filename;
+            for (auto b : digest)
+            {
+                char buf[3];
+                snprintf(buf, sizeof(buf), "%02x", b);
+                filename += buf;
+            }
+            filename += u8".bin";
+
+            auto env = GetContext()->GetPlatformEnvironment();
+            return Path::Combine(env->GetDirectoryPath(DIRBASE::CACHE), u8"previews", filename);
+        }
+
+        bool ReadPreviewCache(const u8string& cachePath)
+        {
+            if (!File::Exists(cachePath))
+            {
+                return false;
+            }
+
+            try
+            {
+                auto data = File::ReadAllBytes(cachePath);
+                if (data.size() != sizeof(TrackPreviewCacheHeader) + _trackDesignPreviewPixels.size())
+                {
+                    return false;
+                }
+
+                TrackPreviewCacheHeader header{};
+                std::memcpy(&header, data.data(), sizeof(header));
+                if (header.Magic != kPreviewCacheMagic || header.Version != kPreviewCacheVersion)
+                {
+                    return false;
+                }
+
+                _loadedTrackDesign->gameStateData.flags = header.GameStateFlags;
+                _loadedTrackDesign->gameStateData.cost = header.Cost;
+                std::memcpy(
+                    _trackDesignPreviewPixels.data(), data.data() + sizeof(header), _trackDesignPreviewPixels.size());
                 return true;
             }
-            return false;
+            catch (const std::exception&)
+            {
+                return false;
+            }
+        }
+
+        void WritePreviewCache(const u8string& cachePath) const
+        {
+            try
+            {
+                Path::CreateDirectory(Path::GetDirectory(cachePath));
+
+                TrackPreviewCacheHeader header{};
+                header.Magic = kPreviewCacheMagic;
+                header.Version = kPreviewCacheVersion;
+                header.GameStateFlags = _loadedTrackDesign->gameStateData.flags;
+                header.Cost = _loadedTrackDesign->gameStateData.cost;
+
+                std::vector<uint8_t> data(sizeof(header) + _trackDesignPreviewPixels.size());
+                std::memcpy(data.data(), &header, sizeof(header));
+                std::memcpy(data.data() + sizeof(header), _trackDesignPreviewPixels.data(), _trackDesignPreviewPixels.size());
+                File::WriteAllBytes(cachePath, data.data(), data.size());
+            }
+            catch (const std::exception& e)
+            {
+                LOG_VERBOSE("Unable to write track design preview cache entry: %s", e.what());
+            }
         }
 
     public:
@@ -243,6 +357,16 @@ static Widget _trackListWidgets[] = {
             _currentTrackPieceDirection = 2;
             _trackDesignPreviewPixels.resize(4 * kTrackPreviewImageSize);
 
+            // The loaded object set influences rendered previews; fold it into the
+            // preview cache key once rather than per design.
+            auto hash = Crypt::CreateSHA1();
+            for (const auto& entry : GetContext()->GetObjectManager().GetLoadedObjects())
+            {
+                auto id = entry.ToString();
+                hash->Update(id.data(), id.size());
+            }
+            _objectListHash = hash->Finish();
+
             _loadedTrackDesign = nullptr;
             _loadedTrackDesignIndex = TRACK_DESIGN_INDEX_UNLOADED;
         }
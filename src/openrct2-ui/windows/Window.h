@@ -104,6 +104,7 @@ namespace OpenRCT2::Ui::Windows
 
     WindowBase* InstallTrackOpen(const utf8* path);
     void WindowGuestListRefreshList();
+    void WindowGuestListRefreshGuest(EntityId guestId);
     WindowBase* GuestListOpen();
     WindowBase* GuestListOpenWithFilter(GuestListFilterType type, int32_t index);
     WindowBase* StaffFirePromptOpen(Peep* peep);
@@ -157,8 +157,16 @@ public:
     }
 };
 
+bool AssetPack::IsLoaded() const
+{
+    return _loaded;
+}
+
 void AssetPack::Load()
 {
+    // Set before reading so a bad archive is not retried on every lookup
+    _loaded = true;
+
     auto path = Path.u8string();
     auto archive = Zip::Open(path, ZIP_ACCESS::READ);
     if (!archive->Exists(ManifestFileName))
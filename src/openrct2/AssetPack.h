@@ -32,6 +32,7 @@ namespace OpenRCT2
         AudioSampleTable _sampleTable;
         std::vector<Entry> _entries;
         bool _enabled{};
+        bool _loaded{};
 
     public:
         fs::path Path;
@@ -49,6 +50,7 @@ namespace OpenRCT2
 
         void Fetch();
         void Load();
+        bool IsLoaded() const;
         bool ContainsObject(std::string_view id) const;
         void LoadSamplesForObject(std::string_view id, AudioSampleTable& objectTable);
 
@@ -15,9 +15,11 @@
 #include "PlatformEnvironment.h"
 #include "config/Config.h"
 #include "core/Console.hpp"
+#include "core/FileIndex.hpp"
 #include "core/FileSystem.hpp"
 #include "core/Path.hpp"
 #include "core/String.hpp"
+#include "localisation/LocalisationService.h"
 #include "object/AudioSampleTable.h"
 
 #include <algorithm>
@@ -25,6 +27,75 @@
 
 using namespace OpenRCT2;
 
+namespace
+{
+    struct AssetPackIndexItem
+    {
+        std::string Path;
+        std::string Id;
+        std::string Version;
+        std::string Name;
+        std::string Description;
+    };
+
+    /**
+     * Caches each pack's manifest metadata so startup does one small index
+     * read instead of opening every archive. Samples and object overrides are
+     * still read from the archive when an enabled pack is loaded.
+     */
+    class AssetPackFileIndex final : public FileIndex<AssetPackIndexItem>
+    {
+    private:
+        static constexpr uint32_t MAGIC_NUMBER = 0x58495041; // APIX
+        static constexpr uint16_t VERSION = 1;
+        static constexpr auto PATTERN = "*.parkap";
+
+    public:
+        explicit AssetPackFileIndex(const IPlatformEnvironment& env)
+            : FileIndex(
+                "asset pack index", MAGIC_NUMBER, VERSION, env.GetFilePath(PATHID::CACHE_ASSET_PACKS), std::string(PATTERN),
+                std::vector<std::string>({
+                    env.GetDirectoryPath(DIRBASE::OPENRCT2, DIRID::ASSET_PACK),
+                    env.GetDirectoryPath(DIRBASE::USER, DIRID::ASSET_PACK),
+                }))
+        {
+        }
+
+    protected:
+        std::optional<AssetPackIndexItem> Create([[maybe_unused]] int32_t language, const std::string& path) const override
+        {
+            try
+            {
+                AssetPack assetPack(fs::u8path(path));
+                assetPack.Fetch();
+
+                AssetPackIndexItem item;
+                item.Path = path;
+                item.Id = assetPack.Id;
+                item.Version = assetPack.Version;
+                item.Name = assetPack.Name;
+                item.Description = assetPack.Description;
+                return item;
+            }
+            catch (const std::exception& e)
+            {
+                auto fileName = fs::u8path(path).filename().u8string();
+                Console::Error::WriteFormat("Unable to load asset pack: %s (%s)", fileName.c_str(), e.what());
+                return std::nullopt;
+            }
+        }
+
+        void Serialise(DataSerialiser& ds, const AssetPackIndexItem& item) const override
+        {
+            ds << item.Path;
+            ds << item.Id;
+            ds << item.Version;
+            ds << item.Name;
+            ds << item.Description;
+        }
+    };
+} // namespace
+
 AssetPackManager::AssetPackManager()
 {
 }
@@ -70,28 +141,19 @@ void AssetPackManager::Scan()
     auto context = GetContext();
     auto env = context->GetPlatformEnvironment();
 
-    auto openrct2Dir = fs::u8path(env->GetDirectoryPath(DIRBASE::OPENRCT2, DIRID::ASSET_PACK));
-    Scan(openrct2Dir);
-
-    auto userDirectory = fs::u8path(env->GetDirectoryPath(DIRBASE::USER, DIRID::ASSET_PACK));
-    Path::CreateDirectory(userDirectory.u8string());
-    Scan(userDirectory);
-}
+    auto userDirectory = env->GetDirectoryPath(DIRBASE::USER, DIRID::ASSET_PACK);
+    Path::CreateDirectory(userDirectory);
 
-void AssetPackManager::Scan(const fs::path& directory)
-{
-    // Recursively scan for .parkap files
-    std::error_code ec;
-    for (const fs::directory_entry& entry : fs::recursive_directory_iterator(directory, ec))
+    auto language = LocalisationService_GetCurrentLanguage();
+    AssetPackFileIndex fileIndex(*env);
+    for (auto& item : fileIndex.LoadOrBuild(language))
     {
-        if (!entry.is_directory())
-        {
-            auto path = entry.path().u8string();
-            if (String::EndsWith(path, ".parkap", true))
-            {
-                AddAssetPack(path);
-            }
-        }
+        auto assetPack = std::make_unique<AssetPack>(fs::u8path(item.Path));
+        assetPack->Id = item.Id;
+        assetPack->Version = item.Version;
+        assetPack->Name = item.Name;
+        assetPack->Description = item.Description;
+        _assetPacks.push_back(std::move(assetPack));
     }
 }
 
@@ -99,7 +161,11 @@ void AssetPackManager::Reload()
 {
     for (auto& assetPack : _assetPacks)
     {
-        assetPack->Load();
+        // Disabled packs never serve any overrides, so do not open their archives
+        if (assetPack->IsEnabled())
+        {
+            assetPack->Load();
+        }
     }
 }
 
@@ -114,9 +180,17 @@ void AssetPackManager::Swap(size_t index, size_t otherIndex)
 void AssetPackManager::LoadSamplesForObject(std::string_view id, AudioSampleTable& objectTable)
 {
     std::for_each(_assetPacks.rbegin(), _assetPacks.rend(), [&](auto& assetPack) {
-        if (assetPack->IsEnabled() && assetPack->ContainsObject(id))
+        if (assetPack->IsEnabled())
         {
-            assetPack->LoadSamplesForObject(id, objectTable);
+            // Packs enabled after startup are opened here on first use
+            if (!assetPack->IsLoaded())
+            {
+                assetPack->Load();
+            }
+            if (assetPack->ContainsObject(id))
+            {
+                assetPack->LoadSamplesForObject(id, objectTable);
+            }
         }
     });
 }
@@ -126,23 +200,6 @@ void AssetPackManager::ClearAssetPacks()
     _assetPacks.clear();
 }
 
-void AssetPackManager::AddAssetPack(const fs::path& path)
-{
-    auto szPath = path.u8string();
-    LOG_VERBOSE("Scanning asset pack: %s", szPath.c_str());
-    try
-    {
-        auto ap = std::make_unique<AssetPack>(path);
-        ap->Fetch();
-        _assetPacks.push_back(std::move(ap));
-    }
-    catch (const std::exception& e)
-    {
-        auto fileName = path.filename().u8string();
-        Console::Error::WriteFormat("Unable to load asset pack: %s (%s)", fileName.c_str(), e.what());
-    }
-}
-
 template<typename TFunc> static void EnumerateCommaSeparatedList(std::string_view csl, TFunc func)
 {
     size_t elStart = 0;
@@ -36,7 +36,6 @@ namespace OpenRCT2
         size_t GetAssetPackIndex(std::string_view id);
 
         void Scan();
-        void Scan(const fs::path& directory);
         void Reload();
         void Swap(size_t index, size_t otherIndex);
 
@@ -47,7 +46,6 @@ namespace OpenRCT2
 
     private:
         void ClearAssetPacks();
-        void AddAssetPack(const fs::path& path);
     };
 
 } // namespace OpenRCT2
@@ -12,8 +12,11 @@
 #include "Context.h"
 #include "Diagnostic.h"
 #include "OpenRCT2.h"
+#include "core/Crypt.h"
+#include "core/File.h"
 #include "core/FileStream.h"
 #include "core/Imaging.h"
+#include "core/JobPool.h"
 #include "core/Json.hpp"
 #include "core/Path.hpp"
 #include "core/String.hpp"
@@ -24,9 +27,12 @@
 #include "object/ObjectRepository.h"
 #include "util/Util.h"
 
+#include <atomic>
 #include <cmath>
 #include <cstring>
 #include <optional>
+#include <string_view>
+#include <unordered_map>
 
 // TODO: Remove when C++20 is enabled and std::format can be used
 #include <iomanip>
@@ -39,10 +45,17 @@ static int32_t CommandLineForSpriteCombine(const char** argv, int32_t argc);
 class SpriteFile
 {
 public:
+    struct DedupeResult
+    {
+        uint32_t NumDuplicates{};
+        uint32_t BytesSaved{};
+    };
+
     RCTG1Header Header{};
     std::vector<G1Element> Entries;
     std::vector<uint8_t> Data;
     void AddImage(ImageImporter::ImportResult& image);
+    DedupeResult Dedupe();
     bool Save(const utf8* path);
     static std::optional<SpriteFile> Open(const utf8* path);
 
@@ -186,6 +199,45 @@ bool SpriteFile::Save(const utf8* path)
     }
 }
 
+SpriteFile::DedupeResult SpriteFile::Dedupe()
+{
+    DedupeResult result{};
+    MakeEntriesAbsolute();
+
+    // Rebuild the data blob with one copy per unique image, pointing duplicate
+    // entries at the first occurrence.
+    std::unordered_map<std::string_view, size_t> uniqueOffsets;
+    std::vector<size_t> newOffsets(Entries.size());
+    std::vector<uint8_t> newData;
+    newData.reserve(Data.size());
+
+    for (size_t i = 0; i < Entries.size(); i++)
+    {
+        const auto& entry = Entries[i];
+        auto length = G1CalculateDataSize(&entry);
+        auto key = std::string_view(reinterpret_cast<const char*>(entry.offset), length);
+        auto [it, inserted] = uniqueOffsets.emplace(key, newData.size());
+        if (inserted)
+        {
+            newData.insert(newData.end(), entry.offset, entry.offset + length);
+        }
+        else
+        {
+            result.NumDuplicates++;
+        }
+        newOffsets[i] = it->second;
+    }
+
+    result.BytesSaved = static_cast<uint32_t>(Data.size() - newData.size());
+    Data = std::move(newData);
+    Header.total_size = static_cast<uint32_t>(Data.size());
+    for (size_t i = 0; i < Entries.size(); i++)
+    {
+        Entries[i].offset = Data.data() + newOffsets[i];
+    }
+    return result;
+}
+
 static bool SpriteImageExport(const G1Element& spriteElement, u8string_view outPath)
 {
     const size_t pixelBufferSize = static_cast<size_t>(spriteElement.width) * spriteElement.height;
@@ -450,6 +502,41 @@ int32_t CommandLineForSprite(const char** argv, int32_t argc)
         return 1;
     }
 
+    if (String::IEquals(argv[0], "dedupe"))
+    {
+        if (argc < 2)
+        {
+            fprintf(stdout, "usage: sprite dedupe <spritefile> [dryrun]\n");
+            return -1;
+        }
+
+        const utf8* spriteFilePath = argv[1];
+        bool dryrun = (argc >= 3 && strcmp(argv[2], "dryrun") == 0);
+
+        auto spriteFile = SpriteFile::Open(spriteFilePath);
+        if (!spriteFile.has_value())
+        {
+            fprintf(stderr, "Unable to open input sprite file.\n");
+            return -1;
+        }
+
+        const auto oldSize = spriteFile->Header.total_size;
+        const auto result = spriteFile->Dedupe();
+        printf("sprites: %u\n", spriteFile->Header.num_entries);
+        printf("duplicates: %u\n", result.NumDuplicates);
+        printf("data size: %u -> %u (%u bytes saved)\n", oldSize, spriteFile->Header.total_size, result.BytesSaved);
+
+        if (!dryrun && result.BytesSaved > 0)
+        {
+            if (!spriteFile->Save(spriteFilePath))
+            {
+                fprintf(stderr, "Could not save sprite file.\n");
+                return -1;
+            }
+        }
+        return 1;
+    }
+
     if (String::IEquals(argv[0], "create"))
     {
         if (argc < 2)
@@ -550,9 +637,13 @@ int32_t CommandLineForSprite(const char** argv, int32_t argc)
         spriteFile.Header.num_entries = 0;
         spriteFile.Header.total_size = 0;
 
-        fprintf(stdout, "Building: %s\n", spriteFilePath);
+        struct SpriteBuildEntry
+        {
+            u8string Path;
+            ImageImportMeta Meta;
+        };
 
-        json_t sprite_description;
+        std::vector<SpriteBuildEntry> buildEntries;
 
         // Note: jsonSprite is deliberately left non-const: json_t behaviour changes when const
         for (auto& [jsonKey, jsonSprite] : jsonSprites.items())
@@ -575,18 +666,97 @@ int32_t CommandLineForSprite(const char** argv, int32_t argc)
             meta.importMode = gSpriteMode;
 
             auto imagePath = Path::GetAbsolute(Path::Combine(directoryPath, strPath));
+            buildEntries.push_back({ imagePath, meta });
+        }
+
+        // Incremental mode: digest the description file, the import mode and
+        // every input image. When the digest matches the one stored alongside
+        // an existing output, no input has changed and the build is skipped.
+        const auto digestPath = u8string(spriteFilePath) + ".sha1";
+        u8string digest;
+        try
+        {
+            // The description file and every input image are independent, so
+            // they are hashed as one batch across the job pool and the
+            // per-file digests folded into the final key in description order.
+            std::vector<std::vector<uint8_t>> inputData;
+            inputData.reserve(buildEntries.size() + 1);
+            inputData.push_back(File::ReadAllBytes(spriteDescriptionPath));
+            for (const auto& entry : buildEntries)
+            {
+                inputData.push_back(File::ReadAllBytes(entry.Path));
+            }
 
-            auto importResult = SpriteImageImport(imagePath, meta);
-            if (importResult == std::nullopt)
+            std::vector<Crypt::HashInput> inputs;
+            inputs.reserve(inputData.size());
+            for (const auto& data : inputData)
             {
-                fprintf(stderr, "Could not import image file: %s\nCanceling\n", imagePath.c_str());
-                return -1;
+                inputs.push_back({ data.data(), data.size() });
             }
+            const auto fileDigests = Crypt::SHA1Batch(inputs);
 
-            spriteFile.AddImage(importResult.value());
+            auto hasher = Crypt::CreateSHA1();
+            hasher->Update(&gSpriteMode, sizeof(gSpriteMode));
+            for (const auto& fileDigest : fileDigests)
+            {
+                hasher->Update(fileDigest.data(), fileDigest.size());
+            }
+            auto hashResult = hasher->Finish();
+
+            std::ostringstream oss;
+            for (auto b : hashResult)
+                oss << std::setfill('0') << std::setw(2) << std::hex << static_cast<int32_t>(b);
+            digest = PopStr(oss);
+        }
+        catch (const std::exception&)
+        {
+            // An unreadable input gets a proper error from the import below;
+            // just fall through to a full build.
+            digest.clear();
+        }
+
+        if (!digest.empty() && File::Exists(spriteFilePath) && File::Exists(digestPath)
+            && File::ReadAllText(digestPath) == digest)
+        {
+            fprintf(stdout, "Up to date: %s\n", spriteFilePath);
+            return 1;
+        }
+
+        fprintf(stdout, "Building: %s\n", spriteFilePath);
+
+        // The PNG decode and palette quantisation are independent per input,
+        // so they run on the job pool, with each result landing in its input's
+        // slot. Appending afterwards in description order keeps the output
+        // byte-identical to a sequential build.
+        std::vector<std::optional<ImageImporter::ImportResult>> importResults(buildEntries.size());
+        std::atomic<bool> importFailed{ false };
+        JobPool jobPool;
+        for (size_t i = 0; i < buildEntries.size(); i++)
+        {
+            jobPool.AddTask([i, &buildEntries, &importResults, &importFailed]() {
+                const auto& entry = buildEntries[i];
+                importResults[i] = SpriteImageImport(entry.Path, entry.Meta);
+                if (!importResults[i].has_value())
+                {
+                    fprintf(stderr, "Could not import image file: %s\n", entry.Path.c_str());
+                    importFailed = true;
+                }
+            });
+        }
+        jobPool.Join();
+
+        if (importFailed)
+        {
+            fprintf(stderr, "Canceling\n");
+            return -1;
+        }
+
+        for (size_t i = 0; i < buildEntries.size(); i++)
+        {
+            spriteFile.AddImage(importResults[i].value());
 
             if (!silent)
-                fprintf(stdout, "Added: %s\n", imagePath.c_str());
+                fprintf(stdout, "Added: %s\n", buildEntries[i].Path.c_str());
         }
 
         if (!spriteFile.Save(spriteFilePath))
@@ -595,6 +765,19 @@ int32_t CommandLineForSprite(const char** argv, int32_t argc)
             return -1;
         }
 
+        if (!digest.empty())
+        {
+            try
+            {
+                File::WriteAllBytes(digestPath, digest.data(), digest.size());
+            }
+            catch (const std::exception&)
+            {
+                // The digest sidecar only enables the skip above; failing to
+                // write it just means the next build runs in full.
+            }
+        }
+
         fprintf(stdout, "Finished\n");
         return 1;
     }
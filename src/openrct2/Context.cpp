@@ -35,6 +35,7 @@
 #include "core/FileStream.h"
 #include "core/Guard.hpp"
 #include "core/Http.h"
+#include "core/JobPool.h"
 #include "core/MemoryStream.h"
 #include "core/Path.hpp"
 #include "core/String.hpp"
@@ -60,6 +61,7 @@
 #include "park/ParkFile.h"
 #include "platform/Crash.h"
 #include "platform/Platform.h"
+#include "profiling/PerfCounters.h"
 #include "profiling/Profiling.h"
 #include "rct2/RCT2.h"
 #include "ride/TrackData.h"
@@ -78,11 +80,13 @@
 #include "util/Util.h"
 #include "world/Park.h"
 
+#include <chrono>
 #include <cmath>
 #include <exception>
 #include <future>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <string>
 
 using namespace OpenRCT2;
@@ -135,11 +139,23 @@ namespace OpenRCT2
         std::unique_ptr<IDrawingEngine> _drawingEngine;
         std::unique_ptr<Painter> _painter;
 
+        // Serialised park captured when a scenario is loaded, before
+        // ScenarioBegin runs, so a restart can restore from memory instead of
+        // re-reading and re-importing the scenario file.
+        MemoryStream _scenarioBaseline;
+        u8string _scenarioBaselinePath;
+
         bool _initialised = false;
+        // Startup milestones are measured from here; see RecordStartupMilestone.
+        std::chrono::steady_clock::time_point _initialiseStart;
+        // Initialisation tasks running in parallel report progress through the
+        // same intents; dispatch is serialised so they cannot interleave.
+        std::mutex _progressMutex;
 
         Timer _timer;
         float _ticksAccumulator = 0.0f;
         float _realtimeAccumulator = 0.0f;
+        float _frameAccumulator = 0.0f;
         float _timeScale = 1.0f;
         bool _variableFrame = false;
 
@@ -398,6 +414,7 @@ namespace OpenRCT2
                 throw std::runtime_error("Context already initialised.");
             }
             _initialised = true;
+            _initialiseStart = std::chrono::steady_clock::now();
 
             CrashInit();
 
@@ -532,10 +549,18 @@ namespace OpenRCT2
                 InitialiseScriptEngine();
             }
 
+            RecordStartupMilestone("context_initialise");
+
             return true;
         }
 
     private:
+        void RecordStartupMilestone(const char* name)
+        {
+            PerfCounters::RecordStartupMilestone(
+                name, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _initialiseStart).count());
+        }
+
         void InitialiseRepositories()
         {
             if (!_initialised)
@@ -545,8 +570,17 @@ namespace OpenRCT2
 
             auto currentLanguage = _localisationService->GetCurrentLanguage();
 
+            // The track design, scenario and title sequence scans only touch
+            // their own directories and index files, so they can overlap the
+            // object repository and audio loading below.
+            JobPool scanJobs;
+            scanJobs.AddTask([this, currentLanguage]() { _trackDesignRepository->Scan(currentLanguage); });
+            scanJobs.AddTask([this, currentLanguage]() { _scenarioRepository->Scan(currentLanguage); });
+            scanJobs.AddTask([]() { TitleSequenceManager::Scan(); });
+
             OpenProgress(STR_CHECKING_OBJECT_FILES);
             _objectRepository->LoadOrConstruct(currentLanguage);
+            RecordStartupMilestone("object_repository");
 
             OpenProgress(STR_LOADING_GENERIC);
             Audio::LoadAudioObjects();
@@ -558,17 +592,11 @@ namespace OpenRCT2
                 _assetPackManager->LoadEnabledAssetPacks();
                 _assetPackManager->Reload();
             }
-
-            OpenProgress(STR_CHECKING_TRACK_DESIGN_FILES);
-            _trackDesignRepository->Scan(currentLanguage);
-
-            OpenProgress(STR_CHECKING_SCENARIO_FILES);
-            _scenarioRepository->Scan(currentLanguage);
-
-            OpenProgress(STR_CHECKING_TITLE_SEQUENCES);
-            TitleSequenceManager::Scan();
+            RecordStartupMilestone("audio_and_asset_packs");
 
             OpenProgress(STR_LOADING_GENERIC);
+            scanJobs.Join();
+            RecordStartupMilestone("repositories");
         }
 
         void InitialiseScriptEngine()
@@ -577,6 +605,7 @@ namespace OpenRCT2
             OpenProgress(STR_LOADING_PLUGIN_ENGINE);
             _scriptEngine.Initialise();
             _uiContext->InitialiseScriptExtensions();
+            RecordStartupMilestone("script_engine");
 
             OpenProgress(STR_LOADING_GENERIC);
 #endif
@@ -653,6 +682,7 @@ namespace OpenRCT2
             auto captionString = _localisationService->GetString(captionStringId);
             auto intent = Intent(INTENT_ACTION_PROGRESS_OPEN);
             intent.PutExtra(INTENT_EXTRA_MESSAGE, captionString);
+            std::scoped_lock lock(_progressMutex);
             ContextOpenIntent(&intent);
         }
 
@@ -663,7 +693,10 @@ namespace OpenRCT2
             intent.PutExtra(INTENT_EXTRA_PROGRESS_OFFSET, currentProgress);
             intent.PutExtra(INTENT_EXTRA_PROGRESS_TOTAL, totalCount);
             intent.PutExtra(INTENT_EXTRA_STRING_ID, format);
-            ContextOpenIntent(&intent);
+            {
+                std::scoped_lock lock(_progressMutex);
+                ContextOpenIntent(&intent);
+            }
 
             // Ideally, we'd force a redraw at all times at this point. OpenGL has to be directed
             // from the main thread, though, so this cannot be invoked when off main thread.
@@ -679,6 +712,7 @@ namespace OpenRCT2
         void CloseProgress() override
         {
             auto intent = Intent(INTENT_ACTION_PROGRESS_CLOSE);
+            std::scoped_lock lock(_progressMutex);
             ContextOpenIntent(&intent);
         }
 
@@ -805,6 +839,11 @@ namespace OpenRCT2
 #endif
                 if (!asScenario && (info.Type == FILE_TYPE::PARK || info.Type == FILE_TYPE::SAVED_GAME))
                 {
+                    // The resident baseline belongs to the previously loaded
+                    // scenario; a restart after this load must not silently
+                    // restore that park over the one now being played.
+                    _scenarioBaseline.Clear();
+                    _scenarioBaselinePath.clear();
 #ifndef DISABLE_NETWORK
                     if (_network.GetMode() == NETWORK_MODE_CLIENT)
                     {
@@ -821,6 +860,7 @@ namespace OpenRCT2
                 }
                 else
                 {
+                    CaptureScenarioBaseline(gameState, path);
                     ScenarioBegin(gameState);
 #ifndef DISABLE_NETWORK
                     if (_network.GetMode() == NETWORK_MODE_SERVER)
@@ -945,7 +985,41 @@ namespace OpenRCT2
             return false;
         }
 
+        bool RestartScenario() final override
+        {
+            if (_scenarioBaseline.GetLength() == 0)
+            {
+                return false;
+            }
+
+            // Copy the baseline first: the load path recaptures it once the
+            // restored state has been imported.
+            auto ms = MemoryStream(_scenarioBaseline);
+            ms.SetPosition(0);
+            return LoadParkFromStream(&ms, _scenarioBaselinePath, false, true);
+        }
+
     private:
+        void CaptureScenarioBaseline(GameState_t& gameState, const std::string& path)
+        {
+            try
+            {
+                auto baseline = MemoryStream();
+                ParkFileExporter exporter;
+                // The baseline never touches disk; trade size for capture speed.
+                exporter.FastCompression = true;
+                exporter.Export(gameState, baseline);
+                _scenarioBaseline = std::move(baseline);
+                _scenarioBaselinePath = path;
+            }
+            catch (const std::exception& e)
+            {
+                Console::Error::WriteLine("Unable to capture scenario baseline: %s", e.what());
+                _scenarioBaseline = MemoryStream();
+                _scenarioBaselinePath.clear();
+            }
+        }
+
         bool HasObjectsThatUseFallbackImages()
         {
             for (auto objectType : getAllObjectTypes())
@@ -1269,9 +1343,12 @@ namespace OpenRCT2
 
         void UpdateTimeAccumulators(float deltaTime)
         {
-            // Ticks
+            // Ticks. Let the backlog grow with the time scale, otherwise a
+            // fast-forwarding headless server is clamped back to
+            // kGameMaxUpdates ticks per frame regardless of the scale.
             float scaledDeltaTime = deltaTime * _timeScale;
-            _ticksAccumulator = std::min(_ticksAccumulator + scaledDeltaTime, kGameUpdateMaxThreshold);
+            const float maxTicksThreshold = std::max(kGameUpdateMaxThreshold, kGameUpdateTimeMS * _timeScale);
+            _ticksAccumulator = std::min(_ticksAccumulator + scaledDeltaTime, maxTicksThreshold);
 
             // Real Time.
             _realtimeAccumulator = std::min(_realtimeAccumulator + deltaTime, kGameUpdateMaxThreshold);
@@ -1280,6 +1357,35 @@ namespace OpenRCT2
                 gCurrentRealTimeTicks++;
                 _realtimeAccumulator -= kGameUpdateTimeMS;
             }
+
+            // Rendered frames, for the optional frame limiter.
+            _frameAccumulator = std::min(_frameAccumulator + deltaTime, kGameUpdateMaxThreshold);
+        }
+
+        /**
+         * Sleeps off the remainder of the frame budget when a frame limit is
+         * configured, so an uncapped client can pace itself to its display
+         * instead of spinning. Ticks always run at 40Hz, the budget only
+         * schedules how often the interpolated frames are presented.
+         */
+        void PaceVariableFrame()
+        {
+            const auto fpsLimit = Config::Get().general.FPSLimit;
+            if (fpsLimit <= 0)
+            {
+                _frameAccumulator = 0.0f;
+                return;
+            }
+
+            const float targetFrameMS = 1000.0f / fpsLimit;
+            if (_frameAccumulator < targetFrameMS)
+            {
+                Platform::Sleep(static_cast<uint32_t>(targetFrameMS - _frameAccumulator));
+            }
+            // A negative remainder carries the slept time into the next frame
+            // so the cadence stays even; cap the positive side to one frame so
+            // a slow frame is followed by a prompt one rather than a burst.
+            _frameAccumulator = std::min(_frameAccumulator - targetFrameMS, targetFrameMS);
         }
 
         void RunFixedFrame(float deltaTime)
@@ -1344,6 +1450,7 @@ namespace OpenRCT2
                 tweener.Tween(alpha);
 
                 Draw();
+                PaceVariableFrame();
             }
         }
 
@@ -1512,7 +1619,8 @@ namespace OpenRCT2
 
         void SetTimeScale(float newScale) override
         {
-            _timeScale = std::clamp(newScale, kGameMinTimeScale, kGameMaxTimeScale);
+            const auto maxScale = gOpenRCT2Headless ? kGameMaxTimeScaleHeadless : kGameMaxTimeScale;
+            _timeScale = std::clamp(newScale, kGameMinTimeScale, maxScale);
         }
 
         float GetTimeScale() const override
@@ -169,6 +169,13 @@ namespace OpenRCT2
         virtual bool LoadParkFromStream(
             IStream* stream, const std::string& path, bool loadTitleScreenFirstOnFail = false, bool asScenario = false)
             = 0;
+
+        /**
+         * Restores the in-memory baseline captured when the current scenario
+         * was loaded, skipping the file read and import of a full reload.
+         * Returns false when no baseline is resident.
+         */
+        virtual bool RestartScenario() = 0;
         virtual void WriteLine(const std::string& s) = 0;
         virtual void WriteErrorLine(const std::string& s) = 0;
         virtual void Finish() = 0;
@@ -202,6 +209,9 @@ namespace
 
 constexpr float kGameMinTimeScale = 0.1f;
 constexpr float kGameMaxTimeScale = 5.0f;
+// Headless servers have no rendering or audio to pace against, so they may
+// fast-forward far harder; the only bound is simulation cost.
+constexpr float kGameMaxTimeScaleHeadless = 100.0f;
 
 void ContextInit();
 void ContextSetCurrentCursor(CursorID cursor);
@@ -72,9 +72,12 @@
 #include "world/Scenery.h"
 #include "world/Surface.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <iterator>
 #include <memory>
+#include <optional>
+#include <utility>
 
 using namespace OpenRCT2;
 
@@ -339,6 +342,26 @@ void GameFixSaveVars()
     MapCountRemainingLandRights();
 }
 
+// Parses the --view startup option ("x,y[,zoom]", tile coordinates) into a
+// map position and optional zoom level.
+static std::optional<std::pair<TileCoordsXY, std::optional<ZoomLevel>>> ParseStartupView(const u8string& value)
+{
+    int32_t x, y, zoom;
+    const auto numParsed = sscanf(value.c_str(), "%d,%d,%d", &x, &y, &zoom);
+    if (numParsed < 2)
+    {
+        return std::nullopt;
+    }
+
+    std::optional<ZoomLevel> zoomLevel;
+    if (numParsed == 3)
+    {
+        zoomLevel = ZoomLevel{ static_cast<int8_t>(std::clamp<int32_t>(
+            zoom, static_cast<int8_t>(ZoomLevel::min()), static_cast<int8_t>(ZoomLevel::max()))) };
+    }
+    return std::make_pair(TileCoordsXY{ x, y }, zoomLevel);
+}
+
 void GameLoadInit()
 {
     auto* context = GetContext();
@@ -363,10 +386,33 @@ void GameLoadInit()
     auto& gameState = GetGameState();
     windowManager->SetMainView(gameState.SavedView, gameState.SavedViewZoom, gameState.SavedViewRotation);
 
+    // Render followers of a multi-process video wall pass --view to pin their
+    // main viewport to their shard of the map; the simulation itself is kept
+    // in sync by the network client, only the camera differs per process.
+    if (!gOpenRCT2StartupView.empty())
+    {
+        if (const auto startupView = ParseStartupView(gOpenRCT2StartupView))
+        {
+            const auto centre = startupView->first.ToCoordsXY().ToTileCentre();
+            const auto viewPos = Translate3DTo2DWithZ(
+                gameState.SavedViewRotation, CoordsXYZ{ centre, TileElementHeight(centre) });
+            windowManager->SetMainView(
+                viewPos, startupView->second.value_or(gameState.SavedViewZoom), gameState.SavedViewRotation);
+        }
+        else
+        {
+            LOG_ERROR("Ignoring invalid --view value '%s'; expected x,y[,zoom]", gOpenRCT2StartupView.c_str());
+        }
+    }
+
     if (NetworkGetMode() != NETWORK_MODE_CLIENT)
     {
         GameActions::ClearQueue();
     }
+    // Repack the tile elements and dematerialise everything outside the
+    // playable map; loaded and imported parks arrive with the full technical
+    // rectangle materialised.
+    ReorganiseTileElements();
     ResetEntitySpatialIndices();
     ResetAllSpriteQuadrantPlacements();
     ScenerySetDefaultPlacementConfiguration();
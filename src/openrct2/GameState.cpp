@@ -28,9 +28,14 @@
 #include "interface/Screenshot.h"
 #include "localisation/Localisation.Date.h"
 #include "management/NewsItem.h"
+#include "management/Research.h"
 #include "network/network.h"
 #include "platform/Platform.h"
+#include "profiling/AllocationTracker.h"
+#include "profiling/PerfCounters.h"
 #include "profiling/Profiling.h"
+#include "profiling/TickWatchdog.h"
+#include "profiling/Tracing.h"
 #include "ride/Vehicle.h"
 #include "scenario/Scenario.h"
 #include "scenes/title/TitleScene.h"
@@ -44,6 +49,7 @@
 #include "world/Scenery.h"
 
 #include <chrono>
+#include <iterator>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
@@ -110,6 +116,7 @@ namespace OpenRCT2
     void gameStateTick()
     {
         PROFILED_FUNCTION();
+        TRACE_SCOPE("gameStateTick");
 
         // Normal game play will update only once every kGameUpdateTimeMS
         uint32_t numUpdates = 1;
@@ -237,6 +244,180 @@ namespace OpenRCT2
         gDoSingleUpdate = false;
     }
 
+    /**
+     * Logic that runs on a fixed tick cadence rather than every tick. An entry
+     * fires exactly when CurrentTicks reaches its next due tick, which keeps the
+     * cadence identical to the modulo gate it replaces while the per-tick cost is
+     * one comparison per entry. Other periodic work in gameStateUpdateLogic can
+     * adopt this table instead of carrying its own tick mask. Work tied to
+     * calendar boundaries (days, weeks, months) stays on the date checks in
+     * ScenarioUpdate, as those boundaries are not evenly spaced in ticks.
+     */
+    struct ScheduledTickEvent
+    {
+        uint32_t Interval; // Fires whenever CurrentTicks is a multiple of this.
+        void (*Handler)();
+    };
+
+    static constexpr ScheduledTickEvent _scheduledTickEvents[] = {
+        { 32, ResearchUpdate },
+    };
+
+    static uint32_t _scheduledTickEventsDue[std::size(_scheduledTickEvents)];
+    static uint32_t _lastScheduledTick = std::numeric_limits<uint32_t>::max();
+
+    static void gameStateUpdateScheduledTickEvents(uint32_t currentTicks)
+    {
+        if (currentTicks != _lastScheduledTick + 1)
+        {
+            // The tick counter jumped (park load, map change): re-derive each due
+            // tick from the counter so the schedule stays deterministic.
+            for (size_t i = 0; i < std::size(_scheduledTickEvents); i++)
+            {
+                const auto interval = _scheduledTickEvents[i].Interval;
+                _scheduledTickEventsDue[i] = currentTicks + (interval - currentTicks % interval) % interval;
+            }
+        }
+        _lastScheduledTick = currentTicks;
+
+        for (size_t i = 0; i < std::size(_scheduledTickEvents); i++)
+        {
+            if (currentTicks == _scheduledTickEventsDue[i])
+            {
+                _scheduledTickEventsDue[i] += _scheduledTickEvents[i].Interval;
+                _scheduledTickEvents[i].Handler();
+            }
+        }
+    }
+
+    /**
+     * The simulation sweep of the tick, declared as an ordered pipeline of
+     * stages. Each stage is a coherent pass over one family of data; the
+     * comment on each handler documents what it reads and writes so the
+     * dependencies between stages are explicit. The order is part of the
+     * synchronised game state - it fixes the RNG draw order that multiplayer
+     * peers must agree on - so it is declared here at compile time and must
+     * never come from per-machine configuration.
+     */
+    struct TickStage
+    {
+        // The watchdog phase doubles as the stage's identity: it supplies the
+        // exported name and the index under which the stage's timings are
+        // accumulated.
+        TickWatchdog::TickPhase Phase;
+        void (*Handler)();
+    };
+
+    // Advances the calendar. Runs first; every later stage may read the date.
+    static void TickStageDate()
+    {
+        DateUpdate(GetGameState());
+    }
+
+    // Objectives, awards, finances and weather. Reads the calendar, writes
+    // park-wide state and draws from the scenario RNG.
+    static void TickStageScenario()
+    {
+        auto& gameState = GetGameState();
+        ScenarioUpdate(gameState);
+        ClimateUpdate();
+    }
+
+    // Sweeps a rolling window of map tiles (grass growth, fences, water).
+    // Touches tile elements only.
+    static void TickStageMapTiles()
+    {
+        MapUpdateTiles();
+    }
+
+    // Walks every guest and staff member. Provisional (ghost) paths are
+    // removed for the duration so peeps never interact with them, and wide
+    // path flags are refreshed first because pathfinding reads them.
+    static void TickStagePeeps()
+    {
+        MapRemoveProvisionalElements();
+        MapUpdatePathWideFlags();
+        PeepUpdateAll();
+        MapRestoreProvisionalElements();
+    }
+
+    // Moves every vehicle. Reads track elements and ride state, moves
+    // entities (and therefore updates the spatial index as it goes).
+    static void TickStageVehicles()
+    {
+        VehicleUpdateAll();
+    }
+
+    // Litter, ducks, balloons and particles; entity state only.
+    static void TickStageMiscEntities()
+    {
+        UpdateAllMiscEntities();
+    }
+
+    // Per-ride logic: breakdowns, inspections, stations and queues. Reads
+    // guest state written by the peep stage this tick.
+    static void TickStageRides()
+    {
+        Ride::UpdateAll();
+    }
+
+    // Park rating, guest generation and marketing; reads ride and guest
+    // state, so runs after both have been brought up to date.
+    static void TickStagePark()
+    {
+        if (!(gScreenFlags & SCREEN_FLAGS_EDITOR))
+        {
+            auto& gameState = GetGameState();
+            Park::Update(gameState, gameState.Date);
+        }
+    }
+
+    // Fires the fixed-cadence entries of the scheduled event table.
+    static void TickStageScheduled()
+    {
+        gameStateUpdateScheduledTickEvents(GetGameState().CurrentTicks);
+    }
+
+    // Recalculates ratings for one ride per tick.
+    static void TickStageRideRatings()
+    {
+        RideRatingsUpdateAll();
+    }
+
+    // Ride measurement sampling and the news ticker.
+    static void TickStageMeasurements()
+    {
+        RideMeasurementsUpdate();
+        News::UpdateCurrentItem();
+    }
+
+    // Presentation sweeps: animation invalidation and audio. These read
+    // simulation state but never write synchronised state, so they always
+    // stay at the tail of the pipeline.
+    static void TickStageAmbience()
+    {
+        MapAnimationInvalidateAll();
+        VehicleSoundsUpdate();
+        PeepUpdateCrowdNoise();
+        ClimateUpdateSound();
+        EditorOpenWindowsForCurrentStep();
+    }
+
+    static constexpr TickStage kTickStages[] = {
+        { TickWatchdog::TickPhase::Date, TickStageDate },
+        { TickWatchdog::TickPhase::Scenario, TickStageScenario },
+        { TickWatchdog::TickPhase::MapTiles, TickStageMapTiles },
+        { TickWatchdog::TickPhase::Peeps, TickStagePeeps },
+        { TickWatchdog::TickPhase::Vehicles, TickStageVehicles },
+        { TickWatchdog::TickPhase::MiscEntities, TickStageMiscEntities },
+        { TickWatchdog::TickPhase::Rides, TickStageRides },
+        { TickWatchdog::TickPhase::Park, TickStagePark },
+        { TickWatchdog::TickPhase::Scheduled, TickStageScheduled },
+        { TickWatchdog::TickPhase::RideRatings, TickStageRideRatings },
+        { TickWatchdog::TickPhase::Measurements, TickStageMeasurements },
+        { TickWatchdog::TickPhase::Ambience, TickStageAmbience },
+    };
+
     static void gameStateCreateStateSnapshot()
     {
         PROFILED_FUNCTION();
@@ -251,6 +432,8 @@ namespace OpenRCT2
     void gameStateUpdateLogic()
     {
         PROFILED_FUNCTION();
+        TRACE_SCOPE("gameStateUpdateLogic");
+        AllocationTracker::TagScope allocScope(AllocationTracker::AllocTag::Simulation);
 
         gInUpdateCode = true;
 
@@ -260,39 +443,44 @@ namespace OpenRCT2
 
         GetContext()->GetReplayManager()->Update();
 
-        NetworkUpdate();
-
-        if (NetworkGetMode() == NETWORK_MODE_SERVER)
+        TickWatchdog::TickBegin();
         {
-            if (NetworkGamestateSnapshotsEnabled())
-            {
-                gameStateCreateStateSnapshot();
-            }
+            TickWatchdog::PhaseScope watchdogScope(TickWatchdog::TickPhase::Network);
 
-            // Send current tick out.
-            NetworkSendTick();
-        }
-        else if (NetworkGetMode() == NETWORK_MODE_CLIENT)
-        {
-            // Don't run past the server, this condition can happen during map changes.
-            if (NetworkGetServerTick() == GetGameState().CurrentTicks)
-            {
-                gInUpdateCode = false;
-                return;
-            }
+            NetworkUpdate();
 
-            // Check desync.
-            bool desynced = NetworkCheckDesynchronisation();
-            if (desynced)
+            if (NetworkGetMode() == NETWORK_MODE_SERVER)
             {
-                // If desync debugging is enabled and we are still connected request the specific game state from server.
-                if (NetworkGamestateSnapshotsEnabled() && NetworkGetStatus() == NETWORK_STATUS_CONNECTED)
+                if (NetworkGamestateSnapshotsEnabled())
                 {
-                    // Create snapshot from this tick so we can compare it later
-                    // as we won't pause the game on this event.
                     gameStateCreateStateSnapshot();
+                }
 
-                    NetworkRequestGamestateSnapshot();
+                // Send current tick out.
+                NetworkSendTick();
+            }
+            else if (NetworkGetMode() == NETWORK_MODE_CLIENT)
+            {
+                // Don't run past the server, this condition can happen during map changes.
+                if (NetworkGetServerTick() == GetGameState().CurrentTicks)
+                {
+                    gInUpdateCode = false;
+                    return;
+                }
+
+                // Check desync.
+                bool desynced = NetworkCheckDesynchronisation();
+                if (desynced)
+                {
+                    // If desync debugging is enabled and we are still connected request the specific game state from server.
+                    if (NetworkGamestateSnapshotsEnabled() && NetworkGetStatus() == NETWORK_STATUS_CONNECTED)
+                    {
+                        // Create snapshot from this tick so we can compare it later
+                        // as we won't pause the game on this event.
+                        gameStateCreateStateSnapshot();
+
+                        NetworkRequestGamestateSnapshot();
+                    }
                 }
             }
         }
@@ -304,36 +492,18 @@ namespace OpenRCT2
         auto day = gameState.Date.GetDay();
 #endif
 
-        DateUpdate(gameState);
-
-        ScenarioUpdate(gameState);
-        ClimateUpdate();
-        MapUpdateTiles();
-        // Temporarily remove provisional paths to prevent peep from interacting with them
-        MapRemoveProvisionalElements();
-        MapUpdatePathWideFlags();
-        PeepUpdateAll();
-        MapRestoreProvisionalElements();
-        VehicleUpdateAll();
-        UpdateAllMiscEntities();
-        Ride::UpdateAll();
-
-        if (!(gScreenFlags & SCREEN_FLAGS_EDITOR))
+        for (const auto& stage : kTickStages)
         {
-            Park::Update(gameState, gameState.Date);
+            const auto* stageName = TickWatchdog::TickPhaseName(stage.Phase);
+            TRACE_SCOPE(stageName);
+            TickWatchdog::PhaseScope watchdogScope(stage.Phase);
+            const auto stageStart = std::chrono::steady_clock::now();
+            stage.Handler();
+            PerfCounters::RecordTickStageTime(
+                static_cast<size_t>(stage.Phase), stageName,
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - stageStart).count());
         }
 
-        ResearchUpdate();
-        RideRatingsUpdateAll();
-        RideMeasurementsUpdate();
-        News::UpdateCurrentItem();
-
-        MapAnimationInvalidateAll();
-        VehicleSoundsUpdate();
-        PeepUpdateCrowdNoise();
-        ClimateUpdateSound();
-        EditorOpenWindowsForCurrentStep();
-
         // Update windows
         // WindowDispatchUpdateAll();
 
@@ -343,23 +513,32 @@ namespace OpenRCT2
             gLastAutoSaveUpdate = Platform::GetTicks();
         }
 
-        GameActions::ProcessQueue();
+        {
+            TickWatchdog::PhaseScope watchdogScope(TickWatchdog::TickPhase::GameActions);
+            GameActions::ProcessQueue();
+        }
 
         NetworkProcessPending();
         NetworkFlush();
 
         gameState.CurrentTicks++;
+        PerfCounters::GameTicks.fetch_add(1, std::memory_order_relaxed);
 
 #ifdef ENABLE_SCRIPTING
-        auto& hookEngine = GetContext()->GetScriptEngine().GetHookEngine();
-        hookEngine.Call(HOOK_TYPE::INTERVAL_TICK, true);
-
-        if (day != gameState.Date.GetDay())
         {
-            hookEngine.Call(HOOK_TYPE::INTERVAL_DAY, true);
+            TickWatchdog::PhaseScope watchdogScope(TickWatchdog::TickPhase::ScriptHooks);
+            auto& hookEngine = GetContext()->GetScriptEngine().GetHookEngine();
+            hookEngine.Call(HOOK_TYPE::INTERVAL_TICK, true);
+
+            if (day != gameState.Date.GetDay())
+            {
+                hookEngine.Call(HOOK_TYPE::INTERVAL_DAY, true);
+            }
         }
 #endif
 
+        TickWatchdog::TickEnd();
+
         gInUpdateCode = false;
     }
 } // namespace OpenRCT2
@@ -90,7 +90,7 @@ namespace OpenRCT2
         std::string ScenarioCompletedBy;
 
         std::vector<Banner> Banners;
-        Entity_t Entities[MAX_ENTITIES]{};
+        EntityStorage Entities;
         // Ride storage for all the rides in the park, rides with RideId::Null are considered free.
         std::array<Ride, OpenRCT2::Limits::kMaxRidesInPark> Rides{};
         ::RideRatingUpdateStates RideRatingUpdateStates;
@@ -149,6 +149,15 @@ namespace OpenRCT2
         CheatsState Cheats;
     };
 
+    /**
+     * The process-wide game state. The codebase assumes a single instance:
+     * free functions reach it through this accessor rather than taking a
+     * GameState_t&, and further state lives in statics beside the systems
+     * that own it (entity lists, spatial index, pathfinding caches, the
+     * scripting engine). Hosting several parks in one process would require
+     * threading GameState_t through all of those first; prefer passing
+     * gameState down explicitly in new code so that distance shrinks.
+     */
     GameState_t& GetGameState();
 
     void gameStateInitAll(GameState_t& gameState, const TileCoordsXY& mapSize);
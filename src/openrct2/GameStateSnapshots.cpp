@@ -23,6 +23,10 @@
 #include "entity/Staff.h"
 #include "ride/Vehicle.h"
 
+#include <cstring>
+#include <memory>
+#include <vector>
+
 static constexpr size_t MaximumGameStateSnapshots = 32;
 static constexpr uint32_t InvalidTick = 0xFFFFFFFF;
 
@@ -39,12 +43,18 @@ union EntitySnapshot
 static_assert(sizeof(EntitySnapshot) == 0x200);
 #pragma pack(pop)
 
+// Serialised bytes of a single entity, shared between snapshots for as long
+// as the entity does not change so unchanged entities cost no extra memory.
+using EntityBlob = std::shared_ptr<const std::vector<uint8_t>>;
+using EntityBlobList = std::vector<std::pair<uint32_t, EntityBlob>>;
+
 struct GameStateSnapshot_t
 {
     GameStateSnapshot_t& operator=(GameStateSnapshot_t&& mv) noexcept
     {
         tick = mv.tick;
         storedSprites = std::move(mv.storedSprites);
+        capturedBlobs = std::move(mv.capturedBlobs);
         return *this;
     }
 
@@ -54,6 +64,10 @@ struct GameStateSnapshot_t
     OpenRCT2::MemoryStream storedSprites;
     OpenRCT2::MemoryStream parkParameters;
 
+    // Per entity index, the bytes captured for it. Only populated for locally
+    // captured snapshots; received snapshots carry storedSprites directly.
+    EntityBlobList capturedBlobs;
+
     template<typename T> bool EntitySizeCheck(DataSerialiser& ds)
     {
         uint32_t size = sizeof(T);
@@ -69,30 +83,120 @@ struct GameStateSnapshot_t
         return (EntitySizeCheck<T>(ds) && ...);
     }
 
-    // Must pass a function that can access the sprite.
-    void SerialiseSprites(std::function<EntitySnapshot*(const EntityId)> getEntity, const size_t numSprites, bool saving)
+    static void SerialiseEntityData(DataSerialiser& ds, EntitySnapshot& sprite)
     {
-        const bool loading = !saving;
-
-        storedSprites.SetPosition(0);
-        DataSerialiser ds(saving, storedSprites);
+        ds << sprite.base.Type;
 
-        std::vector<uint32_t> indexTable;
-        indexTable.reserve(numSprites);
+        switch (sprite.base.Type)
+        {
+            case EntityType::Vehicle:
+                reinterpret_cast<Vehicle&>(sprite).Serialise(ds);
+                break;
+            case EntityType::Guest:
+                reinterpret_cast<Guest&>(sprite).Serialise(ds);
+                break;
+            case EntityType::Staff:
+                reinterpret_cast<Staff&>(sprite).Serialise(ds);
+                break;
+            case EntityType::Litter:
+                reinterpret_cast<Litter&>(sprite).Serialise(ds);
+                break;
+            case EntityType::MoneyEffect:
+                reinterpret_cast<MoneyEffect&>(sprite).Serialise(ds);
+                break;
+            case EntityType::Balloon:
+                reinterpret_cast<Balloon&>(sprite).Serialise(ds);
+                break;
+            case EntityType::Duck:
+                reinterpret_cast<Duck&>(sprite).Serialise(ds);
+                break;
+            case EntityType::JumpingFountain:
+                reinterpret_cast<JumpingFountain&>(sprite).Serialise(ds);
+                break;
+            case EntityType::SteamParticle:
+                reinterpret_cast<SteamParticle&>(sprite).Serialise(ds);
+                break;
+            case EntityType::Null:
+                break;
+            default:
+                break;
+        }
+    }
 
-        uint32_t numSavedSprites = 0;
+    /**
+     * Serialises each live entity and shares the bytes of entities that did
+     * not change since the previous capture, so repeated snapshots only cost
+     * memory for what actually moved. Every snapshot stays independently
+     * readable regardless of which older snapshots have been evicted.
+     */
+    void CaptureSprites(
+        std::function<EntitySnapshot*(const EntityId)> getEntity, const size_t numSprites, const EntityBlobList& previousBlobs)
+    {
+        capturedBlobs.clear();
 
-        if (saving)
+        OpenRCT2::MemoryStream scratch;
+        size_t prevPos = 0;
+        for (EntityId::UnderlyingType i = 0; i < numSprites; i++)
         {
-            for (EntityId::UnderlyingType i = 0; i < numSprites; i++)
+            auto* entity = getEntity(EntityId::FromUnderlying(i));
+            if (entity == nullptr || entity->base.Type == EntityType::Null)
+                continue;
+
+            scratch.SetPosition(0);
+            DataSerialiser ds(true, scratch);
+            SerialiseEntityData(ds, *entity);
+
+            const auto* data = static_cast<const uint8_t*>(scratch.GetData());
+            const auto size = static_cast<size_t>(scratch.GetPosition());
+
+            while (prevPos < previousBlobs.size() && previousBlobs[prevPos].first < i)
+            {
+                prevPos++;
+            }
+
+            if (prevPos < previousBlobs.size() && previousBlobs[prevPos].first == i
+                && previousBlobs[prevPos].second->size() == size
+                && std::memcmp(previousBlobs[prevPos].second->data(), data, size) == 0)
             {
-                auto entity = getEntity(EntityId::FromUnderlying(i));
-                if (entity == nullptr || entity->base.Type == EntityType::Null)
-                    continue;
-                indexTable.push_back(static_cast<uint32_t>(i));
+                capturedBlobs.emplace_back(i, previousBlobs[prevPos].second);
             }
-            numSavedSprites = static_cast<uint32_t>(indexTable.size());
+            else
+            {
+                capturedBlobs.emplace_back(i, std::make_shared<const std::vector<uint8_t>>(data, data + size));
+            }
+        }
+    }
+
+    // Builds the flat sprite stream from the captured blobs the first time
+    // the snapshot is compared or sent to a peer.
+    void EnsureStoredSprites()
+    {
+        if (storedSprites.GetLength() != 0)
+            return;
+
+        storedSprites.SetPosition(0);
+        DataSerialiser ds(true, storedSprites);
+
+        // Encodes and checks the size of each of the entity so that we
+        // can fail gracefully when fields added/removed
+        EntitiesSizeCheck<Vehicle, Guest, Staff, Litter, MoneyEffect, Balloon, Duck, JumpingFountain, SteamParticle>(ds);
+
+        uint32_t numSavedSprites = static_cast<uint32_t>(capturedBlobs.size());
+        ds << numSavedSprites;
+
+        for (auto& [index, blob] : capturedBlobs)
+        {
+            uint32_t spriteIndex = index;
+            ds << spriteIndex;
+            storedSprites.Write(blob->data(), blob->size());
         }
+    }
+
+    // Must pass a function that can access the sprite.
+    void LoadSprites(std::function<EntitySnapshot*(const EntityId)> getEntity, const size_t numSprites)
+    {
+        storedSprites.SetPosition(0);
+        DataSerialiser ds(false, storedSprites);
 
         // Encodes and checks the size of each of the entity so that we
         // can fail gracefully when fields added/removed
@@ -101,62 +205,24 @@ struct GameStateSnapshot_t
             LOG_ERROR("Entity index corrupted!");
             return;
         }
-        ds << numSavedSprites;
 
-        if (loading)
-        {
-            indexTable.resize(numSavedSprites);
-        }
+        uint32_t numSavedSprites = 0;
+        ds << numSavedSprites;
 
         for (uint32_t i = 0; i < numSavedSprites; i++)
         {
-            ds << indexTable[i];
+            uint32_t spriteIndex = 0;
+            ds << spriteIndex;
 
-            const EntityId spriteIdx = EntityId::FromUnderlying(indexTable[i]);
+            const EntityId spriteIdx = EntityId::FromUnderlying(spriteIndex);
             EntitySnapshot* entity = getEntity(spriteIdx);
             if (entity == nullptr)
             {
                 LOG_ERROR("Entity index corrupted!");
                 return;
             }
-            auto& sprite = *entity;
-
-            ds << sprite.base.Type;
 
-            switch (sprite.base.Type)
-            {
-                case EntityType::Vehicle:
-                    reinterpret_cast<Vehicle&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Guest:
-                    reinterpret_cast<Guest&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Staff:
-                    reinterpret_cast<Staff&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Litter:
-                    reinterpret_cast<Litter&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::MoneyEffect:
-                    reinterpret_cast<MoneyEffect&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Balloon:
-                    reinterpret_cast<Balloon&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Duck:
-                    reinterpret_cast<Duck&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::JumpingFountain:
-                    reinterpret_cast<JumpingFountain&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::SteamParticle:
-                    reinterpret_cast<SteamParticle&>(sprite).Serialise(ds);
-                    break;
-                case EntityType::Null:
-                    break;
-                default:
-                    break;
-            }
+            SerialiseEntityData(ds, *entity);
         }
     }
 };
@@ -166,6 +232,7 @@ struct GameStateSnapshots final : public IGameStateSnapshots
     virtual void Reset() override final
     {
         _snapshots.clear();
+        _lastBlobs.clear();
     }
 
     virtual GameStateSnapshot_t& CreateSnapshot() override final
@@ -184,8 +251,10 @@ struct GameStateSnapshots final : public IGameStateSnapshots
 
     virtual void Capture(GameStateSnapshot_t& snapshot) override final
     {
-        snapshot.SerialiseSprites(
-            [](const EntityId index) { return reinterpret_cast<EntitySnapshot*>(GetEntity(index)); }, MAX_ENTITIES, true);
+        snapshot.CaptureSprites(
+            [](const EntityId index) { return reinterpret_cast<EntitySnapshot*>(GetEntity(index)); }, MAX_ENTITIES,
+            _lastBlobs);
+        _lastBlobs = snapshot.capturedBlobs;
 
         // LOG_INFO("Snapshot size: %u bytes", static_cast<uint32_t>(snapshot.storedSprites.GetLength()));
     }
@@ -202,6 +271,10 @@ struct GameStateSnapshots final : public IGameStateSnapshots
 
     virtual void SerialiseSnapshot(GameStateSnapshot_t& snapshot, DataSerialiser& ds) const override final
     {
+        if (ds.IsSaving())
+        {
+            snapshot.EnsureStoredSprites();
+        }
         ds << snapshot.tick;
         ds << snapshot.srand0;
         ds << snapshot.storedSprites;
@@ -219,8 +292,8 @@ struct GameStateSnapshots final : public IGameStateSnapshots
             sprite.base.Type = EntityType::Null;
         }
 
-        snapshot.SerialiseSprites(
-            [&spriteList](const EntityId index) { return &spriteList[index.ToUnderlying()]; }, MAX_ENTITIES, false);
+        snapshot.EnsureStoredSprites();
+        snapshot.LoadSprites([&spriteList](const EntityId index) { return &spriteList[index.ToUnderlying()]; }, MAX_ENTITIES);
 
         return spriteList;
     }
@@ -788,6 +861,9 @@ struct GameStateSnapshots final : public IGameStateSnapshots
 
 private:
     CircularBuffer<std::unique_ptr<GameStateSnapshot_t>, MaximumGameStateSnapshots> _snapshots;
+    // Blobs of the most recent capture, used as the baseline the next capture
+    // shares unchanged entity bytes with.
+    EntityBlobList _lastBlobs;
 };
 
 std::unique_ptr<IGameStateSnapshots> CreateGameStateSnapshots()
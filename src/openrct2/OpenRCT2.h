@@ -49,6 +49,12 @@ extern bool gOpenRCT2ShowChangelog;
 extern bool gOpenRCT2SilentBreakpad;
 extern u8string gSilentRecordingName;
 
+// Viewport to centre the main window on after the first park load, as
+// "x,y[,zoom]" in tile coordinates. Render followers of a multi-process video
+// wall each join the host with a different view so that together they cover
+// one wide composite viewport; empty keeps the park's saved view.
+extern u8string gOpenRCT2StartupView;
+
 #ifndef DISABLE_NETWORK
 extern int32_t gNetworkStart;
 extern std::string gNetworkStartHost;
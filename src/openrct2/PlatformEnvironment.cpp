@@ -68,6 +68,7 @@ static constexpr u8string_view FileNames[] = {
     u8"objects.idx",                             // CACHE_OBJECTS
     u8"tracks.idx",                              // CACHE_TRACKS
     u8"scenarios.idx",                           // CACHE_SCENARIOS
+    u8"assetpacks.idx",                          // CACHE_ASSET_PACKS
     u8"groups.json",                             // NETWORK_GROUPS
     u8"servers.cfg",                             // NETWORK_SERVERS
     u8"users.json",                              // NETWORK_USERS
@@ -188,6 +189,7 @@ private:
             case PATHID::CACHE_OBJECTS:
             case PATHID::CACHE_TRACKS:
             case PATHID::CACHE_SCENARIOS:
+            case PATHID::CACHE_ASSET_PACKS:
                 return DIRBASE::CACHE;
             case PATHID::SCORES_RCT2:
                 return DIRBASE::RCT2;
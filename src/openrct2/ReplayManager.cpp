@@ -97,15 +97,22 @@ namespace OpenRCT2
         std::vector<std::pair<uint32_t, EntitiesChecksum>> checksums;
         uint32_t checksumIndex;
         OpenRCT2::MemoryStream gameStateSnapshots;
+        // Periodic park keyframes (tick, exported park) recorded in tick
+        // order, so playback can start near a target tick instead of
+        // simulating from the beginning.
+        std::vector<std::pair<uint32_t, OpenRCT2::MemoryStream>> keyframes;
     };
 
     class ReplayManager final : public IReplayManager
     {
-        static constexpr uint16_t ReplayVersion = 10;
+        static constexpr uint16_t ReplayVersion = 11;
         static constexpr uint32_t ReplayMagic = 0x5243524F; // ORCR.
         static constexpr int ReplayCompressionLevel = 9;
         static constexpr int NormalRecordingChecksumTicks = 1;
         static constexpr int SilentRecordingChecksumTicks = 40; // Same as network server
+        // Trade-off between replay size and how close to a target tick
+        // playback can start.
+        static constexpr uint32_t KeyframeIntervalTicks = 5000;
 
         enum class ReplayMode
         {
@@ -173,6 +180,14 @@ namespace OpenRCT2
 
             if (_mode == ReplayMode::RECORDING)
             {
+                // Silent recordings run during normal play, so they skip the
+                // periodic export cost and stay seek-from-start only.
+                if (_recordType == RecordType::NORMAL && currentTicks == _nextKeyframeTick)
+                {
+                    RecordKeyframe(currentTicks);
+                    _nextKeyframeTick = currentTicks + KeyframeIntervalTicks;
+                }
+
                 if (currentTicks >= _currentRecording->tickEnd)
                 {
                     StopRecording();
@@ -212,6 +227,14 @@ namespace OpenRCT2
             }
         }
 
+        void RecordKeyframe(uint32_t tick)
+        {
+            auto& keyframe = _currentRecording->keyframes.emplace_back(tick, MemoryStream());
+            auto exporter = std::make_unique<ParkFileExporter>();
+            exporter->FastCompression = true;
+            exporter->Export(GetGameState(), keyframe.second);
+        }
+
         void TakeGameStateSnapshot(MemoryStream& snapshotStream)
         {
             IGameStateSnapshots* snapshots = GetContext()->GetGameStateSnapshots();
@@ -274,6 +297,7 @@ namespace OpenRCT2
             _currentRecording = std::move(replayData);
             _recordType = rt;
             _nextChecksumTick = currentTicks + 1;
+            _nextKeyframeTick = currentTicks + KeyframeIntervalTicks;
 
             return true;
         }
@@ -425,7 +449,7 @@ namespace OpenRCT2
             }
         }
 
-        virtual bool StartPlayback(const std::string& file) override
+        virtual bool StartPlayback(const std::string& file, uint32_t targetTick) override
         {
             if (_mode != ReplayMode::NONE && _mode != ReplayMode::NORMALISATION)
                 return false;
@@ -438,18 +462,52 @@ namespace OpenRCT2
                 return false;
             }
 
-            if (!LoadReplayDataMap(*replayData))
+            // When a target tick is given, start from the last keyframe at or
+            // before it rather than from the beginning of the replay.
+            MemoryStream* startData = &replayData->parkData;
+            uint32_t startTick = replayData->tickStart;
+            if (targetTick > replayData->tickStart)
+            {
+                for (auto& keyframe : replayData->keyframes)
+                {
+                    if (keyframe.first > targetTick)
+                        break;
+                    startData = &keyframe.second;
+                    startTick = keyframe.first;
+                }
+            }
+
+            if (!LoadReplayDataMap(*replayData, *startData))
             {
                 LOG_ERROR("Unable to load map.");
                 return false;
             }
 
-            GetGameState().CurrentTicks = replayData->tickStart;
+            GetGameState().CurrentTicks = startTick;
+
+            if (startTick == replayData->tickStart)
+            {
+                // The recorded snapshot only matches the state at the very
+                // start of the replay.
+                LoadAndCompareSnapshot(replayData->gameStateSnapshots);
+            }
+            else
+            {
+                LOG_VERBOSE("Replay resumed from keyframe at tick %u", startTick);
 
-            LoadAndCompareSnapshot(replayData->gameStateSnapshots);
+                // Commands and checksums before the keyframe have already
+                // been applied to its state.
+                auto& commands = replayData->commands;
+                commands.erase(commands.begin(), commands.lower_bound(ReplayCommand(startTick, nullptr, 0)));
+            }
 
             _currentReplay = std::move(replayData);
             _currentReplay->checksumIndex = 0;
+            while (_currentReplay->checksumIndex < _currentReplay->checksums.size()
+                   && _currentReplay->checksums[_currentReplay->checksumIndex].first < startTick)
+            {
+                _currentReplay->checksumIndex++;
+            }
             _faultyChecksumIndex = -1;
 
             // Make sure game is not paused.
@@ -495,7 +553,7 @@ namespace OpenRCT2
         {
             _mode = ReplayMode::NORMALISATION;
 
-            if (!StartPlayback(file))
+            if (!StartPlayback(file, 0))
             {
                 return false;
             }
@@ -524,17 +582,17 @@ namespace OpenRCT2
             }
         }
 
-        bool LoadReplayDataMap(ReplayRecordData& data)
+        bool LoadReplayDataMap(ReplayRecordData& data, MemoryStream& parkData)
         {
             try
             {
-                data.parkData.SetPosition(0);
+                parkData.SetPosition(0);
 
                 auto context = GetContext();
                 auto& objManager = context->GetObjectManager();
                 auto importer = ParkImporter::CreateParkFile(context->GetObjectRepository());
 
-                auto loadResult = importer->LoadFromStream(&data.parkData, false);
+                auto loadResult = importer->LoadFromStream(&parkData, false);
                 objManager.LoadObjects(loadResult.RequiredObjects);
 
                 // TODO: Have a separate GameState and exchange once loaded.
@@ -719,7 +777,8 @@ namespace OpenRCT2
 
         bool Compatible(ReplayRecordData& data)
         {
-            return data.version == ReplayVersion;
+            // Version 10 is identical apart from the missing keyframes.
+            return data.version == 10 || data.version == ReplayVersion;
         }
 
         bool Serialise(DataSerialiser& serialiser, ReplayRecordData& data)
@@ -792,6 +851,24 @@ namespace OpenRCT2
             }
 
             serialiser << data.gameStateSnapshots;
+
+            if (data.version >= 11)
+            {
+                uint32_t countKeyframes = static_cast<uint32_t>(data.keyframes.size());
+                serialiser << countKeyframes;
+
+                if (serialiser.IsLoading())
+                {
+                    data.keyframes.resize(countKeyframes);
+                }
+
+                for (uint32_t i = 0; i < countKeyframes; i++)
+                {
+                    serialiser << data.keyframes[i].first;
+                    serialiser << data.keyframes[i].second;
+                }
+            }
+
             return true;
         }
 
@@ -888,6 +965,7 @@ namespace OpenRCT2
         int32_t _faultyChecksumIndex = -1;
         uint32_t _commandId = 0;
         uint32_t _nextChecksumTick = 0;
+        uint32_t _nextKeyframeTick = 0;
         uint32_t _nextReplayTick = 0;
         RecordType _recordType = RecordType::NORMAL;
     };
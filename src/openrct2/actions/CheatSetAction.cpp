@@ -616,10 +616,7 @@ void CheatSetAction::ClearLoan() const
 
 void CheatSetAction::GenerateGuests(int32_t count) const
 {
-    for (int32_t i = 0; i < count; i++)
-    {
-        Park::GenerateGuest();
-    }
+    Park::GenerateGuests(count);
     WindowInvalidateByClass(WindowClass::BottomToolbar);
 }
 
@@ -116,8 +116,27 @@ GameActions::Result ClearAction::QueryExecute(bool executing) const
     return result;
 }
 
+static uint16_t GetClearableTypeMask(ClearableItems itemsToClear)
+{
+    uint16_t typeMask = 0;
+    if (itemsToClear & CLEARABLE_ITEMS::SCENERY_FOOTPATH)
+        typeMask |= 1u << static_cast<uint8_t>(TileElementType::Path);
+    if (itemsToClear & CLEARABLE_ITEMS::SCENERY_SMALL)
+        typeMask |= (1u << static_cast<uint8_t>(TileElementType::SmallScenery))
+            | (1u << static_cast<uint8_t>(TileElementType::Wall));
+    if (itemsToClear & CLEARABLE_ITEMS::SCENERY_LARGE)
+        typeMask |= 1u << static_cast<uint8_t>(TileElementType::LargeScenery);
+    return typeMask;
+}
+
 money64 ClearAction::ClearSceneryFromTile(const CoordsXY& tilePos, bool executing) const
 {
+    // The occupancy summary partitions each tile by element type, so tiles
+    // holding none of the requested scenery types are rejected without walking
+    // their element lists or constructing remove actions.
+    if ((MapGetTileOccupancy(TileCoordsXY(tilePos)).TypeMask & GetClearableTypeMask(_itemsToClear)) == 0)
+        return 0;
+
     // Pass down all flags.
     TileElement* tileElement = nullptr;
     money64 totalCost = 0;
@@ -216,11 +235,12 @@ money64 ClearAction::ClearSceneryFromTile(const CoordsXY& tilePos, bool executin
 void ClearAction::ResetClearLargeSceneryFlag()
 {
     auto& gameState = OpenRCT2::GetGameState();
-    // TODO: Improve efficiency of this
     for (int32_t y = 0; y < gameState.MapSize.y; y++)
     {
         for (int32_t x = 0; x < gameState.MapSize.x; x++)
         {
+            if (!MapGetTileOccupancy(TileCoordsXY{ x, y }).HasType(TileElementType::LargeScenery))
+                continue;
             auto tileElement = MapGetFirstElementAt(TileCoordsXY{ x, y });
             do
             {
@@ -65,6 +65,12 @@ namespace GameActions
     static std::multiset<QueuedGameAction> _actionQueue;
     static uint32_t _nextUniqueId = 0;
     static bool _suspended = false;
+    static uint64_t _executedCount = 0;
+
+    uint64_t GetExecutedCount()
+    {
+        return _executedCount;
+    }
 
     void SuspendQueue()
     {
@@ -160,6 +166,22 @@ namespace GameActions
         _actionQueue.clear();
     }
 
+    size_t GetQueueDepth()
+    {
+        return _actionQueue.size();
+    }
+
+    std::vector<QueuedActionInfo> GetQueueInfo()
+    {
+        std::vector<QueuedActionInfo> result;
+        result.reserve(_actionQueue.size());
+        for (const auto& queued : _actionQueue)
+        {
+            result.push_back({ queued.tick, queued.uniqueId, queued.action->GetName() });
+        }
+        return result;
+    }
+
     GameAction::Ptr Clone(const GameAction* action)
     {
         std::unique_ptr<GameAction> ga = GameActions::Create(action->GetType());
@@ -357,6 +379,10 @@ namespace GameActions
 
             // Execute the action, changing the game state
             result = action->Execute();
+            if (result.Error == GameActions::Status::Ok)
+            {
+                _executedCount++;
+            }
 #ifdef ENABLE_SCRIPTING
             if (result.Error == GameActions::Status::Ok)
             {
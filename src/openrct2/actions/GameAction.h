@@ -19,6 +19,7 @@
 #include <functional>
 #include <memory>
 #include <utility>
+#include <vector>
 
 namespace GameActions
 {
@@ -282,6 +283,25 @@ namespace GameActions
     void ProcessQueue();
     void ClearQueue();
 
+    // Number of actions currently waiting for their execution tick.
+    size_t GetQueueDepth();
+
+    // Number of actions that have successfully executed and modified the game
+    // state. Lets callers detect mutations that happen without the tick
+    // advancing, e.g. actions allowed while the game is paused.
+    uint64_t GetExecutedCount();
+
+    // Lightweight view of a queued action for diagnostics.
+    struct QueuedActionInfo
+    {
+        uint32_t tick;
+        uint32_t uniqueId;
+        const char* name;
+    };
+
+    // Snapshot of the actions currently waiting for their execution tick.
+    std::vector<QueuedActionInfo> GetQueueInfo();
+
     GameAction::Ptr Create(GameCommand id);
     GameAction::Ptr Clone(const GameAction* action);
 
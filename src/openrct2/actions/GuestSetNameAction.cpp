@@ -97,6 +97,7 @@ GameActions::Result GuestSetNameAction::Execute() const
     GfxInvalidateScreen();
 
     auto intent = Intent(INTENT_ACTION_REFRESH_GUEST_LIST);
+    intent.PutExtra(INTENT_EXTRA_PEEP_ID, guest->Id);
     ContextBroadcastIntent(&intent);
 
     auto res = GameActions::Result();
@@ -21,6 +21,7 @@
 #include "../ride/RideConstruction.h"
 #include "../ride/RideData.h"
 #include "../windows/Intent.h"
+#include "../world/Map.h"
 #include "../world/Park.h"
 #include "../world/Scenery.h"
 #include "../world/Surface.h"
@@ -68,6 +69,9 @@ GameActions::Result LandRaiseAction::QueryExecute(bool isExecuting) const
     auto res = GameActions::Result();
     size_t tableRow = _selectionType;
 
+    // Coalesce the per-tile invalidations raised by the nested height changes.
+    MapInvalidationBatch invalidationBatch;
+
     // The selections between MAP_SELECT_TYPE_FULL and MAP_SELECT_TYPE_EDGE_0 are not included in the tables
     if (_selectionType >= MAP_SELECT_TYPE_EDGE_0 && _selectionType <= MAP_SELECT_TYPE_EDGE_3)
         tableRow -= MAP_SELECT_TYPE_EDGE_0 - MAP_SELECT_TYPE_FULL - 1;
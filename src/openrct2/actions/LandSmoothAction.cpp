@@ -21,6 +21,7 @@
 #include "../management/Finance.h"
 #include "../ride/RideData.h"
 #include "../windows/Intent.h"
+#include "../world/Map.h"
 #include "../world/Park.h"
 #include "../world/Scenery.h"
 #include "../world/Surface.h"
@@ -333,6 +334,9 @@ GameActions::Result LandSmoothAction::SmoothLand(bool isExecuting) const
     const int32_t selectionType = _selectionType;
     const int32_t heightOffset = raiseLand ? 2 : -2;
 
+    // Coalesce the per-tile invalidations raised by the nested height changes.
+    MapInvalidationBatch invalidationBatch;
+
     auto normRange = _range.Normalise();
     // Cap bounds to map
     auto l = std::max(normRange.GetLeft(), 32);
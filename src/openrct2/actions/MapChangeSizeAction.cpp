@@ -15,8 +15,11 @@
 #include "../ui/UiContext.h"
 #include "../ui/WindowManager.h"
 #include "../windows/Intent.h"
+#include "../world/Map.h"
 #include "../world/Park.h"
 
+#include <algorithm>
+
 MapChangeSizeAction::MapChangeSizeAction(const TileCoordsXY& targetSize)
     : MapChangeSizeAction(targetSize, TileCoordsXY())
 {
@@ -58,7 +61,19 @@ GameActions::Result MapChangeSizeAction::Query() const
 GameActions::Result MapChangeSizeAction::Execute() const
 {
     auto& gameState = OpenRCT2::GetGameState();
+
     // Expand map
+    if (_targetSize.x > gameState.MapSize.x || _targetSize.y > gameState.MapSize.y)
+    {
+        // Tiles outside the playable map share the canonical empty element
+        // and must not be written through; give everything the map will grow
+        // over its own elements before the boundary surfaces are copied
+        // outwards.
+        const auto oldSize = gameState.MapSize;
+        gameState.MapSize = { std::max(_targetSize.x, oldSize.x), std::max(_targetSize.y, oldSize.y) };
+        ReorganiseTileElements();
+        gameState.MapSize = oldSize;
+    }
     while (_targetSize.x > gameState.MapSize.x)
     {
         gameState.MapSize.x++;
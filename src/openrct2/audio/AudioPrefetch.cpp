@@ -0,0 +1,140 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "AudioPrefetch.h"
+
+#include "../core/ConcurrentQueue.hpp"
+#include "../object/AudioSampleTable.h"
+#include "AudioSource.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace OpenRCT2::Audio
+{
+    namespace
+    {
+        struct ReadySample
+        {
+            AudioSampleTable* Table{};
+            uint32_t Index{};
+            IAudioSource* Source{};
+        };
+
+        constexpr auto kWorkerIdleTimeout = std::chrono::seconds(30);
+
+        std::mutex _mutex;
+        std::condition_variable _condPending;
+        std::condition_variable _condIdle;
+        std::deque<ReadySample> _requests;
+        const AudioSampleTable* _inFlight{};
+        bool _workerRunning{};
+
+        // Worker to main thread handoff: one producer, one consumer, drained
+        // every frame, so decoded sources never block either side.
+        SPSCQueue<ReadySample, 64> _ready;
+
+        void WorkerMain()
+        {
+            std::unique_lock lock(_mutex);
+            while (true)
+            {
+                if (_requests.empty())
+                {
+                    auto hasWork = _condPending.wait_for(lock, kWorkerIdleTimeout, []() { return !_requests.empty(); });
+                    if (!hasWork)
+                    {
+                        break;
+                    }
+                    continue;
+                }
+
+                auto request = _requests.front();
+                _requests.pop_front();
+                _inFlight = request.Table;
+                lock.unlock();
+
+                request.Source = request.Table->LoadSample(request.Index);
+                if (request.Source != nullptr)
+                {
+                    // The queue is drained every frame, a full queue only
+                    // means the main thread has not caught up yet.
+                    while (!_ready.TryPush(request))
+                    {
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                    }
+                }
+
+                lock.lock();
+                _inFlight = nullptr;
+                _condIdle.notify_all();
+            }
+            _workerRunning = false;
+        }
+    } // namespace
+
+    void PrefetchSample(AudioSampleTable& table, uint32_t index)
+    {
+        if (table.IsSampleLoaded(index))
+            return;
+
+        std::unique_lock lock(_mutex);
+        auto alreadyQueued = std::any_of(_requests.begin(), _requests.end(), [&](const ReadySample& request) {
+            return request.Table == &table && request.Index == index;
+        });
+        if (alreadyQueued)
+            return;
+
+        _requests.push_back({ &table, index, nullptr });
+        if (!_workerRunning)
+        {
+            _workerRunning = true;
+            std::thread(WorkerMain).detach();
+        }
+        _condPending.notify_one();
+    }
+
+    void InstallReadySamples()
+    {
+        ReadySample ready;
+        while (_ready.TryPop(ready))
+        {
+            ready.Table->InstallSample(ready.Index, ready.Source);
+        }
+    }
+
+    void CancelPrefetches(const AudioSampleTable* table)
+    {
+        std::unique_lock lock(_mutex);
+        _requests.erase(
+            std::remove_if(
+                _requests.begin(), _requests.end(), [table](const ReadySample& request) { return request.Table == table; }),
+            _requests.end());
+        _condIdle.wait(lock, [table]() { return _inFlight != table; });
+
+        // Drain anything the worker already finished; entries for other
+        // tables are installed as usual, the cancelled table's are released.
+        ReadySample ready;
+        while (_ready.TryPop(ready))
+        {
+            if (ready.Table == table)
+            {
+                ready.Source->Release();
+            }
+            else
+            {
+                ready.Table->InstallSample(ready.Index, ready.Source);
+            }
+        }
+    }
+} // namespace OpenRCT2::Audio
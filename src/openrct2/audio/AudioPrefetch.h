@@ -0,0 +1,42 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+class AudioSampleTable;
+
+namespace OpenRCT2::Audio
+{
+    // Background decode service for audio samples. Prefetch requests are
+    // served by a worker thread which is spawned on demand and exits after
+    // being idle for a while; decoded sources come back over a lock-free
+    // queue and are installed into their sample table on the main thread by
+    // InstallReadySamples, so a sample requested while a ride approaches the
+    // audible radius is already decoded by the time it is triggered.
+
+    /**
+     * Queues the given sample table entry for background decode. Does nothing
+     * if the entry is already loaded or already queued. Main thread only.
+     */
+    void PrefetchSample(AudioSampleTable& table, uint32_t index);
+
+    /**
+     * Installs all samples the worker has finished decoding. Main thread only.
+     */
+    void InstallReadySamples();
+
+    /**
+     * Drops all pending and finished prefetches for the given table, waiting
+     * for an in-flight decode on it to complete. Must be called before a
+     * table with outstanding prefetches is unloaded or destroyed.
+     */
+    void CancelPrefetches(const AudioSampleTable* table);
+} // namespace OpenRCT2::Audio
@@ -0,0 +1,165 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../Game.h"
+#include "../GameState.h"
+#include "../OpenRCT2.h"
+#include "../ReplayManager.h"
+#include "../core/Console.hpp"
+#include "../entity/EntityRegistry.h"
+#include "../network/network.h"
+#include "../profiling/Profiling.h"
+#include "CommandLine.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+
+using namespace OpenRCT2;
+
+static exitcode_t HandleBenchGameState(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::BenchGameStateCommands[]{
+    // Main commands
+    DefineCommand("", "<park-file> <ticks> [<replay-file>]", nullptr, HandleBenchGameState), CommandTableEnd
+};
+
+/**
+ * The subsystems reported in the breakdown, in the order they run within
+ * gameStateUpdateLogic. Each is matched against the profiler registry by a
+ * substring of the recorded function prototype.
+ */
+static constexpr struct
+{
+    const char* Label;
+    const char* Pattern;
+} _benchSubsystems[] = {
+    { "Scenario/finance", "ScenarioUpdate(" },
+    { "Map tiles", "MapUpdateTiles()" },
+    { "Peeps", "PeepUpdateAll()" },
+    { "Vehicles", "VehicleUpdateAll()" },
+    { "Misc entities", "UpdateAllMiscEntities()" },
+    { "Rides", "Ride::UpdateAll()" },
+    { "Ride ratings", "RideRatingsUpdateAll()" },
+};
+
+static const Profiling::Function* BenchFindProfiledFunction(const char* pattern)
+{
+    for (const auto* func : Profiling::Detail::GetRegistry())
+    {
+        if (std::strstr(func->GetName(), pattern) != nullptr)
+        {
+            return func;
+        }
+    }
+    return nullptr;
+}
+
+static exitcode_t HandleBenchGameState(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    if (argc < 2)
+    {
+        Console::Error::WriteLine("Missing arguments <park-file> <ticks> [<replay-file>].");
+        return EXITCODE_FAIL;
+    }
+
+    const char* inputPath = argv[0];
+    uint32_t ticks = atol(argv[1]);
+    const char* replayPath = argc >= 3 ? argv[2] : nullptr;
+
+    gOpenRCT2Headless = true;
+
+#ifndef DISABLE_NETWORK
+    gNetworkStart = NETWORK_MODE_SERVER;
+#endif
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    if (!context->LoadParkFromFile(inputPath))
+    {
+        return EXITCODE_FAIL;
+    }
+
+    auto* replayManager = context->GetReplayManager();
+    if (replayPath != nullptr)
+    {
+        if (!replayManager->StartPlayback(replayPath))
+        {
+            Console::Error::WriteLine("Unable to start replay: %s", replayPath);
+            return EXITCODE_FAIL;
+        }
+    }
+
+    Console::WriteLine("Running %d ticks...", ticks);
+
+    Profiling::ResetData();
+    Profiling::Enable();
+
+    const auto startTime = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < ticks; i++)
+    {
+        gameStateUpdateLogic();
+    }
+    const auto endTime = std::chrono::steady_clock::now();
+
+    Profiling::Disable();
+
+    bool replayMismatch = false;
+    if (replayManager->IsReplaying())
+    {
+        replayMismatch = replayManager->IsPlaybackStateMismatching();
+        replayManager->StopPlayback();
+    }
+
+    const auto elapsed = std::chrono::duration<double>(endTime - startTime).count();
+    const auto ticksPerSecond = elapsed > 0.0 ? ticks / elapsed : 0.0;
+
+    Console::WriteLine("");
+    Console::WriteLine("Ticks:          %u", ticks);
+    Console::WriteLine("Elapsed:        %.3f s", elapsed);
+    Console::WriteLine("Throughput:     %.1f ticks/s", ticksPerSecond);
+    Console::WriteLine("");
+
+    const auto elapsedUs = elapsed * 1'000'000.0;
+    Console::WriteLine("%-18s %10s %12s %12s %7s", "Subsystem", "Calls", "Total ms", "Avg us", "Share");
+    for (const auto& subsystem : _benchSubsystems)
+    {
+        const auto* func = BenchFindProfiledFunction(subsystem.Pattern);
+        if (func == nullptr)
+            continue;
+
+        const auto callCount = func->GetCallCount();
+        const auto totalUs = func->GetTotalTime();
+        const auto avgUs = callCount != 0 ? totalUs / callCount : 0.0;
+        const auto share = elapsedUs > 0.0 ? (totalUs / elapsedUs) * 100.0 : 0.0;
+        Console::WriteLine(
+            "%-18s %10llu %12.3f %12.3f %6.2f%%", subsystem.Label, static_cast<unsigned long long>(callCount),
+            totalUs / 1000.0, avgUs, share);
+    }
+
+    Console::WriteLine("");
+    Console::WriteLine("Completed: %s", GetAllEntitiesChecksum().ToString().c_str());
+    if (replayMismatch)
+    {
+        Console::Error::WriteLine("Replay playback diverged from the recorded state.");
+        return EXITCODE_FAIL;
+    }
+
+    return EXITCODE_OK;
+}
@@ -0,0 +1,87 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../Context.h"
+#include "../Game.h"
+#include "../OpenRCT2.h"
+#include "../core/Console.hpp"
+#include "../drawing/Drawing.h"
+#include "../interface/PaintBenchmark.h"
+#include "CommandLine.hpp"
+
+#include <cstdlib>
+#include <memory>
+
+using namespace OpenRCT2;
+
+static exitcode_t HandleBenchPaint(CommandLineArgEnumerator* argEnumerator);
+
+const CommandLineCommand CommandLine::BenchPaintCommands[]{
+    // Main commands
+    DefineCommand("", "<park-file> <frames> [<width> <height>]", nullptr, HandleBenchPaint), CommandTableEnd
+};
+
+static exitcode_t HandleBenchPaint(CommandLineArgEnumerator* argEnumerator)
+{
+    const char** argv = const_cast<const char**>(argEnumerator->GetArguments()) + argEnumerator->GetIndex();
+    int32_t argc = argEnumerator->GetCount() - argEnumerator->GetIndex();
+
+    if (argc < 2)
+    {
+        Console::Error::WriteLine("Missing arguments <park-file> <frames> [<width> <height>].");
+        return EXITCODE_FAIL;
+    }
+
+    const char* inputPath = argv[0];
+    int32_t frames = atoi(argv[1]);
+    int32_t width = argc >= 4 ? atoi(argv[2]) : 1920;
+    int32_t height = argc >= 4 ? atoi(argv[3]) : 1080;
+
+    if (frames <= 0 || width <= 0 || height <= 0)
+    {
+        Console::Error::WriteLine("Frames, width and height must be positive.");
+        return EXITCODE_FAIL;
+    }
+
+    gOpenRCT2Headless = true;
+
+    std::unique_ptr<IContext> context(CreateContext());
+    if (!context->Initialise())
+    {
+        Console::Error::WriteLine("Context initialization failed.");
+        return EXITCODE_FAIL;
+    }
+
+    DrawingEngineInit();
+
+    if (!context->LoadParkFromFile(inputPath))
+    {
+        DrawingEngineDispose();
+        return EXITCODE_FAIL;
+    }
+
+    gScreenFlags = SCREEN_FLAGS_PLAYING;
+
+    Console::WriteLine("Rendering %d frames per scene at %dx%d...", frames, width, height);
+
+    const auto results = RunPaintBenchmark(width, height, frames, GetStandardPaintBenchmarkScenes());
+
+    Console::WriteLine("");
+    Console::WriteLine("%-14s %8s %9s %9s %9s %9s %9s %9s", "Scene", "Frames", "Mean ms", "p50 ms", "p95 ms", "p99 ms", "Min ms", "Max ms");
+    for (const auto& result : results)
+    {
+        Console::WriteLine(
+            "%-14s %8d %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f", result.SceneName.c_str(), result.Frames, result.MeanMs,
+            result.MedianMs, result.P95Ms, result.P99Ms, result.MinMs, result.MaxMs);
+    }
+
+    DrawingEngineDispose();
+
+    return EXITCODE_OK;
+}
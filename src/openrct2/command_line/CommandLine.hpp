@@ -117,6 +117,8 @@ namespace CommandLine
     extern const CommandLineCommand ScreenshotCommands[];
     extern const CommandLineCommand SpriteCommands[];
     extern const CommandLineCommand SimulateCommands[];
+    extern const CommandLineCommand BenchGameStateCommands[];
+    extern const CommandLineCommand BenchPaintCommands[];
     extern const CommandLineCommand ParkInfoCommands[];
 
     extern const CommandLineExample RootExamples[];
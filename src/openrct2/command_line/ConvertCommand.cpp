@@ -13,6 +13,7 @@
 #include "../OpenRCT2.h"
 #include "../ParkImporter.h"
 #include "../core/Console.hpp"
+#include "../core/FileScanner.h"
 #include "../core/Path.hpp"
 #include "../interface/Window.h"
 #include "../object/ObjectManager.h"
@@ -25,6 +26,8 @@
 
 using namespace OpenRCT2;
 
+static void ConvertParkFile(IContext& context, const u8string& sourcePath, const u8string& destinationPath);
+static exitcode_t ConvertDirectory(const u8string& sourcePath, const u8string& destinationPath);
 static void WriteConvertFromAndToMessage(FileExtension sourceFileType, FileExtension destinationFileType);
 static u8string GetFileTypeFriendlyName(FileExtension fileType);
 
@@ -58,6 +61,14 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
     const auto destinationPath = Path::GetAbsolute(rawDestinationPath);
     auto destinationFileType = GetFileExtensionType(destinationPath.c_str());
 
+    // A directory as the source converts every legacy save inside it,
+    // sharing one context (and thus one object repository scan) across the
+    // whole batch.
+    if (Path::DirectoryExists(sourcePath))
+    {
+        return ConvertDirectory(sourcePath, destinationPath);
+    }
+
     // Validate target type
     if (destinationFileType != FileExtension::PARK)
     {
@@ -92,18 +103,9 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
     auto context = OpenRCT2::CreateContext();
     context->Initialise();
 
-    auto& objManager = context->GetObjectManager();
-    auto& gameState = GetGameState();
-
     try
     {
-        auto importer = ParkImporter::Create(sourcePath);
-        auto loadResult = importer->Load(sourcePath.c_str());
-
-        objManager.LoadObjects(loadResult.RequiredObjects);
-
-        // TODO: Have a separate GameState and exchange once loaded.
-        importer->Import(gameState);
+        ConvertParkFile(*context, sourcePath, destinationPath);
     }
     catch (const std::exception& ex)
     {
@@ -111,30 +113,83 @@ exitcode_t CommandLine::HandleCommandConvert(CommandLineArgEnumerator* enumerato
         return EXITCODE_FAIL;
     }
 
+    Console::WriteLine("Conversion successful!");
+    return EXITCODE_OK;
+}
+
+static void ConvertParkFile(IContext& context, const u8string& sourcePath, const u8string& destinationPath)
+{
+    auto& objManager = context.GetObjectManager();
+    auto& gameState = GetGameState();
+
+    auto importer = ParkImporter::Create(sourcePath);
+    auto loadResult = importer->Load(sourcePath.c_str());
+
+    objManager.LoadObjects(loadResult.RequiredObjects);
+
+    // TODO: Have a separate GameState and exchange once loaded.
+    importer->Import(gameState);
+
+    auto sourceFileType = GetFileExtensionType(sourcePath.c_str());
     if (sourceFileType == FileExtension::SC4 || sourceFileType == FileExtension::SC6)
     {
         // We are converting a scenario, so reset the park
         ScenarioBegin(gameState);
     }
 
-    try
-    {
-        auto exporter = std::make_unique<ParkFileExporter>();
+    auto exporter = std::make_unique<ParkFileExporter>();
+
+    // HACK remove the main window so it saves the park with the
+    //      correct initial view
+    WindowCloseByClass(WindowClass::MainWindow);
 
-        // HACK remove the main window so it saves the park with the
-        //      correct initial view
-        WindowCloseByClass(WindowClass::MainWindow);
+    exporter->Export(gameState, destinationPath);
+}
 
-        exporter->Export(gameState, destinationPath);
+static exitcode_t ConvertDirectory(const u8string& sourcePath, const u8string& destinationPath)
+{
+    if (GetFileExtensionType(destinationPath.c_str()) == FileExtension::PARK)
+    {
+        Console::Error::WriteLine("Expected a destination directory when converting a directory.");
+        return EXITCODE_FAIL;
     }
-    catch (const std::exception& ex)
+
+    gOpenRCT2Headless = true;
+    auto context = OpenRCT2::CreateContext();
+    context->Initialise();
+
+    if (!Path::DirectoryExists(destinationPath) && !Path::CreateDirectory(destinationPath))
     {
-        Console::Error::WriteLine(ex.what());
+        Console::Error::WriteLine("Unable to create destination directory.");
         return EXITCODE_FAIL;
     }
 
-    Console::WriteLine("Conversion successful!");
-    return EXITCODE_OK;
+    size_t numConverted = 0;
+    size_t numFailed = 0;
+    const auto pattern = Path::Combine(sourcePath, u8"*.sc4;*.sv4;*.sc6;*.sv6");
+    auto scanner = Path::ScanDirectory(pattern, true);
+    while (scanner->Next())
+    {
+        const auto& filePath = scanner->GetPath();
+        auto outPath = Path::Combine(destinationPath, u8string(Path::GetFileNameWithoutExtension(filePath)) + u8".park");
+        try
+        {
+            ConvertParkFile(*context, filePath, outPath);
+            numConverted++;
+            Console::WriteFormat("Converted %s", filePath.c_str());
+            Console::WriteLine();
+        }
+        catch (const std::exception& ex)
+        {
+            numFailed++;
+            Console::Error::WriteFormat("Failed to convert %s: %s", filePath.c_str(), ex.what());
+            Console::Error::WriteLine();
+        }
+    }
+
+    Console::WriteFormat("Converted %zu file(s), %zu failure(s).", numConverted, numFailed);
+    Console::WriteLine();
+    return numFailed == 0 ? EXITCODE_OK : EXITCODE_FAIL;
 }
 
 static void WriteConvertFromAndToMessage(FileExtension sourceFileType, FileExtension destinationFileType)
@@ -57,6 +57,7 @@ static bool _about = false;
 static bool _verbose = false;
 static bool _headless = false;
 static u8string _password = {};
+static u8string _startupView = {};
 static u8string _userDataPath = {};
 static u8string _openrct2DataPath = {};
 static u8string _rct1DataPath = {};
@@ -78,6 +79,7 @@ static constexpr CommandLineOptionDefinition StandardOptions[]
     { CMDLINE_TYPE_STRING,  &_address,          NAC, "address",            "address to listen on when hosting a server"                 },
 #endif
     { CMDLINE_TYPE_STRING,  &_password,         NAC, "password",           "password needed to join the server"                         },
+    { CMDLINE_TYPE_STRING,  &_startupView,      NAC, "view",               "centre the viewport on <x>,<y>[,<zoom>] (tile coordinates) after loading" },
     { CMDLINE_TYPE_STRING,  &_userDataPath,     NAC, "user-data-path",     "path to the user data directory (containing config.ini)"    },
     { CMDLINE_TYPE_STRING,  &_openrct2DataPath, NAC, "openrct2-data-path", "path to the OpenRCT2 data directory (containing languages)" },
     { CMDLINE_TYPE_STRING,  &_rct1DataPath,     NAC, "rct1-data-path",     "path to the RollerCoaster Tycoon 1 data directory (containing data/csg1.dat)" },
@@ -143,6 +145,8 @@ const CommandLineCommand CommandLine::RootCommands[]
     DefineSubCommand("screenshot",      CommandLine::ScreenshotCommands       ),
     DefineSubCommand("sprite",          CommandLine::SpriteCommands           ),
     DefineSubCommand("simulate",        CommandLine::SimulateCommands         ),
+    DefineSubCommand("benchgamestate",  CommandLine::BenchGameStateCommands   ),
+    DefineSubCommand("benchpaint",      CommandLine::BenchPaintCommands       ),
     DefineSubCommand("parkinfo",        CommandLine::ParkInfoCommands         ),
     CommandTableEnd
 };
@@ -157,6 +161,7 @@ const CommandLineExample CommandLine::RootExamples[]
 #endif
 #ifndef DISABLE_NETWORK
     { "host ./my_park.sv6 --port 11753 --headless",   "run a headless server for a saved park" },
+    { "join localhost --port 11753 --view 64,64,1",   "join a server as one shard of a video wall" },
 #endif
     ExampleTableEnd
 };
@@ -224,6 +229,11 @@ exitcode_t CommandLine::HandleCommandDefault()
         gCustomPassword = _password;
     }
 
+    if (!_startupView.empty())
+    {
+        gOpenRCT2StartupView = _startupView;
+    }
+
     return result;
 }
 
@@ -38,6 +38,7 @@ const CommandLineCommand CommandLine::SpriteCommands[]
     DefineCommand("build",        "<spritefile> <json path> [silent]",        SpriteOptions, HandleSprite),
     DefineCommand("combine",      "<index file> <image file> <output>",       SpriteOptions, HandleSprite),
     DefineCommand("create",       "<spritefile>",                             SpriteOptions, HandleSprite),
+    DefineCommand("dedupe",       "<spritefile> [dryrun]",                    SpriteOptions, HandleSprite),
     DefineCommand("details",      "<spritefile> [idx]",                       SpriteOptions, HandleSprite),
     DefineCommand("export",       "<spritefile> <idx> <output>",              SpriteOptions, HandleSprite),
     DefineCommand("exportall",    "<spritefile> <output directory>",          SpriteOptions, HandleSprite),
@@ -53,12 +53,18 @@ static constexpr bool kEnlargedUiDefault = false;
 namespace OpenRCT2::Config
 {
     static Config _config{};
+    static uint32_t _configGeneration{};
 
     Config& Get()
     {
         return _config;
     }
 
+    uint32_t GetGeneration()
+    {
+        return _configGeneration;
+    }
+
 #pragma region Enums
 
     static const auto Enum_MeasurementFormat = ConfigEnum<MeasurementFormat>({
@@ -191,9 +197,11 @@ namespace OpenRCT2::Config
             model->DrawingEngine = reader->GetEnum<DrawingEngine>(
                 "drawing_engine", DrawingEngine::Software, Enum_DrawingEngine);
             model->UncapFPS = reader->GetBoolean("uncap_fps", false);
+            model->FPSLimit = reader->GetInt32("fps_limit", 0);
             model->UseVSync = reader->GetBoolean("use_vsync", true);
             model->VirtualFloorStyle = reader->GetEnum<VirtualFloorStyles>(
                 "virtual_floor_style", VirtualFloorStyles::Glassy, Enum_VirtualFloorStyle);
+            model->EntityLodZoomLevel = reader->GetInt32("entity_lod_zoom_level", 2);
             model->DateFormat = reader->GetEnum<int32_t>("date_format", Platform::GetLocaleDateFormat(), Enum_DateFormat);
             model->AutoStaffPlacement = reader->GetBoolean("auto_staff", true);
             model->HandymenMowByDefault = reader->GetBoolean("handymen_mow_default", false);
@@ -221,6 +229,7 @@ namespace OpenRCT2::Config
 #else
             model->MultiThreading = reader->GetBoolean("multithreading", true);
 #endif // _DEBUG
+            model->PaintFlatSort = reader->GetBoolean("paint_flat_sort", false);
             model->TrapCursor = reader->GetBoolean("trap_cursor", false);
             model->AutoOpenShops = reader->GetBoolean("auto_open_shops", false);
             model->ScenarioSelectMode = reader->GetInt32("scenario_select_mode", SCENARIO_SELECT_MODE_ORIGIN);
@@ -287,6 +296,7 @@ namespace OpenRCT2::Config
         writer->WriteInt32("default_display", model->DefaultDisplay);
         writer->WriteEnum<DrawingEngine>("drawing_engine", model->DrawingEngine, Enum_DrawingEngine);
         writer->WriteBoolean("uncap_fps", model->UncapFPS);
+        writer->WriteInt32("fps_limit", model->FPSLimit);
         writer->WriteBoolean("use_vsync", model->UseVSync);
         writer->WriteEnum<int32_t>("date_format", model->DateFormat, Enum_DateFormat);
         writer->WriteBoolean("auto_staff", model->AutoStaffPlacement);
@@ -307,6 +317,7 @@ namespace OpenRCT2::Config
         writer->WriteBoolean("infer_display_dpi", model->InferDisplayDPI);
         writer->WriteBoolean("show_fps", model->ShowFPS);
         writer->WriteBoolean("multithreading", model->MultiThreading);
+        writer->WriteBoolean("paint_flat_sort", model->PaintFlatSort);
         writer->WriteBoolean("trap_cursor", model->TrapCursor);
         writer->WriteBoolean("auto_open_shops", model->AutoOpenShops);
         writer->WriteInt32("scenario_select_mode", model->ScenarioSelectMode);
@@ -327,6 +338,7 @@ namespace OpenRCT2::Config
         writer->WriteString("asset_pack_order", model->AssetPackOrder);
         writer->WriteString("enabled_asset_packs", model->EnabledAssetPacks);
         writer->WriteEnum<VirtualFloorStyles>("virtual_floor_style", model->VirtualFloorStyle, Enum_VirtualFloorStyle);
+        writer->WriteInt32("entity_lod_zoom_level", model->EntityLodZoomLevel);
         writer->WriteBoolean("transparent_screenshot", model->TransparentScreenshot);
         writer->WriteBoolean("transparent_water", model->TransparentWater);
         writer->WriteBoolean("invisible_rides", model->InvisibleRides);
@@ -590,6 +602,7 @@ namespace OpenRCT2::Config
             auto model = &_config.plugin;
             model->EnableHotReloading = reader->GetBoolean("enable_hot_reloading", false);
             model->AllowedHosts = reader->GetString("allowed_hosts", "");
+            model->TickBudgetMs = reader->GetInt32("tick_budget_ms", 0);
         }
     }
 
@@ -599,6 +612,7 @@ namespace OpenRCT2::Config
         writer->WriteSection("plugin");
         writer->WriteBoolean("enable_hot_reloading", model->EnableHotReloading);
         writer->WriteString("allowed_hosts", model->AllowedHosts);
+        writer->WriteInt32("tick_budget_ms", model->TickBudgetMs);
     }
 
     bool SetDefaults()
@@ -613,6 +627,7 @@ namespace OpenRCT2::Config
             ReadNotifications(reader.get());
             ReadFont(reader.get());
             ReadPlugin(reader.get());
+            _configGeneration++;
             return true;
         }
         catch (const std::exception&)
@@ -810,6 +825,7 @@ namespace OpenRCT2::Config
         if (result)
         {
             CurrencyLoadCustomCurrencyConfig();
+            _configGeneration++;
         }
         return result;
     }
@@ -822,6 +838,9 @@ namespace OpenRCT2::Config
 
     bool SaveToPath(u8string_view path)
     {
+        // Callers mutate the fields of Get() directly and then save, so a save
+        // is the point at which a change becomes observable.
+        _configGeneration++;
         return WriteFile(path);
     }
 
@@ -39,9 +39,11 @@ namespace OpenRCT2::Config
         bool InferDisplayDPI;
         ::DrawingEngine DrawingEngine;
         bool UncapFPS;
+        int32_t FPSLimit;
         bool UseVSync;
         bool ShowFPS;
         std::atomic_uint8_t MultiThreading;
+        bool PaintFlatSort;
         bool MinimizeFullscreenFocusLoss;
         bool DisableScreensaver;
 
@@ -49,6 +51,9 @@ namespace OpenRCT2::Config
         bool LandscapeSmoothing;
         bool AlwaysShowGridlines;
         VirtualFloorStyles VirtualFloorStyle;
+        // Zoom level beyond which guests paint as one representative sprite
+        // per tile instead of individually; they are only pixels there.
+        int32_t EntityLodZoomLevel;
         bool DayNightCycle;
         bool EnableLightFx;
         bool EnableLightFxForVehicles;
@@ -221,6 +226,9 @@ namespace OpenRCT2::Config
     {
         bool EnableHotReloading;
         u8string AllowedHosts;
+        // Maximum script time per plugin per tick in milliseconds before the
+        // plugin is throttled, 0 disables budgets.
+        int32_t TickBudgetMs;
     };
 
     struct Config
@@ -240,6 +248,15 @@ namespace OpenRCT2::Config
     };
 
     Config& Get();
+
+    /**
+     * Monotonic counter bumped whenever the configuration is loaded, reset to
+     * defaults or saved. Code that derives state from config values can compare
+     * this against the generation it last saw instead of re-reading the values
+     * on every use.
+     */
+    uint32_t GetGeneration();
+
     bool OpenFromPath(u8string_view path);
     bool SaveToPath(u8string_view path);
     u8string GetDefaultPath();
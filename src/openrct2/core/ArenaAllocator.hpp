@@ -0,0 +1,229 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../profiling/AllocationTracker.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace OpenRCT2
+{
+    /**
+     * Bump allocator over a chain of fixed-size blocks. Allocations are a
+     * pointer bump; nothing is freed individually and no destructors are run,
+     * memory is reclaimed wholesale with Reset or by unwinding a Scope. Blocks
+     * are retained across resets, so a steady state workload stops allocating
+     * from the system after the first cycle.
+     *
+     * A buffer obtained from Allocate can back a non-owning MemoryStream via
+     * MemoryStream(data, size, MEMORY_ACCESS::READ | MEMORY_ACCESS::WRITE).
+     */
+    class ArenaAllocator
+    {
+    public:
+        static constexpr size_t kDefaultBlockSize = 64 * 1024;
+
+    private:
+        struct Block
+        {
+            std::unique_ptr<uint8_t[]> Data;
+            size_t Size{};
+            size_t Used{};
+        };
+
+        std::vector<Block> _blocks;
+        size_t _currentBlock{};
+        size_t _blockSize;
+
+    public:
+        explicit ArenaAllocator(size_t blockSize = kDefaultBlockSize)
+            : _blockSize(blockSize)
+        {
+        }
+
+        void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+        {
+            AllocationTracker::RecordArenaAllocation(size);
+
+            while (_currentBlock < _blocks.size())
+            {
+                auto& block = _blocks[_currentBlock];
+                auto base = reinterpret_cast<uintptr_t>(block.Data.get());
+                auto offset = AlignUp(base + block.Used, alignment) - base;
+                if (offset + size <= block.Size)
+                {
+                    block.Used = offset + size;
+                    return block.Data.get() + offset;
+                }
+                _currentBlock++;
+            }
+
+            auto& block = _blocks.emplace_back();
+            block.Size = std::max(_blockSize, size + alignment);
+            block.Data = std::make_unique<uint8_t[]>(block.Size);
+            auto base = reinterpret_cast<uintptr_t>(block.Data.get());
+            auto offset = AlignUp(base, alignment) - base;
+            block.Used = offset + size;
+            _currentBlock = _blocks.size() - 1;
+            return block.Data.get() + offset;
+        }
+
+        /**
+         * Allocates and constructs a T in the arena. The destructor is never
+         * run, so only trivially destructible types are allowed.
+         */
+        template<typename T, typename... TArgs> T* Create(TArgs&&... args)
+        {
+            static_assert(std::is_trivially_destructible_v<T>);
+            auto* mem = Allocate(sizeof(T), alignof(T));
+            return new (mem) T(std::forward<TArgs>(args)...);
+        }
+
+        template<typename T> T* AllocateArray(size_t count)
+        {
+            static_assert(std::is_trivially_destructible_v<T>);
+            auto* mem = Allocate(sizeof(T) * count, alignof(T));
+            return static_cast<T*>(mem);
+        }
+
+        void Reset()
+        {
+            for (auto& block : _blocks)
+            {
+                block.Used = 0;
+            }
+            _currentBlock = 0;
+        }
+
+        size_t GetCapacity() const
+        {
+            size_t total = 0;
+            for (const auto& block : _blocks)
+            {
+                total += block.Size;
+            }
+            return total;
+        }
+
+        /**
+         * Restores the arena to the allocation state it had at construction of
+         * the scope, releasing everything allocated since in one step.
+         */
+        class Scope
+        {
+        private:
+            ArenaAllocator& _arena;
+            size_t _blockIndex;
+            size_t _used;
+
+        public:
+            explicit Scope(ArenaAllocator& arena)
+                : _arena(arena)
+                , _blockIndex(arena._currentBlock)
+                , _used(arena._blocks.empty() ? 0 : arena._blocks[arena._currentBlock].Used)
+            {
+            }
+
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+            ~Scope()
+            {
+                auto& blocks = _arena._blocks;
+                for (auto i = _blockIndex; i < blocks.size(); i++)
+                {
+                    blocks[i].Used = i == _blockIndex ? _used : 0;
+                }
+                _arena._currentBlock = std::min(_blockIndex, blocks.empty() ? size_t{} : blocks.size() - 1);
+            }
+        };
+
+    private:
+        static size_t AlignUp(size_t value, size_t alignment)
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+    };
+
+    /**
+     * Fixed-size object pool with an intrusive freelist. Allocation and
+     * release are O(1) pointer swaps; storage grows in blocks and is only
+     * returned to the system when the pool is destroyed. Objects are
+     * constructed on Allocate and destructed on Free.
+     */
+    template<typename T> class ObjectPool
+    {
+    private:
+        union Slot
+        {
+            Slot* Next;
+            alignas(T) uint8_t Storage[sizeof(T)];
+        };
+
+        static constexpr size_t kSlotsPerBlock = 256;
+
+        std::vector<std::unique_ptr<Slot[]>> _blocks;
+        Slot* _freeList{};
+
+    public:
+        ObjectPool() = default;
+        ObjectPool(const ObjectPool&) = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+
+        template<typename... TArgs> T* Allocate(TArgs&&... args)
+        {
+            if (_freeList == nullptr)
+            {
+                Grow();
+            }
+            auto* slot = _freeList;
+            _freeList = slot->Next;
+            return new (slot->Storage) T(std::forward<TArgs>(args)...);
+        }
+
+        void Free(T* obj)
+        {
+            obj->~T();
+            auto* slot = reinterpret_cast<Slot*>(obj);
+            slot->Next = _freeList;
+            _freeList = slot;
+        }
+
+    private:
+        void Grow()
+        {
+            auto block = std::make_unique<Slot[]>(kSlotsPerBlock);
+            for (size_t i = 0; i < kSlotsPerBlock; i++)
+            {
+                block[i].Next = _freeList;
+                _freeList = &block[i];
+            }
+            _blocks.push_back(std::move(block));
+        }
+    };
+
+    /**
+     * Per-thread scratch arena for transient allocations within a single
+     * operation. Callers are expected to bracket their use with a Scope so
+     * that nested users on the same thread compose.
+     */
+    inline ArenaAllocator& GetThreadArena()
+    {
+        thread_local ArenaAllocator instance;
+        return instance;
+    }
+} // namespace OpenRCT2
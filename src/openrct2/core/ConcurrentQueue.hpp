@@ -0,0 +1,243 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace OpenRCT2
+{
+    // 64 bytes on every platform we target; std::hardware_destructive_interference_size
+    // triggers an ABI warning on GCC so the constant is spelt out.
+    constexpr size_t kCacheLineSize = 64;
+
+    /**
+     * Bounded lock-free queue for exactly one producer thread and one consumer
+     * thread. The indices live on their own cache lines and each side keeps a
+     * cached copy of the other side's index, so in the common case a push or
+     * pop touches no shared line that the other thread is writing to.
+     *
+     * TCapacity must be a power of two.
+     */
+    template<typename TType, size_t TCapacity> class SPSCQueue
+    {
+        static_assert((TCapacity & (TCapacity - 1)) == 0, "Capacity must be a power of two.");
+
+    public:
+        using value_type = TType;
+
+        bool TryPush(value_type value)
+        {
+            auto tail = _tail.load(std::memory_order_relaxed);
+            if (tail - _cachedHead == TCapacity)
+            {
+                _cachedHead = _head.load(std::memory_order_acquire);
+                if (tail - _cachedHead == TCapacity)
+                {
+                    return false;
+                }
+            }
+            _elements[tail & kMask] = std::move(value);
+            _tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool TryPop(value_type& outValue)
+        {
+            auto head = _head.load(std::memory_order_relaxed);
+            if (head == _cachedTail)
+            {
+                _cachedTail = _tail.load(std::memory_order_acquire);
+                if (head == _cachedTail)
+                {
+                    return false;
+                }
+            }
+            outValue = std::move(_elements[head & kMask]);
+            _head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * Pushes up to count values, returning how many fitted.
+         */
+        size_t PushBatch(const value_type* values, size_t count)
+        {
+            auto tail = _tail.load(std::memory_order_relaxed);
+            auto available = TCapacity - (tail - _cachedHead);
+            if (available < count)
+            {
+                _cachedHead = _head.load(std::memory_order_acquire);
+                available = TCapacity - (tail - _cachedHead);
+            }
+            auto numToPush = count < available ? count : available;
+            for (size_t i = 0; i < numToPush; i++)
+            {
+                _elements[(tail + i) & kMask] = values[i];
+            }
+            _tail.store(tail + numToPush, std::memory_order_release);
+            return numToPush;
+        }
+
+        /**
+         * Pops up to maxCount values into outValues, returning how many were
+         * popped.
+         */
+        size_t PopBatch(value_type* outValues, size_t maxCount)
+        {
+            auto head = _head.load(std::memory_order_relaxed);
+            auto available = _cachedTail - head;
+            if (available < maxCount)
+            {
+                _cachedTail = _tail.load(std::memory_order_acquire);
+                available = _cachedTail - head;
+            }
+            auto numToPop = maxCount < available ? maxCount : available;
+            for (size_t i = 0; i < numToPop; i++)
+            {
+                outValues[i] = std::move(_elements[(head + i) & kMask]);
+            }
+            _head.store(head + numToPop, std::memory_order_release);
+            return numToPop;
+        }
+
+        bool IsEmpty() const
+        {
+            return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+        }
+
+        constexpr size_t GetCapacity() const
+        {
+            return TCapacity;
+        }
+
+    private:
+        static constexpr size_t kMask = TCapacity - 1;
+
+        std::array<value_type, TCapacity> _elements{};
+
+        // Consumer side.
+        alignas(kCacheLineSize) std::atomic<size_t> _head{};
+        size_t _cachedTail{};
+
+        // Producer side.
+        alignas(kCacheLineSize) std::atomic<size_t> _tail{};
+        size_t _cachedHead{};
+    };
+
+    /**
+     * Bounded lock-free queue for any number of producer threads and exactly
+     * one consumer thread, based on the Vyukov bounded queue: every slot
+     * carries a sequence number that tells producers and the consumer whether
+     * the slot is theirs, so producers only contend on the tail index.
+     *
+     * TCapacity must be a power of two.
+     */
+    template<typename TType, size_t TCapacity> class MPSCQueue
+    {
+        static_assert((TCapacity & (TCapacity - 1)) == 0, "Capacity must be a power of two.");
+
+    public:
+        using value_type = TType;
+
+        MPSCQueue()
+        {
+            for (size_t i = 0; i < TCapacity; i++)
+            {
+                _slots[i].Sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        bool TryPush(value_type value)
+        {
+            auto tail = _tail.load(std::memory_order_relaxed);
+            while (true)
+            {
+                auto& slot = _slots[tail & kMask];
+                auto sequence = slot.Sequence.load(std::memory_order_acquire);
+                auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(tail);
+                if (diff == 0)
+                {
+                    if (_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+                    {
+                        slot.Value = std::move(value);
+                        slot.Sequence.store(tail + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    // The consumer has not vacated this slot yet, the queue is full.
+                    return false;
+                }
+                else
+                {
+                    tail = _tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        bool TryPop(value_type& outValue)
+        {
+            auto head = _head.load(std::memory_order_relaxed);
+            auto& slot = _slots[head & kMask];
+            auto sequence = slot.Sequence.load(std::memory_order_acquire);
+            if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(head + 1) < 0)
+            {
+                return false;
+            }
+            outValue = std::move(slot.Value);
+            slot.Sequence.store(head + TCapacity, std::memory_order_release);
+            _head.store(head + 1, std::memory_order_relaxed);
+            return true;
+        }
+
+        /**
+         * Pops up to maxCount values into outValues, returning how many were
+         * popped.
+         */
+        size_t PopBatch(value_type* outValues, size_t maxCount)
+        {
+            size_t numPopped = 0;
+            while (numPopped < maxCount && TryPop(outValues[numPopped]))
+            {
+                numPopped++;
+            }
+            return numPopped;
+        }
+
+        bool IsEmpty() const
+        {
+            return _head.load(std::memory_order_acquire) == _tail.load(std::memory_order_acquire);
+        }
+
+        constexpr size_t GetCapacity() const
+        {
+            return TCapacity;
+        }
+
+    private:
+        static constexpr size_t kMask = TCapacity - 1;
+
+        struct Slot
+        {
+            std::atomic<size_t> Sequence{};
+            value_type Value{};
+        };
+
+        std::array<Slot, TCapacity> _slots{};
+
+        alignas(kCacheLineSize) std::atomic<size_t> _head{};
+        alignas(kCacheLineSize) std::atomic<size_t> _tail{};
+    };
+} // namespace OpenRCT2
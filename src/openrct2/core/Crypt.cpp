@@ -0,0 +1,76 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Crypt.h"
+
+#include "../config/Config.h"
+#include "JobPool.h"
+
+namespace Crypt
+{
+    // The per-buffer implementations come from the platform backend (OpenSSL,
+    // CNG or the built-in fallback); OpenSSL and CNG already dispatch to the
+    // CPU's SHA extensions where available. The batch interface exploits the
+    // other axis of parallelism: independent buffers are hashed concurrently
+    // across the job pool, which is where the object scan and snapshot
+    // checksum workloads spend their time.
+
+    static std::unique_ptr<JobPool> _hashJobs;
+
+    static JobPool* GetHashJobPool()
+    {
+        bool useMultithreading = OpenRCT2::Config::Get().general.MultiThreading;
+        if (useMultithreading && _hashJobs == nullptr)
+        {
+            _hashJobs = std::make_unique<JobPool>();
+        }
+        else if (useMultithreading == false && _hashJobs != nullptr)
+        {
+            _hashJobs.reset();
+        }
+        return _hashJobs.get();
+    }
+
+    template<typename TAlgorithm>
+    static std::vector<typename TAlgorithm::Result> HashBatch(
+        std::unique_ptr<TAlgorithm> (*factory)(), const std::vector<HashInput>& inputs)
+    {
+        std::vector<typename TAlgorithm::Result> results(inputs.size());
+        auto hashRange = [&](size_t begin, size_t end) {
+            auto algorithm = factory();
+            for (size_t i = begin; i < end; i++)
+            {
+                algorithm->Clear();
+                algorithm->Update(inputs[i].Data, inputs[i].Length);
+                results[i] = algorithm->Finish();
+            }
+        };
+
+        auto* jobPool = inputs.size() >= 2 ? GetHashJobPool() : nullptr;
+        if (jobPool != nullptr)
+        {
+            jobPool->ParallelFor(inputs.size(), 1, hashRange);
+        }
+        else
+        {
+            hashRange(0, inputs.size());
+        }
+        return results;
+    }
+
+    std::vector<Sha1Algorithm::Result> SHA1Batch(const std::vector<HashInput>& inputs)
+    {
+        return HashBatch(CreateSHA1, inputs);
+    }
+
+    std::vector<Sha256Algorithm::Result> SHA256Batch(const std::vector<HashInput>& inputs)
+    {
+        return HashBatch(CreateSHA256, inputs);
+    }
+} // namespace Crypt
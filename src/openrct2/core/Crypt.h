@@ -71,4 +71,17 @@ namespace Crypt
     {
         return CreateSHA256()->Update(data, dataLen)->Finish();
     }
+
+    /**
+     * Batch hashing: hashes independent buffers concurrently across the
+     * worker threads. Results are in input order and identical to calling
+     * SHA1/SHA256 on each input individually.
+     */
+    struct HashInput
+    {
+        const void* Data{};
+        size_t Length{};
+    };
+    [[nodiscard]] std::vector<Sha1Algorithm::Result> SHA1Batch(const std::vector<HashInput>& inputs);
+    [[nodiscard]] std::vector<Sha256Algorithm::Result> SHA256Batch(const std::vector<HashInput>& inputs);
 } // namespace Crypt
@@ -21,12 +21,12 @@
 template<typename T> class EnumMap
 {
 private:
+    // Entries sorted by value; _keyIndex holds the same entries sorted by key
+    // for binary search, so both directions are flat lookups over one array.
     std::vector<std::pair<std::string_view, T>> _map;
+    std::vector<int32_t> _keyIndex;
     bool _continiousValueIndex{ false };
 
-    static constexpr size_t BucketSize = 43;
-    std::array<std::vector<int32_t>, BucketSize> _buckets;
-
     static constexpr bool ValueIndexable()
     {
         if constexpr (std::is_enum_v<T>)
@@ -45,17 +45,6 @@ private:
             return (b - a);
     }
 
-    static constexpr uint32_t MakeHash(const std::string_view str)
-    {
-        uint32_t res = 0x811c9dc5;
-        for (auto chr : str)
-        {
-            res ^= chr;
-            res *= 0x01000193;
-        }
-        return res;
-    }
-
 public:
     EnumMap(const std::initializer_list<std::pair<std::string_view, T>>&& items)
         : _map{ items }
@@ -79,15 +68,13 @@ public:
             }
         }
 
-        int32_t index = 0;
-        for (auto& kv : _map)
+        _keyIndex.resize(_map.size());
+        for (size_t i = 0; i < _keyIndex.size(); i++)
         {
-            auto hash = MakeHash(kv.first);
-            auto bucketIndex = hash % BucketSize;
-            auto& bucket = _buckets[bucketIndex];
-            bucket.push_back(index);
-            index++;
+            _keyIndex[i] = static_cast<int32_t>(i);
         }
+        std::sort(
+            _keyIndex.begin(), _keyIndex.end(), [this](int32_t a, int32_t b) { return _map[a].first < _map[b].first; });
     }
 
     std::string_view operator[](T k) const
@@ -114,19 +101,12 @@ public:
 
     auto find(const std::string_view k) const
     {
-        const auto hash = MakeHash(k);
-        const auto bucketIndex = hash % BucketSize;
-        const auto& bucket = _buckets[bucketIndex];
-
-        for (auto index : bucket)
+        auto it = std::lower_bound(
+            _keyIndex.begin(), _keyIndex.end(), k, [this](int32_t idx, const std::string_view key) { return _map[idx].first < key; });
+        if (it != _keyIndex.end() && _map[*it].first == k)
         {
-            auto& entry = _map[index];
-            if (entry.first == k)
-            {
-                return _map.begin() + index;
-            }
+            return _map.begin() + *it;
         }
-
         return end();
     }
 
@@ -17,13 +17,14 @@
 #include "FileScanner.h"
 #include "FileStream.h"
 #include "JobPool.h"
+#include "MemoryStream.h"
 #include "Numerics.hpp"
 #include "Path.hpp"
 
 #include <chrono>
-#include <list>
+#include <optional>
 #include <string>
-#include <tuple>
+#include <unordered_map>
 #include <vector>
 
 template<typename TItem> class FileIndex
@@ -37,12 +38,19 @@ private:
         uint32_t PathChecksum = 0;
     };
 
+    struct ScannedFile
+    {
+        std::string Path;
+        uint64_t Size = 0;
+        uint64_t LastModified = 0;
+    };
+
     struct ScanResult
     {
         DirectoryStats const Stats;
-        std::vector<std::string> const Files;
+        std::vector<ScannedFile> const Files;
 
-        ScanResult(DirectoryStats stats, std::vector<std::string>&& files) noexcept
+        ScanResult(DirectoryStats stats, std::vector<ScannedFile>&& files) noexcept
             : Stats(stats)
             , Files(std::move(files))
         {
@@ -60,8 +68,18 @@ private:
         uint32_t NumItems = 0;
     };
 
+    struct ReadIndexResult
+    {
+        // True when the directory stats match and Items can be used as-is.
+        bool UpToDate = false;
+        std::vector<TItem> Items;
+        // Size and modified time of each item's source file, aligned with
+        // Items; used to reuse unchanged items when the index is stale.
+        std::vector<std::pair<uint64_t, uint64_t>> FileMeta;
+    };
+
     // Index file format version which when incremented forces a rebuild
-    static constexpr uint8_t FILE_INDEX_VERSION = 4;
+    static constexpr uint8_t FILE_INDEX_VERSION = 5;
 
     std::string const _name;
     uint32_t const _magicNumber;
@@ -98,30 +116,24 @@ public:
 
     /**
      * Queries and directories and loads the index header. If the index is up to date,
-     * the items are loaded from the index and returned, otherwise the index is rebuilt.
+     * the items are loaded from the index and returned, otherwise the index is rebuilt,
+     * reusing items whose source files are unchanged.
      */
     std::vector<TItem> LoadOrBuild(int32_t language) const
     {
-        std::vector<TItem> items;
         auto scanResult = Scan();
-        auto readIndexResult = ReadIndexFile(language, scanResult.Stats);
-        if (std::get<0>(readIndexResult))
+        auto readResult = ReadIndexFile(language, scanResult.Stats);
+        if (readResult.UpToDate)
         {
-            // Index was loaded
-            items = std::get<1>(readIndexResult);
+            return std::move(readResult.Items);
         }
-        else
-        {
-            // Index was not loaded
-            items = Build(language, scanResult);
-        }
-        return items;
+        return Build(language, scanResult, readResult);
     }
 
     std::vector<TItem> Rebuild(int32_t language) const
     {
         auto scanResult = Scan();
-        auto items = Build(language, scanResult);
+        auto items = Build(language, scanResult, ReadIndexResult());
         return items;
     }
 
@@ -139,41 +151,66 @@ protected:
 private:
     ScanResult Scan() const
     {
-        DirectoryStats stats{};
-        std::vector<std::string> files;
-        for (const auto& directory : SearchPaths)
+        std::vector<DirectoryStats> pathStats(SearchPaths.size());
+        std::vector<std::vector<ScannedFile>> pathFiles(SearchPaths.size());
+
+        // Walk each search path in its own job; on slow (e.g. network)
+        // storage the directory enumeration itself is a large part of a
+        // cold start.
+        JobPool jobPool;
+        for (size_t pathIndex = 0; pathIndex < SearchPaths.size(); pathIndex++)
         {
-            auto absoluteDirectory = Path::GetAbsolute(directory);
-            LOG_VERBOSE("FileIndex:Scanning for %s in '%s'", _pattern.c_str(), absoluteDirectory.c_str());
+            jobPool.AddTask([&, pathIndex]() {
+                auto absoluteDirectory = Path::GetAbsolute(SearchPaths[pathIndex]);
+                LOG_VERBOSE("FileIndex:Scanning for %s in '%s'", _pattern.c_str(), absoluteDirectory.c_str());
 
-            auto pattern = Path::Combine(absoluteDirectory, _pattern);
-            auto scanner = Path::ScanDirectory(pattern, true);
-            while (scanner->Next())
-            {
-                const auto& fileInfo = scanner->GetFileInfo();
-                auto path = scanner->GetPath();
+                auto& stats = pathStats[pathIndex];
+                auto& files = pathFiles[pathIndex];
 
-                stats.TotalFiles++;
-                stats.TotalFileSize += fileInfo.Size;
-                stats.FileDateModifiedChecksum ^= static_cast<uint32_t>(fileInfo.LastModified >> 32)
-                    ^ static_cast<uint32_t>(fileInfo.LastModified & 0xFFFFFFFF);
-                stats.FileDateModifiedChecksum = Numerics::ror32(stats.FileDateModifiedChecksum, 5);
-                stats.PathChecksum += GetPathChecksum(path);
+                auto pattern = Path::Combine(absoluteDirectory, _pattern);
+                auto scanner = Path::ScanDirectory(pattern, true);
+                while (scanner->Next())
+                {
+                    const auto& fileInfo = scanner->GetFileInfo();
+                    auto path = scanner->GetPath();
 
-                files.push_back(std::move(path));
-            }
+                    stats.TotalFiles++;
+                    stats.TotalFileSize += fileInfo.Size;
+                    stats.FileDateModifiedChecksum ^= static_cast<uint32_t>(fileInfo.LastModified >> 32)
+                        ^ static_cast<uint32_t>(fileInfo.LastModified & 0xFFFFFFFF);
+                    stats.FileDateModifiedChecksum = Numerics::ror32(stats.FileDateModifiedChecksum, 5);
+                    stats.PathChecksum += GetPathChecksum(path);
+
+                    files.push_back({ std::move(path), fileInfo.Size, fileInfo.LastModified });
+                }
+            });
+        }
+        jobPool.Join();
+
+        // Combine in search path order so the stats are deterministic.
+        DirectoryStats stats{};
+        std::vector<ScannedFile> files;
+        for (size_t pathIndex = 0; pathIndex < SearchPaths.size(); pathIndex++)
+        {
+            stats.TotalFiles += pathStats[pathIndex].TotalFiles;
+            stats.TotalFileSize += pathStats[pathIndex].TotalFileSize;
+            stats.FileDateModifiedChecksum ^= pathStats[pathIndex].FileDateModifiedChecksum;
+            stats.PathChecksum += pathStats[pathIndex].PathChecksum;
+            files.insert(
+                files.end(), std::make_move_iterator(pathFiles[pathIndex].begin()),
+                std::make_move_iterator(pathFiles[pathIndex].end()));
         }
         return ScanResult(stats, std::move(files));
     }
 
     void BuildRange(
-        int32_t language, const ScanResult& scanResult, size_t rangeStart, size_t rangeEnd, std::vector<TItem>& items,
-        std::atomic<size_t>& processed, std::mutex& printLock) const
+        int32_t language, const ScanResult& scanResult, const std::vector<size_t>& pending, size_t rangeStart,
+        size_t rangeEnd, std::vector<std::optional<TItem>>& slots, std::atomic<size_t>& processed,
+        std::mutex& printLock) const
     {
-        items.reserve(rangeEnd - rangeStart);
         for (size_t i = rangeStart; i < rangeEnd; i++)
         {
-            const auto& filePath = scanResult.Files.at(i);
+            const auto& filePath = scanResult.Files[pending[i]].Path;
 
             if (_log_levels[EnumValue(DiagnosticLevel::Verbose)])
             {
@@ -181,65 +218,94 @@ private:
                 LOG_VERBOSE("FileIndex:Indexing '%s'", filePath.c_str());
             }
 
-            if (auto item = Create(language, filePath); item.has_value())
-            {
-                items.push_back(std::move(item.value()));
-            }
+            slots[pending[i]] = Create(language, filePath);
 
             ++processed;
         }
     }
 
-    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult) const
+    std::vector<TItem> Build(int32_t language, const ScanResult& scanResult, const ReadIndexResult& previous) const
     {
-        std::vector<TItem> allItems;
-        Console::WriteLine("Building %s (%zu items)", _name.c_str(), scanResult.Files.size());
+        const size_t totalCount = scanResult.Files.size();
+        std::vector<std::optional<TItem>> slots(totalCount);
+
+        // Reuse items from the stale index whose source file has the same
+        // size and modified time; only new or touched files are re-created,
+        // so adding one file re-indexes one file.
+        std::unordered_map<std::string_view, size_t> previousByPath;
+        for (size_t i = 0; i < previous.Items.size(); i++)
+        {
+            previousByPath[previous.Items[i].Path] = i;
+        }
+
+        std::vector<size_t> pending;
+        pending.reserve(totalCount);
+        for (size_t i = 0; i < totalCount; i++)
+        {
+            const auto& file = scanResult.Files[i];
+            auto it = previousByPath.find(file.Path);
+            if (it != previousByPath.end() && previous.FileMeta[it->second].first == file.Size
+                && previous.FileMeta[it->second].second == file.LastModified)
+            {
+                slots[i] = previous.Items[it->second];
+            }
+            else
+            {
+                pending.push_back(i);
+            }
+        }
+
+        Console::WriteLine("Building %s (%zu of %zu files)", _name.c_str(), pending.size(), totalCount);
 
         auto startTime = std::chrono::high_resolution_clock::now();
 
-        const size_t totalCount = scanResult.Files.size();
-        if (totalCount > 0)
+        const size_t pendingCount = pending.size();
+        if (pendingCount > 0)
         {
             JobPool jobPool;
             std::mutex printLock; // For verbose prints.
 
-            std::list<std::vector<TItem>> containers;
-
             size_t stepSize = 100; // Handpicked, seems to work well with 4/8 cores.
 
             std::atomic<size_t> processed{ 0 };
 
             auto reportProgress = [&]() {
                 const size_t completed = processed;
-                Console::WriteFormat("File %5zu of %zu, done %3d%%\r", completed, totalCount, completed * 100 / totalCount);
-                OpenRCT2::GetContext()->SetProgress(static_cast<uint32_t>(completed), static_cast<uint32_t>(totalCount));
+                Console::WriteFormat("File %5zu of %zu, done %3d%%\r", completed, pendingCount, completed * 100 / pendingCount);
+                OpenRCT2::GetContext()->SetProgress(static_cast<uint32_t>(completed), static_cast<uint32_t>(pendingCount));
             };
 
-            for (size_t rangeStart = 0; rangeStart < totalCount; rangeStart += stepSize)
+            for (size_t rangeStart = 0; rangeStart < pendingCount; rangeStart += stepSize)
             {
-                if (rangeStart + stepSize > totalCount)
+                if (rangeStart + stepSize > pendingCount)
                 {
-                    stepSize = totalCount - rangeStart;
+                    stepSize = pendingCount - rangeStart;
                 }
 
-                auto& items = containers.emplace_back();
-
                 jobPool.AddTask([&, rangeStart, stepSize]() {
-                    BuildRange(language, scanResult, rangeStart, rangeStart + stepSize, items, processed, printLock);
+                    BuildRange(language, scanResult, pending, rangeStart, rangeStart + stepSize, slots, processed, printLock);
                 });
 
                 reportProgress();
             }
 
             jobPool.Join(reportProgress);
+        }
 
-            for (const auto& itr : containers)
+        std::vector<TItem> allItems;
+        std::vector<std::pair<uint64_t, uint64_t>> fileMeta;
+        allItems.reserve(totalCount);
+        fileMeta.reserve(totalCount);
+        for (size_t i = 0; i < totalCount; i++)
+        {
+            if (slots[i].has_value())
             {
-                allItems.insert(allItems.end(), itr.begin(), itr.end());
+                allItems.push_back(std::move(slots[i].value()));
+                fileMeta.emplace_back(scanResult.Files[i].Size, scanResult.Files[i].LastModified);
             }
         }
 
-        WriteIndexFile(language, scanResult.Stats, allItems);
+        WriteIndexFile(language, scanResult.Stats, allItems, fileMeta);
 
         auto endTime = std::chrono::high_resolution_clock::now();
         auto duration = std::chrono::duration<float>(endTime - startTime);
@@ -248,10 +314,9 @@ private:
         return allItems;
     }
 
-    std::tuple<bool, std::vector<TItem>> ReadIndexFile(int32_t language, const DirectoryStats& stats) const
+    ReadIndexResult ReadIndexFile(int32_t language, const DirectoryStats& stats) const
     {
-        bool loadedItems = false;
-        std::vector<TItem> items;
+        ReadIndexResult result;
         if (File::Exists(_indexPath))
         {
             try
@@ -259,40 +324,59 @@ private:
                 LOG_VERBOSE("FileIndex:Loading index: '%s'", _indexPath.c_str());
                 auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_OPEN);
 
+                // Read the whole index in one go and deserialise from memory;
+                // items are made up of many small fields and reading them
+                // straight from the file dominated warm start-up time.
+                std::vector<uint8_t> data(static_cast<size_t>(fs.GetLength()));
+                fs.Read(data.data(), data.size());
+                auto ms = OpenRCT2::MemoryStream(std::move(data));
+
                 // Read header, check if we need to re-scan
-                auto header = fs.ReadValue<FileIndexHeader>();
+                auto header = ms.ReadValue<FileIndexHeader>();
                 if (header.HeaderSize == sizeof(FileIndexHeader) && header.MagicNumber == _magicNumber
-                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language
-                    && header.Stats.TotalFiles == stats.TotalFiles && header.Stats.TotalFileSize == stats.TotalFileSize
-                    && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
-                    && header.Stats.PathChecksum == stats.PathChecksum)
+                    && header.VersionA == FILE_INDEX_VERSION && header.VersionB == _version && header.LanguageId == language)
                 {
-                    items.reserve(header.NumItems);
-                    DataSerialiser ds(false, fs);
-                    // Directory is the same, just read the saved items
+                    result.UpToDate = header.Stats.TotalFiles == stats.TotalFiles
+                        && header.Stats.TotalFileSize == stats.TotalFileSize
+                        && header.Stats.FileDateModifiedChecksum == stats.FileDateModifiedChecksum
+                        && header.Stats.PathChecksum == stats.PathChecksum;
+                    if (!result.UpToDate)
+                    {
+                        // A stale index is still read; unchanged items are
+                        // reused by the rebuild.
+                        Console::WriteLine("%s out of date", _name.c_str());
+                    }
+
+                    result.Items.reserve(header.NumItems);
+                    result.FileMeta.reserve(header.NumItems);
+                    DataSerialiser ds(false, ms);
                     for (uint32_t i = 0; i < header.NumItems; i++)
                     {
+                        uint64_t fileSize{};
+                        uint64_t fileModified{};
+                        ds << fileSize;
+                        ds << fileModified;
+
                         TItem item;
                         Serialise(ds, item);
-                        items.emplace_back(std::move(item));
+                        result.Items.emplace_back(std::move(item));
+                        result.FileMeta.emplace_back(fileSize, fileModified);
                     }
-                    loadedItems = true;
-                }
-                else
-                {
-                    Console::WriteLine("%s out of date", _name.c_str());
                 }
             }
             catch (const std::exception& e)
             {
                 Console::Error::WriteLine("Unable to load index: '%s'.", _indexPath.c_str());
                 Console::Error::WriteLine("%s", e.what());
+                result = ReadIndexResult();
             }
         }
-        return std::make_tuple(loadedItems, std::move(items));
+        return result;
     }
 
-    void WriteIndexFile(int32_t language, const DirectoryStats& stats, const std::vector<TItem>& items) const
+    void WriteIndexFile(
+        int32_t language, const DirectoryStats& stats, const std::vector<TItem>& items,
+        const std::vector<std::pair<uint64_t, uint64_t>>& fileMeta) const
     {
         try
         {
@@ -300,6 +384,10 @@ private:
             Path::CreateDirectory(Path::GetDirectory(_indexPath));
             auto fs = OpenRCT2::FileStream(_indexPath, OpenRCT2::FILE_MODE_WRITE);
 
+            // Serialise into memory first so the index is written with a
+            // single file write, mirroring the read path.
+            auto ms = OpenRCT2::MemoryStream();
+
             // Write header
             FileIndexHeader header;
             header.MagicNumber = _magicNumber;
@@ -308,14 +396,21 @@ private:
             header.LanguageId = language;
             header.Stats = stats;
             header.NumItems = static_cast<uint32_t>(items.size());
-            fs.WriteValue(header);
+            ms.WriteValue(header);
 
-            DataSerialiser ds(true, fs);
-            // Write items
-            for (const auto& item : items)
+            DataSerialiser ds(true, ms);
+            // Write items, each preceded by its source file's size and
+            // modified time for the incremental rebuild.
+            for (size_t i = 0; i < items.size(); i++)
             {
-                Serialise(ds, item);
+                auto fileSize = fileMeta[i].first;
+                auto fileModified = fileMeta[i].second;
+                ds << fileSize;
+                ds << fileModified;
+                Serialise(ds, items[i]);
             }
+
+            fs.Write(ms.GetData(), static_cast<size_t>(ms.GetLength()));
         }
         catch (const std::exception& e)
         {
@@ -27,6 +27,11 @@
 
 namespace OpenRCT2
 {
+    // Callers frequently issue tiny (4-64 byte) reads and writes through IStream,
+    // so give stdio a much larger buffer than its few-KiB default to amortise the
+    // underlying syscalls into large sequential transfers.
+    constexpr size_t kFileBufferSize = 256 * 1024;
+
     FileStream::FileStream(const fs::path& path, int32_t fileMode)
         : FileStream(path.u8string(), fileMode)
     {
@@ -100,6 +105,10 @@ namespace OpenRCT2
             throw IOException(String::StdFormat("Unable to open '%s'", path));
         }
 
+        // Must happen before any other operation on the stream; stdio allocates
+        // and owns the buffer. Failure just leaves the default buffer in place.
+        setvbuf(_file, nullptr, _IOFBF, kFileBufferSize);
+
 #ifdef _WIN32
         _fileSize = _filelengthi64(_fileno(_file));
 #else
@@ -16,8 +16,10 @@
 
 #    include <cstring>
 #    include <memory>
+#    include <mutex>
 #    include <stdexcept>
 #    include <thread>
+#    include <vector>
 
 #    if defined(_WIN32) && !defined(WIN32_LEAN_AND_MEAN)
 // cURL includes windows.h, but we don't need all of it.
@@ -29,6 +31,42 @@
 
 namespace Http
 {
+    // Easy handles are pooled and reset between requests rather than destroyed;
+    // curl_easy_reset clears the options but keeps the handle's connection
+    // cache, so consecutive requests to the same host reuse the TCP/TLS
+    // connection instead of re-handshaking.
+    static std::mutex _handlePoolMutex;
+    static std::vector<CURL*> _handlePool;
+    static constexpr size_t kMaxPooledHandles = 4;
+
+    static CURL* AcquireHandle()
+    {
+        {
+            std::unique_lock lock(_handlePoolMutex);
+            if (!_handlePool.empty())
+            {
+                auto* handle = _handlePool.back();
+                _handlePool.pop_back();
+                return handle;
+            }
+        }
+        return curl_easy_init();
+    }
+
+    static void ReleaseHandle(CURL* handle)
+    {
+        curl_easy_reset(handle);
+        {
+            std::unique_lock lock(_handlePoolMutex);
+            if (_handlePool.size() < kMaxPooledHandles)
+            {
+                _handlePool.push_back(handle);
+                return;
+            }
+        }
+        curl_easy_cleanup(handle);
+    }
+
     static size_t WriteData(const char* src, size_t size, size_t nmemb, void* userdata)
     {
         size_t realsize = size * nmemb;
@@ -84,8 +122,8 @@ namespace Http
 
     Response Do(const Request& req)
     {
-        CURL* curl = curl_easy_init();
-        std::shared_ptr<void> _(nullptr, [curl](...) { curl_easy_cleanup(curl); });
+        CURL* curl = AcquireHandle();
+        std::shared_ptr<void> _(nullptr, [curl](...) { ReleaseHandle(curl); });
 
         if (!curl)
             throw std::runtime_error("Failed to initialize curl");
@@ -0,0 +1,126 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifndef DISABLE_HTTP
+
+#    include "Http.h"
+
+#    include <chrono>
+#    include <condition_variable>
+#    include <deque>
+#    include <mutex>
+#    include <thread>
+#    include <unordered_map>
+#    include <vector>
+
+namespace Http
+{
+    // Shared dispatcher for asynchronous requests. Requests are queued and
+    // served by a small set of worker threads which are spawned on demand and
+    // exit after being idle for a while; reusing workers lets the backend keep
+    // its connections alive between requests instead of paying a thread and a
+    // TLS handshake per call. Identical GET requests that are still queued are
+    // coalesced into a single fetch with all callbacks invoked on the one
+    // response.
+    namespace
+    {
+        struct PendingRequest
+        {
+            Request Req;
+            std::vector<std::function<void(Response&)>> Callbacks;
+        };
+
+        constexpr size_t kMaxWorkers = 4;
+        constexpr auto kWorkerIdleTimeout = std::chrono::seconds(30);
+
+        std::mutex _mutex;
+        std::condition_variable _condPending;
+        std::deque<PendingRequest> _queue;
+        std::unordered_map<std::string, PendingRequest*> _queuedGets;
+        size_t _numWorkers{};
+        size_t _idleWorkers{};
+
+        void WorkerMain()
+        {
+            std::unique_lock lock(_mutex);
+            while (true)
+            {
+                if (_queue.empty())
+                {
+                    _idleWorkers++;
+                    auto hasWork = _condPending.wait_for(lock, kWorkerIdleTimeout, []() { return !_queue.empty(); });
+                    _idleWorkers--;
+                    if (!hasWork)
+                    {
+                        break;
+                    }
+                    continue;
+                }
+
+                auto pending = std::move(_queue.front());
+                _queue.pop_front();
+                if (pending.Req.method == Method::GET)
+                {
+                    _queuedGets.erase(pending.Req.url);
+                }
+
+                lock.unlock();
+
+                Response res{};
+                try
+                {
+                    res = Do(pending.Req);
+                }
+                catch (const std::exception& e)
+                {
+                    res.error = e.what();
+                }
+                for (auto& callback : pending.Callbacks)
+                {
+                    callback(res);
+                }
+
+                lock.lock();
+            }
+            _numWorkers--;
+        }
+    } // namespace
+
+    void DoAsync(const Request& req, std::function<void(Response& res)> fn)
+    {
+        std::unique_lock lock(_mutex);
+
+        if (req.method == Method::GET)
+        {
+            auto it = _queuedGets.find(req.url);
+            if (it != _queuedGets.end())
+            {
+                it->second->Callbacks.push_back(std::move(fn));
+                return;
+            }
+        }
+
+        auto& pending = _queue.emplace_back();
+        pending.Req = req;
+        pending.Callbacks.push_back(std::move(fn));
+        if (req.method == Method::GET)
+        {
+            _queuedGets[req.url] = &pending;
+        }
+
+        if (_idleWorkers == 0 && _numWorkers < kMaxWorkers)
+        {
+            _numWorkers++;
+            std::thread(WorkerMain).detach();
+        }
+        _condPending.notify_one();
+    }
+} // namespace Http
+
+#endif // DISABLE_HTTP
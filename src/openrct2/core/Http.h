@@ -14,7 +14,6 @@
 #    include <functional>
 #    include <map>
 #    include <string>
-#    include <thread>
 
 namespace Http
 {
@@ -52,23 +51,13 @@ namespace Http
 
     Response Do(const Request& req);
 
-    inline void DoAsync(const Request& req, std::function<void(Response& res)> fn)
-    {
-        auto thread = std::thread([=]() {
-            Response res{};
-            try
-            {
-                res = Do(req);
-            }
-            catch (std::exception& e)
-            {
-                res.error = e.what();
-                return;
-            }
-            fn(res);
-        });
-        thread.detach();
-    }
+    /**
+     * Performs the request on a pooled worker thread and invokes fn with the
+     * response once it completes. On failure the response has error set and
+     * fn is still invoked. Identical GET requests that are still queued share
+     * one fetch. fn runs on the worker thread.
+     */
+    void DoAsync(const Request& req, std::function<void(Response& res)> fn);
 } // namespace Http
 
 #endif // DISABLE_HTTP
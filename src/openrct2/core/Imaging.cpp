@@ -164,14 +164,28 @@ namespace Imaging
         }
     }
 
-    static void WritePng(std::ostream& ostream, const Image& image)
+    struct PngWriter::Impl
+    {
+        std::ostream& Stream;
+        png_structp Png{};
+        png_infop Info{};
+        png_colorp Palette{};
+        bool Finished{};
+
+        explicit Impl(std::ostream& stream)
+            : Stream(stream)
+        {
+        }
+    };
+
+    PngWriter::PngWriter(std::ostream& ostream, uint32_t width, uint32_t height, uint32_t depth, const GamePalette* palette)
+        : _impl(std::make_unique<Impl>(ostream))
     {
-        png_structp png_ptr = nullptr;
-        png_colorp png_palette = nullptr;
+        auto& impl = *_impl;
         try
         {
-            png_ptr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, PngError, PngWarning);
-            if (png_ptr == nullptr)
+            impl.Png = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, PngError, PngWarning);
+            if (impl.Png == nullptr)
             {
                 throw std::runtime_error("png_create_write_struct failed.");
             }
@@ -181,78 +195,115 @@ namespace Imaging
             text_ptr[0].text = const_cast<char*>(gVersionInfoFull);
             text_ptr[0].compression = PNG_TEXT_COMPRESSION_zTXt;
 
-            auto info_ptr = png_create_info_struct(png_ptr);
-            if (info_ptr == nullptr)
+            impl.Info = png_create_info_struct(impl.Png);
+            if (impl.Info == nullptr)
             {
                 throw std::runtime_error("png_create_info_struct failed.");
             }
 
-            if (image.Depth == 8)
+            if (depth == 8)
             {
-                if (image.Palette == nullptr)
+                if (palette == nullptr)
                 {
                     throw std::runtime_error("Expected a palette for 8-bit image.");
                 }
 
                 // Set the palette
-                png_palette = static_cast<png_colorp>(png_malloc(png_ptr, PNG_MAX_PALETTE_LENGTH * sizeof(png_color)));
-                if (png_palette == nullptr)
+                impl.Palette = static_cast<png_colorp>(png_malloc(impl.Png, PNG_MAX_PALETTE_LENGTH * sizeof(png_color)));
+                if (impl.Palette == nullptr)
                 {
                     throw std::runtime_error("png_malloc failed.");
                 }
                 for (size_t i = 0; i < PNG_MAX_PALETTE_LENGTH; i++)
                 {
-                    const auto& entry = (*image.Palette)[i];
-                    png_palette[i].blue = entry.Blue;
-                    png_palette[i].green = entry.Green;
-                    png_palette[i].red = entry.Red;
+                    const auto& entry = (*palette)[i];
+                    impl.Palette[i].blue = entry.Blue;
+                    impl.Palette[i].green = entry.Green;
+                    impl.Palette[i].red = entry.Red;
                 }
-                png_set_PLTE(png_ptr, info_ptr, png_palette, PNG_MAX_PALETTE_LENGTH);
+                png_set_PLTE(impl.Png, impl.Info, impl.Palette, PNG_MAX_PALETTE_LENGTH);
             }
 
-            png_set_write_fn(png_ptr, &ostream, PngWriteData, PngFlush);
+            png_set_write_fn(impl.Png, &impl.Stream, PngWriteData, PngFlush);
 
             // Set error handler
-            if (setjmp(png_jmpbuf(png_ptr)))
+            if (setjmp(png_jmpbuf(impl.Png)))
             {
                 throw std::runtime_error("PNG ERROR");
             }
 
             // Write header
             auto colourType = PNG_COLOR_TYPE_RGB_ALPHA;
-            if (image.Depth == 8)
+            if (depth == 8)
             {
                 png_byte transparentIndex = 0;
-                png_set_tRNS(png_ptr, info_ptr, &transparentIndex, 1, nullptr);
+                png_set_tRNS(impl.Png, impl.Info, &transparentIndex, 1, nullptr);
                 colourType = PNG_COLOR_TYPE_PALETTE;
             }
-            png_set_text(png_ptr, info_ptr, text_ptr, 1);
+            png_set_text(impl.Png, impl.Info, text_ptr, 1);
             png_set_IHDR(
-                png_ptr, info_ptr, image.Width, image.Height, 8, colourType, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
+                impl.Png, impl.Info, width, height, 8, colourType, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT,
                 PNG_FILTER_TYPE_DEFAULT);
-            png_write_info(png_ptr, info_ptr);
-
-            // Write pixels
-            auto pixels = image.Pixels.data();
-            for (uint32_t y = 0; y < image.Height; y++)
-            {
-                png_write_row(png_ptr, const_cast<png_byte*>(pixels));
-                pixels += image.Stride;
-            }
-
-            png_write_end(png_ptr, nullptr);
-            png_destroy_info_struct(png_ptr, &info_ptr);
-            png_free(png_ptr, png_palette);
-            png_destroy_write_struct(&png_ptr, nullptr);
+            png_write_info(impl.Png, impl.Info);
         }
         catch (const std::exception&)
         {
-            png_free(png_ptr, png_palette);
-            png_destroy_write_struct(&png_ptr, nullptr);
+            png_free(impl.Png, impl.Palette);
+            png_destroy_write_struct(&impl.Png, &impl.Info);
             throw;
         }
     }
 
+    PngWriter::~PngWriter()
+    {
+        auto& impl = *_impl;
+        if (!impl.Finished && impl.Png != nullptr)
+        {
+            png_free(impl.Png, impl.Palette);
+            png_destroy_write_struct(&impl.Png, &impl.Info);
+        }
+    }
+
+    void PngWriter::WriteRow(const uint8_t* row)
+    {
+        auto& impl = *_impl;
+        if (setjmp(png_jmpbuf(impl.Png)))
+        {
+            throw std::runtime_error("PNG ERROR");
+        }
+        png_write_row(impl.Png, const_cast<png_byte*>(row));
+    }
+
+    void PngWriter::Finish()
+    {
+        auto& impl = *_impl;
+        if (setjmp(png_jmpbuf(impl.Png)))
+        {
+            throw std::runtime_error("PNG ERROR");
+        }
+        png_write_end(impl.Png, nullptr);
+        png_destroy_info_struct(impl.Png, &impl.Info);
+        png_free(impl.Png, impl.Palette);
+        impl.Palette = nullptr;
+        png_destroy_write_struct(&impl.Png, nullptr);
+        impl.Png = nullptr;
+        impl.Finished = true;
+    }
+
+    static void WritePng(std::ostream& ostream, const Image& image)
+    {
+        PngWriter writer(ostream, image.Width, image.Height, image.Depth, image.Palette.get());
+
+        // Write pixels
+        auto pixels = image.Pixels.data();
+        for (uint32_t y = 0; y < image.Height; y++)
+        {
+            writer.WriteRow(pixels);
+            pixels += image.Stride;
+        }
+        writer.Finish();
+    }
+
     IMAGE_FORMAT GetImageFormatFromPath(std::string_view path)
     {
         if (String::EndsWith(path, ".png", true))
@@ -14,6 +14,7 @@
 #include <functional>
 #include <istream>
 #include <memory>
+#include <ostream>
 #include <string_view>
 #include <vector>
 
@@ -45,6 +46,27 @@ using ImageReaderFunc = std::function<Image(std::istream&, IMAGE_FORMAT)>;
 
 namespace Imaging
 {
+    /**
+     * Incrementally encodes a PNG. Rows are supplied top to bottom and are
+     * compressed as they arrive, so the whole image never has to be resident
+     * in memory at once. The stream must outlive the writer.
+     */
+    class PngWriter
+    {
+    public:
+        PngWriter(std::ostream& ostream, uint32_t width, uint32_t height, uint32_t depth, const GamePalette* palette);
+        PngWriter(const PngWriter&) = delete;
+        PngWriter& operator=(const PngWriter&) = delete;
+        ~PngWriter();
+
+        void WriteRow(const uint8_t* row);
+        void Finish();
+
+    private:
+        struct Impl;
+        std::unique_ptr<Impl> _impl;
+    };
+
     IMAGE_FORMAT GetImageFormatFromPath(std::string_view path);
     Image ReadFromFile(std::string_view path, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
     Image ReadFromBuffer(const std::vector<uint8_t>& buffer, IMAGE_FORMAT format = IMAGE_FORMAT::AUTOMATIC);
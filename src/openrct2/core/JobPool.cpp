@@ -9,11 +9,18 @@
 
 #include "JobPool.h"
 
+#include <algorithm>
 #include <cassert>
 
-JobPool::TaskData::TaskData(std::function<void()> workFn, std::function<void()> completionFn)
+// Identifies the worker queue owned by the current thread, so that tasks
+// submitted from within tasks go to the submitting worker's own deque.
+static thread_local JobPool* _tlsOwner = nullptr;
+static thread_local size_t _tlsWorkerIndex = 0;
+
+JobPool::TaskData::TaskData(std::function<void()> workFn, std::function<void()> completionFn, std::shared_ptr<Dependency> signals)
     : WorkFn(workFn)
     , CompletionFn(completionFn)
+    , Signals(std::move(signals))
 {
 }
 
@@ -22,7 +29,11 @@ JobPool::JobPool(size_t maxThreads)
     maxThreads = std::min<size_t>(maxThreads, std::thread::hardware_concurrency());
     for (size_t n = 0; n < maxThreads; n++)
     {
-        _threads.emplace_back(&JobPool::ProcessQueue, this);
+        _workerQueues.push_back(std::make_unique<WorkerQueue>());
+    }
+    for (size_t n = 0; n < maxThreads; n++)
+    {
+        _threads.emplace_back(&JobPool::ProcessQueue, this, n);
     }
 }
 
@@ -43,9 +54,87 @@ JobPool::~JobPool()
 
 void JobPool::AddTask(std::function<void()> workFn, std::function<void()> completionFn)
 {
-    unique_lock lock(_mutex);
-    _pending.emplace_back(workFn, completionFn);
-    _condPending.notify_one();
+    EnqueueTask(TaskData(workFn, completionFn));
+}
+
+void JobPool::AddTaskSignalling(const std::shared_ptr<Dependency>& signals, std::function<void()> workFn)
+{
+    {
+        std::unique_lock depLock(signals->_mutex);
+        signals->_remaining++;
+    }
+    EnqueueTask(TaskData(workFn, nullptr, signals));
+}
+
+void JobPool::AddTaskAfter(const std::shared_ptr<Dependency>& dependency, std::function<void()> workFn)
+{
+    {
+        std::unique_lock depLock(dependency->_mutex);
+        if (dependency->_remaining != 0)
+        {
+            dependency->_waiting.emplace_back(workFn, nullptr);
+            return;
+        }
+    }
+    EnqueueTask(TaskData(workFn, nullptr));
+}
+
+std::shared_ptr<JobPool::Dependency> JobPool::CreateDependency()
+{
+    return std::make_shared<Dependency>();
+}
+
+void JobPool::ParallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)>& body)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    grainSize = std::max<size_t>(1, grainSize);
+    if (count <= grainSize || _threads.empty())
+    {
+        body(0, count);
+        return;
+    }
+
+    // Chunks are claimed from a shared index so that workers self balance;
+    // the calling thread participates rather than just waiting.
+    std::atomic<size_t> next = { 0 };
+    auto runChunks = [&]() {
+        for (;;)
+        {
+            auto begin = next.fetch_add(grainSize);
+            if (begin >= count)
+            {
+                break;
+            }
+            body(begin, std::min(begin + grainSize, count));
+        }
+    };
+
+    auto numChunks = (count + grainSize - 1) / grainSize;
+    auto numHelpers = std::min(_threads.size(), numChunks - 1);
+
+    std::atomic<size_t> activeHelpers = { numHelpers };
+    std::mutex doneMutex;
+    std::condition_variable doneCond;
+    for (size_t n = 0; n < numHelpers; n++)
+    {
+        AddTask([&]() {
+            runChunks();
+            if (activeHelpers.fetch_sub(1) == 1)
+            {
+                std::unique_lock doneLock(doneMutex);
+                doneCond.notify_all();
+            }
+        });
+    }
+
+    runChunks();
+
+    std::unique_lock doneLock(doneMutex);
+    doneCond.wait(doneLock, [&]() { return activeHelpers == 0; });
 }
 
 void JobPool::Join(std::function<void()> reportFn)
@@ -54,7 +143,7 @@ void JobPool::Join(std::function<void()> reportFn)
     while (true)
     {
         // Wait for the queue to become empty or having completed tasks.
-        _condComplete.wait(lock, [this]() { return (_pending.empty() && _processing == 0) || !_completed.empty(); });
+        _condComplete.wait(lock, [this]() { return (_queued == 0 && _processing == 0) || !_completed.empty(); });
 
         // Dispatch all completion callbacks if there are any.
         while (!_completed.empty())
@@ -82,7 +171,7 @@ void JobPool::Join(std::function<void()> reportFn)
         }
 
         // If everything is empty and no more work has to be done we can stop waiting.
-        if (_completed.empty() && _pending.empty() && _processing == 0)
+        if (_completed.empty() && _queued == 0 && _processing == 0)
         {
             break;
         }
@@ -91,41 +180,136 @@ void JobPool::Join(std::function<void()> reportFn)
 
 size_t JobPool::CountPending()
 {
-    unique_lock lock(_mutex);
-    return _pending.size();
+    return _queued;
 }
 
 size_t JobPool::CountProcessing()
 {
-    unique_lock lock(_mutex);
     return _processing;
 }
 
-void JobPool::ProcessQueue()
+size_t JobPool::GetThreadCount() const noexcept
 {
-    unique_lock lock(_mutex);
-    do
+    return _threads.size();
+}
+
+void JobPool::EnqueueTask(TaskData&& task)
+{
+    // Incremented before the push so that Join can never observe an empty
+    // pool while a task is in flight between the two steps.
+    _queued++;
+    if (_tlsOwner == this)
     {
-        // Wait for work or cancellation.
-        _condPending.wait(lock, [this]() { return _shouldStop || !_pending.empty(); });
+        auto& worker = *_workerQueues[_tlsWorkerIndex];
+        std::unique_lock queueLock(worker.Mutex);
+        worker.Queue.push_back(std::move(task));
+    }
+    else
+    {
+        unique_lock lock(_mutex);
+        _pending.push_back(std::move(task));
+    }
+    _condPending.notify_one();
+}
 
-        if (!_pending.empty())
+bool JobPool::TryTakeTask(size_t workerIndex, TaskData& outTask)
+{
+    bool found = false;
+
+    // Own queue first, newest task for cache locality.
+    {
+        auto& own = *_workerQueues[workerIndex];
+        std::unique_lock queueLock(own.Mutex);
+        if (!own.Queue.empty())
         {
-            _processing++;
+            outTask = std::move(own.Queue.back());
+            own.Queue.pop_back();
+            found = true;
+        }
+    }
 
-            auto taskData = _pending.front();
+    // Then the shared queue of externally submitted tasks.
+    if (!found)
+    {
+        unique_lock lock(_mutex);
+        if (!_pending.empty())
+        {
+            outTask = std::move(_pending.front());
             _pending.pop_front();
+            found = true;
+        }
+    }
 
-            lock.unlock();
+    // Finally steal the oldest task from another worker.
+    for (size_t offset = 1; !found && offset < _workerQueues.size(); offset++)
+    {
+        auto& victim = *_workerQueues[(workerIndex + offset) % _workerQueues.size()];
+        std::unique_lock queueLock(victim.Mutex);
+        if (!victim.Queue.empty())
+        {
+            outTask = std::move(victim.Queue.front());
+            victim.Queue.pop_front();
+            found = true;
+        }
+    }
 
-            taskData.WorkFn();
+    if (found)
+    {
+        // Processing is raised before queued is lowered so that their sum
+        // stays positive while the task is in flight.
+        _processing++;
+        _queued--;
+    }
+    return found;
+}
 
-            lock.lock();
+void JobPool::SignalDependency(const std::shared_ptr<Dependency>& dependency)
+{
+    std::vector<TaskData> released;
+    {
+        std::unique_lock depLock(dependency->_mutex);
+        if (--dependency->_remaining != 0)
+        {
+            return;
+        }
+        released.swap(dependency->_waiting);
+    }
+    for (auto& task : released)
+    {
+        EnqueueTask(std::move(task));
+    }
+}
 
-            _completed.push_back(std::move(taskData));
+void JobPool::ProcessQueue(size_t workerIndex)
+{
+    _tlsOwner = this;
+    _tlsWorkerIndex = workerIndex;
+    while (!_shouldStop)
+    {
+        TaskData task;
+        if (!TryTakeTask(workerIndex, task))
+        {
+            unique_lock lock(_mutex);
+            _condPending.wait(lock, [this]() { return _shouldStop || _queued != 0; });
+            continue;
+        }
 
+        task.WorkFn();
+
+        if (task.Signals)
+        {
+            SignalDependency(task.Signals);
+        }
+
+        {
+            unique_lock lock(_mutex);
+            if (task.CompletionFn)
+            {
+                _completed.push_back(std::move(task));
+            }
             _processing--;
             _condComplete.notify_one();
         }
-    } while (!_shouldStop);
+    }
+    _tlsOwner = nullptr;
 }
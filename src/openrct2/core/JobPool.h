@@ -13,24 +13,64 @@
 #include <condition_variable>
 #include <deque>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <thread>
 #include <vector>
 
 class JobPool
 {
+public:
+    class Dependency;
+
 private:
     struct TaskData
     {
-        const std::function<void()> WorkFn;
-        const std::function<void()> CompletionFn;
+        std::function<void()> WorkFn;
+        std::function<void()> CompletionFn;
+        // Dependency this task contributes to, signalled when the task finishes.
+        std::shared_ptr<Dependency> Signals;
+
+        TaskData() = default;
+        TaskData(std::function<void()> workFn, std::function<void()> completionFn, std::shared_ptr<Dependency> signals = {});
+    };
+
+public:
+    /**
+     * Lightweight task dependency. Tasks scheduled with AddTaskSignalling
+     * contribute to it, tasks scheduled with AddTaskAfter are held back until
+     * every contributing task has finished, allowing "generate, then merge"
+     * graphs without ad-hoc synchronisation. Register the contributing tasks
+     * before the dependent ones, otherwise the dependent tasks run immediately.
+     */
+    class Dependency
+    {
+        friend class JobPool;
 
-        TaskData(std::function<void()> workFn, std::function<void()> completionFn);
+    private:
+        std::mutex _mutex;
+        size_t _remaining{};
+        std::vector<TaskData> _waiting;
+    };
+
+private:
+    // Each worker thread owns a deque guarded by its own mutex. Workers pop
+    // their newest task from the back and steal the oldest task from the front
+    // of other queues, so task submission from within tasks does not contend
+    // on the shared queue.
+    struct WorkerQueue
+    {
+        std::mutex Mutex;
+        std::deque<TaskData> Queue;
     };
 
     std::atomic_bool _shouldStop = { false };
     std::atomic<size_t> _processing = { 0 };
+    // Number of tasks sitting in any queue; drives the sleep/wake predicate
+    // without having to lock every worker queue.
+    std::atomic<size_t> _queued = { 0 };
     std::vector<std::thread> _threads;
+    std::vector<std::unique_ptr<WorkerQueue>> _workerQueues;
     std::deque<TaskData> _pending;
     std::deque<TaskData> _completed;
     std::condition_variable _condPending;
@@ -44,10 +84,25 @@ public:
     ~JobPool();
 
     void AddTask(std::function<void()> workFn, std::function<void()> completionFn = nullptr);
+    void AddTaskSignalling(const std::shared_ptr<Dependency>& signals, std::function<void()> workFn);
+    void AddTaskAfter(const std::shared_ptr<Dependency>& dependency, std::function<void()> workFn);
+    static std::shared_ptr<Dependency> CreateDependency();
+
+    /**
+     * Invokes body(begin, end) over [0, count) in chunks of at most grainSize,
+     * executed across the worker threads with the calling thread participating.
+     * Returns once the whole range has been processed.
+     */
+    void ParallelFor(size_t count, size_t grainSize, const std::function<void(size_t, size_t)>& body);
+
     void Join(std::function<void()> reportFn = nullptr);
     size_t CountPending();
     size_t CountProcessing();
+    size_t GetThreadCount() const noexcept;
 
 private:
-    void ProcessQueue();
+    void ProcessQueue(size_t workerIndex);
+    void EnqueueTask(TaskData&& task);
+    bool TryTakeTask(size_t workerIndex, TaskData& outTask);
+    void SignalDependency(const std::shared_ptr<Dependency>& dependency);
 };
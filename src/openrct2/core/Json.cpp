@@ -26,14 +26,17 @@ namespace Json
             throw IOException("Json file too large.");
         }
 
-        auto fileData = std::string(static_cast<size_t>(fileLength) + 1, '\0');
-        fs.Read(static_cast<void*>(fileData.data()), fileLength);
+        // Read into an uninitialised buffer; zero-filling a string of this size
+        // first would touch every page twice.
+        auto fileData = fs.ReadArray<uint8_t>(fileLength);
 
         json_t json;
 
         try
         {
-            json = json_t::parse(fileData, /* callback */ nullptr, /* allow_exceptions */ true, /* ignore_comments */ true);
+            json = json_t::parse(
+                fileData.get(), fileData.get() + fileLength, /* callback */ nullptr, /* allow_exceptions */ true,
+                /* ignore_comments */ true);
         }
         catch (const json_t::exception& e)
         {
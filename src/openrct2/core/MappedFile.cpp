@@ -0,0 +1,104 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace OpenRCT2
+{
+    std::shared_ptr<MappedFile> MappedFile::TryOpen(u8string_view path)
+    {
+        std::shared_ptr<MappedFile> result(new MappedFile());
+#ifdef _WIN32
+        auto pathW = String::ToWideChar(u8string(path));
+        HANDLE file = CreateFileW(
+            pathW.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return nullptr;
+        }
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+        {
+            CloseHandle(file);
+            return nullptr;
+        }
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping == nullptr)
+        {
+            CloseHandle(file);
+            return nullptr;
+        }
+        void* address = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (address == nullptr)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return nullptr;
+        }
+        result->_fileHandle = file;
+        result->_mappingHandle = mapping;
+        result->_address = address;
+        result->_length = static_cast<size_t>(size.QuadPart);
+#else
+        int fd = open(u8string(path).c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            return nullptr;
+        }
+        struct stat fileStat{};
+        if (fstat(fd, &fileStat) != 0 || fileStat.st_size == 0)
+        {
+            close(fd);
+            return nullptr;
+        }
+        void* address = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_SHARED, fd, 0);
+        // The mapping holds its own reference to the file
+        close(fd);
+        if (address == MAP_FAILED)
+        {
+            return nullptr;
+        }
+        result->_address = address;
+        result->_length = static_cast<size_t>(fileStat.st_size);
+#endif
+        return result;
+    }
+
+    MappedFile::~MappedFile()
+    {
+#ifdef _WIN32
+        if (_address != nullptr)
+        {
+            UnmapViewOfFile(_address);
+        }
+        if (_mappingHandle != nullptr)
+        {
+            CloseHandle(_mappingHandle);
+        }
+        if (_fileHandle != nullptr)
+        {
+            CloseHandle(_fileHandle);
+        }
+#else
+        if (_address != nullptr)
+        {
+            munmap(_address, _length);
+        }
+#endif
+    }
+} // namespace OpenRCT2
@@ -0,0 +1,56 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "String.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace OpenRCT2
+{
+    /**
+     * A read-only memory mapping of a file. Pages are shared between processes
+     * mapping the same file and are only faulted in when first touched.
+     */
+    class MappedFile
+    {
+    private:
+        void* _address = nullptr;
+        size_t _length = 0;
+#ifdef _WIN32
+        void* _fileHandle = nullptr;
+        void* _mappingHandle = nullptr;
+#endif
+
+        MappedFile() = default;
+
+    public:
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile();
+
+        const uint8_t* GetData() const
+        {
+            return static_cast<const uint8_t*>(_address);
+        }
+
+        size_t GetLength() const
+        {
+            return _length;
+        }
+
+        /**
+         * Maps the given file, returning nullptr if it cannot be mapped.
+         */
+        static std::shared_ptr<MappedFile> TryOpen(u8string_view path);
+    };
+} // namespace OpenRCT2
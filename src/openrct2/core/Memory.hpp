@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "../profiling/AllocationTracker.h"
 #include "Guard.hpp"
 
 #include <cstdlib>
@@ -24,6 +25,7 @@ namespace Memory
     {
         T* result = static_cast<T*>(malloc(sizeof(T)));
         Guard::ArgumentNotNull(result, "Failed to allocate %zu bytes for %s", sizeof(T), typeid(T).name());
+        OpenRCT2::AllocationTracker::RecordAllocation(result, sizeof(T));
         return result;
     }
 
@@ -31,6 +33,7 @@ namespace Memory
     {
         T* result = static_cast<T*>(malloc(size));
         Guard::ArgumentNotNull(result, "Failed to allocate %zu bytes for %s", size, typeid(T).name());
+        OpenRCT2::AllocationTracker::RecordAllocation(result, size);
         return result;
     }
 
@@ -38,6 +41,7 @@ namespace Memory
     {
         T* result = static_cast<T*>(malloc(count * sizeof(T)));
         Guard::ArgumentNotNull(result, "Failed to allocate array of %zu * %s (%zu bytes)", count, typeid(T).name(), sizeof(T));
+        OpenRCT2::AllocationTracker::RecordAllocation(result, count * sizeof(T));
         return result;
     }
 
@@ -53,6 +57,7 @@ namespace Memory
             result = static_cast<T*>(realloc(reinterpret_cast<void*>(ptr), size));
         }
         Guard::ArgumentNotNull(result, "Failed to reallocate %x (%s) to have %zu bytes", ptr, typeid(T).name(), size);
+        OpenRCT2::AllocationTracker::RecordReallocation(ptr, result, size);
         return result;
     }
 
@@ -69,11 +74,13 @@ namespace Memory
         }
         Guard::ArgumentNotNull(
             result, "Failed to reallocate array at %x (%s) to have %zu entries", ptr, typeid(T).name(), count);
+        OpenRCT2::AllocationTracker::RecordReallocation(ptr, result, count * sizeof(T));
         return result;
     }
 
     template<typename T> static void Free(T* ptr)
     {
+        OpenRCT2::AllocationTracker::RecordFree(ptr);
         free(const_cast<void*>(reinterpret_cast<const void*>(ptr)));
     }
 
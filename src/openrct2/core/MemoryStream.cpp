@@ -9,8 +9,6 @@
 
 #include "MemoryStream.h"
 
-#include "Memory.hpp"
-
 #include <cstring>
 
 namespace OpenRCT2
@@ -23,16 +21,22 @@ namespace OpenRCT2
 
         if (_access & MEMORY_ACCESS::OWNER)
         {
-            _data = Memory::Allocate<void>(_dataCapacity);
-            std::memcpy(_data, copy._data, _dataCapacity);
-            _position = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(_data) + copy.GetPosition());
+            _buffer = copy._buffer;
+            _data = _buffer.data();
+        }
+        else
+        {
+            // Non-owning streams are views, a copy shares the same memory.
+            _data = copy._data;
         }
+        _position = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(_data) + copy.GetPosition());
     }
 
     MemoryStream::MemoryStream(size_t capacity)
     {
+        _buffer.resize(capacity);
         _dataCapacity = capacity;
-        _data = Memory::Allocate<void>(capacity);
+        _data = _buffer.data();
         _position = _data;
     }
 
@@ -51,17 +55,17 @@ namespace OpenRCT2
     }
 
     MemoryStream::MemoryStream(std::vector<uint8_t>&& v)
+        : _buffer(std::move(v))
     {
-        _access = MEMORY_ACCESS::OWNER;
-        _dataCapacity = v.size();
-        _dataSize = v.size();
-        _data = Memory::Allocate<void>(v.size());
+        _dataCapacity = _buffer.size();
+        _dataSize = _buffer.size();
+        _data = _buffer.data();
         _position = _data;
-        std::memcpy(_data, v.data(), v.size());
     }
 
     MemoryStream::MemoryStream(MemoryStream&& mv) noexcept
         : _access(mv._access)
+        , _buffer(std::move(mv._buffer))
         , _dataCapacity(mv._dataCapacity)
         , _dataSize(mv._dataSize)
         , _data(mv._data)
@@ -73,22 +77,12 @@ namespace OpenRCT2
         mv._dataSize = 0;
     }
 
-    MemoryStream::~MemoryStream()
-    {
-        if (_access & MEMORY_ACCESS::OWNER)
-        {
-            Memory::Free(_data);
-        }
-        _dataCapacity = 0;
-        _dataSize = 0;
-        _data = nullptr;
-    }
-
     MemoryStream& MemoryStream::operator=(MemoryStream&& mv) noexcept
     {
         if (this != &mv)
         {
             _access = mv._access;
+            _buffer = std::move(mv._buffer);
             _dataCapacity = mv._dataCapacity;
             _data = mv._data;
             _dataSize = mv._dataSize;
@@ -108,17 +102,44 @@ namespace OpenRCT2
         return _data;
     }
 
-    void* MemoryStream::GetDataCopy() const
+    std::vector<uint8_t> MemoryStream::ReleaseData()
     {
-        auto result = Memory::Allocate<void>(_dataSize);
-        std::memcpy(result, _data, _dataSize);
+        std::vector<uint8_t> result;
+        if (_access & MEMORY_ACCESS::OWNER)
+        {
+            _buffer.resize(_dataSize);
+            result = std::move(_buffer);
+        }
+        else if (_data != nullptr)
+        {
+            const auto* src = static_cast<const uint8_t*>(_data);
+            result.assign(src, src + _dataSize);
+        }
+        _buffer = {};
+        _dataCapacity = 0;
+        _dataSize = 0;
+        _data = nullptr;
+        _position = nullptr;
         return result;
     }
 
-    void* MemoryStream::TakeData()
+    void MemoryStream::AdoptData(std::vector<uint8_t>&& data)
     {
-        _access &= ~MEMORY_ACCESS::OWNER;
-        return _data;
+        _access = MEMORY_ACCESS::READ | MEMORY_ACCESS::WRITE | MEMORY_ACCESS::OWNER;
+        _buffer = std::move(data);
+        _dataCapacity = _buffer.size();
+        _dataSize = _buffer.size();
+        _data = _buffer.data();
+        _position = _data;
+    }
+
+    MemoryStream MemoryStream::GetView(size_t offset, size_t length) const
+    {
+        if (offset + length > _dataSize)
+        {
+            throw IOException("View out of bounds.");
+        }
+        return MemoryStream(static_cast<const uint8_t*>(_data) + offset, length);
     }
 
     bool MemoryStream::CanRead() const
@@ -279,7 +300,8 @@ namespace OpenRCT2
 
             uint64_t position = GetPosition();
             _dataCapacity = newCapacity;
-            _data = Memory::Reallocate(_data, _dataCapacity);
+            _buffer.resize(_dataCapacity);
+            _data = _buffer.data();
             _position = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(_data) + static_cast<uintptr_t>(position));
         }
     }
@@ -24,11 +24,14 @@ namespace OpenRCT2
 
     /**
      * A stream for reading and writing to a buffer in memory. By default this buffer can grow.
+     * Owned buffers are backed by a std::vector, so whole buffers can be moved in and out of
+     * the stream without copying; non-owning streams are views over external memory.
      */
     class MemoryStream final : public IStream
     {
     private:
         uint8_t _access = MEMORY_ACCESS::READ | MEMORY_ACCESS::WRITE | MEMORY_ACCESS::OWNER;
+        std::vector<uint8_t> _buffer;
         size_t _dataCapacity = 0;
         size_t _dataSize = 0;
         void* _data = nullptr;
@@ -42,13 +45,28 @@ namespace OpenRCT2
         MemoryStream(void* data, size_t dataSize, uint8_t access = MEMORY_ACCESS::READ);
         MemoryStream(const void* data, size_t dataSize);
         MemoryStream(std::vector<uint8_t>&& v);
-        virtual ~MemoryStream();
+        virtual ~MemoryStream() = default;
 
         MemoryStream& operator=(MemoryStream&& mv) noexcept;
 
         const void* GetData() const override;
-        void* GetDataCopy() const;
-        void* TakeData();
+
+        /**
+         * Steals the underlying buffer, leaving the stream empty. Falls back to
+         * copying when the stream does not own its buffer.
+         */
+        std::vector<uint8_t> ReleaseData();
+
+        /**
+         * Replaces the stream contents with the given buffer without copying.
+         */
+        void AdoptData(std::vector<uint8_t>&& data);
+
+        /**
+         * Returns a non-owning read-only stream over a range of this stream's
+         * buffer; the view must not outlive the buffer it references.
+         */
+        MemoryStream GetView(size_t offset, size_t length) const;
 
         ///////////////////////////////////////////////////////////////////////////
         // ISteam methods
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "../util/Util.h"
 #include "../world/Location.hpp"
 #include "Crypt.h"
 #include "FileStream.h"
@@ -18,6 +19,8 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <cstring>
+#include <future>
 #include <stack>
 #include <type_traits>
 #include <vector>
@@ -66,12 +69,17 @@ namespace OpenRCT2
         std::vector<ChunkEntry> _chunks;
         MemoryStream _buffer;
         ChunkEntry _currentChunk;
+        GzipLevel _compressionLevel;
+        std::future<bool> _hashVerification;
 
     public:
-        OrcaStream(IStream& stream, const Mode mode)
+        OrcaStream(
+            IStream& stream, const Mode mode, const GzipLevel compressionLevel = GzipLevel::Default,
+            const uint32_t compression = COMPRESSION_GZIP)
         {
             _stream = &stream;
             _mode = mode;
+            _compressionLevel = compressionLevel;
             if (mode == Mode::READING)
             {
                 _header = _stream->ReadValue<Header>();
@@ -83,34 +91,61 @@ namespace OpenRCT2
                     _chunks.push_back(entry);
                 }
 
-                // Read compressed data into buffer (read in blocks)
-                _buffer = MemoryStream{};
-                uint8_t temp[2048];
-                uint64_t bytesLeft = _header.CompressedSize;
-                do
-                {
-                    auto readLen = std::min(size_t(bytesLeft), sizeof(temp));
-                    _stream->Read(temp, readLen);
-                    _buffer.Write(temp, readLen);
-                    bytesLeft -= readLen;
-                } while (bytesLeft > 0);
+                // Read the compressed data in one go, then let the buffer
+                // adopt the uncompressed bytes; the sizes in the header allow
+                // both allocations to be made up front. The whole payload is
+                // buffered deliberately: callers (e.g. ParkFile) keep reading
+                // chunks after the source stream has been closed, so the
+                // stream must not be referenced past construction.
+                std::vector<uint8_t> compressedData(static_cast<size_t>(_header.CompressedSize));
+                _stream->Read(compressedData.data(), compressedData.size());
 
-                // Uncompress
                 if (_header.Compression == COMPRESSION_GZIP)
                 {
-                    auto uncompressedData = Ungzip(_buffer.GetData(), _buffer.GetLength());
+                    auto uncompressedData = Ungzip(
+                        compressedData.data(), compressedData.size(), static_cast<size_t>(_header.UncompressedSize));
                     if (_header.UncompressedSize != uncompressedData.size())
                     {
                         // Warning?
                     }
-                    _buffer.Clear();
-                    _buffer.Write(uncompressedData.data(), uncompressedData.size());
+                    _buffer = MemoryStream(std::move(uncompressedData));
+                }
+                else
+                {
+                    _buffer = MemoryStream(std::move(compressedData));
+                }
+
+                // Reject chunk entries pointing outside the payload before
+                // anything is parsed; a corrupt or hostile table must not
+                // make it as far as the chunk readers.
+                const auto payloadSize = static_cast<uint64_t>(_buffer.GetLength());
+                for (const auto& entry : _chunks)
+                {
+                    if (entry.Offset > payloadSize || entry.Length > payloadSize - entry.Offset)
+                    {
+                        throw IOException("Chunk table entry exceeds the park file payload.");
+                    }
+                }
+
+                // Verify the payload against the header hash on a worker so
+                // the check overlaps with chunk deserialisation; callers join
+                // via VerifyIntegrity. Writers have always filled the hash
+                // in, but an all-zero value is treated as absent.
+                if (_header.FNV1a != decltype(_header.FNV1a){})
+                {
+                    _hashVerification = std::async(
+                        std::launch::async,
+                        [data = static_cast<const uint8_t*>(_buffer.GetData()), size = static_cast<size_t>(payloadSize),
+                         expected = _header.FNV1a]() { return Crypt::FNV1a(data, size) == expected; });
                 }
             }
             else
             {
                 _header = {};
-                _header.Compression = COMPRESSION_GZIP;
+                // COMPRESSION_NONE trades file size for load speed; reading
+                // such a file is a single sized read with no inflate step,
+                // which suits transient local saves.
+                _header.Compression = compression;
 
                 _buffer = MemoryStream{};
             }
@@ -120,6 +155,12 @@ namespace OpenRCT2
 
         ~OrcaStream()
         {
+            // The verification worker reads out of _buffer, so it must have
+            // finished before the members are destroyed.
+            if (_hashVerification.valid())
+            {
+                _hashVerification.wait();
+            }
             if (_mode == Mode::WRITING)
             {
                 const void* uncompressedData = _buffer.GetData();
@@ -134,7 +175,7 @@ namespace OpenRCT2
                 std::optional<std::vector<uint8_t>> compressedBytes;
                 if (_header.Compression == COMPRESSION_GZIP)
                 {
-                    compressedBytes = Gzip(uncompressedData, uncompressedSize);
+                    compressedBytes = Gzip(uncompressedData, uncompressedSize, _compressionLevel);
                     if (compressedBytes)
                     {
                         _header.CompressedSize = compressedBytes->size();
@@ -165,6 +206,82 @@ namespace OpenRCT2
             }
         }
 
+        /**
+         * Re-encodes a stream written with COMPRESSION_NONE into its gzip
+         * form. The chunk table and FNV1a cover the uncompressed payload, so
+         * only the compression fields of the header change. This lets
+         * serialisation run on the game thread while the costly compression
+         * and disk write happen elsewhere on the finished buffer.
+         */
+        static void Compress(const MemoryStream& uncompressed, IStream& dest, const GzipLevel level = GzipLevel::Default)
+        {
+            const auto* src = static_cast<const uint8_t*>(uncompressed.GetData());
+
+            Header header;
+            std::memcpy(&header, src, sizeof(Header));
+            const size_t tableSize = header.NumChunks * sizeof(ChunkEntry);
+            const auto* payload = src + sizeof(Header) + tableSize;
+
+            if (header.Compression == COMPRESSION_NONE)
+            {
+                auto compressedBytes = Gzip(payload, static_cast<size_t>(header.UncompressedSize), level);
+                header.Compression = COMPRESSION_GZIP;
+                header.CompressedSize = compressedBytes.size();
+                dest.WriteValue(header);
+                dest.Write(src + sizeof(Header), tableSize);
+                dest.Write(compressedBytes.data(), compressedBytes.size());
+            }
+            else
+            {
+                // Already compressed, pass the stream through untouched.
+                dest.Write(src, static_cast<size_t>(uncompressed.GetLength()));
+            }
+        }
+
+        /**
+         * FNV1a over the uncompressed payload with one chunk's bytes skipped,
+         * so two streams can be compared for identical content while ignoring
+         * a chunk holding volatile metadata such as authoring timestamps.
+         */
+        static Crypt::FNV1aAlgorithm::Result ContentHash(const MemoryStream& uncompressed, const uint32_t excludeChunkId)
+        {
+            const auto* src = static_cast<const uint8_t*>(uncompressed.GetData());
+
+            Header header;
+            std::memcpy(&header, src, sizeof(Header));
+            const auto* payload = src + sizeof(Header) + header.NumChunks * sizeof(ChunkEntry);
+
+            auto algo = Crypt::CreateFNV1a();
+            for (uint32_t i = 0; i < header.NumChunks; i++)
+            {
+                ChunkEntry entry;
+                std::memcpy(&entry, src + sizeof(Header) + i * sizeof(ChunkEntry), sizeof(ChunkEntry));
+                if (entry.Id != excludeChunkId)
+                {
+                    algo->Update(payload + entry.Offset, static_cast<size_t>(entry.Length));
+                }
+            }
+            return algo->Finish();
+        }
+
+        /**
+         * Joins the checksum verification started when the stream was opened
+         * for reading and throws if the payload does not match the header
+         * hash. Call this once the cheap chunks have been read, so the hash
+         * computation runs concurrently with deserialisation rather than
+         * adding to the load time.
+         */
+        void VerifyIntegrity()
+        {
+            if (_hashVerification.valid())
+            {
+                if (!_hashVerification.get())
+                {
+                    throw IOException("Park file payload does not match its header checksum.");
+                }
+            }
+        }
+
         Mode GetMode() const
         {
             return _mode;
@@ -11,11 +11,11 @@
 
 #include "String.hpp"
 
-#include <iterator>
+#include <cstring>
 
 StringBuilder::StringBuilder(size_t capacity)
 {
-    _buffer.reserve(capacity);
+    Reserve(capacity);
 }
 
 void StringBuilder::Append(int32_t codepoint)
@@ -25,10 +25,18 @@ void StringBuilder::Append(int32_t codepoint)
 
 void StringBuilder::Append(codepoint_t codepoint)
 {
+    if (codepoint < 0x80)
+    {
+        // ASCII, the overwhelmingly common case: a single byte, no encoding pass.
+        auto b = static_cast<utf8>(codepoint);
+        Append(&b, 1);
+        return;
+    }
+
+    utf8 data[4];
     size_t codepointLength = String::GetCodepointLength(codepoint);
-    std::basic_string<utf8> data(codepointLength, {});
-    String::WriteCodepoint(data.data(), codepoint);
-    _buffer.insert(_buffer.end(), data.begin(), data.end());
+    String::WriteCodepoint(data, codepoint);
+    Append(data, codepointLength);
 }
 
 void StringBuilder::Append(std::string_view text)
@@ -39,7 +47,19 @@ void StringBuilder::Append(std::string_view text)
 
 void StringBuilder::Append(const utf8* text, size_t textLength)
 {
-    _buffer.insert(_buffer.end(), text, text + textLength);
+    if (!_onHeap)
+    {
+        if (_length + textLength + 1 <= kInlineCapacity)
+        {
+            std::memcpy(_inlineBuffer + _length, text, textLength);
+            _length += textLength;
+            _inlineBuffer[_length] = '\0';
+            return;
+        }
+        SpillToHeap(_length + textLength);
+    }
+    _heapBuffer.append(text, textLength);
+    _length = _heapBuffer.size();
 }
 
 void StringBuilder::Append(const StringBuilder* sb)
@@ -47,9 +67,32 @@ void StringBuilder::Append(const StringBuilder* sb)
     Append(sb->GetBuffer(), sb->GetLength());
 }
 
+void StringBuilder::Reserve(size_t capacity)
+{
+    if (_onHeap)
+    {
+        _heapBuffer.reserve(capacity);
+    }
+    else if (capacity + 1 > kInlineCapacity)
+    {
+        SpillToHeap(capacity);
+    }
+}
+
+void StringBuilder::SpillToHeap(size_t capacity)
+{
+    _heapBuffer.reserve(capacity);
+    _heapBuffer.assign(_inlineBuffer, _length);
+    _onHeap = true;
+}
+
 void StringBuilder::Clear()
 {
-    _buffer.clear();
+    // Keeps any heap allocation for another string but resumes building inline.
+    _heapBuffer.clear();
+    _inlineBuffer[0] = '\0';
+    _length = 0;
+    _onHeap = false;
 }
 
 std::string StringBuilder::GetStdString() const
@@ -60,12 +103,12 @@ std::string StringBuilder::GetStdString() const
 const utf8* StringBuilder::GetBuffer() const
 {
     // buffer may be empty, so return an immutable empty string
-    if (_buffer.empty())
+    if (_length == 0)
         return "";
-    return _buffer.c_str();
+    return _onHeap ? _heapBuffer.c_str() : _inlineBuffer;
 }
 
 size_t StringBuilder::GetLength() const
 {
-    return _buffer.size();
+    return _length;
 }
@@ -14,8 +14,10 @@
 #include <string>
 
 /**
- * Class for constructing strings efficiently. A buffer is automatically allocated and reallocated when characters or strings
- * are appended. Use GetString to copy the current state of the string builder to a new fire-and-forget string.
+ * Class for constructing strings efficiently. Strings up to the inline capacity are built in place without touching the heap,
+ * which covers the typical label and token sizes in the UI and format paths; longer strings spill to a heap buffer which grows
+ * as characters or strings are appended. Use GetString to copy the current state of the string builder to a new
+ * fire-and-forget string.
  */
 class StringBuilder final
 {
@@ -49,6 +51,11 @@ public:
      */
     void Append(const StringBuilder* sb);
 
+    /**
+     * Ensures capacity for at least the given number of bytes, for callers that know the final size up front.
+     */
+    void Reserve(size_t capacity);
+
     /**
      * Clears the current string, but preserves the allocated memory for another string.
      */
@@ -71,5 +78,13 @@ public:
     size_t GetLength() const;
 
 private:
-    std::basic_string<utf8> _buffer;
+    // Inline capacity includes the null terminator.
+    static constexpr size_t kInlineCapacity = 64;
+
+    void SpillToHeap(size_t capacity);
+
+    utf8 _inlineBuffer[kInlineCapacity] = {};
+    std::basic_string<utf8> _heapBuffer;
+    size_t _length = 0;
+    bool _onHeap = false;
 };
@@ -55,3 +55,20 @@ bool UTF8StringReader::CanRead() const
 {
     return _current != nullptr;
 }
+
+std::string_view UTF8StringReader::ReadUntilNewLine()
+{
+    if (_current == nullptr)
+        return {};
+
+    // New lines and the terminator are single bytes, so the remainder of the
+    // line can be taken as-is without decoding each codepoint.
+    const utf8* start = _current;
+    const utf8* ch = _current;
+    while (*ch != '\0' && *ch != '\n' && *ch != '\r')
+    {
+        ch++;
+    }
+    _current = ch;
+    return std::string_view(start, ch - start);
+}
@@ -19,6 +19,10 @@ struct IStringReader
     virtual bool TryRead(codepoint_t* outCodepoint) = 0;
     virtual void Skip() = 0;
     virtual bool CanRead() const = 0;
+
+    // Returns everything up to (but not consuming) the next new line or the
+    // end of the text in one pass, without decoding individual codepoints.
+    virtual std::string_view ReadUntilNewLine() = 0;
 };
 
 class UTF8StringReader final : public IStringReader
@@ -30,6 +34,7 @@ public:
     bool TryRead(codepoint_t* outCodepoint) override;
     void Skip() override;
     bool CanRead() const override;
+    std::string_view ReadUntilNewLine() override;
 
 private:
     const utf8* _text;
@@ -0,0 +1,84 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "IStream.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace OpenRCT2
+{
+    /**
+     * A write-only stream appending to a caller-owned byte vector, so data can
+     * be serialised straight into its final buffer without an intermediate
+     * copy.
+     */
+    class VectorStream final : public IStream
+    {
+        std::vector<uint8_t>& _buffer;
+
+    public:
+        VectorStream(std::vector<uint8_t>& buffer)
+            : _buffer(buffer)
+        {
+        }
+
+        VectorStream(const VectorStream&) = delete;
+
+        bool CanRead() const override
+        {
+            return false;
+        }
+
+        bool CanWrite() const override
+        {
+            return true;
+        }
+
+        uint64_t GetLength() const override
+        {
+            return _buffer.size();
+        }
+
+        uint64_t GetPosition() const override
+        {
+            return _buffer.size();
+        }
+
+        void SetPosition(uint64_t position) override
+        {
+        }
+
+        void Seek(int64_t offset, int32_t origin) override
+        {
+        }
+
+        void Read(void* buffer, uint64_t length) override
+        {
+        }
+
+        uint64_t TryRead(void* buffer, uint64_t length) override
+        {
+            return 0;
+        }
+
+        const void* GetData() const override
+        {
+            return _buffer.data();
+        }
+
+        void Write(const void* buffer, uint64_t length) override
+        {
+            const auto* src = reinterpret_cast<const uint8_t*>(buffer);
+            _buffer.insert(_buffer.end(), src, src + length);
+        }
+    };
+} // namespace OpenRCT2
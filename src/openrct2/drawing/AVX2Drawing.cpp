@@ -41,6 +41,70 @@ void MaskAvx2(
     }
 }
 
+/**
+ * Maps 32 destination bytes through a 256-entry palette map. VPSHUFB can only
+ * index 16 bytes at a time, so the map is split into 16 chunks selected by the
+ * high nibble; a gather would read past the end of the map for index 255.
+ */
+static __m256i LookupPalette32(const __m256i values, const uint8_t* RESTRICT paletteMap)
+{
+    const __m256i lowNibble = _mm256_set1_epi8(0x0F);
+    const __m256i low = _mm256_and_si256(values, lowNibble);
+    const __m256i high = _mm256_and_si256(_mm256_srli_epi16(values, 4), lowNibble);
+    __m256i result = _mm256_setzero_si256();
+    for (int32_t chunk = 0; chunk < 16; chunk++)
+    {
+        const __m256i table = _mm256_broadcastsi128_si256(
+            _mm_lddqu_si128(reinterpret_cast<const __m128i*>(paletteMap + chunk * 16)));
+        const __m256i mapped = _mm256_shuffle_epi8(table, low);
+        const __m256i select = _mm256_cmpeq_epi8(high, _mm256_set1_epi8(static_cast<int8_t>(chunk)));
+        result = _mm256_blendv_epi8(result, mapped, select);
+    }
+    return result;
+}
+
+void FilterPaletteAvx2(uint8_t* RESTRICT dst, size_t count, const uint8_t* RESTRICT paletteMap)
+{
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i values = _mm256_lddqu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), LookupPalette32(values, paletteMap));
+    }
+    for (; i < count; i++)
+    {
+        dst[i] = paletteMap[dst[i]];
+    }
+}
+
+void BlendTransparentDstAvx2(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, size_t count, const uint8_t* RESTRICT paletteMap)
+{
+    const __m256i zero = {};
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32)
+    {
+        const __m256i source = _mm256_lddqu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i dest = _mm256_lddqu_si256(reinterpret_cast<const __m256i*>(dst + i));
+        const __m256i mapped = LookupPalette32(dest, paletteMap);
+        // BLEND_TRANSPARENT keeps the destination where the source pixel or
+        // the mapped colour is zero
+        const __m256i keep = _mm256_or_si256(_mm256_cmpeq_epi8(source, zero), _mm256_cmpeq_epi8(mapped, zero));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_blendv_epi8(mapped, dest, keep));
+    }
+    for (; i < count; i++)
+    {
+        if (src[i] != 0)
+        {
+            auto paletteEntry = paletteMap[dst[i]];
+            if (paletteEntry != 0)
+            {
+                dst[i] = paletteEntry;
+            }
+        }
+    }
+}
+
 #else
 
 #    ifdef OPENRCT2_X86
@@ -54,4 +118,15 @@ void MaskAvx2(
     Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
 }
 
+void FilterPaletteAvx2(uint8_t* RESTRICT dst, size_t count, const uint8_t* RESTRICT paletteMap)
+{
+    Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
+void BlendTransparentDstAvx2(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, size_t count, const uint8_t* RESTRICT paletteMap)
+{
+    Guard::Fail("AVX2 function called on a CPU that doesn't support AVX2");
+}
+
 #endif // __AVX2__
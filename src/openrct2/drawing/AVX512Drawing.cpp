@@ -0,0 +1,52 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../core/Guard.hpp"
+#include "Drawing.h"
+
+#if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512VL__)
+
+#    include <immintrin.h>
+
+void MaskAvx512(
+    int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
+    int32_t maskWrap, int32_t colourWrap, int32_t dstWrap)
+{
+    if (width == 32)
+    {
+        const int32_t maskWrapSIMD = maskWrap + 32;
+        const int32_t colourWrapSIMD = colourWrap + 32;
+        const int32_t dstWrapSIMD = dstWrap + 32;
+        for (int32_t yy = 0; yy < height; yy++)
+        {
+            const __m256i colour = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(colourSrc + yy * colourWrapSIMD));
+            const __m256i mask = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(maskSrc + yy * maskWrapSIMD));
+            const __m256i mc = _mm256_and_si256(colour, mask);
+            // With byte-granular masked stores the destination does not have to be read
+            // and blended at all; only the opaque pixels are written back.
+            const __mmask32 opaque = _mm256_test_epi8_mask(mc, mc);
+            _mm256_mask_storeu_epi8(dst + yy * dstWrapSIMD, opaque, mc);
+        }
+    }
+    else
+    {
+        MaskScalar(width, height, maskSrc, colourSrc, dst, maskWrap, colourWrap, dstWrap);
+    }
+}
+
+#else
+
+void MaskAvx512(
+    int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
+    int32_t maskWrap, int32_t colourWrap, int32_t dstWrap)
+{
+    Guard::Fail("AVX-512 function called on a CPU that doesn't support AVX-512");
+}
+
+#endif // __AVX512F__ && __AVX512BW__ && __AVX512VL__
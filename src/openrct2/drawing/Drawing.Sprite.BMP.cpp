@@ -7,8 +7,199 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include "../sprites.h"
 #include "Drawing.h"
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    /**
+     * A bitmap sprite with a palette map already applied to every pixel, so a
+     * remapped draw collapses to a plain transparency-tested copy instead of a
+     * table lookup per pixel. An empty pixel buffer records that the sprite
+     * cannot be pre-translated for this palette.
+     */
+    struct TranslatedBmpSprite
+    {
+        std::vector<uint8_t> Pixels;
+
+        size_t GetMemoryUsage() const
+        {
+            return Pixels.capacity();
+        }
+    };
+
+    struct TranslatedBmpKey
+    {
+        ImageIndex Image;
+        uint64_t PaletteHash;
+
+        bool operator==(const TranslatedBmpKey&) const = default;
+    };
+
+    struct TranslatedBmpKeyHasher
+    {
+        size_t operator()(const TranslatedBmpKey& key) const noexcept
+        {
+            return static_cast<size_t>(key.PaletteHash ^ (key.Image * 0x9E3779B1u));
+        }
+    };
+
+    /**
+     * Memory budgeted LRU cache of palette-translated bitmap sprites, keyed by
+     * image index and the content of the palette map. Keying on the map's
+     * content means glyphs drawn with per-text-colour palettes and sprites
+     * drawn with remap palettes share the same cache and stay correct if a
+     * palette table is swapped out. Entries are handed out as shared pointers
+     * as sprites are drawn from multiple threads and an entry may be evicted
+     * mid-draw.
+     */
+    class TranslatedBmpSpriteCache
+    {
+        static constexpr size_t kMemoryBudget = 16 * 1024 * 1024;
+        // A single sprite may not hog the budget, anything larger stays on the
+        // classic lookup-per-pixel path.
+        static constexpr size_t kMaxEntrySize = kMemoryBudget / 16;
+
+        struct Entry
+        {
+            std::shared_ptr<TranslatedBmpSprite> Sprite;
+            uint64_t LastUsed{};
+        };
+
+        std::unordered_map<TranslatedBmpKey, Entry, TranslatedBmpKeyHasher> _entries;
+        size_t _memoryUsage{};
+        uint64_t _useCounter{};
+        std::mutex _mutex;
+
+    public:
+        std::shared_ptr<TranslatedBmpSprite> GetOrTranslate(ImageIndex imageIndex, const G1Element& g1, const PaletteMap& paletteMap)
+        {
+            const auto key = TranslatedBmpKey{ imageIndex, HashPaletteMap(paletteMap) };
+
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            auto it = _entries.find(key);
+            if (it != _entries.end())
+            {
+                it->second.LastUsed = ++_useCounter;
+                return it->second.Sprite;
+            }
+
+            auto sprite = TranslateSprite(g1, paletteMap);
+            const auto memoryUsage = sprite->GetMemoryUsage();
+            if (memoryUsage > kMaxEntrySize)
+            {
+                return nullptr;
+            }
+
+            _memoryUsage += memoryUsage;
+            EvictUntilWithinBudget();
+            _entries[key] = Entry{ sprite, ++_useCounter };
+            return sprite;
+        }
+
+        void Invalidate(ImageIndex imageIndex)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (auto it = _entries.begin(); it != _entries.end();)
+            {
+                if (it->first.Image == imageIndex)
+                {
+                    _memoryUsage -= it->second.Sprite->GetMemoryUsage();
+                    it = _entries.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+
+        void Clear()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _entries.clear();
+            _memoryUsage = 0;
+        }
+
+    private:
+        static uint64_t HashPaletteMap(const PaletteMap& paletteMap)
+        {
+            // FNV-1a. Remap tables are 256 bytes, glyph palettes only a few.
+            uint64_t hash = 0xCBF29CE484222325uLL;
+            const uint8_t* data = paletteMap.GetData();
+            const auto length = paletteMap.GetDataLength();
+            for (uint32_t i = 0; i < length; i++)
+            {
+                hash = (hash ^ data[i]) * 0x100000001B3uLL;
+            }
+            return hash;
+        }
+
+        static std::shared_ptr<TranslatedBmpSprite> TranslateSprite(const G1Element& g1, const PaletteMap& paletteMap)
+        {
+            auto sprite = std::make_shared<TranslatedBmpSprite>();
+            const auto numPixels = static_cast<size_t>(g1.width) * g1.height;
+            sprite->Pixels.resize(numPixels);
+            const uint8_t* src = g1.offset;
+            for (size_t i = 0; i < numPixels; i++)
+            {
+                const auto pixel = src[i];
+                if (pixel == 0)
+                {
+                    continue;
+                }
+                const auto translated = paletteMap[pixel];
+                if (translated == 0)
+                {
+                    // The palette maps a visible pixel to the transparent
+                    // index; a transparency-tested copy would drop it, so this
+                    // sprite has to keep the per-pixel lookup path.
+                    sprite->Pixels.clear();
+                    sprite->Pixels.shrink_to_fit();
+                    return sprite;
+                }
+                sprite->Pixels[i] = translated;
+            }
+            return sprite;
+        }
+
+        void EvictUntilWithinBudget()
+        {
+            while (_memoryUsage > kMemoryBudget && !_entries.empty())
+            {
+                auto lru = _entries.begin();
+                for (auto it = _entries.begin(); it != _entries.end(); ++it)
+                {
+                    if (it->second.LastUsed < lru->second.LastUsed)
+                    {
+                        lru = it;
+                    }
+                }
+                _memoryUsage -= lru->second.Sprite->GetMemoryUsage();
+                _entries.erase(lru);
+            }
+        }
+    };
+
+    TranslatedBmpSpriteCache _translatedBmpSpriteCache;
+} // namespace
+
+void GfxBmpSpriteCacheInvalidate(ImageIndex imageIndex)
+{
+    _translatedBmpSpriteCache.Invalidate(imageIndex);
+}
+
+void GfxBmpSpriteCacheClear()
+{
+    _translatedBmpSpriteCache.Clear();
+}
+
 template<DrawBlendOp TBlendOp> static void FASTCALL DrawBMPSpriteMagnify(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
 {
     auto& g1 = args.SourceImage;
@@ -72,6 +263,34 @@ template<DrawBlendOp TBlendOp> static void FASTCALL DrawBMPSprite(DrawPixelInfo&
     }
 }
 
+/**
+ * Draws a remapped bitmap sprite from the translated sprite cache, turning the
+ * per-pixel palette lookup into a plain transparency-tested copy. Returns
+ * false when the sprite is not cacheable and the caller has to take the
+ * classic path.
+ */
+static bool FASTCALL DrawBMPSpriteTranslated(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
+{
+    if (!args.Image.HasValue() || args.Image.GetIndex() == SPR_TEMP)
+    {
+        return false;
+    }
+
+    auto translated = _translatedBmpSpriteCache.GetOrTranslate(args.Image.GetIndex(), args.SourceImage, args.PalMap);
+    if (translated == nullptr || translated->Pixels.empty())
+    {
+        return false;
+    }
+
+    G1Element translatedImage = args.SourceImage;
+    translatedImage.offset = translated->Pixels.data();
+    DrawSpriteArgs translatedArgs(
+        args.Image, PaletteMap::GetDefault(), translatedImage, args.SrcX, args.SrcY, args.Width, args.Height,
+        args.DestinationBits);
+    DrawBMPSprite<BLEND_TRANSPARENT>(dpi, translatedArgs);
+    return true;
+}
+
 /**
  * Copies a sprite onto the buffer. There is no compression used on the sprite
  * image.
@@ -93,7 +312,10 @@ void FASTCALL GfxBmpSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& arg
         else
         {
             // Copy non-transparent bitmap data but re-colour using the palette map.
-            DrawBMPSprite<BLEND_TRANSPARENT | BLEND_SRC>(dpi, args);
+            if (!DrawBMPSpriteTranslated(dpi, args))
+            {
+                DrawBMPSprite<BLEND_TRANSPARENT | BLEND_SRC>(dpi, args);
+            }
         }
     }
     else if (imageId.IsBlended())
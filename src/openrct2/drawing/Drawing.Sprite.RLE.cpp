@@ -7,10 +7,273 @@
  * OpenRCT2 is licensed under the GNU General Public License version 3.
  *****************************************************************************/
 
+#include "../sprites.h"
 #include "Drawing.h"
 
 #include <cassert>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    /**
+     * A single decoded run of opaque pixels. The pixels live contiguously in
+     * the owning sprite's pixel buffer, so drawing no longer has to parse the
+     * per-line offsets and chunk headers of the RLE stream.
+     */
+    struct RLESpan
+    {
+        uint32_t SourceOffset;
+        uint16_t Y;
+        uint16_t X;
+        uint16_t Count;
+    };
+
+    struct DecodedRLESprite
+    {
+        std::vector<RLESpan> Spans;
+        std::vector<uint8_t> Pixels;
+
+        size_t GetMemoryUsage() const
+        {
+            return Spans.capacity() * sizeof(RLESpan) + Pixels.capacity();
+        }
+    };
+
+    /**
+     * Memory budgeted LRU cache of decoded RLE sprites keyed by image index.
+     * Entries are handed out as shared pointers as sprites are drawn from
+     * multiple threads and an entry may be evicted mid-draw.
+     */
+    class RLESpriteCache
+    {
+        static constexpr size_t kMemoryBudget = 64 * 1024 * 1024;
+        // A single sprite may not hog the budget, anything larger stays on the
+        // classic decode-per-draw path.
+        static constexpr size_t kMaxEntrySize = kMemoryBudget / 16;
+
+        struct Entry
+        {
+            std::shared_ptr<DecodedRLESprite> Sprite;
+            uint64_t LastUsed{};
+        };
+
+        std::unordered_map<ImageIndex, Entry> _entries;
+        // Recoloured copies of cached sprites, keyed by image index in the
+        // upper half and the remap colours in the lower half. They share the
+        // memory budget and LRU ordering with the plain entries.
+        std::unordered_map<uint64_t, Entry> _remappedEntries;
+        size_t _memoryUsage{};
+        uint64_t _useCounter{};
+        std::mutex _mutex;
+
+    public:
+        std::shared_ptr<DecodedRLESprite> GetOrDecode(ImageIndex imageIndex, const G1Element& g1)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return GetOrDecodeBase(imageIndex, g1);
+        }
+
+        std::shared_ptr<DecodedRLESprite> GetOrDecodeRemapped(
+            ImageIndex imageIndex, const G1Element& g1, uint32_t remapKey, const PaletteMap& paletteMap)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            const auto key = (static_cast<uint64_t>(imageIndex) << 32) | remapKey;
+            auto it = _remappedEntries.find(key);
+            if (it != _remappedEntries.end())
+            {
+                it->second.LastUsed = ++_useCounter;
+                return it->second.Sprite;
+            }
+
+            auto base = GetOrDecodeBase(imageIndex, g1);
+            if (base == nullptr)
+            {
+                return nullptr;
+            }
+
+            // Materialise the recoloured pixels once; subsequent draws of this
+            // (image, colours) combination then blit without any per-pixel
+            // palette lookup. Palette index 0 is kept at 0 so transparency is
+            // decided exactly as the remapping blitter would have decided it.
+            auto variant = std::make_shared<DecodedRLESprite>();
+            variant->Spans = base->Spans;
+            variant->Pixels.resize(base->Pixels.size());
+            for (size_t i = 0; i < base->Pixels.size(); i++)
+            {
+                const auto pixel = base->Pixels[i];
+                variant->Pixels[i] = pixel == 0 ? 0 : paletteMap[pixel];
+            }
+
+            const auto memoryUsage = variant->GetMemoryUsage();
+            if (memoryUsage > kMaxEntrySize)
+            {
+                return nullptr;
+            }
+
+            _memoryUsage += memoryUsage;
+            EvictUntilWithinBudget();
+            _remappedEntries[key] = Entry{ variant, ++_useCounter };
+            return variant;
+        }
+
+        void Invalidate(ImageIndex imageIndex)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto it = _entries.find(imageIndex);
+            if (it != _entries.end())
+            {
+                _memoryUsage -= it->second.Sprite->GetMemoryUsage();
+                _entries.erase(it);
+            }
+            for (auto rit = _remappedEntries.begin(); rit != _remappedEntries.end();)
+            {
+                if (static_cast<ImageIndex>(rit->first >> 32) == imageIndex)
+                {
+                    _memoryUsage -= rit->second.Sprite->GetMemoryUsage();
+                    rit = _remappedEntries.erase(rit);
+                }
+                else
+                {
+                    ++rit;
+                }
+            }
+        }
+
+        void Clear()
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _entries.clear();
+            _remappedEntries.clear();
+            _memoryUsage = 0;
+        }
+
+    private:
+        std::shared_ptr<DecodedRLESprite> GetOrDecodeBase(ImageIndex imageIndex, const G1Element& g1)
+        {
+            auto it = _entries.find(imageIndex);
+            if (it != _entries.end())
+            {
+                it->second.LastUsed = ++_useCounter;
+                return it->second.Sprite;
+            }
+
+            auto sprite = DecodeSprite(g1);
+            const auto memoryUsage = sprite->GetMemoryUsage();
+            if (memoryUsage > kMaxEntrySize)
+            {
+                return nullptr;
+            }
+
+            _memoryUsage += memoryUsage;
+            EvictUntilWithinBudget();
+            _entries[imageIndex] = Entry{ sprite, ++_useCounter };
+            return sprite;
+        }
+
+        static std::shared_ptr<DecodedRLESprite> DecodeSprite(const G1Element& g1)
+        {
+            auto sprite = std::make_shared<DecodedRLESprite>();
+            const uint8_t* src0 = g1.offset;
+            for (int32_t y = 0; y < g1.height; y++)
+            {
+                const uint16_t lineOffset = src0[y * 2] | (src0[y * 2 + 1] << 8);
+                const uint8_t* nextRun = src0 + lineOffset;
+                bool isEndOfLine = false;
+                while (!isEndOfLine)
+                {
+                    const uint8_t* src = nextRun;
+                    auto dataSize = *src++;
+                    auto firstPixelX = *src++;
+                    isEndOfLine = (dataSize & 0x80) != 0;
+                    dataSize &= 0x7F;
+                    nextRun = src + dataSize;
+
+                    if (dataSize != 0)
+                    {
+                        sprite->Spans.push_back({ static_cast<uint32_t>(sprite->Pixels.size()), static_cast<uint16_t>(y),
+                                                  firstPixelX, dataSize });
+                        sprite->Pixels.insert(sprite->Pixels.end(), src, src + dataSize);
+                    }
+                }
+            }
+            sprite->Spans.shrink_to_fit();
+            sprite->Pixels.shrink_to_fit();
+            return sprite;
+        }
+
+        template<typename TMap> static typename TMap::iterator FindLeastRecentlyUsed(TMap& map)
+        {
+            auto lru = map.begin();
+            for (auto it = map.begin(); it != map.end(); ++it)
+            {
+                if (it->second.LastUsed < lru->second.LastUsed)
+                {
+                    lru = it;
+                }
+            }
+            return lru;
+        }
+
+        void EvictUntilWithinBudget()
+        {
+            while (_memoryUsage > kMemoryBudget && !(_entries.empty() && _remappedEntries.empty()))
+            {
+                auto lruBase = FindLeastRecentlyUsed(_entries);
+                auto lruRemapped = FindLeastRecentlyUsed(_remappedEntries);
+                const bool evictBase = !_entries.empty()
+                    && (_remappedEntries.empty() || lruBase->second.LastUsed < lruRemapped->second.LastUsed);
+                if (evictBase)
+                {
+                    _memoryUsage -= lruBase->second.Sprite->GetMemoryUsage();
+                    _entries.erase(lruBase);
+                }
+                else
+                {
+                    _memoryUsage -= lruRemapped->second.Sprite->GetMemoryUsage();
+                    _remappedEntries.erase(lruRemapped);
+                }
+            }
+        }
+    };
+
+    RLESpriteCache _rleSpriteCache;
+
+    /**
+     * Packs the remap colours of an image id into the variant cache key.
+     * Image ids with equal keys always resolve to the same palette map, so a
+     * variant materialised for one draw is valid for all of them.
+     */
+    uint32_t GetRemapKey(ImageId imageId)
+    {
+        uint32_t key = imageId.GetRemap();
+        key |= static_cast<uint32_t>(imageId.GetSecondary()) << 8;
+        key |= static_cast<uint32_t>(imageId.GetTertiary()) << 16;
+        if (imageId.HasSecondary())
+        {
+            key |= 1u << 24;
+        }
+        if (imageId.HasTertiary())
+        {
+            key |= 1u << 25;
+        }
+        return key;
+    }
+} // namespace
+
+void GfxRleSpriteCacheInvalidate(ImageIndex imageIndex)
+{
+    _rleSpriteCache.Invalidate(imageIndex);
+}
+
+void GfxRleSpriteCacheClear()
+{
+    _rleSpriteCache.Clear();
+}
 
 template<DrawBlendOp TBlendOp, size_t TZoom>
 static void FASTCALL DrawRLESpriteMagnify(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
@@ -163,6 +426,15 @@ static void FASTCALL DrawRLESpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArg
                     std::memcpy(dst, src, numPixels);
                 }
             }
+            else if constexpr (TBlendOp == (BLEND_TRANSPARENT | BLEND_DST) && TZoom == 0)
+            {
+                // Glass and water remap whole destination runs, so hand each
+                // contiguous run to the vectorised palette kernel
+                if (numPixels > 0)
+                {
+                    BlendTransparentDstFn(src, dst, numPixels, args.PalMap);
+                }
+            }
             else
             {
                 auto& paletteMap = args.PalMap;
@@ -178,8 +450,182 @@ static void FASTCALL DrawRLESpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArg
     }
 }
 
+template<DrawBlendOp TBlendOp, size_t TZoom>
+static void FASTCALL DrawDecodedSpriteMagnify(DrawPixelInfo& dpi, const DrawSpriteArgs& args, const DecodedRLESprite& sprite)
+{
+    auto dst0 = args.DestinationBits;
+    auto srcX = args.SrcX;
+    auto srcY = args.SrcY;
+    auto width = args.Width;
+    auto height = args.Height;
+    auto& paletteMap = args.PalMap;
+    auto zoom = 1 << TZoom;
+    auto dstLineWidth = (static_cast<size_t>(dpi.width) << TZoom) + dpi.pitch;
+
+    if (srcY < 0)
+    {
+        srcY += zoom;
+        height -= zoom;
+        dst0 += dstLineWidth;
+    }
+
+    for (const auto& span : sprite.Spans)
+    {
+        const int32_t i = span.Y - srcY;
+        if (i < 0 || i >= height)
+        {
+            continue;
+        }
+
+        const uint8_t* src = sprite.Pixels.data() + span.SourceOffset;
+        int32_t x = span.X - srcX;
+        int32_t numPixels = span.Count;
+        if (x < 0)
+        {
+            src += -x;
+            numPixels += x;
+            x = 0;
+        }
+        numPixels = std::min(numPixels, width - x);
+
+        auto dst = dst0 + ((dstLineWidth * i) << TZoom) + (static_cast<size_t>(x) << TZoom);
+        while (numPixels > 0)
+        {
+            BlitPixels<TBlendOp>(src, dst, paletteMap, zoom, dstLineWidth);
+            src++;
+            dst += zoom;
+            numPixels--;
+        }
+    }
+}
+
+template<DrawBlendOp TBlendOp, size_t TZoom>
+static void FASTCALL DrawDecodedSpriteMinify(DrawPixelInfo& dpi, const DrawSpriteArgs& args, const DecodedRLESprite& sprite)
+{
+    auto dst0 = args.DestinationBits;
+    auto srcX = args.SrcX;
+    auto srcY = args.SrcY;
+    auto width = args.Width;
+    auto height = args.Height;
+    auto zoom = 1 << TZoom;
+    auto dstLineWidth = (static_cast<size_t>(dpi.width) >> TZoom) + dpi.pitch;
+
+    if (srcY < 0)
+    {
+        srcY += zoom;
+        height -= zoom;
+        dst0 += dstLineWidth;
+    }
+
+    for (const auto& span : sprite.Spans)
+    {
+        const int32_t i = span.Y - srcY;
+        if (i < 0 || i >= height || (i & (zoom - 1)) != 0)
+        {
+            continue;
+        }
+
+        const uint8_t* src = sprite.Pixels.data() + span.SourceOffset;
+        int32_t x = span.X - srcX;
+        int32_t numPixels = span.Count;
+        if (x > 0)
+        {
+            // If x is not a multiple of zoom, round it up to a multiple
+            auto mod = x & (zoom - 1);
+            if (mod != 0)
+            {
+                auto offset = zoom - mod;
+                x += offset;
+                src += offset;
+                numPixels -= offset;
+            }
+        }
+        else if (x < 0)
+        {
+            // Clamp x to zero if negative
+            src += -x;
+            numPixels += x;
+            x = 0;
+        }
+        numPixels = std::min(numPixels, width - x);
+
+        auto dst = dst0 + dstLineWidth * (i >> TZoom) + (x >> TZoom);
+        if constexpr ((TBlendOp & BLEND_SRC) == 0 && (TBlendOp & BLEND_DST) == 0 && TZoom == 0)
+        {
+            // Since we're sampling each pixel at this zoom level, just do a straight std::memcpy
+            if (numPixels > 0)
+            {
+                std::memcpy(dst, src, numPixels);
+            }
+        }
+        else if constexpr (TBlendOp == (BLEND_TRANSPARENT | BLEND_DST) && TZoom == 0)
+        {
+            // Glass and water remap whole destination runs, so hand each
+            // contiguous run to the vectorised palette kernel
+            if (numPixels > 0)
+            {
+                BlendTransparentDstFn(src, dst, numPixels, args.PalMap);
+            }
+        }
+        else
+        {
+            auto& paletteMap = args.PalMap;
+            while (numPixels > 0)
+            {
+                BlitPixel<TBlendOp>(src, dst, paletteMap);
+                numPixels -= zoom;
+                src += zoom;
+                dst++;
+            }
+        }
+    }
+}
+
+template<DrawBlendOp TBlendOp>
+static void FASTCALL DrawDecodedSprite(DrawPixelInfo& dpi, const DrawSpriteArgs& args, const DecodedRLESprite& sprite)
+{
+    auto zoom_level = static_cast<int8_t>(dpi.zoom_level);
+    switch (zoom_level)
+    {
+        case -2:
+            DrawDecodedSpriteMagnify<TBlendOp, 2>(dpi, args, sprite);
+            break;
+        case -1:
+            DrawDecodedSpriteMagnify<TBlendOp, 1>(dpi, args, sprite);
+            break;
+        case 0:
+            DrawDecodedSpriteMinify<TBlendOp, 0>(dpi, args, sprite);
+            break;
+        case 1:
+            DrawDecodedSpriteMinify<TBlendOp, 1>(dpi, args, sprite);
+            break;
+        case 2:
+            DrawDecodedSpriteMinify<TBlendOp, 2>(dpi, args, sprite);
+            break;
+        case 3:
+            DrawDecodedSpriteMinify<TBlendOp, 3>(dpi, args, sprite);
+            break;
+        default:
+            assert(false);
+            break;
+    }
+}
+
 template<DrawBlendOp TBlendOp> static void FASTCALL DrawRLESprite(DrawPixelInfo& dpi, const DrawSpriteArgs& args)
 {
+    // Use the pre-decoded span representation when the sprite fits in the
+    // cache; the draw loop then only clips and blits contiguous pixel runs.
+    // SPR_TEMP is rewritten before every use, caching it would only churn.
+    if (args.Image.HasValue() && args.Image.GetIndex() != SPR_TEMP)
+    {
+        auto decoded = _rleSpriteCache.GetOrDecode(args.Image.GetIndex(), args.SourceImage);
+        if (decoded != nullptr)
+        {
+            DrawDecodedSprite<TBlendOp>(dpi, args, *decoded);
+            return;
+        }
+    }
+
     auto zoom_level = static_cast<int8_t>(dpi.zoom_level);
     switch (zoom_level)
     {
@@ -223,6 +669,20 @@ void FASTCALL GfxRleSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& arg
         }
         else
         {
+            // Recolouring that derives purely from the image id resolves to
+            // the same palette map on every draw, so the remapped pixels can
+            // be materialised once and then blitted without the per-pixel
+            // table lookup in the inner loop.
+            if (args.PalMapFromImage && args.Image.GetIndex() != SPR_TEMP)
+            {
+                auto remapped = _rleSpriteCache.GetOrDecodeRemapped(
+                    args.Image.GetIndex(), args.SourceImage, GetRemapKey(args.Image), args.PalMap);
+                if (remapped != nullptr)
+                {
+                    DrawDecodedSprite<BLEND_TRANSPARENT>(dpi, args, *remapped);
+                    return;
+                }
+            }
             DrawRLESprite<BLEND_TRANSPARENT | BLEND_SRC>(dpi, args);
         }
     }
@@ -15,6 +15,7 @@
 #include "../PlatformEnvironment.h"
 #include "../config/Config.h"
 #include "../core/FileStream.h"
+#include "../core/MappedFile.h"
 #include "../core/MemoryStream.h"
 #include "../core/Path.hpp"
 #include "../platform/Platform.h"
@@ -235,6 +236,25 @@ static G1Element _g1Temp = {};
 static std::vector<G1Element> _imageListElements;
 bool gTinyFontAntiAliased = false;
 
+/**
+ * Maps the element data region of the given file read-only so the pages are
+ * shared across processes, falling back to reading it onto the heap. The
+ * stream must be positioned at the start of the element data. Returns the base
+ * address of the element data.
+ */
+static uint8_t* LoadGxData(Gx& gx, FileStream& fs, const u8string& path)
+{
+    uint64_t dataOffset = fs.GetPosition();
+    gx.mapping = MappedFile::TryOpen(path);
+    if (gx.mapping != nullptr && gx.mapping->GetLength() >= dataOffset + gx.header.total_size)
+    {
+        return const_cast<uint8_t*>(gx.mapping->GetData()) + dataOffset;
+    }
+    gx.mapping = nullptr;
+    gx.data = fs.ReadArray<uint8_t>(gx.header.total_size);
+    return gx.data.get();
+}
+
 /**
  *
  *  rct2: 0x00678998
@@ -262,12 +282,12 @@ bool GfxLoadG1(const IPlatformEnvironment& env)
         gTinyFontAntiAliased = is_rctc;
 
         // Read element data
-        _g1.data = fs.ReadArray<uint8_t>(_g1.header.total_size);
+        auto* data = LoadGxData(_g1, fs, path);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _g1.header.num_entries; i++)
         {
-            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(_g1.data.get());
+            _g1.elements[i].offset += reinterpret_cast<uintptr_t>(data);
         }
         return true;
     }
@@ -288,21 +308,30 @@ bool GfxLoadG1(const IPlatformEnvironment& env)
 
 void GfxUnloadG1()
 {
+    GfxRleSpriteCacheClear();
+    GfxBmpSpriteCacheClear();
     _g1.data.reset();
+    _g1.mapping = nullptr;
     _g1.elements.clear();
     _g1.elements.shrink_to_fit();
 }
 
 void GfxUnloadG2()
 {
+    GfxRleSpriteCacheClear();
+    GfxBmpSpriteCacheClear();
     _g2.data.reset();
+    _g2.mapping = nullptr;
     _g2.elements.clear();
     _g2.elements.shrink_to_fit();
 }
 
 void GfxUnloadCsg()
 {
+    GfxRleSpriteCacheClear();
+    GfxBmpSpriteCacheClear();
     _csg.data.reset();
+    _csg.mapping = nullptr;
     _csg.elements.clear();
     _csg.elements.shrink_to_fit();
 }
@@ -325,7 +354,7 @@ bool GfxLoadG2()
         ReadAndConvertGxDat(&fs, _g2.header.num_entries, false, _g2.elements.data());
 
         // Read element data
-        _g2.data = fs.ReadArray<uint8_t>(_g2.header.total_size);
+        auto* data = LoadGxData(_g2, fs, path);
 
         if (_g2.header.num_entries != G2_SPRITE_COUNT)
         {
@@ -346,7 +375,7 @@ bool GfxLoadG2()
         // Fix entry data offsets
         for (uint32_t i = 0; i < _g2.header.num_entries; i++)
         {
-            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(_g2.data.get());
+            _g2.elements[i].offset += reinterpret_cast<uintptr_t>(data);
         }
         return true;
     }
@@ -398,12 +427,12 @@ bool GfxLoadCsg()
         ReadAndConvertGxDat(&fileHeader, _csg.header.num_entries, false, _csg.elements.data());
 
         // Read element data
-        _csg.data = fileData.ReadArray<uint8_t>(_csg.header.total_size);
+        auto* data = LoadGxData(_csg, fileData, pathDataPath);
 
         // Fix entry data offsets
         for (uint32_t i = 0; i < _csg.header.num_entries; i++)
         {
-            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(_csg.data.get());
+            _csg.elements[i].offset += reinterpret_cast<uintptr_t>(data);
             // RCT1 used zoomed offsets that counted from the beginning of the file, rather than from the current sprite.
             if (_csg.elements[i].flags & G1_FLAG_HAS_ZOOM_SPRITE)
             {
@@ -498,7 +527,7 @@ void FASTCALL GfxDrawSpriteSoftware(DrawPixelInfo& dpi, const ImageId imageId, c
         {
             palette = PaletteMap::GetDefault();
         }
-        GfxDrawSpritePaletteSetSoftware(dpi, imageId, spriteCoords, *palette);
+        GfxDrawSpritePaletteSetSoftware(dpi, imageId, spriteCoords, *palette, true);
     }
 }
 
@@ -512,7 +541,8 @@ void FASTCALL GfxDrawSpriteSoftware(DrawPixelInfo& dpi, const ImageId imageId, c
  * y (dx)
  */
 void FASTCALL GfxDrawSpritePaletteSetSoftware(
-    DrawPixelInfo& dpi, const ImageId imageId, const ScreenCoordsXY& coords, const PaletteMap& paletteMap)
+    DrawPixelInfo& dpi, const ImageId imageId, const ScreenCoordsXY& coords, const PaletteMap& paletteMap,
+    bool paletteFromImage)
 {
     int32_t x = coords.x;
     int32_t y = coords.y;
@@ -536,7 +566,7 @@ void FASTCALL GfxDrawSpritePaletteSetSoftware(
 
         const auto spriteCoords = ScreenCoordsXY{ x >> 1, y >> 1 };
         GfxDrawSpritePaletteSetSoftware(
-            zoomed_dpi, imageId.WithIndex(imageId.GetIndex() - g1->zoomed_offset), spriteCoords, paletteMap);
+            zoomed_dpi, imageId.WithIndex(imageId.GetIndex() - g1->zoomed_offset), spriteCoords, paletteMap, paletteFromImage);
         return;
     }
 
@@ -661,7 +691,8 @@ void FASTCALL GfxDrawSpritePaletteSetSoftware(
     // Move the pointer to the start point of the destination
     dest_pointer += (zoom_level.ApplyInversedTo(dpi.width) + dpi.pitch) * dest_start_y + dest_start_x;
 
-    DrawSpriteArgs args(imageId, paletteMap, *g1, source_start_x, source_start_y, width, height, dest_pointer);
+    DrawSpriteArgs args(
+        imageId, paletteMap, *g1, source_start_x, source_start_y, width, height, dest_pointer, paletteFromImage);
     GfxSpriteToBuffer(dpi, args);
 }
 
@@ -820,6 +851,10 @@ void GfxSetG1Element(ImageIndex imageId, const G1Element* g1)
 
     if (g1 != nullptr)
     {
+        // The decoded sprite caches may hold the previous content of this slot.
+        GfxRleSpriteCacheInvalidate(imageId);
+        GfxBmpSpriteCacheInvalidate(imageId);
+
         if (isTemp)
         {
             _g1Temp = *g1;
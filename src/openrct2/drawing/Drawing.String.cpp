@@ -425,8 +425,29 @@ void DrawNewsTicker(
 
     DrawText(dpi, screenCoords, { colour }, "");
 
-    u8string wrappedString;
-    GfxWrapString(FormatStringID(format, args), width, FontStyle::Small, &wrappedString, &numLines);
+    // The ticker draws the same item every frame while it scrolls, so the
+    // formatted and wrapped text is cached and only rebuilt when the item text,
+    // the available width or the language changes. The drawing loop below
+    // truncates its buffer in place, so it works on a copy of the cached string.
+    static u8string _cachedArgs;
+    static u8string _cachedWrapped;
+    static StringId _cachedFormat = STR_NONE;
+    static int32_t _cachedWidth;
+    static int32_t _cachedNumLines;
+    static int32_t _cachedLanguage;
+
+    const auto language = LocalisationService_GetCurrentLanguage();
+    if (format != _cachedFormat || width != _cachedWidth || language != _cachedLanguage || args != _cachedArgs)
+    {
+        GfxWrapString(FormatStringID(format, args), width, FontStyle::Small, &_cachedWrapped, &_cachedNumLines);
+        _cachedFormat = format;
+        _cachedWidth = width;
+        _cachedLanguage = language;
+        _cachedArgs = args;
+    }
+
+    u8string wrappedString = _cachedWrapped;
+    numLines = _cachedNumLines;
     lineHeight = FontGetLineHeight(FontStyle::Small);
 
     int32_t numCharactersDrawn = 0;
@@ -496,6 +517,14 @@ static void TTFDrawCharacterSprite(DrawPixelInfo& dpi, int32_t codepoint, TextDr
 
 static void TTFDrawStringRawSprite(DrawPixelInfo& dpi, std::string_view text, TextDrawInfo* info)
 {
+    if (info->flags & TEXT_DRAW_FLAG_NO_DRAW)
+    {
+        // Measurement only: accumulate glyph widths in one batched pass rather
+        // than decoding and drawing each codepoint.
+        info->x += FontSpriteGetStringWidth(info->FontStyle, text);
+        return;
+    }
+
     CodepointView codepoints(text);
     for (auto codepoint : codepoints)
     {
@@ -668,7 +668,12 @@ ImageCatalogue ImageId::GetCatalogue() const
 
 static auto GetMaskFunction()
 {
-    if (Platform::AVX2Available())
+    if (Platform::AVX512Available())
+    {
+        LOG_VERBOSE("registering AVX-512 mask function");
+        return MaskAvx512;
+    }
+    else if (Platform::AVX2Available())
     {
         LOG_VERBOSE("registering AVX2 mask function");
         return MaskAvx2;
@@ -678,6 +683,11 @@ static auto GetMaskFunction()
         LOG_VERBOSE("registering SSE4.1 mask function");
         return MaskSse4_1;
     }
+    else if (Platform::NeonAvailable())
+    {
+        LOG_VERBOSE("registering NEON mask function");
+        return MaskNeon;
+    }
     else
     {
         LOG_VERBOSE("registering scalar mask function");
@@ -694,6 +704,96 @@ void MaskFn(
     MaskFunc(width, height, maskSrc, colourSrc, dst, maskWrap, colourWrap, dstWrap);
 }
 
+void FilterPaletteScalar(uint8_t* RESTRICT dst, size_t count, const uint8_t* RESTRICT paletteMap)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        dst[i] = paletteMap[dst[i]];
+    }
+}
+
+void BlendTransparentDstScalar(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, size_t count, const uint8_t* RESTRICT paletteMap)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        if (src[i] != 0)
+        {
+            auto paletteEntry = paletteMap[dst[i]];
+            if (paletteEntry != 0)
+            {
+                dst[i] = paletteEntry;
+            }
+        }
+    }
+}
+
+static auto GetFilterPaletteFunction()
+{
+    if (Platform::AVX2Available())
+    {
+        LOG_VERBOSE("registering AVX2 palette filter function");
+        return FilterPaletteAvx2;
+    }
+    else
+    {
+        LOG_VERBOSE("registering scalar palette filter function");
+        return FilterPaletteScalar;
+    }
+}
+
+static auto GetBlendTransparentDstFunction()
+{
+    if (Platform::AVX2Available())
+    {
+        LOG_VERBOSE("registering AVX2 transparent destination blend function");
+        return BlendTransparentDstAvx2;
+    }
+    else
+    {
+        LOG_VERBOSE("registering scalar transparent destination blend function");
+        return BlendTransparentDstScalar;
+    }
+}
+
+static const auto FilterPaletteFunc = GetFilterPaletteFunction();
+static const auto BlendTransparentDstFunc = GetBlendTransparentDstFunction();
+
+void FilterPaletteFn(uint8_t* dst, size_t count, const PaletteMap& paletteMap)
+{
+    // The vectorised kernels index the raw map data directly, so they need all
+    // 256 entries to be present; shorter maps keep the bounds-checked lookup.
+    if (paletteMap.GetDataLength() >= 256)
+    {
+        FilterPaletteFunc(dst, count, paletteMap.GetData());
+        return;
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        dst[i] = paletteMap[dst[i]];
+    }
+}
+
+void BlendTransparentDstFn(const uint8_t* src, uint8_t* dst, size_t count, const PaletteMap& paletteMap)
+{
+    if (paletteMap.GetDataLength() >= 256)
+    {
+        BlendTransparentDstFunc(src, dst, count, paletteMap.GetData());
+        return;
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        if (src[i] != 0)
+        {
+            auto paletteEntry = paletteMap[dst[i]];
+            if (paletteEntry != 0)
+            {
+                dst[i] = paletteEntry;
+            }
+        }
+    }
+}
+
 void GfxFilterPixel(DrawPixelInfo& dpi, const ScreenCoordsXY& coords, FilterPaletteID palette)
 {
     GfxFilterRect(dpi, { coords, coords }, palette);
@@ -30,6 +30,7 @@ namespace OpenRCT2
 {
     struct IPlatformEnvironment;
     struct IStream;
+    class MappedFile;
 } // namespace OpenRCT2
 
 namespace OpenRCT2::Drawing
@@ -103,6 +104,9 @@ struct Gx
     RCTG1Header header;
     std::vector<G1Element> elements;
     std::unique_ptr<uint8_t[]> data;
+    // Element data is read directly out of the mapped file when set; data then
+    // stays null and the pages are shared with other processes by the OS.
+    std::shared_ptr<OpenRCT2::MappedFile> mapping;
 };
 
 struct DrawPixelInfo
@@ -401,6 +405,16 @@ public:
     {
     }
 
+    const uint8_t* GetData() const
+    {
+        return _data;
+    }
+
+    uint32_t GetDataLength() const
+    {
+        return _dataLength;
+    }
+
     uint8_t& operator[](size_t index);
     uint8_t operator[](size_t index) const;
     uint8_t Blend(uint8_t src, uint8_t dst) const;
@@ -417,10 +431,13 @@ struct DrawSpriteArgs
     int32_t Width;
     int32_t Height;
     uint8_t* DestinationBits;
+    // True when PalMap was derived purely from Image's remap bits, i.e. equal
+    // image ids are always drawn with an identical palette map.
+    bool PalMapFromImage;
 
     DrawSpriteArgs(
         ImageId image, const PaletteMap& palMap, const G1Element& sourceImage, int32_t srcX, int32_t srcY, int32_t width,
-        int32_t height, uint8_t* destinationBits)
+        int32_t height, uint8_t* destinationBits, bool palMapFromImage = false)
         : Image(image)
         , PalMap(palMap)
         , SourceImage(sourceImage)
@@ -429,6 +446,7 @@ struct DrawSpriteArgs
         , Width(width)
         , Height(height)
         , DestinationBits(destinationBits)
+        , PalMapFromImage(palMapFromImage)
     {
     }
 };
@@ -566,6 +584,10 @@ bool IsCsgLoaded();
 void FASTCALL GfxSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& args);
 void FASTCALL GfxBmpSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& args);
 void FASTCALL GfxRleSpriteToBuffer(DrawPixelInfo& dpi, const DrawSpriteArgs& args);
+void GfxRleSpriteCacheInvalidate(ImageIndex imageIndex);
+void GfxRleSpriteCacheClear();
+void GfxBmpSpriteCacheInvalidate(ImageIndex imageIndex);
+void GfxBmpSpriteCacheClear();
 void FASTCALL GfxDrawSprite(DrawPixelInfo& dpi, const ImageId image_id, const ScreenCoordsXY& coords);
 void FASTCALL GfxDrawGlyph(DrawPixelInfo& dpi, const ImageId image, const ScreenCoordsXY& coords, const PaletteMap& paletteMap);
 void FASTCALL GfxDrawSpriteSolid(DrawPixelInfo& dpi, const ImageId image, const ScreenCoordsXY& coords, uint8_t colour);
@@ -573,7 +595,8 @@ void FASTCALL GfxDrawSpriteRawMasked(
     DrawPixelInfo& dpi, const ScreenCoordsXY& coords, const ImageId maskImage, const ImageId colourImage);
 void FASTCALL GfxDrawSpriteSoftware(DrawPixelInfo& dpi, const ImageId imageId, const ScreenCoordsXY& spriteCoords);
 void FASTCALL GfxDrawSpritePaletteSetSoftware(
-    DrawPixelInfo& dpi, const ImageId imageId, const ScreenCoordsXY& coords, const PaletteMap& paletteMap);
+    DrawPixelInfo& dpi, const ImageId imageId, const ScreenCoordsXY& coords, const PaletteMap& paletteMap,
+    bool paletteFromImage = false);
 void FASTCALL GfxDrawSpriteRawMaskedSoftware(
     DrawPixelInfo& dpi, const ScreenCoordsXY& scrCoords, const ImageId maskImage, const ImageId colourImage);
 
@@ -620,11 +643,27 @@ void MaskSse4_1(
 void MaskAvx2(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
+void MaskAvx512(
+    int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
+    int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
+void MaskNeon(
+    int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
+    int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
 void MaskFn(
     int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
     int32_t maskWrap, int32_t colourWrap, int32_t dstWrap);
 
+void FilterPaletteScalar(uint8_t* RESTRICT dst, size_t count, const uint8_t* RESTRICT paletteMap);
+void FilterPaletteAvx2(uint8_t* RESTRICT dst, size_t count, const uint8_t* RESTRICT paletteMap);
+void BlendTransparentDstScalar(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, size_t count, const uint8_t* RESTRICT paletteMap);
+void BlendTransparentDstAvx2(
+    const uint8_t* RESTRICT src, uint8_t* RESTRICT dst, size_t count, const uint8_t* RESTRICT paletteMap);
+
+void FilterPaletteFn(uint8_t* dst, size_t count, const PaletteMap& paletteMap);
+void BlendTransparentDstFn(const uint8_t* src, uint8_t* dst, size_t count, const PaletteMap& paletteMap);
+
 std::optional<uint32_t> GetPaletteG1Index(colour_t paletteId);
 std::optional<PaletteMap> GetPaletteMapForColour(colour_t paletteId);
 void UpdatePalette(const uint8_t* colours, int32_t start_index, int32_t num_colours);
@@ -19,6 +19,7 @@
 #include "Drawing.h"
 #include "TTF.h"
 
+#include <cstring>
 #include <iterator>
 #include <limits>
 #include <unordered_map>
@@ -32,6 +33,11 @@ static constexpr int32_t SpriteFontLineHeight[FontStyleCount] = {
 static uint8_t _spriteFontCharacterWidths[FontStyleCount][FONT_SPRITE_GLYPH_COUNT];
 static uint8_t _additionalSpriteFontCharacterWidth[FontStyleCount][SPR_G2_GLYPH_COUNT] = {};
 
+// Widths of the 7-bit codepoints indexed directly by byte value, so that
+// measuring the ASCII portions of a string is a flat table sum that the
+// compiler can vectorise rather than a decode and lookup per character.
+static uint8_t _asciiSpriteFontWidths[FontStyleCount][128] = {};
+
 #ifndef NO_TTF
 TTFFontSetDescriptor* gCurrentTTFFontSet;
 #endif // NO_TTF
@@ -297,6 +303,15 @@ void FontSpriteInitialiseCharacters()
         }
     }
 
+    for (const auto& fontStyle : FontStyles)
+    {
+        for (int32_t codepoint = 0; codepoint < 128; codepoint++)
+        {
+            _asciiSpriteFontWidths[EnumValue(fontStyle)][codepoint] = static_cast<uint8_t>(
+                FontSpriteGetCodepointWidth(fontStyle, codepoint));
+        }
+    }
+
     ScrollingTextInitialiseBitmaps();
 }
 
@@ -341,6 +356,42 @@ int32_t FontSpriteGetCodepointWidth(FontStyle fontStyle, int32_t codepoint)
     return _spriteFontCharacterWidths[baseFontIndex][glyphIndex];
 }
 
+int32_t FontSpriteGetStringWidth(FontStyle fontStyle, std::string_view text)
+{
+    const auto* asciiWidths = _asciiSpriteFontWidths[EnumValue(fontStyle)];
+    int32_t width = 0;
+    size_t i = 0;
+    while (i < text.size())
+    {
+        auto c = static_cast<uint8_t>(text[i]);
+        if (c < 0x80)
+        {
+            // Accumulate a run of plain ASCII straight from the width table
+            // without decoding codepoints.
+            size_t runEnd = i;
+            do
+            {
+                width += asciiWidths[static_cast<uint8_t>(text[runEnd])];
+                runEnd++;
+            } while (runEnd < text.size() && !(static_cast<uint8_t>(text[runEnd]) & 0x80));
+            i = runEnd;
+        }
+        else
+        {
+            // Multi-byte sequence, fall back to the generic codepoint lookup.
+            // Copy into a NUL padded buffer so that a sequence truncated by the
+            // end of the string cannot be read past.
+            char buffer[5]{};
+            std::memcpy(buffer, text.data() + i, std::min<size_t>(text.size() - i, 4));
+            const utf8* next{};
+            auto codepoint = UTF8GetNext(buffer, &next);
+            width += FontSpriteGetCodepointWidth(fontStyle, codepoint);
+            i += next - buffer;
+        }
+    }
+    return width;
+}
+
 ImageId FontSpriteGetCodepointSprite(FontStyle fontStyle, int32_t codepoint)
 {
     int32_t offset = EnumValue(fontStyle) * FONT_SPRITE_GLYPH_COUNT;
@@ -13,6 +13,7 @@
 #include "../drawing/ImageId.hpp"
 
 #include <array>
+#include <string_view>
 
 constexpr uint16_t FONT_SPRITE_GLYPH_COUNT = 224;
 
@@ -54,6 +55,7 @@ extern TTFFontSetDescriptor* gCurrentTTFFontSet;
 void FontSpriteInitialiseCharacters();
 int32_t FontSpriteGetCodepointOffset(int32_t codepoint);
 int32_t FontSpriteGetCodepointWidth(FontStyle fontStyle, int32_t codepoint);
+int32_t FontSpriteGetStringWidth(FontStyle fontStyle, std::string_view text);
 ImageId FontSpriteGetCodepointSprite(FontStyle fontStyle, int32_t codepoint);
 int32_t FontGetLineHeight(FontStyle fontStyle);
 int32_t FontGetLineHeightSmall(FontStyle fontStyle);
@@ -13,6 +13,7 @@
 #include "../Game.h"
 #include "../GameState.h"
 #include "../config/Config.h"
+#include "../core/JobPool.h"
 #include "../entity/EntityRegistry.h"
 #include "../interface/Viewport.h"
 #include "../interface/Window.h"
@@ -26,6 +27,8 @@
 
 #include <cmath>
 #include <cstring>
+#include <memory>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -64,6 +67,21 @@ struct LightListEntry
     uint8_t LightLinger;
 };
 
+// A light halo clipped against the render buffer, ready to accumulate.
+struct LightBlit
+{
+    const uint8_t* ReadBase;
+    uint32_t ReadStride;
+    int32_t X;
+    int32_t Y;
+    int32_t Width;
+    int32_t Height;
+    uint8_t Intensity;
+};
+
+static std::vector<LightBlit> _lightBlits;
+static std::unique_ptr<JobPool> _lightFXJobs;
+
 static LightListEntry _LightListA[16000];
 static LightListEntry _LightListB[16000];
 
@@ -442,6 +460,64 @@ void LightFXUpdateViewportSettings()
     }
 }
 
+// Accumulates the rows of a blit that fall inside [bandTop, bandBottom) into
+// the front buffer. Bands never overlap, so concurrent calls for different
+// bands are free of write conflicts.
+static void LightFXAccumulateBlit(const LightBlit& blit, int32_t bandTop, int32_t bandBottom)
+{
+    const int32_t top = std::max(blit.Y, bandTop);
+    const int32_t bottom = std::min(blit.Y + blit.Height, bandBottom);
+    if (top >= bottom)
+        return;
+
+    const uint8_t* bufReadBase = blit.ReadBase + static_cast<uint32_t>(top - blit.Y) * blit.ReadStride;
+    uint8_t* bufWriteBase = static_cast<uint8_t*>(_light_rendered_buffer_front) + top * _pixelInfo.width + blit.X;
+
+    if (blit.Intensity == 0xFF)
+    {
+        for (int32_t y = top; y < bottom; y++)
+        {
+            for (int32_t x = 0; x < blit.Width; x++)
+            {
+                // Saturating add, written so the compiler can vectorise it
+                uint8_t sum = static_cast<uint8_t>(bufWriteBase[x] + bufReadBase[x]);
+                bufWriteBase[x] = sum < bufReadBase[x] ? 0xFF : sum;
+            }
+            bufWriteBase += _pixelInfo.width;
+            bufReadBase += blit.ReadStride;
+        }
+    }
+    else
+    {
+        const uint32_t scale = 1 + blit.Intensity;
+        for (int32_t y = top; y < bottom; y++)
+        {
+            for (int32_t x = 0; x < blit.Width; x++)
+            {
+                uint8_t value = static_cast<uint8_t>((bufReadBase[x] * scale) >> 8);
+                uint8_t sum = static_cast<uint8_t>(bufWriteBase[x] + value);
+                bufWriteBase[x] = sum < value ? 0xFF : sum;
+            }
+            bufWriteBase += _pixelInfo.width;
+            bufReadBase += blit.ReadStride;
+        }
+    }
+}
+
+static JobPool* LightFXGetJobPool()
+{
+    bool useMultithreading = Config::Get().general.MultiThreading;
+    if (useMultithreading && _lightFXJobs == nullptr)
+    {
+        _lightFXJobs = std::make_unique<JobPool>();
+    }
+    else if (useMultithreading == false && _lightFXJobs != nullptr)
+    {
+        _lightFXJobs.reset();
+    }
+    return _lightFXJobs.get();
+}
+
 void LightFXRenderLightsToFrontBuffer()
 {
     if (_light_rendered_buffer_front == nullptr)
@@ -455,14 +531,15 @@ void LightFXRenderLightsToFrontBuffer()
 
     //  LOG_WARNING("%i lights", LightListCurrentCountFront);
 
+    // Clip every light against the buffer up front so the accumulation below
+    // only deals with rectangles that are fully inside it.
+    _lightBlits.clear();
     for (uint32_t light = 0; light < LightListCurrentCountFront; light++)
     {
         const uint8_t* bufReadBase = nullptr;
-        uint8_t* bufWriteBase = static_cast<uint8_t*>(_light_rendered_buffer_front);
         uint32_t bufReadWidth, bufReadHeight;
         int32_t bufWriteX, bufWriteY;
         int32_t bufWriteWidth, bufWriteHeight;
-        uint32_t bufReadSkip, bufWriteSkip;
 
         LightListEntry* entry = &_LightListFront[light];
 
@@ -538,10 +615,6 @@ void LightFXRenderLightsToFrontBuffer()
             bufReadBase += -bufWriteX;
             bufWriteWidth += bufWriteX;
         }
-        else
-        {
-            bufWriteBase += bufWriteX;
-        }
 
         if (bufWriteWidth <= 0)
             continue;
@@ -551,10 +624,6 @@ void LightFXRenderLightsToFrontBuffer()
             bufReadBase += -bufWriteY * bufReadWidth;
             bufWriteHeight += bufWriteY;
         }
-        else
-        {
-            bufWriteBase += bufWriteY * _pixelInfo.width;
-        }
 
         if (bufWriteHeight <= 0)
             continue;
@@ -578,40 +647,40 @@ void LightFXRenderLightsToFrontBuffer()
 
         _lightPolution_back += (bufWriteWidth * bufWriteHeight) / 256;
 
-        bufReadSkip = bufReadWidth - bufWriteWidth;
-        bufWriteSkip = _pixelInfo.width - bufWriteWidth;
+        _lightBlits.push_back({ bufReadBase, bufReadWidth, std::max(0, bufWriteX), std::max(0, bufWriteY), bufWriteWidth,
+                                bufWriteHeight, entry->LightIntensity });
+    }
+
+    if (_lightBlits.empty())
+    {
+        return;
+    }
 
-        if (entry->LightIntensity == 0xFF)
+    auto* jobPool = LightFXGetJobPool();
+    if (jobPool == nullptr)
+    {
+        for (const auto& blit : _lightBlits)
         {
-            for (int32_t y = 0; y < bufWriteHeight; y++)
-            {
-                for (int32_t x = 0; x < bufWriteWidth; x++)
-                {
-                    *bufWriteBase = std::min(0xFF, *bufWriteBase + *bufReadBase);
-                    bufWriteBase++;
-                    bufReadBase++;
-                }
-
-                bufWriteBase += bufWriteSkip;
-                bufReadBase += bufReadSkip;
-            }
+            LightFXAccumulateBlit(blit, 0, _pixelInfo.height);
         }
-        else
-        {
-            for (int32_t y = 0; y < bufWriteHeight; y++)
-            {
-                for (int32_t x = 0; x < bufWriteWidth; x++)
-                {
-                    *bufWriteBase = std::min(0xFF, *bufWriteBase + (((*bufReadBase) * (1 + entry->LightIntensity)) >> 8));
-                    bufWriteBase++;
-                    bufReadBase++;
-                }
+        return;
+    }
 
-                bufWriteBase += bufWriteSkip;
-                bufReadBase += bufReadSkip;
+    // Horizontal bands: each task owns its rows exclusively, a halo crossing
+    // a band boundary simply contributes its clipped part to each band.
+    const int32_t numBands = static_cast<int32_t>(jobPool->GetThreadCount() * 2);
+    const int32_t bandHeight = std::max(1, (_pixelInfo.height + numBands - 1) / std::max(1, numBands));
+    for (int32_t bandTop = 0; bandTop < _pixelInfo.height; bandTop += bandHeight)
+    {
+        const int32_t bandBottom = std::min<int32_t>(_pixelInfo.height, bandTop + bandHeight);
+        jobPool->AddTask([bandTop, bandBottom]() -> void {
+            for (const auto& blit : _lightBlits)
+            {
+                LightFXAccumulateBlit(blit, bandTop, bandBottom);
             }
-        }
+        });
     }
+    jobPool->Join();
 }
 
 void* LightFXGetFrontBuffer()
@@ -1033,30 +1102,49 @@ void LightFXRenderToTexture(
         return;
     }
 
-    for (uint32_t y = 0; y < height; y++)
-    {
-        uintptr_t dstOffset = static_cast<uintptr_t>(y * dstPitch);
-        uint32_t* dst = reinterpret_cast<uint32_t*>(reinterpret_cast<uintptr_t>(dstPixels) + dstOffset);
-        for (uint32_t x = 0; x < width; x++)
+    const auto mixRows = [&](uint32_t yStart, uint32_t yEnd) -> void {
+        for (uint32_t y = yStart; y < yEnd; y++)
         {
-            uint8_t* src = &bits[y * width + x];
-            uint32_t darkColour = palette[*src];
-            uint32_t lightColour = lightPalette[*src];
-            uint8_t lightIntensity = lightBits[y * width + x];
-
-            uint32_t colour = 0;
-            if (lightIntensity == 0)
-            {
-                colour = darkColour;
-            }
-            else
+            uintptr_t dstOffset = static_cast<uintptr_t>(y * dstPitch);
+            uint32_t* dst = reinterpret_cast<uint32_t*>(reinterpret_cast<uintptr_t>(dstPixels) + dstOffset);
+            for (uint32_t x = 0; x < width; x++)
             {
-                colour |= MixLight((darkColour >> 0) & 0xFF, (lightColour >> 0) & 0xFF, lightIntensity);
-                colour |= MixLight((darkColour >> 8) & 0xFF, (lightColour >> 8) & 0xFF, lightIntensity) << 8;
-                colour |= MixLight((darkColour >> 16) & 0xFF, (lightColour >> 16) & 0xFF, lightIntensity) << 16;
-                colour |= MixLight((darkColour >> 24) & 0xFF, (lightColour >> 24) & 0xFF, lightIntensity) << 24;
+                uint8_t* src = &bits[y * width + x];
+                uint32_t darkColour = palette[*src];
+                uint32_t lightColour = lightPalette[*src];
+                uint8_t lightIntensity = lightBits[y * width + x];
+
+                uint32_t colour = 0;
+                if (lightIntensity == 0)
+                {
+                    colour = darkColour;
+                }
+                else
+                {
+                    colour |= MixLight((darkColour >> 0) & 0xFF, (lightColour >> 0) & 0xFF, lightIntensity);
+                    colour |= MixLight((darkColour >> 8) & 0xFF, (lightColour >> 8) & 0xFF, lightIntensity) << 8;
+                    colour |= MixLight((darkColour >> 16) & 0xFF, (lightColour >> 16) & 0xFF, lightIntensity) << 16;
+                    colour |= MixLight((darkColour >> 24) & 0xFF, (lightColour >> 24) & 0xFF, lightIntensity) << 24;
+                }
+                *dst++ = colour;
             }
-            *dst++ = colour;
         }
+    };
+
+    auto* jobPool = LightFXGetJobPool();
+    if (jobPool == nullptr)
+    {
+        mixRows(0, height);
+        return;
+    }
+
+    // Rows are fully independent, merge them in bands as well.
+    const uint32_t numBands = static_cast<uint32_t>(jobPool->GetThreadCount() * 2);
+    const uint32_t bandHeight = std::max<uint32_t>(1, (height + numBands - 1) / std::max<uint32_t>(1, numBands));
+    for (uint32_t bandTop = 0; bandTop < height; bandTop += bandHeight)
+    {
+        const uint32_t bandBottom = std::min(height, bandTop + bandHeight);
+        jobPool->AddTask([&mixRows, bandTop, bandBottom]() -> void { mixRows(bandTop, bandBottom); });
     }
+    jobPool->Join();
 }
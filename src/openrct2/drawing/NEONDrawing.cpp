@@ -0,0 +1,59 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "../core/Guard.hpp"
+#include "Drawing.h"
+
+#if defined(__ARM_NEON) || defined(_M_ARM64)
+
+#    include <arm_neon.h>
+
+void MaskNeon(
+    int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
+    int32_t maskWrap, int32_t colourWrap, int32_t dstWrap)
+{
+    if (width == 32)
+    {
+        const int32_t maskWrapSIMD = maskWrap + 32;
+        const int32_t colourWrapSIMD = colourWrap + 32;
+        const int32_t dstWrapSIMD = dstWrap + 32;
+        const uint8x16_t zero = vdupq_n_u8(0);
+        for (int32_t yy = 0; yy < height; yy++)
+        {
+            const uint8_t* colourRow = colourSrc + yy * colourWrapSIMD;
+            const uint8_t* maskRow = maskSrc + yy * maskWrapSIMD;
+            uint8_t* dstRow = dst + yy * dstWrapSIMD;
+            for (int32_t xx = 0; xx < 32; xx += 16)
+            {
+                const uint8x16_t colour = vld1q_u8(colourRow + xx);
+                const uint8x16_t mask = vld1q_u8(maskRow + xx);
+                const uint8x16_t dest = vld1q_u8(dstRow + xx);
+                const uint8x16_t mc = vandq_u8(colour, mask);
+                const uint8x16_t saturate = vceqq_u8(mc, zero);
+                const uint8x16_t blended = vbslq_u8(saturate, dest, mc);
+                vst1q_u8(dstRow + xx, blended);
+            }
+        }
+    }
+    else
+    {
+        MaskScalar(width, height, maskSrc, colourSrc, dst, maskWrap, colourWrap, dstWrap);
+    }
+}
+
+#else
+
+void MaskNeon(
+    int32_t width, int32_t height, const uint8_t* RESTRICT maskSrc, const uint8_t* RESTRICT colourSrc, uint8_t* RESTRICT dst,
+    int32_t maskWrap, int32_t colourWrap, int32_t dstWrap)
+{
+    Guard::Fail("NEON function called on a CPU that doesn't support NEON");
+}
+
+#endif // __ARM_NEON || _M_ARM64
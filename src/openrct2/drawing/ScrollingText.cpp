@@ -20,11 +20,15 @@
 #include "Drawing.h"
 #include "TTF.h"
 
+#include <array>
 #include <cassert>
 #include <mutex>
+#include <unordered_map>
 
 using namespace OpenRCT2;
 
+constexpr size_t kScrollingTextBitmapSize = 64 * 40;
+
 struct DrawScrollText
 {
     StringId string_id;
@@ -33,7 +37,7 @@ struct DrawScrollText
     uint16_t position;
     uint16_t mode;
     uint32_t id;
-    uint8_t bitmap[64 * 40];
+    uint8_t bitmap[kScrollingTextBitmapSize];
 };
 
 static DrawScrollText _drawScrollTextList[OpenRCT2::MaxScrollingTextEntries];
@@ -41,6 +45,112 @@ static uint8_t _characterBitmaps[FONT_SPRITE_GLYPH_COUNT + SPR_G2_GLYPH_COUNT][8
 static uint32_t _drawSCrollNextIndex = 0;
 static std::mutex _scrollingTextMutex;
 
+namespace
+{
+    /**
+     * Identifies one rendered scroll bitmap. The rendering settings are part
+     * of the key so toggling them never serves a stale bitmap.
+     */
+    struct ScrollTextCacheKey
+    {
+        StringId String;
+        std::array<uint8_t, 32> Args;
+        colour_t Colour;
+        uint16_t Position;
+        uint16_t Mode;
+        bool UpperCase;
+        bool UseTrueType;
+
+        bool operator==(const ScrollTextCacheKey&) const = default;
+    };
+
+    struct ScrollTextCacheKeyHasher
+    {
+        size_t operator()(const ScrollTextCacheKey& key) const noexcept
+        {
+            uint64_t hash = 0xCBF29CE484222325uLL;
+            const auto combine = [&hash](uint64_t value) { hash = (hash ^ value) * 0x100000001B3uLL; };
+            combine(key.String);
+            for (auto arg : key.Args)
+            {
+                combine(arg);
+            }
+            combine(key.Colour);
+            combine(key.Position);
+            combine(key.Mode);
+            combine(key.UpperCase);
+            combine(key.UseTrueType);
+            return static_cast<size_t>(hash);
+        }
+    };
+
+    /**
+     * Memory budgeted LRU cache of rendered scroll bitmaps. Each unique
+     * (string, mode, colour) is rendered once per scroll offset and every
+     * further frame of the scroll cycle is served with a copy, which with
+     * hundreds of banners avoids re-rendering glyphs on every offset change.
+     * Guarded by the scrolling text mutex of the callers.
+     */
+    class ScrollingTextRenderCache
+    {
+        static constexpr size_t kMemoryBudget = 4 * 1024 * 1024;
+        static constexpr size_t kMaxEntries = kMemoryBudget / kScrollingTextBitmapSize;
+
+        struct Entry
+        {
+            std::array<uint8_t, kScrollingTextBitmapSize> Bitmap;
+            uint64_t LastUsed{};
+        };
+
+        std::unordered_map<ScrollTextCacheKey, Entry, ScrollTextCacheKeyHasher> _entries;
+        uint64_t _useCounter{};
+
+    public:
+        const uint8_t* Get(const ScrollTextCacheKey& key)
+        {
+            auto it = _entries.find(key);
+            if (it == _entries.end())
+            {
+                return nullptr;
+            }
+            it->second.LastUsed = ++_useCounter;
+            return it->second.Bitmap.data();
+        }
+
+        void Store(const ScrollTextCacheKey& key, const uint8_t* bitmap)
+        {
+            EvictUntilWithinBudget();
+            auto& entry = _entries[key];
+            std::copy_n(bitmap, kScrollingTextBitmapSize, entry.Bitmap.begin());
+            entry.LastUsed = ++_useCounter;
+        }
+
+        void Clear()
+        {
+            _entries.clear();
+        }
+
+    private:
+        void EvictUntilWithinBudget()
+        {
+            while (_entries.size() >= kMaxEntries)
+            {
+                auto lru = _entries.begin();
+                for (auto it = _entries.begin(); it != _entries.end(); ++it)
+                {
+                    if (it->second.LastUsed < lru->second.LastUsed)
+                    {
+                        lru = it;
+                    }
+                }
+                _entries.erase(lru);
+            }
+        }
+    };
+
+    ScrollingTextRenderCache _scrollingTextRenderCache;
+} // namespace
+
 static void ScrollingTextSetBitmapForSprite(
     std::string_view text, int32_t scroll, uint8_t* bitmap, const int16_t* scrollPositionOffsets, colour_t colour);
 static void ScrollingTextSetBitmapForTTF(
@@ -1430,6 +1540,7 @@ void ScrollingTextInvalidate()
         scrollText.string_id = 0;
         std::memset(scrollText.string_args, 0, sizeof(scrollText.string_args));
     }
+    _scrollingTextRenderCache.Clear();
 }
 
 ImageId ScrollingTextSetup(
@@ -1457,20 +1568,39 @@ ImageId ScrollingTextSetup(
     scrollText->mode = scrollingMode;
     scrollText->id = _drawSCrollNextIndex;
 
-    // Create the string to draw
-    utf8 scrollString[256];
-    ScrollingTextFormat(scrollString, 256, scrollText);
+    // A full scroll cycle revisits each offset, so the rendered bitmap for
+    // this offset may still be cached from the previous pass.
+    ScrollTextCacheKey cacheKey{};
+    cacheKey.String = stringId;
+    std::memcpy(cacheKey.Args.data(), ft.Buf(), cacheKey.Args.size());
+    cacheKey.Colour = colour;
+    cacheKey.Position = scroll;
+    cacheKey.Mode = scrollingMode;
+    cacheKey.UpperCase = Config::Get().general.UpperCaseBanners;
+    cacheKey.UseTrueType = LocalisationService_UseTrueTypeFont();
 
-    const int16_t* scrollingModePositions = _scrollPositions[scrollingMode];
-
-    std::fill_n(scrollText->bitmap, 320 * 8, 0x00);
-    if (LocalisationService_UseTrueTypeFont())
+    if (const auto* cachedBitmap = _scrollingTextRenderCache.Get(cacheKey); cachedBitmap != nullptr)
     {
-        ScrollingTextSetBitmapForTTF(scrollString, scroll, scrollText->bitmap, scrollingModePositions, colour);
+        std::copy_n(cachedBitmap, kScrollingTextBitmapSize, scrollText->bitmap);
     }
     else
     {
-        ScrollingTextSetBitmapForSprite(scrollString, scroll, scrollText->bitmap, scrollingModePositions, colour);
+        // Create the string to draw
+        utf8 scrollString[256];
+        ScrollingTextFormat(scrollString, 256, scrollText);
+
+        const int16_t* scrollingModePositions = _scrollPositions[scrollingMode];
+
+        std::fill_n(scrollText->bitmap, kScrollingTextBitmapSize, 0x00);
+        if (cacheKey.UseTrueType)
+        {
+            ScrollingTextSetBitmapForTTF(scrollString, scroll, scrollText->bitmap, scrollingModePositions, colour);
+        }
+        else
+        {
+            ScrollingTextSetBitmapForSprite(scrollString, scroll, scrollText->bitmap, scrollingModePositions, colour);
+        }
+        _scrollingTextRenderCache.Store(cacheKey, scrollText->bitmap);
     }
 
     uint32_t imageId = SPR_SCROLLING_TEXT_START + scrollIndex;
@@ -32,7 +32,9 @@ using namespace OpenRCT2;
 
 static bool _ttfInitialised = false;
 
-constexpr int32_t kTTFSurfaceCacheSize = 256;
+// Each unique (font, text) run is laid out and blitted once and then served
+// from here; chat heavy multiplayer sessions easily exceed 256 live strings.
+constexpr int32_t kTTFSurfaceCacheSize = 1024;
 constexpr int32_t kTTFGetWidthCacheSize = 1024;
 
 struct ttf_cache_entry
@@ -101,8 +101,12 @@ struct c_glyph
     int yoffset;
     int advance;
     uint16_t cached;
+    uint32_t used;
 };
 
+/* Associativity of the glyph cache, replacement within a set is LRU */
+#    define TTF_GLYPH_CACHE_WAYS 4
+
 /* The structure used to hold internal font information */
 struct InternalTTFFont
 {
@@ -131,9 +135,12 @@ struct InternalTTFFont
     int underline_offset;
     int underline_height;
 
-    /* Cache for style-transformed glyphs */
+    /* Cache for style-transformed glyphs. Set associative so that the large
+       character sets of ideographic scripts do not constantly evict each
+       other the way a direct mapped cache would */
     c_glyph* current;
-    c_glyph cache[257]; /* 257 is a prime */
+    c_glyph cache[256 * TTF_GLYPH_CACHE_WAYS];
+    uint32_t cache_tick;
 
     /* We are responsible for closing the font stream */
     FILE* src;
@@ -562,6 +569,7 @@ static void Flush_Glyph(c_glyph* glyph)
         glyph->pixmap.buffer = 0;
     }
     glyph->cached = 0;
+    glyph->used = 0;
 }
 
 static void Flush_Cache(TTF_Font* font)
@@ -971,13 +979,26 @@ static FT_Error Load_Glyph(TTF_Font* font, uint16_t ch, c_glyph* cached, int wan
 static FT_Error Find_Glyph(TTF_Font* font, uint16_t ch, int want)
 {
     int retval = 0;
-    int hsize = sizeof(font->cache) / sizeof(font->cache[0]);
+    int nsets = static_cast<int>(sizeof(font->cache) / sizeof(font->cache[0])) / TTF_GLYPH_CACHE_WAYS;
 
-    int h = ch % hsize;
-    font->current = &font->cache[h];
+    c_glyph* set = &font->cache[(ch % nsets) * TTF_GLYPH_CACHE_WAYS];
+    c_glyph* entry = &set[0];
+    for (int i = 0; i < TTF_GLYPH_CACHE_WAYS; ++i)
+    {
+        if (set[i].cached == ch)
+        {
+            entry = &set[i];
+            break;
+        }
+        /* Remember the least recently used way in case of a miss */
+        if (set[i].used < entry->used)
+            entry = &set[i];
+    }
 
-    if (font->current->cached != ch)
-        Flush_Glyph(font->current);
+    if (entry->cached != ch)
+        Flush_Glyph(entry);
+    entry->used = ++font->cache_tick;
+    font->current = entry;
 
     if ((font->current->stored & want) != want)
     {
@@ -33,12 +33,14 @@ using namespace OpenRCT2::Ui;
 
 X8WeatherDrawer::X8WeatherDrawer()
 {
-    _weatherPixels = new WeatherPixel[_weatherPixelsCapacity];
+    _weatherSpans = new WeatherSpan[MaxWeatherSpans];
+    _weatherSavedColours = new uint8_t[_weatherPixelsCapacity];
 }
 
 X8WeatherDrawer::~X8WeatherDrawer()
 {
-    delete[] _weatherPixels;
+    delete[] _weatherSpans;
+    delete[] _weatherSavedColours;
 }
 
 void X8WeatherDrawer::Draw(
@@ -57,30 +59,34 @@ void X8WeatherDrawer::Draw(
 
     uint8_t* screenBits = dpi.bits;
 
-    // Stores the colours of changed pixels
-    WeatherPixel* newPixels = &_weatherPixels[_weatherPixelsCount];
     for (; height != 0; height--)
     {
         auto patternX = pattern[patternYPos * 2];
-        if (patternX != 0xFF)
+        if (patternX != 0xFF && _weatherSpansCount < MaxWeatherSpans
+            && _weatherPixelsCount < (_weatherPixelsCapacity - static_cast<uint32_t>(width)))
         {
-            if (_weatherPixelsCount < (_weatherPixelsCapacity - static_cast<uint32_t>(width)))
-            {
-                uint32_t finalPixelOffset = width + pixelOffset;
+            uint32_t finalPixelOffset = width + pixelOffset;
 
-                uint32_t xPixelOffset = pixelOffset;
-                xPixelOffset += (static_cast<uint8_t>(patternX - patternStartXOffset)) % patternXSpace;
+            uint32_t xPixelOffset = pixelOffset;
+            xPixelOffset += (static_cast<uint8_t>(patternX - patternStartXOffset)) % patternXSpace;
 
+            if (xPixelOffset < finalPixelOffset)
+            {
+                // The whole row is a single strided run of one colour, so
+                // save the overwritten colours contiguously and record one
+                // span instead of per-pixel positions
+                auto count = static_cast<uint16_t>((finalPixelOffset - xPixelOffset + patternXSpace - 1) / patternXSpace);
                 auto patternPixel = pattern[patternYPos * 2 + 1];
-                for (; xPixelOffset < finalPixelOffset; xPixelOffset += patternXSpace)
+                uint8_t* savedColours = &_weatherSavedColours[_weatherPixelsCount];
+                uint32_t offset = xPixelOffset;
+                for (uint16_t i = 0; i < count; i++)
                 {
-                    uint8_t current_pixel = screenBits[xPixelOffset];
-                    screenBits[xPixelOffset] = patternPixel;
-                    _weatherPixelsCount++;
-
-                    // Store colour and position
-                    *newPixels++ = { xPixelOffset, current_pixel };
+                    savedColours[i] = screenBits[offset];
+                    screenBits[offset] = patternPixel;
+                    offset += patternXSpace;
                 }
+                _weatherPixelsCount += count;
+                _weatherSpans[_weatherSpansCount++] = { xPixelOffset, count, patternXSpace };
             }
         }
 
@@ -92,21 +98,28 @@ void X8WeatherDrawer::Draw(
 
 void X8WeatherDrawer::Restore(DrawPixelInfo& dpi)
 {
-    if (_weatherPixelsCount > 0)
+    if (_weatherSpansCount > 0)
     {
         uint32_t numPixels = (dpi.width + dpi.pitch) * dpi.height;
         uint8_t* bits = dpi.bits;
-        for (uint32_t i = 0; i < _weatherPixelsCount; i++)
+        const uint8_t* savedColours = _weatherSavedColours;
+        for (uint32_t i = 0; i < _weatherSpansCount; i++)
         {
-            WeatherPixel weatherPixel = _weatherPixels[i];
-            if (weatherPixel.Position >= numPixels)
+            const WeatherSpan& span = _weatherSpans[i];
+            uint32_t position = span.Position;
+            if (position + static_cast<uint32_t>(span.Count - 1) * span.XSpace >= numPixels)
             {
-                // Pixel out of bounds, bail
+                // Span out of bounds, bail
                 break;
             }
 
-            bits[weatherPixel.Position] = weatherPixel.Colour;
+            for (uint16_t j = 0; j < span.Count; j++)
+            {
+                bits[position] = *savedColours++;
+                position += span.XSpace;
+            }
         }
+        _weatherSpansCount = 0;
         _weatherPixelsCount = 0;
     }
 }
@@ -702,11 +715,7 @@ void X8DrawingContext::FilterRect(
         for (int32_t i = 0; i < c; i++)
         {
             uint8_t* nextdst = dst + step * i;
-            for (int32_t j = 0; j < scaled_width; j++)
-            {
-                auto index = *(nextdst + j);
-                *(nextdst + j) = paletteEntries[index];
-            }
+            FilterPaletteFn(nextdst, scaled_width, paletteEntries);
         }
     }
 }
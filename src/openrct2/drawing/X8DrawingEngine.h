@@ -39,17 +39,24 @@ namespace OpenRCT2
         class X8WeatherDrawer final : public IWeatherDrawer
         {
         private:
-            struct WeatherPixel
+            // A strided run of weather pixels within one screen row. The
+            // colours the run overwrote are stored contiguously in
+            // _weatherSavedColours so they can be restored next frame.
+            struct WeatherSpan
             {
                 uint32_t Position;
-                uint8_t Colour;
+                uint16_t Count;
+                uint8_t XSpace;
             };
 
             static constexpr uint32_t MaxWeatherPixels = 0xFFFE;
+            static constexpr uint32_t MaxWeatherSpans = 0x4000;
 
             size_t _weatherPixelsCapacity = MaxWeatherPixels;
             uint32_t _weatherPixelsCount = 0;
-            WeatherPixel* _weatherPixels = nullptr;
+            uint32_t _weatherSpansCount = 0;
+            WeatherSpan* _weatherSpans = nullptr;
+            uint8_t* _weatherSavedColours = nullptr;
 
         public:
             X8WeatherDrawer();
@@ -10,6 +10,7 @@
 #include "EntityBase.h"
 
 #include "../core/DataSerialiser.h"
+#include "EntityRegistry.h"
 
 // Required for GetEntity to return a default
 template<> bool EntityBase::Is<EntityBase>() const
@@ -64,6 +65,9 @@ void EntityBase::Invalidate()
             break;
     }
 
+    // Sprite dimensions may have changed, e.g. by an animation frame.
+    EntitySpatialBoundsUpdate(this);
+
     ViewportsInvalidate(GetLocation(), SpriteData.Width, SpriteData.HeightMin, SpriteData.HeightMax, maxZoom);
 }
 
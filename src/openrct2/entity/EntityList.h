@@ -14,16 +14,170 @@
 #include "EntityBase.h"
 #include "EntityRegistry.h"
 
-#include <list>
+#include <array>
+#include <bit>
 #include <vector>
 
-const std::list<EntityId>& GetEntityList(const EntityType id);
+/**
+ * An ordered set of entity ids, stored as a bitmap over the entity slots.
+ * Insertion and removal are O(1) and iteration visits ids in ascending
+ * order, so the entity update order is identical to that of the sorted
+ * lists this replaces and multiplayer stays in lockstep.
+ */
+class EntityIdList
+{
+private:
+    static constexpr size_t kBitsPerWord = 64;
+    static constexpr size_t kNumWords = (MAX_ENTITIES + (kBitsPerWord - 1)) / kBitsPerWord;
+
+    std::array<uint64_t, kNumWords> _words{};
+    size_t _count{};
+
+public:
+    class const_iterator
+    {
+    private:
+        const std::array<uint64_t, kNumWords>* _words{};
+        size_t _pos{};
+
+        void SkipToNextSetBit()
+        {
+            while (_pos < MAX_ENTITIES)
+            {
+                const auto word = (*_words)[_pos / kBitsPerWord] >> (_pos % kBitsPerWord);
+                if (word != 0)
+                {
+                    _pos += std::countr_zero(word);
+                    return;
+                }
+                _pos = ((_pos / kBitsPerWord) + 1) * kBitsPerWord;
+            }
+            _pos = MAX_ENTITIES;
+        }
+
+    public:
+        const_iterator(const std::array<uint64_t, kNumWords>& words, size_t pos)
+            : _words(&words)
+            , _pos(pos)
+        {
+            SkipToNextSetBit();
+        }
+        EntityId operator*() const
+        {
+            return EntityId::FromUnderlying(static_cast<uint16_t>(_pos));
+        }
+        const_iterator& operator++()
+        {
+            _pos++;
+            SkipToNextSetBit();
+            return *this;
+        }
+        const_iterator operator++(int)
+        {
+            auto retval = *this;
+            ++(*this);
+            return retval;
+        }
+        bool operator==(const const_iterator& other) const
+        {
+            return _pos == other._pos;
+        }
+        bool operator!=(const const_iterator& other) const
+        {
+            return !(*this == other);
+        }
+        // iterator traits
+        using difference_type = std::ptrdiff_t;
+        using value_type = EntityId;
+        using pointer = const EntityId*;
+        using reference = const EntityId&;
+        using iterator_category = std::forward_iterator_tag;
+    };
+
+    size_t size() const
+    {
+        return _count;
+    }
+    bool Contains(EntityId id) const
+    {
+        const auto index = id.ToUnderlying();
+        return (_words[index / kBitsPerWord] & (1uLL << (index % kBitsPerWord))) != 0;
+    }
+    void Add(EntityId id)
+    {
+        if (!Contains(id))
+        {
+            const auto index = id.ToUnderlying();
+            _words[index / kBitsPerWord] |= 1uLL << (index % kBitsPerWord);
+            _count++;
+        }
+    }
+    void Remove(EntityId id)
+    {
+        if (Contains(id))
+        {
+            const auto index = id.ToUnderlying();
+            _words[index / kBitsPerWord] &= ~(1uLL << (index % kBitsPerWord));
+            _count--;
+        }
+    }
+    void Clear()
+    {
+        _words.fill(0);
+        _count = 0;
+    }
+    const_iterator begin() const
+    {
+        return const_iterator(_words, 0);
+    }
+    const_iterator end() const
+    {
+        return const_iterator(_words, MAX_ENTITIES);
+    }
+};
+
+const EntityIdList& GetEntityList(const EntityType id);
 
 uint16_t GetEntityListCount(EntityType list);
 uint16_t GetMiscEntityCount();
 uint16_t GetNumFreeEntities();
 const std::vector<EntityId>& GetEntityTileList(const CoordsXY& spritePos);
 
+/**
+ * Number of guests in the 8x8 tile cell containing the given location,
+ * maintained incrementally on entity moves. Cheap enough to poll every tick
+ * and exposed to plugins for reading crowding without entity iteration.
+ */
+uint16_t GetGuestDensity(const CoordsXY& spritePos);
+
+/**
+ * Number of litter entities in the cells of the density grid overlapping the
+ * square of the given radius (at most one cell's width) around the location.
+ * Lets handymen rule out any litter being in reach without iterating the
+ * litter entity list.
+ */
+uint16_t GetLitterDensity(const CoordsXY& spritePos, int32_t radius);
+
+/**
+ * Conservative bounds over all entities in a spatial index cell, kept up to
+ * date by the entity registry so a viewport paint can reject a whole tile of
+ * entities without iterating them. The bounds only ever grow while entities
+ * stay in the cell and are recomputed exactly whenever one leaves.
+ */
+struct EntityTileBounds
+{
+    int32_t MinZ;
+    int32_t MaxZ;
+    int32_t MaxWidth;
+    int32_t MaxHeightMin;
+    int32_t MaxHeightMax;
+};
+const EntityTileBounds& GetEntityTileBounds(const CoordsXY& spritePos);
+
+// Recomputes the bounds of every cell an entity left since the last flush.
+// Called on the main thread before paint sessions start reading the bounds.
+void EntitySpatialBoundsFlush();
+
 template<typename T> class EntityTileIterator
 {
 private:
@@ -99,12 +253,12 @@ public:
 template<typename T> class EntityListIterator
 {
 private:
-    std::list<EntityId>::const_iterator iter;
-    std::list<EntityId>::const_iterator end;
+    EntityIdList::const_iterator iter;
+    EntityIdList::const_iterator end;
     T* Entity = nullptr;
 
 public:
-    EntityListIterator(std::list<EntityId>::const_iterator _iter, std::list<EntityId>::const_iterator _end)
+    EntityListIterator(EntityIdList::const_iterator _iter, EntityIdList::const_iterator _end)
         : iter(_iter)
         , end(_end)
     {
@@ -151,7 +305,7 @@ template<typename T = EntityBase> class EntityList
 {
 private:
     using EntityListIterator_t = EntityListIterator<T>;
-    const std::list<EntityId>& vec;
+    const EntityIdList& vec;
 
 public:
     EntityList()
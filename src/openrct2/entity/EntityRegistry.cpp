@@ -13,6 +13,7 @@
 #include "../Game.h"
 #include "../GameState.h"
 #include "../core/Algorithm.hpp"
+#include "../core/BitSet.hpp"
 #include "../core/ChecksumStream.h"
 #include "../core/Crypt.h"
 #include "../core/DataSerialiser.h"
@@ -27,21 +28,25 @@
 #include "../scenario/Scenario.h"
 #include "Balloon.h"
 #include "Duck.h"
+#include "EntityList.h"
 #include "EntityTweener.h"
 #include "Fountain.h"
 #include "MoneyEffect.h"
 #include "Particle.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <iterator>
+#include <limits>
 #include <numeric>
+#include <optional>
 #include <vector>
 
 using namespace OpenRCT2;
 
-static std::array<std::list<EntityId>, EnumValue(EntityType::Count)> gEntityLists;
-static std::vector<EntityId> _freeIdList;
+static std::array<EntityIdList, EnumValue(EntityType::Count)> gEntityLists;
+static EntityIdList _freeIds;
 
 static bool _entityFlashingList[MAX_ENTITIES];
 
@@ -50,7 +55,31 @@ constexpr uint32_t SPATIAL_INDEX_LOCATION_NULL = SPATIAL_INDEX_SIZE - 1;
 
 static std::array<std::vector<EntityId>, SPATIAL_INDEX_SIZE> gEntitySpatialIndex;
 
+constexpr EntityTileBounds kEmptyEntityTileBounds = { std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min(),
+                                                     0, 0, 0 };
+
+static std::array<EntityTileBounds, SPATIAL_INDEX_SIZE> gEntitySpatialBounds;
+
+/* Cells whose bounds need recomputing because an entity left them. Removals
+ * only mark the cell here; EntitySpatialBoundsFlush rebuilds all marked cells
+ * in one pass before painting, so thousands of vehicle moves per tick
+ * collapse into one recompute per touched cell. Stale bounds still contain
+ * every entity in the cell, so they are safe to read, merely conservative.
+ * The bitset deduplicates marks, the vector makes the flush O(dirty cells). */
+static OpenRCT2::BitSet<SPATIAL_INDEX_SIZE> _entitySpatialBoundsDirty;
+static std::vector<size_t> _entitySpatialBoundsDirtyList;
+
+/* Number of guests and litter per 8x8 tile cell, maintained on the same
+ * transactional paths as the spatial index so crowding and dirtiness can be
+ * read as single counters instead of iterating the per-tile entity lists. */
+constexpr uint32_t kGuestDensityCellShift = 3;
+constexpr uint32_t kGuestDensityGridSize = (kMaximumMapSizeTechnical >> kGuestDensityCellShift) + 1;
+
+static std::array<uint16_t, kGuestDensityGridSize * kGuestDensityGridSize> _guestDensity{};
+static std::array<uint16_t, kGuestDensityGridSize * kGuestDensityGridSize> _litterDensity{};
+
 static void FreeEntity(EntityBase& entity);
+static void EntitySpatialBoundsRecompute(size_t index);
 
 static constexpr size_t GetSpatialIndexOffset(const CoordsXY& loc)
 {
@@ -67,6 +96,66 @@ static constexpr size_t GetSpatialIndexOffset(const CoordsXY& loc)
     return tileX * kMaximumMapSizeTechnical + tileY;
 }
 
+static std::optional<size_t> GetDensityGridOffset(const CoordsXY& loc)
+{
+    if (loc.IsNull())
+        return std::nullopt;
+
+    // NOTE: The input coordinate is rotated and can have negative components.
+    const auto cellX = static_cast<uint32_t>(std::abs(loc.x) / COORDS_XY_STEP) >> kGuestDensityCellShift;
+    const auto cellY = static_cast<uint32_t>(std::abs(loc.y) / COORDS_XY_STEP) >> kGuestDensityCellShift;
+
+    if (cellX >= kGuestDensityGridSize || cellY >= kGuestDensityGridSize)
+        return std::nullopt;
+
+    return cellX * kGuestDensityGridSize + cellY;
+}
+
+static void DensityGridAdjust(const EntityBase* entity, const CoordsXY& loc, int32_t delta)
+{
+    if (entity->Type != EntityType::Guest && entity->Type != EntityType::Litter)
+        return;
+
+    const auto offset = GetDensityGridOffset(loc);
+    if (offset.has_value())
+    {
+        auto& grid = entity->Type == EntityType::Guest ? _guestDensity : _litterDensity;
+        grid[*offset] = static_cast<uint16_t>(grid[*offset] + delta);
+    }
+}
+
+uint16_t GetGuestDensity(const CoordsXY& loc)
+{
+    const auto offset = GetDensityGridOffset(loc);
+    return offset.has_value() ? _guestDensity[*offset] : 0;
+}
+
+uint16_t GetLitterDensity(const CoordsXY& loc, int32_t radius)
+{
+    if (loc.IsNull())
+        return 0;
+
+    // With the radius below a cell's width, the square around loc overlaps at
+    // most four cells and sampling the corners visits each of them.
+    uint16_t total = 0;
+    std::array<std::optional<size_t>, 4> visited{};
+    size_t numVisited = 0;
+    for (auto xOffset : { -radius, radius })
+    {
+        for (auto yOffset : { -radius, radius })
+        {
+            const auto offset = GetDensityGridOffset({ loc.x + xOffset, loc.y + yOffset });
+            if (!offset.has_value())
+                continue;
+            if (std::find(visited.begin(), visited.begin() + numVisited, offset) != visited.begin() + numVisited)
+                continue;
+            visited[numVisited++] = offset;
+            total = static_cast<uint16_t>(total + _litterDensity[*offset]);
+        }
+    }
+    return total;
+}
+
 constexpr bool EntityTypeIsMiscEntity(const EntityType type)
 {
     switch (type)
@@ -93,7 +182,7 @@ uint16_t GetEntityListCount(EntityType type)
 
 uint16_t GetNumFreeEntities()
 {
-    return static_cast<uint16_t>(_freeIdList.size());
+    return static_cast<uint16_t>(_freeIds.size());
 }
 
 std::string EntitiesChecksum::ToString() const
@@ -115,7 +204,12 @@ EntityBase* TryGetEntity(EntityId entityIndex)
 {
     auto& gameState = GetGameState();
     const auto idx = entityIndex.ToUnderlying();
-    return idx >= MAX_ENTITIES ? nullptr : &gameState.Entities[idx].base;
+    if (idx >= MAX_ENTITIES)
+    {
+        return nullptr;
+    }
+    auto* slot = gameState.Entities.Get(idx);
+    return slot != nullptr ? &slot->base : nullptr;
 }
 
 EntityBase* GetEntity(EntityId entityIndex)
@@ -133,28 +227,80 @@ const std::vector<EntityId>& GetEntityTileList(const CoordsXY& spritePos)
     return gEntitySpatialIndex[GetSpatialIndexOffset(spritePos)];
 }
 
+const EntityTileBounds& GetEntityTileBounds(const CoordsXY& spritePos)
+{
+    return gEntitySpatialBounds[GetSpatialIndexOffset(spritePos)];
+}
+
+static void EntitySpatialBoundsExpand(size_t index, const EntityBase* entity)
+{
+    auto& bounds = gEntitySpatialBounds[index];
+    bounds.MinZ = std::min<int32_t>(bounds.MinZ, entity->z);
+    bounds.MaxZ = std::max<int32_t>(bounds.MaxZ, entity->z);
+    bounds.MaxWidth = std::max<int32_t>(bounds.MaxWidth, entity->SpriteData.Width);
+    bounds.MaxHeightMin = std::max<int32_t>(bounds.MaxHeightMin, entity->SpriteData.HeightMin);
+    bounds.MaxHeightMax = std::max<int32_t>(bounds.MaxHeightMax, entity->SpriteData.HeightMax);
+}
+
+static void EntitySpatialBoundsRecompute(size_t index)
+{
+    auto& bounds = gEntitySpatialBounds[index];
+    bounds = kEmptyEntityTileBounds;
+    for (auto id : gEntitySpatialIndex[index])
+    {
+        auto* entity = GetEntity(id);
+        if (entity != nullptr)
+        {
+            EntitySpatialBoundsExpand(index, entity);
+        }
+    }
+}
+
+void EntitySpatialBoundsUpdate(const EntityBase* entity)
+{
+    if (entity->x == LOCATION_NULL)
+        return;
+
+    EntitySpatialBoundsExpand(GetSpatialIndexOffset({ entity->x, entity->y }), entity);
+}
+
+static void EntitySpatialBoundsMarkDirty(size_t index)
+{
+    if (!_entitySpatialBoundsDirty[index])
+    {
+        _entitySpatialBoundsDirty[index] = true;
+        _entitySpatialBoundsDirtyList.push_back(index);
+    }
+}
+
+void EntitySpatialBoundsFlush()
+{
+    for (auto index : _entitySpatialBoundsDirtyList)
+    {
+        EntitySpatialBoundsRecompute(index);
+        _entitySpatialBoundsDirty[index] = false;
+    }
+    _entitySpatialBoundsDirtyList.clear();
+}
+
 static void ResetEntityLists()
 {
     for (auto& list : gEntityLists)
     {
-        list.clear();
+        list.Clear();
     }
 }
 
 static void ResetFreeIds()
 {
-    _freeIdList.clear();
-    _freeIdList.resize(MAX_ENTITIES);
-
-    // List needs to be back to front to simplify removing
-    auto nextId = 0;
-    std::for_each(std::rbegin(_freeIdList), std::rend(_freeIdList), [&](auto& elem) {
-        elem = EntityId::FromUnderlying(nextId);
-        nextId++;
-    });
+    _freeIds.Clear();
+    for (uint16_t i = 0; i < MAX_ENTITIES; i++)
+    {
+        _freeIds.Add(EntityId::FromUnderlying(i));
+    }
 }
 
-const std::list<EntityId>& GetEntityList(const EntityType id)
+const EntityIdList& GetEntityList(const EntityType id)
 {
     return gEntityLists[EnumValue(id)];
 }
@@ -176,22 +322,13 @@ void ResetAllEntities()
         FreeEntity(*spr);
     }
 
+    // Dropping the chunks leaves every slot in the same state allocation
+    // hands out: a null typed entity holding its own id.
     auto& gameState = GetGameState();
-    std::fill(std::begin(gameState.Entities), std::end(gameState.Entities), Entity_t());
+    gameState.Entities.Clear();
     OpenRCT2::RideUse::GetHistory().Clear();
     OpenRCT2::RideUse::GetTypeHistory().Clear();
-    for (int32_t i = 0; i < MAX_ENTITIES; ++i)
-    {
-        auto* spr = GetEntity(EntityId::FromUnderlying(i));
-        if (spr == nullptr)
-        {
-            continue;
-        }
-        spr->Type = EntityType::Null;
-        spr->Id = EntityId::FromUnderlying(i);
-
-        _entityFlashingList[i] = false;
-    }
+    std::fill(std::begin(_entityFlashingList), std::end(_entityFlashingList), false);
     ResetEntityLists();
     ResetFreeIds();
     ResetEntitySpatialIndices();
@@ -211,6 +348,11 @@ void ResetEntitySpatialIndices()
     {
         vec.clear();
     }
+    gEntitySpatialBounds.fill(kEmptyEntityTileBounds);
+    _entitySpatialBoundsDirty.reset();
+    _entitySpatialBoundsDirtyList.clear();
+    _guestDensity.fill(0);
+    _litterDensity.fill(0);
     for (EntityId::UnderlyingType i = 0; i < MAX_ENTITIES; i++)
     {
         auto* spr = GetEntity(EntityId::FromUnderlying(i));
@@ -236,16 +378,36 @@ template<typename... T> void NetworkSerialiseEntityTypes(DataSerialiser& ds)
     (NetworkSerialseEntityType<T>(ds), ...);
 }
 
-EntitiesChecksum GetAllEntitiesChecksum()
+template<typename... T> static EntitiesChecksum ComputeEntitiesChecksum()
 {
     EntitiesChecksum checksum{};
 
     OpenRCT2::ChecksumStream ms(checksum.raw);
     DataSerialiser ds(true, ms);
-    NetworkSerialiseEntityTypes<Guest, Staff, Vehicle, Litter>(ds);
+    NetworkSerialiseEntityTypes<T...>(ds);
 
     return checksum;
 }
+
+EntitiesChecksum GetAllEntitiesChecksum()
+{
+    return ComputeEntitiesChecksum<Guest, Staff, Vehicle, Litter>();
+}
+
+EntitiesChecksum GetPeepEntitiesChecksum()
+{
+    return ComputeEntitiesChecksum<Guest, Staff>();
+}
+
+EntitiesChecksum GetVehicleEntitiesChecksum()
+{
+    return ComputeEntitiesChecksum<Vehicle>();
+}
+
+EntitiesChecksum GetLitterEntitiesChecksum()
+{
+    return ComputeEntitiesChecksum<Litter>();
+}
 #else
 
 EntitiesChecksum GetAllEntitiesChecksum()
@@ -253,6 +415,21 @@ EntitiesChecksum GetAllEntitiesChecksum()
     return EntitiesChecksum{};
 }
 
+EntitiesChecksum GetPeepEntitiesChecksum()
+{
+    return EntitiesChecksum{};
+}
+
+EntitiesChecksum GetVehicleEntitiesChecksum()
+{
+    return EntitiesChecksum{};
+}
+
+EntitiesChecksum GetLitterEntitiesChecksum()
+{
+    return EntitiesChecksum{};
+}
+
 #endif // DISABLE_NETWORK
 
 static void EntityReset(EntityBase* entity)
@@ -272,25 +449,19 @@ static constexpr uint16_t MAX_MISC_SPRITES = 1600;
 
 static void AddToEntityList(EntityBase* entity)
 {
-    auto& list = gEntityLists[EnumValue(entity->Type)];
-    // Entity list must be in sprite_index order to prevent desync issues
-    list.insert(std::lower_bound(std::begin(list), std::end(list), entity->Id), entity->Id);
+    // Entity lists iterate in sprite_index order to prevent desync issues
+    gEntityLists[EnumValue(entity->Type)].Add(entity->Id);
 }
 
 static void AddToFreeList(EntityId index)
 {
-    // Free list must be in reverse sprite_index order to prevent desync issues
-    _freeIdList.insert(std::upper_bound(std::rbegin(_freeIdList), std::rend(_freeIdList), index).base(), index);
+    // Free ids are handed out in ascending order to prevent desync issues
+    _freeIds.Add(index);
 }
 
 static void RemoveFromEntityList(EntityBase* entity)
 {
-    auto& list = gEntityLists[EnumValue(entity->Type)];
-    auto ptr = BinaryFind(std::begin(list), std::end(list), entity->Id);
-    if (ptr != std::end(list))
-    {
-        list.erase(ptr);
-    }
+    gEntityLists[EnumValue(entity->Type)].Remove(entity->Id);
 }
 
 uint16_t GetMiscEntityCount()
@@ -327,7 +498,7 @@ static void PrepareNewEntity(EntityBase* base, const EntityType type)
 
 EntityBase* CreateEntity(EntityType type)
 {
-    if (_freeIdList.size() == 0)
+    if (_freeIds.size() == 0)
     {
         // No free sprites.
         return nullptr;
@@ -342,18 +513,16 @@ EntityBase* CreateEntity(EntityType type)
         }
 
         // If there are less than MAX_MISC_SPRITES free slots, ensure other entities can be created.
-        if (_freeIdList.size() < MAX_MISC_SPRITES)
+        if (_freeIds.size() < MAX_MISC_SPRITES)
         {
             return nullptr;
         }
     }
 
-    auto* entity = GetEntity(_freeIdList.back());
-    if (entity == nullptr)
-    {
-        return nullptr;
-    }
-    _freeIdList.pop_back();
+    // Take the lowest free id, matching the order the reverse sorted free list handed them out in.
+    const auto index = *_freeIds.begin();
+    auto* entity = &GetGameState().Entities.GetOrAllocate(index.ToUnderlying()).base;
+    _freeIds.Remove(index);
 
     PrepareNewEntity(entity, type);
 
@@ -362,19 +531,13 @@ EntityBase* CreateEntity(EntityType type)
 
 EntityBase* CreateEntityAt(const EntityId index, const EntityType type)
 {
-    auto id = BinaryFind(std::rbegin(_freeIdList), std::rend(_freeIdList), index);
-    if (id == std::rend(_freeIdList))
-    {
-        return nullptr;
-    }
-
-    auto* entity = GetEntity(index);
-    if (entity == nullptr)
+    if (!_freeIds.Contains(index))
     {
         return nullptr;
     }
 
-    _freeIdList.erase(std::next(id).base());
+    auto* entity = &GetGameState().Entities.GetOrAllocate(index.ToUnderlying()).base;
+    _freeIds.Remove(index);
 
     PrepareNewEntity(entity, type);
     return entity;
@@ -396,6 +559,11 @@ template<typename... T> void MiscUpdateAllTypes()
 /**
  *
  *  rct2: 0x00672AA4
+ *
+ * Must stay serial and in this type order: every misc entity type draws from
+ * the scenario RNG during its update (duck behaviour, balloon pops, fountain
+ * patterns, particle spawns), and MoveTo/Remove mutate the shared spatial
+ * index, so the update order is part of the synced simulation.
  */
 void UpdateAllMiscEntities()
 {
@@ -418,6 +586,8 @@ static void EntitySpatialInsert(EntityBase* entity, const CoordsXY& newLoc)
     auto& spatialVector = gEntitySpatialIndex[newIndex];
     auto index = std::lower_bound(std::begin(spatialVector), std::end(spatialVector), entity->Id);
     spatialVector.insert(index, entity->Id);
+    EntitySpatialBoundsExpand(newIndex, entity);
+    DensityGridAdjust(entity, newLoc, 1);
 }
 
 static void EntitySpatialRemove(EntityBase* entity)
@@ -428,6 +598,8 @@ static void EntitySpatialRemove(EntityBase* entity)
     if (index != std::end(spatialVector))
     {
         spatialVector.erase(index, index + 1);
+        EntitySpatialBoundsMarkDirty(currentIndex);
+        DensityGridAdjust(entity, { entity->x, entity->y }, -1);
     }
     else
     {
@@ -472,6 +644,7 @@ void EntityBase::MoveTo(const CoordsXYZ& newLocation)
     else
     {
         EntitySetCoordinates(loc, this);
+        EntitySpatialBoundsUpdate(this);
         Invalidate(); // Invalidate new position.
     }
 }
@@ -12,6 +12,7 @@
 #include "EntityBase.h"
 
 #include <array>
+#include <memory>
 
 namespace OpenRCT2
 {
@@ -28,6 +29,61 @@ namespace OpenRCT2
 
 constexpr uint16_t MAX_ENTITIES = 65535;
 
+namespace OpenRCT2
+{
+    /**
+     * Backing storage for the entity slots, allocated in fixed-size chunks the
+     * first time an entity is created inside a chunk. Small parks then only
+     * commit the slot memory they actually touch instead of the full 32 MiB
+     * array, while slot addresses stay stable for the lifetime of the park.
+     * Chunks are only ever allocated from the serial create paths, so lookups
+     * from worker threads race with nothing.
+     */
+    class EntityStorage
+    {
+    private:
+        static constexpr size_t kChunkShift = 11;
+        static constexpr size_t kChunkSize = 1uLL << kChunkShift; // 2048 slots, 1 MiB per chunk
+        static constexpr size_t kNumChunks = (MAX_ENTITIES + kChunkSize - 1) / kChunkSize;
+
+        std::array<std::unique_ptr<Entity_t[]>, kNumChunks> _chunks;
+
+    public:
+        // Returns nullptr if no entity has ever been created in the chunk.
+        Entity_t* Get(size_t index) const
+        {
+            const auto& chunk = _chunks[index >> kChunkShift];
+            return chunk != nullptr ? &chunk[index & (kChunkSize - 1)] : nullptr;
+        }
+
+        Entity_t& GetOrAllocate(size_t index)
+        {
+            auto& chunk = _chunks[index >> kChunkShift];
+            if (chunk == nullptr)
+            {
+                chunk = std::make_unique<Entity_t[]>(kChunkSize);
+
+                // Fresh slots match the state ResetAllEntities leaves them in.
+                const auto baseIndex = index & ~(kChunkSize - 1);
+                for (size_t i = 0; i < kChunkSize; i++)
+                {
+                    chunk[i].base.Id = EntityId::FromUnderlying(static_cast<uint16_t>(baseIndex + i));
+                    chunk[i].base.Type = EntityType::Null;
+                }
+            }
+            return chunk[index & (kChunkSize - 1)];
+        }
+
+        void Clear()
+        {
+            for (auto& chunk : _chunks)
+            {
+                chunk.reset();
+            }
+        }
+    };
+} // namespace OpenRCT2
+
 EntityBase* GetEntity(EntityId sprite_idx);
 
 template<typename T> T* GetEntity(EntityId sprite_idx)
@@ -64,6 +120,7 @@ void ResetEntitySpatialIndices();
 void UpdateAllMiscEntities();
 void UpdateMoneyEffect();
 void EntitySetCoordinates(const CoordsXYZ& entityPos, EntityBase* entity);
+void EntitySpatialBoundsUpdate(const EntityBase* entity);
 void EntityRemove(EntityBase* entity);
 uint16_t RemoveFloatingEntities();
 
@@ -77,5 +134,12 @@ struct EntitiesChecksum
 #pragma pack(pop)
 EntitiesChecksum GetAllEntitiesChecksum();
 
+// Checksums over a subset of the synced entity lists. A desync report built
+// from these can name the subsystem where the state first diverged instead of
+// only that it diverged somewhere.
+EntitiesChecksum GetPeepEntitiesChecksum();
+EntitiesChecksum GetVehicleEntitiesChecksum();
+EntitiesChecksum GetLitterEntitiesChecksum();
+
 void EntitySetFlashing(EntityBase* entity, bool flashing);
 bool EntityGetFlashing(EntityBase* entity);
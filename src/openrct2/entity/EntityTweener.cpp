@@ -60,6 +60,26 @@ void EntityTweener::PostTick()
             PostPos.emplace_back(ent->GetLocation());
         }
     }
+
+    // Gather the entities that moved into parallel arrays so the per-frame
+    // interpolation only ever touches movers.
+    for (size_t i = 0; i < Entities.size(); ++i)
+    {
+        auto* ent = Entities[i];
+        if (ent == nullptr || PrePos[i] == PostPos[i])
+            continue;
+
+        MovedEntities.push_back(ent);
+        PreX.push_back(static_cast<float>(PrePos[i].x));
+        PreY.push_back(static_cast<float>(PrePos[i].y));
+        PreZ.push_back(static_cast<float>(PrePos[i].z));
+        PostX.push_back(static_cast<float>(PostPos[i].x));
+        PostY.push_back(static_cast<float>(PostPos[i].y));
+        PostZ.push_back(static_cast<float>(PostPos[i].z));
+    }
+    DrawX.resize(MovedEntities.size());
+    DrawY.resize(MovedEntities.size());
+    DrawZ.resize(MovedEntities.size());
 }
 
 static bool CanTweenEntity(EntityBase* ent)
@@ -80,28 +100,33 @@ void EntityTweener::RemoveEntity(EntityBase* entity)
     auto it = std::find(Entities.begin(), Entities.end(), entity);
     if (it != Entities.end())
         *it = nullptr;
+
+    auto movedIt = std::find(MovedEntities.begin(), MovedEntities.end(), entity);
+    if (movedIt != MovedEntities.end())
+        *movedIt = nullptr;
 }
 
 void EntityTweener::Tween(float alpha)
 {
+    // Interpolate first over the contiguous coordinate arrays; the loop is
+    // branchless and vectorises, so this costs per-cacheline rather than
+    // per-entity. The results are then applied in a second pass.
     const float inv = (1.0f - alpha);
-    for (size_t i = 0; i < Entities.size(); ++i)
+    const size_t numMoved = MovedEntities.size();
+    for (size_t i = 0; i < numMoved; ++i)
     {
-        auto* ent = Entities[i];
-        if (ent == nullptr)
-            continue;
-
-        auto& posA = PrePos[i];
-        auto& posB = PostPos[i];
+        DrawX[i] = static_cast<int32_t>(std::round(PostX[i] * alpha + PreX[i] * inv));
+        DrawY[i] = static_cast<int32_t>(std::round(PostY[i] * alpha + PreY[i] * inv));
+        DrawZ[i] = static_cast<int32_t>(std::round(PostZ[i] * alpha + PreZ[i] * inv));
+    }
 
-        if (posA == posB)
+    for (size_t i = 0; i < numMoved; ++i)
+    {
+        auto* ent = MovedEntities[i];
+        if (ent == nullptr)
             continue;
 
-        EntitySetCoordinates(
-            { static_cast<int32_t>(std::round(posB.x * alpha + posA.x * inv)),
-              static_cast<int32_t>(std::round(posB.y * alpha + posA.y * inv)),
-              static_cast<int32_t>(std::round(posB.z * alpha + posA.z * inv)) },
-            ent);
+        EntitySetCoordinates({ DrawX[i], DrawY[i], DrawZ[i] }, ent);
         ent->Invalidate();
     }
 }
@@ -124,6 +149,16 @@ void EntityTweener::Reset()
     Entities.clear();
     PrePos.clear();
     PostPos.clear();
+    MovedEntities.clear();
+    PreX.clear();
+    PreY.clear();
+    PreZ.clear();
+    PostX.clear();
+    PostY.clear();
+    PostZ.clear();
+    DrawX.clear();
+    DrawY.clear();
+    DrawZ.clear();
 }
 
 static EntityTweener tweener;
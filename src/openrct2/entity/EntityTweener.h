@@ -19,6 +19,15 @@ class EntityTweener
     std::vector<CoordsXYZ> PrePos;
     std::vector<CoordsXYZ> PostPos;
 
+    // Compact parallel arrays of the entities that actually moved this tick,
+    // rebuilt in PostTick. Tween interpolates over these contiguous floats in
+    // a branchless pass the compiler can vectorise, then applies the results,
+    // so stationary entities cost nothing at display rate.
+    std::vector<EntityBase*> MovedEntities;
+    std::vector<float> PreX, PreY, PreZ;
+    std::vector<float> PostX, PostY, PostZ;
+    std::vector<int32_t> DrawX, DrawY, DrawZ;
+
 private:
     void PopulateEntities();
     void AddEntity(EntityBase* entity);
@@ -787,6 +787,18 @@ void Guest::UpdateMotivesIdle()
     }
 }
 
+/**
+ * Moves a motive towards its target, falling or rising by 4 per step without
+ * overshooting. Kept branch-free so the per-motive updates below compile down
+ * to straight-line byte arithmetic rather than the branchy scalar original.
+ */
+static uint8_t PeepStepMotiveTowardsTarget(uint8_t value, uint8_t target)
+{
+    if (value >= target)
+        return static_cast<uint8_t>(std::max<int32_t>(value - 4, target));
+    return static_cast<uint8_t>(std::min<int32_t>(value + 4, target));
+}
+
 /* rct2: 0x0068FA89*/
 void Guest::UpdateConsumptionMotives()
 {
@@ -854,42 +866,14 @@ void Guest::UpdateConsumptionMotives()
         WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_2;
     }
 
-    uint8_t newHappiness = Happiness;
-    uint8_t newHappinessGrowth = HappinessTarget;
-    if (newHappiness >= newHappinessGrowth)
-    {
-        newHappiness = std::max(newHappiness - 4, 0);
-        if (newHappiness < newHappinessGrowth)
-            newHappiness = newHappinessGrowth;
-    }
-    else
-    {
-        newHappiness = std::min(255, newHappiness + 4);
-        if (newHappiness > newHappinessGrowth)
-            newHappiness = newHappinessGrowth;
-    }
-
+    const uint8_t newHappiness = PeepStepMotiveTowardsTarget(Happiness, HappinessTarget);
     if (newHappiness != Happiness)
     {
         Happiness = newHappiness;
         WindowInvalidateFlags |= PEEP_INVALIDATE_PEEP_2;
     }
 
-    uint8_t newNausea = Nausea;
-    uint8_t newNauseaGrowth = NauseaTarget;
-    if (newNausea >= newNauseaGrowth)
-    {
-        newNausea = std::max(newNausea - 4, 0);
-        if (newNausea < newNauseaGrowth)
-            newNausea = newNauseaGrowth;
-    }
-    else
-    {
-        newNausea = std::min(255, newNausea + 4);
-        if (newNausea > newNauseaGrowth)
-            newNausea = newNauseaGrowth;
-    }
-
+    const uint8_t newNausea = PeepStepMotiveTowardsTarget(Nausea, NauseaTarget);
     if (newNausea != Nausea)
     {
         Nausea = newNausea;
@@ -1767,7 +1751,7 @@ void Guest::OnExitRide(Ride& ride)
     if (PeepFlags & PEEP_FLAGS_RIDE_SHOULD_BE_MARKED_AS_FAVOURITE)
     {
         PeepFlags &= ~PEEP_FLAGS_RIDE_SHOULD_BE_MARKED_AS_FAVOURITE;
-        FavouriteRide = ride.id;
+        SetFavouriteRide(ride.id);
         // TODO fix this flag name or add another one
         WindowInvalidateFlags |= PEEP_INVALIDATE_STAFF_STATS;
     }
@@ -5728,6 +5712,7 @@ void Guest::UpdateEnteringPark()
     IncrementGuestsInPark();
     DecrementGuestsHeadingForPark();
     auto intent = Intent(INTENT_ACTION_UPDATE_GUEST_COUNT);
+    intent.PutExtra(INTENT_EXTRA_PEEP_ID, Id);
     ContextBroadcastIntent(&intent);
 }
 
@@ -5757,6 +5742,7 @@ void Guest::UpdateLeavingPark()
     DestinationTolerance = 5;
     DecrementGuestsInPark();
     auto intent = Intent(INTENT_ACTION_UPDATE_GUEST_COUNT);
+    intent.PutExtra(INTENT_EXTRA_PEEP_ID, Id);
     ContextBroadcastIntent(&intent);
     Var37 = 1;
 
@@ -7112,7 +7098,49 @@ static constexpr uint8_t tshirt_colours[] = {
  *
  *  rct2: 0x0069A05D
  */
+Guest::GenerationParams Guest::GetGenerationParams()
+{
+    auto& gameState = GetGameState();
+
+    GenerationParams params{};
+
+    /* Scenario editor limits the initial values to between 37..253. To be on
+     * the safe side, assume they could have been hacked to any value 0..255,
+     * and assume a default initial happiness of 0 is wrong and use 128 (50%)
+     * instead. */
+    params.HappinessBase = gameState.GuestInitialHappiness == 0 ? 128 : gameState.GuestInitialHappiness;
+    params.HungerBase = gameState.GuestInitialHunger;
+    params.ThirstBase = gameState.GuestInitialThirst;
+
+    params.PrefLessIntense = (gameState.Park.Flags & PARK_FLAGS_PREF_LESS_INTENSE_RIDES) != 0;
+    params.PrefMoreIntense = (gameState.Park.Flags & PARK_FLAGS_PREF_MORE_INTENSE_RIDES) != 0;
+
+    params.CashBase = gameState.GuestInitialCash;
+    if (gameState.Park.Flags & PARK_FLAGS_NO_MONEY)
+    {
+        params.CashIsFixed = true;
+        params.FixedCash = 0;
+    }
+    else if (gameState.GuestInitialCash == kMoney64Undefined)
+    {
+        params.CashIsFixed = true;
+        params.FixedCash = 0;
+    }
+    else if (gameState.GuestInitialCash == 0.00_GBP)
+    {
+        params.CashIsFixed = true;
+        params.FixedCash = 500;
+    }
+
+    return params;
+}
+
 Guest* Guest::Generate(const CoordsXYZ& coords)
+{
+    return Generate(coords, GetGenerationParams());
+}
+
+Guest* Guest::Generate(const CoordsXYZ& coords, const GenerationParams& params)
 {
     if (GetNumFreeEntities() < 400)
         return nullptr;
@@ -7153,9 +7181,9 @@ Guest* Guest::Generate(const CoordsXYZ& coords)
 
     /* Check which intensity boxes are enabled
      * and apply the appropriate intensity settings. */
-    if (gameState.Park.Flags & PARK_FLAGS_PREF_LESS_INTENSE_RIDES)
+    if (params.PrefLessIntense)
     {
-        if (gameState.Park.Flags & PARK_FLAGS_PREF_MORE_INTENSE_RIDES)
+        if (params.PrefMoreIntense)
         {
             intensityLowest = 0;
             intensityHighest = 15;
@@ -7166,7 +7194,7 @@ Guest* Guest::Generate(const CoordsXYZ& coords)
             intensityHighest = 4;
         }
     }
-    else if (gameState.Park.Flags & PARK_FLAGS_PREF_MORE_INTENSE_RIDES)
+    else if (params.PrefMoreIntense)
     {
         intensityLowest = 9;
         intensityHighest = 15;
@@ -7175,21 +7203,14 @@ Guest* Guest::Generate(const CoordsXYZ& coords)
     peep->Intensity = IntensityRange(intensityLowest, intensityHighest);
 
     uint8_t nauseaTolerance = ScenarioRand() & 0x7;
-    if (gameState.Park.Flags & PARK_FLAGS_PREF_MORE_INTENSE_RIDES)
+    if (params.PrefMoreIntense)
     {
         nauseaTolerance += 4;
     }
 
     peep->NauseaTolerance = nausea_tolerance_distribution[nauseaTolerance];
 
-    /* Scenario editor limits initial guest happiness to between 37..253.
-     * To be on the safe side, assume the value could have been hacked
-     * to any value 0..255. */
-    peep->Happiness = gameState.GuestInitialHappiness;
-    /* Assume a default initial happiness of 0 is wrong and set
-     * to 128 (50%) instead. */
-    if (gameState.GuestInitialHappiness == 0)
-        peep->Happiness = 128;
+    peep->Happiness = params.HappinessBase;
     /* Initial value will vary by -15..16 */
     int8_t happinessDelta = (ScenarioRand() & 0x1F) - 15;
     /* Adjust by the delta, clamping at min=0 and max=255. */
@@ -7198,19 +7219,13 @@ Guest* Guest::Generate(const CoordsXYZ& coords)
     peep->Nausea = 0;
     peep->NauseaTarget = 0;
 
-    /* Scenario editor limits initial guest hunger to between 37..253.
-     * To be on the safe side, assume the value could have been hacked
-     * to any value 0..255. */
-    peep->Hunger = gameState.GuestInitialHunger;
+    peep->Hunger = params.HungerBase;
     /* Initial value will vary by -15..16 */
     int8_t hungerDelta = (ScenarioRand() & 0x1F) - 15;
     /* Adjust by the delta, clamping at min=0 and max=255. */
     peep->Hunger = std::clamp(peep->Hunger + hungerDelta, 0, kPeepMaxHunger);
 
-    /* Scenario editor limits initial guest thirst to between 37..253.
-     * To be on the safe side, assume the value could have been hacked
-     * to any value 0..255. */
-    peep->Thirst = gameState.GuestInitialThirst;
+    peep->Thirst = params.ThirstBase;
     /* Initial value will vary by -15..16 */
     int8_t thirstDelta = (ScenarioRand() & 0x1F) - 15;
     /* Adjust by the delta, clamping at min=0 and max=255. */
@@ -7223,24 +7238,11 @@ Guest* Guest::Generate(const CoordsXYZ& coords)
     peep->PeepId = gameState.NextGuestNumber++;
     peep->Name = nullptr;
 
-    money64 cash = (static_cast<money64>(ScenarioRand() & 0x3) * 100) - 100 + gameState.GuestInitialCash;
+    money64 cash = (static_cast<money64>(ScenarioRand() & 0x3) * 100) - 100 + params.CashBase;
     if (cash < 0)
         cash = 0;
-
-    if (gameState.GuestInitialCash == 0.00_GBP)
-    {
-        cash = 500;
-    }
-
-    if (gameState.Park.Flags & PARK_FLAGS_NO_MONEY)
-    {
-        cash = 0;
-    }
-
-    if (gameState.GuestInitialCash == kMoney64Undefined)
-    {
-        cash = 0;
-    }
+    if (params.CashIsFixed)
+        cash = params.FixedCash;
 
     peep->CashInPocket = cash;
     peep->CashSpent = 0;
@@ -7557,6 +7559,28 @@ static bool IsThoughtShopItemRelated(const PeepThoughtType type)
     return false;
 }
 
+void Guest::SetFavouriteRide(RideId rideId)
+{
+    if (FavouriteRide == rideId)
+        return;
+
+    auto* previousRide = GetRide(FavouriteRide);
+    if (previousRide != nullptr && previousRide->guests_favourite > 0)
+    {
+        previousRide->guests_favourite--;
+        previousRide->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_CUSTOMER;
+    }
+
+    FavouriteRide = rideId;
+
+    auto* ride = GetRide(rideId);
+    if (ride != nullptr)
+    {
+        ride->guests_favourite++;
+        ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_CUSTOMER;
+    }
+}
+
 void Guest::RemoveRideFromMemory(RideId rideId)
 {
     if (State == PeepState::Watching)
@@ -7617,7 +7641,7 @@ void Guest::RemoveRideFromMemory(RideId rideId)
     }
     if (FavouriteRide == rideId)
     {
-        FavouriteRide = RideId::GetNull();
+        SetFavouriteRide(RideId::GetNull());
     }
 
     // Erase all thoughts that contain the ride.
@@ -261,17 +261,8 @@ struct Guest : Peep
     static constexpr auto cEntityType = EntityType::Guest;
 
 public:
-    uint8_t GuestNumRides;
-    EntityId GuestNextInQueue;
-    int32_t ParkEntryTime;
-    RideId GuestHeadingToRideId;
-    uint8_t GuestIsLostCountdown;
-    uint8_t GuestTimeOnRide;
-    money64 PaidToEnter;
-    money64 PaidOnRides;
-    money64 PaidOnFood;
-    money64 PaidOnDrink;
-    money64 PaidOnSouvenirs;
+    /* As in Peep, fields are ordered hot-first: the block below is what the
+     * per-tick guest update and the 512-tick park rating scan read. */
     bool OutsideOfPark;
     uint8_t Happiness;
     uint8_t HappinessTarget;
@@ -284,16 +275,14 @@ public:
     IntensityRange Intensity{ 0 };
     PeepNauseaTolerance NauseaTolerance;
     uint16_t TimeInQueue;
-    money64 CashInPocket;
-    money64 CashSpent;
-    RideId Photo1RideRef;
-    RideId Photo2RideRef;
-    RideId Photo3RideRef;
-    RideId Photo4RideRef;
-
     int8_t RejoinQueueTimeout; // whilst waiting for a free vehicle (or pair) in the entrance
     RideId PreviousRide;
     uint16_t PreviousRideTimeOut;
+    uint8_t GuestNumRides;
+    EntityId GuestNextInQueue;
+    RideId GuestHeadingToRideId;
+    uint8_t GuestIsLostCountdown;
+    uint8_t GuestTimeOnRide;
     std::array<PeepThought, kPeepMaxThoughts> Thoughts;
     // 0x3F Litter Count split into lots of 3 with time, 0xC0 Time since last recalc
     uint8_t LitterCount;
@@ -303,22 +292,37 @@ public:
     uint8_t AmountOfDrinks;
     uint8_t AmountOfSouvenirs;
     uint8_t VandalismSeen; // 0xC0 vandalism thought timeout, 0x3F vandalism tiles seen
+    uint8_t SurroundingsThoughtTimeout;
+    uint8_t Angriness;
+    uint8_t TimeLost; // the time the peep has been lost when it reaches 254 generates the lost thought
+    uint8_t DaysInQueue;
+    uint64_t ItemFlags;
+
+    /* Cold data: spending records, photos, vouchers and appearance, touched
+     * on purchases and when painting rather than every tick. */
+    int32_t ParkEntryTime;
+    money64 PaidToEnter;
+    money64 PaidOnRides;
+    money64 PaidOnFood;
+    money64 PaidOnDrink;
+    money64 PaidOnSouvenirs;
+    money64 CashInPocket;
+    money64 CashSpent;
+    RideId Photo1RideRef;
+    RideId Photo2RideRef;
+    RideId Photo3RideRef;
+    RideId Photo4RideRef;
     uint8_t VoucherType;
     union
     {
         RideId VoucherRideId;
         ShopItemIndex VoucherShopItem;
     };
-    uint8_t SurroundingsThoughtTimeout;
-    uint8_t Angriness;
-    uint8_t TimeLost; // the time the peep has been lost when it reaches 254 generates the lost thought
-    uint8_t DaysInQueue;
     uint8_t BalloonColour;
     uint8_t UmbrellaColour;
     uint8_t HatColour;
     RideId FavouriteRide;
     uint8_t FavouriteRideRating;
-    uint64_t ItemFlags;
 
     void UpdateGuest();
     void Tick128UpdateGuest(uint32_t index);
@@ -362,7 +366,24 @@ public:
     void InsertNewThought(PeepThoughtType thought_type, ShopItem thought_arguments);
     void InsertNewThought(PeepThoughtType thought_type, RideId rideId);
     void InsertNewThought(PeepThoughtType thought_type, uint16_t thought_arguments);
+    // Park-derived spawn parameters shared by every guest generated in the
+    // same batch. Resolving them once keeps bulk generation down to the
+    // per-guest random draws, which stay in their original order so the
+    // simulation remains deterministic.
+    struct GenerationParams
+    {
+        uint8_t HappinessBase;
+        uint8_t HungerBase;
+        uint8_t ThirstBase;
+        bool PrefLessIntense;
+        bool PrefMoreIntense;
+        money64 CashBase;
+        bool CashIsFixed;
+        money64 FixedCash;
+    };
+    static GenerationParams GetGenerationParams();
     static Guest* Generate(const CoordsXYZ& coords);
+    static Guest* Generate(const CoordsXYZ& coords, const GenerationParams& params);
     bool UpdateQueuePosition(PeepActionType previous_action);
     void RemoveFromQueue();
 
@@ -378,6 +399,9 @@ public:
     // the history, thoughts, etc.
     void RemoveRideFromMemory(RideId rideId);
 
+    // Sets FavouriteRide, keeping the per-ride favourite counters in step.
+    void SetFavouriteRide(RideId rideId);
+
 private:
     void UpdateRide();
     void UpdateOnRide(){}; // TODO
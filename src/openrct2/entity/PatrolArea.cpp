@@ -9,7 +9,6 @@
 
 #include "PatrolArea.h"
 
-#include "../core/Algorithm.hpp"
 #include "EntityList.h"
 #include "Staff.h"
 
@@ -18,13 +17,6 @@
 static PatrolArea _consolidatedPatrolArea[EnumValue(StaffType::Count)];
 static std::variant<StaffType, EntityId> _patrolAreaToRender;
 
-static bool CompareTileCoordsXY(const TileCoordsXY& lhs, const TileCoordsXY& rhs)
-{
-    if (lhs.y == rhs.y)
-        return lhs.x < rhs.x;
-    return lhs.y < rhs.y;
-}
-
 const PatrolArea::Cell* PatrolArea::GetCell(const TileCoordsXY& pos) const
 {
     return const_cast<PatrolArea*>(this)->GetCell(pos);
@@ -40,6 +32,13 @@ PatrolArea::Cell* PatrolArea::GetCell(const TileCoordsXY& pos)
     return &area;
 }
 
+size_t PatrolArea::GetCellBitIndex(const TileCoordsXY& pos)
+{
+    // Bits are ordered y-major so that iterating them visits tiles in the
+    // same (y, x) order the sorted tile lists used to.
+    return (static_cast<size_t>(pos.y % Cell::Height) * Cell::Width) + (pos.x % Cell::Width);
+}
+
 bool PatrolArea::IsEmpty() const
 {
     return TileCount == 0;
@@ -49,19 +48,19 @@ void PatrolArea::Clear()
 {
     for (auto& area : Areas)
     {
-        area.SortedTiles.clear();
+        area.Bits.reset();
+        area.Count = 0;
     }
+    TileCount = 0;
 }
 
 bool PatrolArea::Get(const TileCoordsXY& pos) const
 {
     auto* area = GetCell(pos);
-    if (area == nullptr)
+    if (area == nullptr || area->Bits == nullptr)
         return false;
 
-    auto it = BinaryFind(area->SortedTiles.begin(), area->SortedTiles.end(), pos, CompareTileCoordsXY);
-    auto found = it != area->SortedTiles.end();
-    return found;
+    return area->Bits->get(GetCellBitIndex(pos));
 }
 
 bool PatrolArea::Get(const CoordsXY& pos) const
@@ -75,18 +74,27 @@ void PatrolArea::Set(const TileCoordsXY& pos, bool value)
     if (area == nullptr)
         return;
 
-    auto it = std::lower_bound(area->SortedTiles.begin(), area->SortedTiles.end(), pos, CompareTileCoordsXY);
-    auto found = it != area->SortedTiles.end() && *it == pos;
+    if (area->Bits == nullptr)
+    {
+        if (!value)
+            return;
+        area->Bits = std::make_unique<OpenRCT2::BitSet<Cell::NumTiles>>();
+    }
+
+    const auto index = GetCellBitIndex(pos);
+    const auto found = area->Bits->get(index);
 
     if (!found && value)
     {
-        area->SortedTiles.insert(it, pos);
+        area->Bits->set(index, true);
+        area->Count++;
         TileCount++;
     }
     else if (found && !value)
     {
-        area->SortedTiles.erase(it);
-        assert(TileCount != 0);
+        area->Bits->set(index, false);
+        assert(area->Count != 0 && TileCount != 0);
+        area->Count--;
         TileCount--;
     }
 }
@@ -100,9 +108,23 @@ void PatrolArea::Union(const PatrolArea& other)
 {
     for (size_t i = 0; i < Areas.size(); i++)
     {
-        for (const auto& pos : other.Areas[i].SortedTiles)
+        const auto& src = other.Areas[i];
+        if (src.Bits == nullptr || src.Count == 0)
+            continue;
+
+        auto& dst = Areas[i];
+        if (dst.Bits == nullptr)
         {
-            Set(pos, true);
+            dst.Bits = std::make_unique<OpenRCT2::BitSet<Cell::NumTiles>>(*src.Bits);
+            dst.Count = src.Count;
+            TileCount += src.Count;
+        }
+        else
+        {
+            *dst.Bits |= *src.Bits;
+            const auto newCount = dst.Bits->count();
+            TileCount += newCount - dst.Count;
+            dst.Count = newCount;
         }
     }
 }
@@ -118,11 +140,22 @@ void PatrolArea::Union(const std::vector<TileCoordsXY>& other)
 std::vector<TileCoordsXY> PatrolArea::ToVector() const
 {
     std::vector<TileCoordsXY> result;
-    for (const auto& area : Areas)
+    result.reserve(TileCount);
+    for (size_t i = 0; i < Areas.size(); i++)
     {
-        for (const auto& pos : area.SortedTiles)
+        const auto& area = Areas[i];
+        if (area.Bits == nullptr || area.Count == 0)
+            continue;
+
+        const auto baseX = static_cast<int32_t>((i % CellColumns) * Cell::Width);
+        const auto baseY = static_cast<int32_t>((i / CellColumns) * Cell::Height);
+        for (size_t bit = 0; bit < Cell::NumTiles; bit++)
         {
-            result.push_back(pos);
+            if (area.Bits->get(bit))
+            {
+                result.push_back(TileCoordsXY(
+                    baseX + static_cast<int32_t>(bit % Cell::Width), baseY + static_cast<int32_t>(bit / Cell::Width)));
+            }
         }
     }
     return result;
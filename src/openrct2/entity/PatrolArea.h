@@ -9,9 +9,11 @@
 
 #pragma once
 
+#include "../core/BitSet.hpp"
 #include "../world/Map.h"
 #include "Peep.h"
 
+#include <memory>
 #include <variant>
 
 // The number of elements in the GameState_t.StaffPatrolAreas array per staff member. Every bit in the array represents a 4x4
@@ -29,7 +31,11 @@ private:
         static constexpr auto Height = 64;
         static constexpr auto NumTiles = Width * Height;
 
-        std::vector<TileCoordsXY> SortedTiles;
+        /* One bit per tile in the cell, allocated lazily so that an empty or
+         * localised patrol area does not pay for bits covering the whole map.
+         * Count mirrors the number of set bits. */
+        std::unique_ptr<OpenRCT2::BitSet<NumTiles>> Bits;
+        size_t Count{};
     };
 
     static constexpr auto CellColumns = (kMaximumMapSizeTechnical + (Cell::Width - 1)) / Cell::Width;
@@ -41,6 +47,7 @@ private:
 
     const Cell* GetCell(const TileCoordsXY& pos) const;
     Cell* GetCell(const TileCoordsXY& pos);
+    static size_t GetCellBitIndex(const TileCoordsXY& pos);
 
 public:
     bool IsEmpty() const;
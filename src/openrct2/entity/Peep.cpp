@@ -22,8 +22,10 @@
 #include "../audio/audio.h"
 #include "../config/Config.h"
 #include "../core/Guard.hpp"
+#include "../core/JobPool.h"
 #include "../drawing/LightFX.h"
 #include "../entity/Balloon.h"
+#include "../entity/EntityList.h"
 #include "../entity/EntityRegistry.h"
 #include "../entity/EntityTweener.h"
 #include "../interface/Window_internal.h"
@@ -59,12 +61,14 @@
 #include "PatrolArea.h"
 #include "Staff.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iterator>
 #include <limits>
 #include <map>
 #include <memory>
 #include <optional>
+#include <vector>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Audio;
@@ -192,6 +196,26 @@ int32_t PeepGetStaffCount()
  *
  *  rct2: 0x0068F0A9
  */
+// Minimum number of guests before sharding the independent update phase is
+// worth the dispatch overhead.
+constexpr size_t kParallelGuestThreshold = 512;
+
+static std::unique_ptr<JobPool> _peepUpdateJobs;
+
+static JobPool* PeepUpdateGetJobPool()
+{
+    bool useMultithreading = Config::Get().general.MultiThreading;
+    if (useMultithreading && _peepUpdateJobs == nullptr)
+    {
+        _peepUpdateJobs = std::make_unique<JobPool>();
+    }
+    else if (useMultithreading == false && _peepUpdateJobs != nullptr)
+    {
+        _peepUpdateJobs.reset();
+    }
+    return _peepUpdateJobs.get();
+}
+
 void PeepUpdateAll()
 {
     PROFILED_FUNCTION();
@@ -199,14 +223,53 @@ void PeepUpdateAll()
     if (gScreenFlags & SCREEN_FLAGS_EDITOR)
         return;
 
+    PathFinding::ResetTickBudget();
+
     const auto currentTicks = OpenRCT2::GetGameState().CurrentTicks;
 
     constexpr auto kTicks128Mask = 128u - 1u;
     const auto currentTicksMasked = currentTicks & kTicks128Mask;
 
+    // The self-contained part of each guest update is sharded across the job
+    // pool; everything that can touch the wider game state (the step state
+    // machines, easter egg interactions and the 128-tick updates) runs
+    // afterwards on this thread in entity order, so the outcome does not
+    // depend on thread count and multiplayer stays in lockstep.
+    std::vector<Guest*> guests;
+    guests.reserve(GetEntityListCount(EntityType::Guest));
+    for (auto* guest : EntityList<Guest>())
+        guests.push_back(guest);
+
+    std::vector<PeepUpdateFollowUp> followUps(guests.size(), PeepUpdateFollowUp::Full);
+    auto independentUpdates = [&](size_t fromIndex, size_t toIndex) {
+        for (size_t i = fromIndex; i < toIndex; i++)
+        {
+            // Guests due their 128-tick update keep the legacy path: that
+            // update runs first and can change what the regular one does.
+            if ((i & kTicks128Mask) != currentTicksMasked)
+                followUps[i] = guests[i]->UpdateIndependent();
+        }
+    };
+
+    auto* jobPool = PeepUpdateGetJobPool();
+    if (jobPool != nullptr && guests.size() >= kParallelGuestThreshold)
+    {
+        const size_t shardSize = std::max<size_t>(1, guests.size() / (jobPool->GetThreadCount() * 2));
+        for (size_t i = 0; i < guests.size(); i += shardSize)
+        {
+            const auto end = std::min(i + shardSize, guests.size());
+            jobPool->AddTask([&independentUpdates, i, end]() { independentUpdates(i, end); });
+        }
+        jobPool->Join();
+    }
+    else
+    {
+        independentUpdates(0, guests.size());
+    }
+
     uint32_t index = 0;
     // Warning this loop can delete peeps
-    for (auto peep : EntityList<Guest>())
+    for (auto* peep : guests)
     {
         if ((index & kTicks128Mask) == currentTicksMasked)
         {
@@ -216,7 +279,7 @@ void PeepUpdateAll()
         // 128 tick can delete so double check its not deleted
         if (peep->Type == EntityType::Guest)
         {
-            peep->Update();
+            peep->UpdateFollowUp(followUps[index]);
         }
 
         index++;
@@ -695,6 +758,7 @@ void PeepEntityRemove(Peep* peep)
     if (guest != nullptr)
     {
         guest->RemoveFromRide();
+        guest->SetFavouriteRide(RideId::GetNull());
     }
     peep->Invalidate();
 
@@ -716,9 +780,14 @@ void PeepEntityRemove(Peep* peep)
 
         News::DisableNewsItems(News::ItemType::Peep, staff->Id.ToUnderlying());
     }
+    const auto peepId = peep->Id;
     EntityRemove(peep);
 
     auto intent = Intent(wasGuest ? INTENT_ACTION_REFRESH_GUEST_LIST : INTENT_ACTION_REFRESH_STAFF_LIST);
+    if (wasGuest)
+    {
+        intent.PutExtra(INTENT_EXTRA_PEEP_ID, peepId);
+    }
     ContextBroadcastIntent(&intent);
 }
 
@@ -967,47 +1036,8 @@ static void GuestUpdateThoughts(Guest* peep)
     }
 }
 
-/**
- *
- *  rct2: 0x0068FC1E
- */
-void Peep::Update()
+uint32_t Peep::CalculateStepsToTake()
 {
-    if (PeepFlags & PEEP_FLAGS_POSITION_FROZEN)
-    {
-        if (!(PeepFlags & PEEP_FLAGS_ANIMATION_FROZEN))
-        {
-            // This is circumventing other logic, so only update every few ticks
-            if ((GetGameState().CurrentTicks & 3) == 0)
-            {
-                if (IsActionWalking())
-                    UpdateWalkingAnimation();
-                else
-                    UpdateActionAnimation();
-                Invalidate();
-            }
-        }
-        return;
-    }
-    else if (PeepFlags & PEEP_FLAGS_ANIMATION_FROZEN)
-    {
-        // Animation is frozen while position is not. This allows a peep to walk
-        // around without its sprite being updated, which looks very glitchy.
-        // We'll just remove the flag and continue as normal, in this case.
-        PeepFlags &= ~PEEP_FLAGS_ANIMATION_FROZEN;
-    }
-
-    auto* guest = As<Guest>();
-    if (guest != nullptr)
-    {
-        if (!guest->PreviousRide.IsNull())
-            if (++guest->PreviousRideTimeOut >= 720)
-                guest->PreviousRide = RideId::GetNull();
-
-        GuestUpdateThoughts(guest);
-    }
-
-    // Walking speed logic
     uint32_t stepsToTake = Energy;
     if (stepsToTake < 95 && State == PeepState::Queuing)
         stepsToTake = 95;
@@ -1023,57 +1053,152 @@ void Peep::Update()
     constexpr auto minStepsForCrossing = 55;
     if (stepsToTake < minStepsForCrossing && IsOnPathBlockedByVehicle())
         stepsToTake = minStepsForCrossing;
+    return stepsToTake;
+}
 
-    uint32_t carryCheck = StepProgress + stepsToTake;
-    StepProgress = carryCheck;
-    if (carryCheck <= 255)
+/**
+ * The part of the per-tick update that only reads and writes this peep;
+ * PeepUpdateAll runs it for many guests concurrently. Anything that can touch
+ * the wider game state is reported back as follow-up work for the caller to
+ * run on the main thread.
+ */
+PeepUpdateFollowUp Peep::UpdateIndependent()
+{
+    if (PeepFlags & (PEEP_FLAGS_POSITION_FROZEN | PEEP_FLAGS_ANIMATION_FROZEN))
     {
-        if (guest != nullptr)
+        // Frozen peeps update animations and raise invalidations; leave the
+        // whole update to the serial phase.
+        return PeepUpdateFollowUp::Full;
+    }
+
+    auto* guest = As<Guest>();
+    if (guest != nullptr)
+    {
+        // Dormant tier: a guest strapped into a ride with no thought or
+        // previous-ride timers running has nothing to advance until the
+        // vehicle state machine hands them back. The step counter would only
+        // tick towards the no-op OnRide step, so it is left alone too.
+        if (State == PeepState::OnRide && guest->PreviousRide.IsNull()
+            && guest->Thoughts[0].type == PeepThoughtType::None && !(PeepFlags & kPeepFlagsEasterEggMask))
         {
-            guest->UpdateEasterEggInteractions();
+            return PeepUpdateFollowUp::None;
         }
+
+        if (!guest->PreviousRide.IsNull())
+            if (++guest->PreviousRideTimeOut >= 720)
+                guest->PreviousRide = RideId::GetNull();
+
+        GuestUpdateThoughts(guest);
     }
-    else
+
+    // Walking speed logic
+    uint32_t carryCheck = StepProgress + CalculateStepsToTake();
+    StepProgress = carryCheck;
+    if (carryCheck <= 255)
+    {
+        return guest != nullptr ? PeepUpdateFollowUp::EasterEggs : PeepUpdateFollowUp::None;
+    }
+    return PeepUpdateFollowUp::Step;
+}
+
+void Peep::UpdateStep()
+{
+    // Loc68FD2F
+    switch (State)
     {
-        // Loc68FD2F
-        switch (State)
+        case PeepState::Falling:
+            UpdateFalling();
+            break;
+        case PeepState::One:
+            Update1();
+            break;
+        case PeepState::OnRide:
+            // No action
+            break;
+        case PeepState::Picked:
+            UpdatePicked();
+            break;
+        default:
         {
-            case PeepState::Falling:
-                UpdateFalling();
-                break;
-            case PeepState::One:
-                Update1();
-                break;
-            case PeepState::OnRide:
-                // No action
-                break;
-            case PeepState::Picked:
-                UpdatePicked();
-                break;
-            default:
+            auto* guest = As<Guest>();
+            if (guest != nullptr)
             {
-                if (guest != nullptr)
+                guest->UpdateGuest();
+            }
+            else
+            {
+                auto* staff = As<Staff>();
+                if (staff != nullptr)
                 {
-                    guest->UpdateGuest();
+                    staff->UpdateStaff(CalculateStepsToTake());
                 }
                 else
                 {
-                    auto* staff = As<Staff>();
-                    if (staff != nullptr)
-                    {
-                        staff->UpdateStaff(stepsToTake);
-                    }
-                    else
-                    {
-                        assert(false);
-                    }
+                    assert(false);
                 }
-                break;
             }
+            break;
+        }
+    }
+}
+
+void Peep::UpdateFollowUp(PeepUpdateFollowUp followUp)
+{
+    switch (followUp)
+    {
+        case PeepUpdateFollowUp::None:
+            break;
+        case PeepUpdateFollowUp::EasterEggs:
+        {
+            auto* guest = As<Guest>();
+            if (guest != nullptr)
+            {
+                guest->UpdateEasterEggInteractions();
+            }
+            break;
         }
+        case PeepUpdateFollowUp::Step:
+            UpdateStep();
+            break;
+        case PeepUpdateFollowUp::Full:
+            Update();
+            break;
     }
 }
 
+/**
+ *
+ *  rct2: 0x0068FC1E
+ */
+void Peep::Update()
+{
+    if (PeepFlags & PEEP_FLAGS_POSITION_FROZEN)
+    {
+        if (!(PeepFlags & PEEP_FLAGS_ANIMATION_FROZEN))
+        {
+            // This is circumventing other logic, so only update every few ticks
+            if ((GetGameState().CurrentTicks & 3) == 0)
+            {
+                if (IsActionWalking())
+                    UpdateWalkingAnimation();
+                else
+                    UpdateActionAnimation();
+                Invalidate();
+            }
+        }
+        return;
+    }
+    else if (PeepFlags & PEEP_FLAGS_ANIMATION_FROZEN)
+    {
+        // Animation is frozen while position is not. This allows a peep to walk
+        // around without its sprite being updated, which looks very glitchy.
+        // We'll just remove the flag and continue as normal, in this case.
+        PeepFlags &= ~PEEP_FLAGS_ANIMATION_FROZEN;
+    }
+
+    UpdateFollowUp(UpdateIndependent());
+}
+
 /**
  *
  *  rct2: 0x0069BF41
@@ -232,6 +232,11 @@ enum PeepFlags : uint32_t
     PEEP_FLAGS_TWITCH_DEPRECATED = (1u << 31),   // Formerly used for twitch integration
 };
 
+// Flags that make Guest::UpdateEasterEggInteractions affect nearby guests or
+// draw from the scenario RNG; a guest holding any of these is never dormant.
+constexpr uint32_t kPeepFlagsEasterEggMask = PEEP_FLAGS_PURPLE | PEEP_FLAGS_PIZZA | PEEP_FLAGS_CONTAGIOUS | PEEP_FLAGS_JOY
+    | PEEP_FLAGS_ICE_CREAM;
+
 enum PeepNextFlags
 {
     PEEP_NEXT_FLAG_DIRECTION_MASK = 0x3,
@@ -309,9 +314,25 @@ enum PeepInvalidate
 struct Guest;
 struct Staff;
 
+/**
+ * Work left over from Peep::UpdateIndependent that has to run on the main
+ * thread, in entity order, because it can mutate the wider game state.
+ */
+enum class PeepUpdateFollowUp : uint8_t
+{
+    None,
+    EasterEggs,
+    Step,
+    Full,
+};
+
 struct Peep : EntityBase
 {
-    char* Name;
+    /* Fields are ordered hot-first: everything a normal Peep::Update tick
+     * touches sits in the first cache lines of the entity slot, with rarely
+     * accessed data (the name, the pathfind memory) at the end. With
+     * thousands of peeps the update loop is bound by cache misses, so keep
+     * new per-tick fields in the hot block. */
     CoordsXYZ NextLoc;
     uint8_t NextFlags;
     PeepState State;
@@ -323,8 +344,6 @@ struct Peep : EntityBase
         PeepUsingBinSubState UsingBinSubState;
     };
     PeepSpriteType SpriteType;
-    uint8_t TshirtColour;
-    uint8_t TrousersColour;
     uint16_t DestinationX; // Location that the peep is trying to get to
     uint16_t DestinationY;
     uint8_t DestinationTolerance; // How close to destination before next action/state 0 = exact
@@ -366,15 +385,22 @@ struct Peep : EntityBase
         ::Direction PeepDirection; // Direction ?
     };
     RideId InteractionRideIndex;
-    uint32_t PeepId;
     uint8_t PathCheckOptimisation; // see peep.checkForPath
-    TileCoordsXYZD PathfindGoal;
-    std::array<TileCoordsXYZD, 4> PathfindHistory;
     uint8_t WalkingFrameNum;
     uint32_t PeepFlags;
 
+    // Cold data: only touched when a peep is named, painted or repathing.
+    char* Name;
+    uint32_t PeepId;
+    uint8_t TshirtColour;
+    uint8_t TrousersColour;
+    TileCoordsXYZD PathfindGoal;
+    std::array<TileCoordsXYZD, 4> PathfindHistory;
+
 public: // Peep
     void Update();
+    PeepUpdateFollowUp UpdateIndependent();
+    void UpdateFollowUp(PeepUpdateFollowUp followUp);
     std::optional<CoordsXY> UpdateAction(int16_t& xy_distance);
     std::optional<CoordsXY> UpdateAction();
     bool UpdateActionAnimation();
@@ -428,6 +454,8 @@ public: // Peep
     [[nodiscard]] PeepActionSpriteType GetActionSpriteType();
 
 private:
+    uint32_t CalculateStepsToTake();
+    void UpdateStep();
     void UpdateFalling();
     void Update1();
     void UpdatePicked();
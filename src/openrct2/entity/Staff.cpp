@@ -331,6 +331,13 @@ bool Staff::HasPatrolArea() const
  */
 Direction Staff::HandymanDirectionToNearestLitter() const
 {
+    // The litter density grid bounds the entity list scan below: litter in
+    // seeking range is also within the same XY radius on the grid, so an
+    // empty neighbourhood means there is nothing to seek. With litter being
+    // rare relative to handymen this skips the scan for most decisions.
+    if (GetLitterDensity(GetLocation(), MAX_LITTER_DISTANCE) == 0)
+        return INVALID_DIRECTION;
+
     uint16_t nearestLitterDist = 0xFFFF;
     Litter* nearestLitter = nullptr;
     for (auto litter : EntityList<Litter>())
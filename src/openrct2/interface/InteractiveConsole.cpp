@@ -29,6 +29,7 @@
 #include "../actions/StaffSetCostumeAction.h"
 #include "../config/Config.h"
 #include "../core/Console.hpp"
+#include "../core/File.h"
 #include "../core/Guard.hpp"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
@@ -40,6 +41,7 @@
 #include "../entity/EntityRegistry.h"
 #include "../entity/Staff.h"
 #include "../interface/Chat.h"
+#include "../interface/PaintBenchmark.h"
 #include "../interface/Colour.h"
 #include "../interface/Window_internal.h"
 #include "../localisation/Formatting.h"
@@ -49,13 +51,22 @@
 #include "../network/network.h"
 #include "../object/Object.h"
 #include "../object/ObjectList.h"
+#include "../object/ObjectLoadStats.h"
 #include "../object/ObjectManager.h"
 #include "../object/ObjectRepository.h"
+#include "../paint/PaintStats.h"
 #include "../platform/Platform.h"
+#include "../profiling/AllocationTracker.h"
+#include "../profiling/PerfCounters.h"
 #include "../profiling/Profiling.h"
+#include "../profiling/TickWatchdog.h"
+#include "../profiling/Tracing.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
 #include "../ride/Vehicle.h"
+#ifdef ENABLE_SCRIPTING
+#    include "../scripting/ScriptEngine.h"
+#endif
 #include "../util/Util.h"
 #include "../windows/Intent.h"
 #include "../world/Climate.h"
@@ -1530,6 +1541,19 @@ static int32_t ConsoleCommandLoadPark([[maybe_unused]] InteractiveConsole& conso
     return 1;
 }
 
+static int32_t ConsoleCommandRestartScenario(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    if (OpenRCT2::GetContext()->RestartScenario())
+    {
+        console.WriteLine("Scenario restarted from the in-memory baseline");
+    }
+    else
+    {
+        console.WriteLineError("No scenario baseline is resident; load a scenario first");
+    }
+    return 1;
+}
+
 static int32_t ConsoleCommandSavePark([[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
 {
     if (argv.size() < 1)
@@ -1660,8 +1684,14 @@ static int32_t ConsoleCommandReplayStart(InteractiveConsole& console, const argu
 
     std::string name = argv[0];
 
+    uint32_t targetTick = 0;
+    if (argv.size() >= 2)
+    {
+        targetTick = atoi(argv[1].c_str());
+    }
+
     auto* replayManager = OpenRCT2::GetContext()->GetReplayManager();
-    if (replayManager->StartPlayback(name))
+    if (replayManager->StartPlayback(name, targetTick))
     {
         OpenRCT2::ReplayRecordInfo info;
         replayManager->GetCurrentReplayInfo(info);
@@ -1791,6 +1821,40 @@ static int32_t ConsoleCommandMpDesync(InteractiveConsole& console, const argumen
     return 0;
 }
 
+static int32_t ConsoleCommandMpStatus(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    const auto mode = NetworkGetMode();
+    if (mode == NETWORK_MODE_NONE)
+    {
+        console.WriteFormatLine("Not connected to a multiplayer game.");
+        return 0;
+    }
+
+    const uint32_t currentTick = GetGameState().CurrentTicks;
+    console.WriteFormatLine("Current tick: %u", currentTick);
+    console.WriteFormatLine("Action queue depth: %u", static_cast<uint32_t>(GameActions::GetQueueDepth()));
+
+    if (mode == NETWORK_MODE_CLIENT)
+    {
+        const uint32_t serverTick = NetworkGetServerTick();
+        console.WriteFormatLine("Server tick: %u (%u behind)", serverTick, serverTick - currentTick);
+    }
+    else
+    {
+        for (int32_t i = 0; i < NetworkGetNumPlayers(); i++)
+        {
+            if (NetworkGetPlayerFlags(i) & NETWORK_PLAYER_FLAG_ISSERVER)
+                continue;
+
+            const uint32_t lastTick = NetworkGetPlayerLastTick(i);
+            console.WriteFormatLine(
+                "%s: ping %d ms, %u ticks behind", NetworkGetPlayerName(i), NetworkGetPlayerPing(i),
+                lastTick < currentTick ? currentTick - lastTick : 0);
+        }
+    }
+    return 0;
+}
+
 #pragma warning(push)
 #pragma warning(disable : 4702) // unreachable code
 static int32_t ConsoleCommandAbort([[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
@@ -1926,6 +1990,314 @@ static int32_t ConsoleCommandProfilerStop(
     return 0;
 }
 
+static int32_t ConsoleCommandPerfCounters(InteractiveConsole& console, const arguments_t& argv)
+{
+    const auto json = OpenRCT2::PerfCounters::ExportJson();
+    if (argv.size() >= 1)
+    {
+        try
+        {
+            File::WriteAllBytes(argv[0], json.data(), json.size());
+        }
+        catch (const std::exception& e)
+        {
+            console.WriteFormatLine("Unable to write counters to %s: %s", argv[0].c_str(), e.what());
+            return 1;
+        }
+        console.WriteFormatLine("Wrote counters to \"%s\"", argv[0].c_str());
+    }
+    else
+    {
+        console.WriteLine(json.c_str());
+    }
+    return 0;
+}
+
+static int32_t ConsoleCommandAllocStatsStart(
+    [[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    if (!OpenRCT2::AllocationTracker::IsEnabled())
+        console.WriteLine("Started allocation tracking");
+    OpenRCT2::AllocationTracker::Reset();
+    OpenRCT2::AllocationTracker::SetEnabled(true);
+    return 0;
+}
+
+static int32_t ConsoleCommandAllocStatsStop(
+    [[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    if (OpenRCT2::AllocationTracker::IsEnabled())
+        console.WriteLine("Stopped allocation tracking");
+    OpenRCT2::AllocationTracker::SetEnabled(false);
+    return 0;
+}
+
+static int32_t ConsoleCommandAllocStats([[maybe_unused]] InteractiveConsole& console, const arguments_t& argv)
+{
+    using namespace OpenRCT2::AllocationTracker;
+
+    if (!IsEnabled())
+    {
+        console.WriteLineError("Allocations are not being tracked, run alloc_stats_start first.");
+        return 1;
+    }
+
+    if (argv.size() >= 1 && argv[0] == "json")
+    {
+        console.WriteLine(ToJson());
+        return 0;
+    }
+
+    console.WriteFormatLine(
+        "%-12s %10s %12s %12s %12s %12s", "tag", "count", "bytes", "live", "peak", "arena bytes");
+    for (size_t i = 0; i < kAllocTagCount; i++)
+    {
+        const auto tag = static_cast<AllocTag>(i);
+        const auto counters = GetCounters(tag);
+        console.WriteFormatLine(
+            "%-12s %10llu %12llu %12llu %12llu %12llu", AllocTagName(tag), static_cast<unsigned long long>(counters.Count),
+            static_cast<unsigned long long>(counters.Bytes), static_cast<unsigned long long>(counters.LiveBytes),
+            static_cast<unsigned long long>(counters.PeakLiveBytes), static_cast<unsigned long long>(counters.ArenaBytes));
+    }
+    return 0;
+}
+
+static int32_t ConsoleCommandTickWatchdog(InteractiveConsole& console, const arguments_t& argv)
+{
+    using namespace OpenRCT2::TickWatchdog;
+
+    if (argv.size() < 1)
+    {
+        if (IsEnabled())
+            console.WriteFormatLine(
+                "Tick watchdog budget: %.2f ms, captures: %u", GetBudgetMs(), static_cast<uint32_t>(GetCaptureCount()));
+        else
+            console.WriteLine("Tick watchdog is disabled.");
+        return 0;
+    }
+
+    if (argv[0] == "dump")
+    {
+        if (GetCaptureCount() == 0)
+        {
+            console.WriteLine("No tick overruns captured.");
+            return 0;
+        }
+
+        const auto json = GetCapturesJson();
+        if (argv.size() >= 2)
+        {
+            try
+            {
+                File::WriteAllBytes(argv[1], json.data(), json.size());
+            }
+            catch (const std::exception& e)
+            {
+                console.WriteFormatLine("Unable to write captures to %s: %s", argv[1].c_str(), e.what());
+                return 1;
+            }
+            console.WriteFormatLine(
+                "Wrote %u captures to \"%s\"", static_cast<uint32_t>(GetCaptureCount()), argv[1].c_str());
+        }
+        else
+        {
+            console.WriteLine(json.c_str());
+        }
+        return 0;
+    }
+
+    if (argv[0] == "clear")
+    {
+        ClearCaptures();
+        console.WriteLine("Cleared tick watchdog captures.");
+        return 0;
+    }
+
+    const auto budgetMs = atof(argv[0].c_str());
+    SetBudgetMs(budgetMs);
+    if (IsEnabled())
+        console.WriteFormatLine("Tick watchdog enabled with a budget of %.2f ms per tick.", GetBudgetMs());
+    else
+        console.WriteLine("Tick watchdog disabled.");
+    return 0;
+}
+
+static int32_t ConsoleCommandBenchPaint(InteractiveConsole& console, const arguments_t& argv)
+{
+    int32_t frames = 100;
+    if (argv.size() >= 1)
+    {
+        frames = atoi(argv[0].c_str());
+        if (frames <= 0)
+        {
+            console.WriteLineError("Frames must be positive.");
+            return 1;
+        }
+    }
+
+    const auto width = ContextGetWidth();
+    const auto height = ContextGetHeight();
+    console.WriteFormatLine("Rendering %d frames per scene at %dx%d...", frames, width, height);
+
+    const auto results = RunPaintBenchmark(width, height, frames, GetStandardPaintBenchmarkScenes());
+    console.WriteFormatLine(
+        "%-14s %8s %9s %9s %9s %9s %9s %9s", "Scene", "Frames", "Mean ms", "p50 ms", "p95 ms", "p99 ms", "Min ms", "Max ms");
+    for (const auto& result : results)
+    {
+        console.WriteFormatLine(
+            "%-14s %8d %9.3f %9.3f %9.3f %9.3f %9.3f %9.3f", result.SceneName.c_str(), result.Frames, result.MeanMs,
+            result.MedianMs, result.P95Ms, result.P99Ms, result.MinMs, result.MaxMs);
+    }
+    return 0;
+}
+
+static int32_t ConsoleCommandTraceStart(
+    [[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    if (!OpenRCT2::Tracing::IsRecording())
+        console.WriteLine("Started trace capture");
+    OpenRCT2::Tracing::Clear();
+    OpenRCT2::Tracing::Start();
+    return 0;
+}
+
+static int32_t ConsoleCommandTraceStop(
+    [[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    if (OpenRCT2::Tracing::IsRecording())
+        console.WriteLine("Stopped trace capture");
+    OpenRCT2::Tracing::Stop();
+
+    if (argv.size() < 1)
+    {
+        console.WriteLineError("Missing argument: <file path>");
+        return 1;
+    }
+
+    const auto& traceFilePath = argv[0];
+    if (!OpenRCT2::Tracing::ExportTrace(traceFilePath))
+    {
+        console.WriteFormatLine("Unable to export trace file to %s", traceFilePath.c_str());
+        return 1;
+    }
+
+    console.WriteFormatLine("Wrote trace file: \"%s\"", traceFilePath.c_str());
+    return 0;
+}
+
+static int32_t ConsoleCommandPaintStatsStart(
+    [[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    if (!OpenRCT2::Paint::PaintStatsAreEnabled())
+        console.WriteLine("Started paint stats collection");
+    OpenRCT2::Paint::PaintStatsSetEnabled(true);
+    return 0;
+}
+
+static int32_t ConsoleCommandPaintStatsStop(
+    [[maybe_unused]] InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
+{
+    if (OpenRCT2::Paint::PaintStatsAreEnabled())
+        console.WriteLine("Stopped paint stats collection");
+    OpenRCT2::Paint::PaintStatsSetEnabled(false);
+    return 0;
+}
+
+static int32_t ConsoleCommandPaintStats([[maybe_unused]] InteractiveConsole& console, const arguments_t& argv)
+{
+    if (!OpenRCT2::Paint::PaintStatsAreEnabled())
+    {
+        console.WriteLineError("Paint stats are not being collected, run paint_stats_start first.");
+        return 1;
+    }
+
+    const auto frame = OpenRCT2::Paint::PaintStatsGetLastFrame();
+    if (argv.size() >= 1 && argv[0] == "json")
+    {
+        console.WriteLine(OpenRCT2::Paint::PaintStatsToJson(frame));
+        return 0;
+    }
+
+    console.WriteFormatLine("%-14s %10s %12s", "category", "count", "time (us)");
+    for (size_t i = 0; i < OpenRCT2::Paint::kPaintStatCategoryCount; i++)
+    {
+        const auto category = static_cast<OpenRCT2::Paint::PaintStatCategory>(i);
+        const auto& entry = frame.Categories[i];
+        console.WriteFormatLine(
+            "%-14s %10llu %12llu", OpenRCT2::Paint::PaintStatCategoryName(category),
+            static_cast<unsigned long long>(entry.Count), static_cast<unsigned long long>(entry.TimeUs));
+    }
+    return 0;
+}
+
+#ifdef ENABLE_SCRIPTING
+static int32_t ConsoleCommandPluginStats(InteractiveConsole& console, const arguments_t& argv)
+{
+    using namespace OpenRCT2::Scripting;
+
+    auto& scriptEngine = OpenRCT2::GetContext()->GetScriptEngine();
+    auto& plugins = scriptEngine.GetPlugins();
+    if (plugins.empty())
+    {
+        console.WriteLine("No plugins loaded.");
+        return 0;
+    }
+
+    if (!argv.empty() && argv[0] == "hooks")
+    {
+        auto& hookEngine = scriptEngine.GetHookEngine();
+        console.WriteFormatLine("%-24s %-32s %10s %12s", "hook", "plugin", "calls", "time (us)");
+        for (const auto& hookList : hookEngine.GetAllHookLists())
+        {
+            for (const auto& hook : hookList.Hooks)
+            {
+                console.WriteFormatLine(
+                    "%-24.*s %-32s %10llu %12llu", static_cast<int>(GetHookName(hookList.Type).size()),
+                    GetHookName(hookList.Type).data(), hook.Owner->GetMetadata().Name.c_str(),
+                    static_cast<unsigned long long>(hook.CallCount), static_cast<unsigned long long>(hook.TotalTimeUs));
+            }
+        }
+        return 0;
+    }
+
+    console.WriteFormatLine("%-32s %10s %12s %16s %10s", "plugin", "calls", "time (us)", "peak tick (us)", "throttled");
+    for (const auto& plugin : plugins)
+    {
+        const auto& perf = plugin->GetPerformance();
+        console.WriteFormatLine(
+            "%-32s %10llu %12llu %16llu %10s", plugin->GetMetadata().Name.c_str(),
+            static_cast<unsigned long long>(perf.CallCount), static_cast<unsigned long long>(perf.TotalTimeUs),
+            static_cast<unsigned long long>(perf.PeakTickTimeUs), plugin->IsThrottled() ? "yes" : "no");
+    }
+    return 0;
+}
+#endif
+
+static int32_t ConsoleCommandObjectLoadStats(InteractiveConsole& console, const arguments_t& argv)
+{
+    auto stats = OpenRCT2::ObjectLoadStats::GetAll();
+    if (stats.empty())
+    {
+        console.WriteLine("No objects have been loaded yet.");
+        return 0;
+    }
+
+    if (!argv.empty() && argv[0] == "json")
+    {
+        console.WriteLine(OpenRCT2::ObjectLoadStats::ToJson());
+        return 0;
+    }
+
+    console.WriteFormatLine("%-48s %12s %14s %14s", "object", "time (us)", "image bytes", "string bytes");
+    for (const auto& entry : stats)
+    {
+        console.WriteFormatLine(
+            "%-48s %12llu %14llu %14llu", entry.Identifier.c_str(), static_cast<unsigned long long>(entry.LoadTimeUs),
+            static_cast<unsigned long long>(entry.ImageBytes), static_cast<unsigned long long>(entry.StringBytes));
+    }
+    return 0;
+}
+
 static int32_t ConsoleSpawnBalloon(InteractiveConsole& console, const arguments_t& argv)
 {
     if (argv.size() < 3)
@@ -2029,6 +2401,8 @@ static constexpr ConsoleCommand console_command_table[] = {
     { "remove_unused_objects", ConsoleCommandRemoveUnusedObjects, "Removes all the unused objects from the object selection.",
       "remove_unused_objects" },
     { "remove_floating_objects", ConsoleCommandRemoveFloatingObjects, "Removes floating objects", "remove_floating_objects" },
+    { "restart_scenario", ConsoleCommandRestartScenario,
+      "Restarts the current scenario from the state captured when it was loaded.", "restart_scenario" },
     { "rides", ConsoleCommandRides, "Ride management.", "rides <subcommand>" },
     { "save_park", ConsoleCommandSavePark, "Save current state of park. If no name specified default path will be used.",
       "save_park [name]" },
@@ -2044,17 +2418,42 @@ static constexpr ConsoleCommand console_command_table[] = {
     { "replay_startrecord", ConsoleCommandReplayStartRecord, "Starts recording a new replay.",
       "replay_startrecord <name> [max_ticks]" },
     { "replay_stoprecord", ConsoleCommandReplayStopRecord, "Stops recording a new replay.", "replay_stoprecord" },
-    { "replay_start", ConsoleCommandReplayStart, "Starts a replay", "replay_start <name>" },
+    { "replay_start", ConsoleCommandReplayStart, "Starts a replay, optionally from the last keyframe before a given tick.",
+      "replay_start <name> [tick]" },
     { "replay_stop", ConsoleCommandReplayStop, "Stops the replay", "replay_stop" },
     { "replay_normalise", ConsoleCommandReplayNormalise, "Normalises the replay to remove all gaps",
       "replay_normalise <input file> <output file>" },
     { "mp_desync", ConsoleCommandMpDesync, "Forces a multiplayer desync",
       "ConsoleCommandMpDesync [desync_type, 0 = Random t-shirt color on random guest, 1 = Remove random guest ]" },
+    { "mp_status", ConsoleCommandMpStatus, "Shows multiplayer tick lag, action queue depth and per-client lag.", "mp_status" },
     { "profiler_reset", ConsoleCommandProfilerReset, "Resets the profiler data.", "profiler_reset" },
     { "profiler_start", ConsoleCommandProfilerStart, "Starts the profiler.", "profiler_start" },
     { "profiler_stop", ConsoleCommandProfilerStop, "Stops the profiler.", "profiler_stop [<output file>]" },
     { "profiler_exportcsv", ConsoleCommandProfilerExportCSV, "Exports the current profiler data.",
       "profiler_exportcsv <output file>" },
+    { "trace_start", ConsoleCommandTraceStart, "Starts capturing trace events.", "trace_start" },
+    { "trace_stop", ConsoleCommandTraceStop, "Stops capturing and exports a Chrome trace JSON file.",
+      "trace_stop <output file>" },
+    { "perf_counters", ConsoleCommandPerfCounters,
+      "Exports the performance counters as JSON, to the console or to a file for scraping.", "perf_counters [<output file>]" },
+    { "tick_watchdog", ConsoleCommandTickWatchdog,
+      "Captures a diagnostic whenever a game tick exceeds the given budget; 0 disables.",
+      "tick_watchdog [<budget ms>|dump [<output file>]|clear]" },
+    { "benchpaint", ConsoleCommandBenchPaint,
+      "Renders the standard benchmark scenes offscreen and reports ms/frame percentiles per scene.", "benchpaint [<frames>]" },
+    { "paint_stats", ConsoleCommandPaintStats, "Shows per-subsystem paint timing for the last painted frame.",
+      "paint_stats [json]" },
+    { "paint_stats_start", ConsoleCommandPaintStatsStart, "Starts collecting paint timing data.", "paint_stats_start" },
+    { "alloc_stats", ConsoleCommandAllocStats, "Shows per-subsystem allocation counters.", "alloc_stats [json]" },
+    { "alloc_stats_start", ConsoleCommandAllocStatsStart, "Starts tracking allocations per subsystem.", "alloc_stats_start" },
+    { "alloc_stats_stop", ConsoleCommandAllocStatsStop, "Stops tracking allocations.", "alloc_stats_stop" },
+    { "paint_stats_stop", ConsoleCommandPaintStatsStop, "Stops collecting paint timing data.", "paint_stats_stop" },
+    { "object_load_stats", ConsoleCommandObjectLoadStats, "Shows per-object load time and decoded data sizes, slowest first.",
+      "object_load_stats [json]" },
+#ifdef ENABLE_SCRIPTING
+    { "plugin_stats", ConsoleCommandPluginStats, "Shows per-plugin script execution time, optionally per hook.",
+      "plugin_stats [hooks]" },
+#endif
 };
 
 static int32_t ConsoleCommandWindows(InteractiveConsole& console, [[maybe_unused]] const arguments_t& argv)
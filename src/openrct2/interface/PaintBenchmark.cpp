@@ -0,0 +1,119 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "PaintBenchmark.h"
+
+#include "../Context.h"
+#include "../Game.h"
+#include "../GameState.h"
+#include "../drawing/X8DrawingEngine.h"
+#include "../paint/Paint.h"
+#include "../world/Map.h"
+#include "Viewport.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <memory>
+
+using namespace OpenRCT2;
+using namespace OpenRCT2::Drawing;
+
+std::vector<PaintBenchmarkScene> OpenRCT2::GetStandardPaintBenchmarkScenes()
+{
+    const auto& mapSize = GetGameState().MapSize;
+    const CoordsXY centre = { (mapSize.x / 2) * COORDS_XY_STEP + 16, (mapSize.y / 2) * COORDS_XY_STEP + 16 };
+
+    std::vector<PaintBenchmarkScene> scenes;
+    for (int8_t zoom = 0; zoom <= 2; zoom++)
+    {
+        scenes.push_back({ "centre z" + std::to_string(zoom) + " r0", centre, zoom, 0 });
+    }
+    for (int32_t rotation = 1; rotation < 4; rotation++)
+    {
+        scenes.push_back({ "centre z1 r" + std::to_string(rotation), centre, 1, rotation });
+    }
+    return scenes;
+}
+
+static Viewport GetSceneViewport(const PaintBenchmarkScene& scene, int32_t width, int32_t height)
+{
+    int32_t z = TileElementHeight(scene.Position);
+    auto coords2d = Translate3DTo2DWithZ(scene.Rotation, CoordsXYZ(scene.Position, z));
+
+    Viewport viewport{};
+    viewport.width = width;
+    viewport.height = height;
+    viewport.view_width = width;
+    viewport.view_height = height;
+    viewport.viewPos = { coords2d.x - ((width << scene.Zoom) / 2), coords2d.y - ((height << scene.Zoom) / 2) };
+    viewport.zoom = ZoomLevel{ scene.Zoom };
+    viewport.rotation = scene.Rotation;
+    return viewport;
+}
+
+static double GetPercentile(const std::vector<double>& sortedSamples, int32_t percentile)
+{
+    const auto index = (sortedSamples.size() - 1) * percentile / 100;
+    return sortedSamples[index];
+}
+
+std::vector<PaintBenchmarkResult> OpenRCT2::RunPaintBenchmark(
+    int32_t width, int32_t height, int32_t frames, const std::vector<PaintBenchmarkScene>& scenes)
+{
+    std::vector<PaintBenchmarkResult> results;
+    if (width <= 0 || height <= 0 || frames <= 0)
+        return results;
+
+    // Ensure sprites appear regardless of rotation
+    ResetAllSpriteQuadrantPlacements();
+
+    auto drawingEngine = std::make_unique<X8DrawingEngine>(GetContext()->GetUiContext());
+    auto bits = std::make_unique<uint8_t[]>(static_cast<size_t>(width) * height);
+
+    for (const auto& scene : scenes)
+    {
+        const auto viewport = GetSceneViewport(scene, width, height);
+
+        DrawPixelInfo dpi;
+        dpi.bits = bits.get();
+        dpi.width = width;
+        dpi.height = height;
+        dpi.DrawingEngine = drawingEngine.get();
+
+        // One unmeasured frame warms the sprite and glyph caches.
+        ViewportRender(dpi, &viewport, { { 0, 0 }, { width, height } });
+
+        std::vector<double> frameMs;
+        frameMs.reserve(frames);
+        for (int32_t i = 0; i < frames; i++)
+        {
+            const auto frameStart = std::chrono::steady_clock::now();
+            ViewportRender(dpi, &viewport, { { 0, 0 }, { width, height } });
+            const auto frameEnd = std::chrono::steady_clock::now();
+            frameMs.push_back(std::chrono::duration<double, std::milli>(frameEnd - frameStart).count());
+        }
+        std::sort(frameMs.begin(), frameMs.end());
+
+        PaintBenchmarkResult result;
+        result.SceneName = scene.Name;
+        result.Frames = frames;
+        double total = 0;
+        for (auto ms : frameMs)
+            total += ms;
+        result.MeanMs = total / frames;
+        result.MedianMs = GetPercentile(frameMs, 50);
+        result.P95Ms = GetPercentile(frameMs, 95);
+        result.P99Ms = GetPercentile(frameMs, 99);
+        result.MinMs = frameMs.front();
+        result.MaxMs = frameMs.back();
+        results.push_back(std::move(result));
+    }
+    return results;
+}
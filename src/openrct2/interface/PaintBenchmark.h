@@ -0,0 +1,56 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include "../world/Location.hpp"
+
+#include <string>
+#include <vector>
+
+namespace OpenRCT2
+{
+    /**
+     * A viewport position to benchmark: the given world position is centred in
+     * the view at the given zoom and rotation.
+     */
+    struct PaintBenchmarkScene
+    {
+        std::string Name;
+        CoordsXY Position;
+        int8_t Zoom{};
+        int32_t Rotation{};
+    };
+
+    struct PaintBenchmarkResult
+    {
+        std::string SceneName;
+        int32_t Frames{};
+        double MeanMs{};
+        double MedianMs{};
+        double P95Ms{};
+        double P99Ms{};
+        double MinMs{};
+        double MaxMs{};
+    };
+
+    /**
+     * The standard scene set used when no scenes are supplied: the map centre
+     * at each zoom level and each rotation, so runs on the same park are
+     * comparable between builds.
+     */
+    std::vector<PaintBenchmarkScene> GetStandardPaintBenchmarkScenes();
+
+    /**
+     * Renders each scene offscreen through the software drawing engine for the
+     * given number of frames and reports per-frame time percentiles per scene.
+     */
+    std::vector<PaintBenchmarkResult> RunPaintBenchmark(
+        int32_t width, int32_t height, int32_t frames, const std::vector<PaintBenchmarkScene>& scenes);
+} // namespace OpenRCT2
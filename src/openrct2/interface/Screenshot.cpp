@@ -21,6 +21,7 @@
 #include "../core/Console.hpp"
 #include "../core/File.h"
 #include "../core/Imaging.h"
+#include "../core/JobPool.h"
 #include "../core/Path.hpp"
 #include "../core/String.hpp"
 #include "../drawing/Drawing.h"
@@ -35,9 +36,11 @@
 #include "../world/Surface.h"
 #include "Viewport.h"
 
+#include <atomic>
 #include <cctype>
 #include <chrono>
 #include <cstdlib>
+#include <fstream>
 #include <memory>
 #include <optional>
 #include <string>
@@ -352,9 +355,89 @@ static void RenderViewport(IDrawingEngine* drawingEngine, const Viewport& viewpo
     ViewportRender(dpi, &viewport, { { 0, 0 }, { viewport.width, viewport.height } });
 }
 
+// A giant screenshot of a large park does not fit in memory as one image, so
+// it is rendered in horizontal strips which are streamed into the PNG
+// encoder. The strips are double buffered: while a worker thread compresses
+// one strip, the next is already being painted.
+static constexpr int32_t kGiantScreenshotStripHeight = 512;
+
+static void RenderViewportToFile(IDrawingEngine* drawingEngine, const Viewport& viewport, std::string_view path)
+{
+    // Ensure sprites appear regardless of rotation
+    ResetAllSpriteQuadrantPlacements();
+
+    std::unique_ptr<X8DrawingEngine> tempDrawingEngine;
+    if (drawingEngine == nullptr)
+    {
+        tempDrawingEngine = std::make_unique<X8DrawingEngine>(GetContext()->GetUiContext());
+        drawingEngine = tempDrawingEngine.get();
+    }
+
+    std::ofstream fs(fs::u8path(path), std::ios::binary);
+    if (!fs)
+    {
+        throw std::runtime_error("Giant screenshot failed, unable to open the destination file.");
+    }
+    Imaging::PngWriter writer(fs, viewport.width, viewport.height, 8, &gPalette);
+
+    const auto stripSize = static_cast<size_t>(viewport.width) * kGiantScreenshotStripHeight;
+    auto stripBufferA = std::make_unique<uint8_t[]>(stripSize);
+    auto stripBufferB = std::make_unique<uint8_t[]>(stripSize);
+    uint8_t* stripBuffers[2] = { stripBufferA.get(), stripBufferB.get() };
+
+    JobPool encodeJob(1);
+    std::atomic_bool encodeFailed{ false };
+    std::string encodeError;
+
+    int32_t stripIndex = 0;
+    for (int32_t top = 0; top < viewport.height && !encodeFailed; top += kGiantScreenshotStripHeight, stripIndex++)
+    {
+        const int32_t stripHeight = std::min(kGiantScreenshotStripHeight, viewport.height - top);
+        uint8_t* bits = stripBuffers[stripIndex & 1];
+
+        if (viewport.flags & VIEWPORT_FLAG_TRANSPARENT_BACKGROUND)
+        {
+            std::memset(bits, PALETTE_INDEX_0, static_cast<size_t>(viewport.width) * stripHeight);
+        }
+
+        DrawPixelInfo dpi;
+        dpi.bits = bits;
+        dpi.y = top;
+        dpi.width = viewport.width;
+        dpi.height = stripHeight;
+        dpi.DrawingEngine = drawingEngine;
+        ViewportRender(dpi, &viewport, { { 0, top }, { viewport.width, top + stripHeight } });
+
+        // The rows have to arrive at the encoder in order and the buffer is
+        // reused for the strip after next, so wait for the previous strip.
+        encodeJob.Join();
+        encodeJob.AddTask([&writer, &encodeFailed, &encodeError, bits, stripHeight, width = viewport.width]() -> void {
+            try
+            {
+                const uint8_t* row = bits;
+                for (int32_t y = 0; y < stripHeight; y++, row += width)
+                {
+                    writer.WriteRow(row);
+                }
+            }
+            catch (const std::exception& e)
+            {
+                encodeFailed = true;
+                encodeError = e.what();
+            }
+        });
+    }
+    encodeJob.Join();
+
+    if (encodeFailed)
+    {
+        throw std::runtime_error(encodeError);
+    }
+    writer.Finish();
+}
+
 void ScreenshotGiant()
 {
-    DrawPixelInfo dpi{};
     try
     {
         auto path = ScreenshotGetNextPath();
@@ -382,10 +465,7 @@ void ScreenshotGiant()
             viewport.flags |= VIEWPORT_FLAG_TRANSPARENT_BACKGROUND;
         }
 
-        dpi = CreateDPI(viewport);
-
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(path.value(), dpi, gPalette);
+        RenderViewportToFile(nullptr, viewport, path.value());
 
         // Show user that screenshot saved successfully
         const auto filename = Path::GetFileName(path.value());
@@ -399,8 +479,6 @@ void ScreenshotGiant()
         LOG_ERROR("%s", e.what());
         ContextShowError(STR_SCREENSHOT_FAILED, STR_NONE, {}, true);
     }
-
-    ReleaseDPI(dpi);
 }
 
 static void ApplyOptions(const ScreenshotOptions* options, Viewport& viewport)
@@ -575,10 +653,17 @@ int32_t CommandLineForScreenshot(const char** argv, int32_t argc, ScreenshotOpti
 
         ApplyOptions(options, viewport);
 
-        dpi = CreateDPI(viewport);
+        if (giantScreenshot)
+        {
+            RenderViewportToFile(nullptr, viewport, outputPath);
+        }
+        else
+        {
+            dpi = CreateDPI(viewport);
 
-        RenderViewport(nullptr, viewport, dpi);
-        WriteDpiToFile(outputPath, dpi, gPalette);
+            RenderViewport(nullptr, viewport, dpi);
+            WriteDpiToFile(outputPath, dpi, gPalette);
+        }
     }
     catch (const std::exception& e)
     {
@@ -670,6 +755,12 @@ void CaptureImage(const CaptureOptions& options)
     }
 
     auto outputPath = ResolveFilenameForCapture(options.Filename);
+    if (!options.View.has_value())
+    {
+        // Whole-map capture, use the strip renderer to keep memory bounded.
+        RenderViewportToFile(nullptr, viewport, outputPath);
+        return;
+    }
     auto dpi = CreateDPI(viewport);
     RenderViewport(nullptr, viewport, dpi);
     WriteDpiToFile(outputPath, dpi, gPalette);
@@ -28,6 +28,8 @@
 #include "../object/SmallSceneryEntry.h"
 #include "../object/WallSceneryEntry.h"
 #include "../paint/Paint.h"
+#include "../paint/Painter.h"
+#include "../paint/tile_element/Paint.Surface.h"
 #include "../profiling/Profiling.h"
 #include "../ride/Ride.h"
 #include "../ride/RideData.h"
@@ -42,9 +44,13 @@
 #include "Window.h"
 #include "Window_internal.h"
 
+#include <algorithm>
 #include <cstring>
 #include <list>
+#include <mutex>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -62,8 +68,62 @@ uint8_t gShowConstructionRightsRefCount;
 static std::list<Viewport> _viewports;
 Viewport* g_music_tracking_viewport;
 
+// World-space invalidations are queued as packed entries and flushed once per
+// frame, so the per-viewport projection and clipping run as a single batch
+// pass with exact duplicates folded first. The queue is mutex guarded so
+// entity updates running on worker threads can post entries directly.
+enum class PendingInvalidationType : uint8_t
+{
+    Tile,   // X/Y pre-offset to the tile centre; A = z0, B = z1
+    Box,    // X/Y/Z world position; A = width, B = minHeight, C = maxHeight
+    Screen, // X/Y = top left, A/B = bottom right (2D map coords at zoom 0)
+};
+
+struct PendingViewportInvalidation
+{
+    PendingInvalidationType Type{};
+    int8_t MaxZoom{};
+    int32_t X{};
+    int32_t Y{};
+    int32_t Z{};
+    int32_t A{};
+    int32_t B{};
+    int32_t C{};
+
+    constexpr auto Tie() const
+    {
+        return std::tie(Type, MaxZoom, X, Y, Z, A, B, C);
+    }
+    bool operator==(const PendingViewportInvalidation& other) const
+    {
+        return Tie() == other.Tie();
+    }
+    bool operator<(const PendingViewportInvalidation& other) const
+    {
+        return Tie() < other.Tie();
+    }
+};
+
+static std::vector<PendingViewportInvalidation> _pendingInvalidations;
+static std::mutex _pendingInvalidationsMutex;
+
+static void QueueViewportInvalidation(const PendingViewportInvalidation& entry)
+{
+    if (_viewports.empty())
+        return;
+
+    std::scoped_lock lock(_pendingInvalidationsMutex);
+    _pendingInvalidations.push_back(entry);
+}
+
 static std::unique_ptr<JobPool> _paintJobs;
 static std::vector<PaintSession*> _paintColumns;
+static std::vector<PaintSession*> _fillColumns;
+static std::vector<Paint::Painter::CachedPaintColumn*> _imposterColumns;
+
+// Zoom level from which cached columns additionally keep their composited
+// pixels, so an unchanged column costs a copy instead of a redraw.
+static constexpr ZoomLevel kImposterMinZoom{ 3 };
 
 InteractionInfo::InteractionInfo(const PaintStruct* ps)
     : Loc(ps->MapPos)
@@ -75,6 +135,7 @@ InteractionInfo::InteractionInfo(const PaintStruct* ps)
 
 static void ViewportPaintWeatherGloom(DrawPixelInfo& dpi);
 static void ViewportPaint(const Viewport* viewport, DrawPixelInfo& dpi, const ScreenRect& screenRect);
+static void HitTestCacheInvalidateViewport(const Viewport* viewport);
 static void ViewportUpdateFollowSprite(WindowBase* window);
 static void ViewportUpdateSmartFollowEntity(WindowBase* window);
 static void ViewportUpdateSmartFollowStaff(WindowBase* window, const Staff& peep);
@@ -229,6 +290,7 @@ void ViewportRemove(Viewport* viewport)
         LOG_ERROR("Unable to remove viewport: %p", viewport);
         return;
     }
+    HitTestCacheInvalidateViewport(viewport);
     _viewports.erase(it);
 }
 
@@ -244,48 +306,95 @@ static Viewport* ViewportGetMain()
 
 void ViewportsInvalidate(int32_t x, int32_t y, int32_t z0, int32_t z1, ZoomLevel maxZoom)
 {
-    for (auto& vp : _viewports)
-    {
-        if (maxZoom == ZoomLevel{ -1 } || vp.zoom <= ZoomLevel{ maxZoom })
-        {
-            int32_t x1, y1, x2, y2;
-
-            x += 16;
-            y += 16;
-            auto screenCoord = Translate3DTo2DWithZ(vp.rotation, CoordsXYZ{ x, y, 0 });
-
-            x1 = screenCoord.x - 32;
-            y1 = screenCoord.y - 32 - z1;
-            x2 = screenCoord.x + 32;
-            y2 = screenCoord.y + 32 - z0;
-
-            ViewportInvalidate(&vp, ScreenRect{ { x1, y1 }, { x2, y2 } });
-        }
-    }
+    // The tile centre offset is applied once here rather than accumulating
+    // per viewport as the old immediate path did.
+    QueueViewportInvalidation(
+        { PendingInvalidationType::Tile, static_cast<int8_t>(maxZoom), x + 16, y + 16, 0, z0, z1, 0 });
 }
 
 void ViewportsInvalidate(const CoordsXYZ& pos, int32_t width, int32_t minHeight, int32_t maxHeight, ZoomLevel maxZoom)
+{
+    QueueViewportInvalidation(
+        { PendingInvalidationType::Box, static_cast<int8_t>(maxZoom), pos.x, pos.y, pos.z, width, minHeight, maxHeight });
+}
+
+void ViewportsInvalidateAll()
 {
     for (auto& vp : _viewports)
     {
-        if (maxZoom == ZoomLevel{ -1 } || vp.zoom <= ZoomLevel{ maxZoom })
-        {
-            auto screenCoords = Translate3DTo2DWithZ(vp.rotation, pos);
-            auto screenPos = ScreenRect(
-                screenCoords - ScreenCoordsXY{ width, minHeight }, screenCoords + ScreenCoordsXY{ width, maxHeight });
-
-            ViewportInvalidate(&vp, screenPos);
-        }
+        vp.Invalidate();
     }
 }
 
 void ViewportsInvalidate(const ScreenRect& screenRect, ZoomLevel maxZoom)
 {
+    QueueViewportInvalidation({ PendingInvalidationType::Screen, static_cast<int8_t>(maxZoom),
+                                screenRect.Point1.x, screenRect.Point1.y, 0, screenRect.Point2.x, screenRect.Point2.y, 0 });
+}
+
+void ViewportsFlushPendingInvalidations()
+{
+    std::vector<PendingViewportInvalidation> pending;
+    {
+        std::scoped_lock lock(_pendingInvalidationsMutex);
+        pending.swap(_pendingInvalidations);
+    }
+    if (pending.empty())
+        return;
+
+    // Entities sharing a tile and repeated invalidations of the same sprite
+    // box produce identical entries; sort so they are adjacent and fold them
+    // before paying the per-viewport projection.
+    std::sort(pending.begin(), pending.end());
+    pending.erase(std::unique(pending.begin(), pending.end()), pending.end());
+
+    // Gather the world points once; each viewport then projects the whole
+    // batch for its rotation in one call. Screen entries contribute a dummy
+    // point to keep the indices aligned.
+    std::vector<CoordsXYZ> worldPoints;
+    worldPoints.reserve(pending.size());
+    for (const auto& entry : pending)
+    {
+        worldPoints.push_back({ entry.X, entry.Y, entry.Type == PendingInvalidationType::Box ? entry.Z : 0 });
+    }
+    std::vector<ScreenCoordsXY> screenPoints(worldPoints.size());
+
     for (auto& vp : _viewports)
     {
-        if (maxZoom == ZoomLevel{ -1 } || vp.zoom <= ZoomLevel{ maxZoom })
+        Translate3DTo2DWithZBatch(vp.rotation, worldPoints.data(), screenPoints.data(), worldPoints.size());
+
+        for (size_t i = 0; i < pending.size(); i++)
         {
-            ViewportInvalidate(&vp, screenRect);
+            const auto& entry = pending[i];
+            const auto maxZoom = ZoomLevel{ entry.MaxZoom };
+            if (maxZoom != ZoomLevel{ -1 } && vp.zoom > maxZoom)
+                continue;
+
+            switch (entry.Type)
+            {
+                case PendingInvalidationType::Tile:
+                {
+                    const auto& screenCoord = screenPoints[i];
+                    ViewportInvalidate(
+                        &vp,
+                        ScreenRect{ { screenCoord.x - 32, screenCoord.y - 32 - entry.B },
+                                    { screenCoord.x + 32, screenCoord.y + 32 - entry.A } });
+                    break;
+                }
+                case PendingInvalidationType::Box:
+                {
+                    const auto& screenCoords = screenPoints[i];
+                    ViewportInvalidate(
+                        &vp,
+                        ScreenRect(
+                            screenCoords - ScreenCoordsXY{ entry.A, entry.B },
+                            screenCoords + ScreenCoordsXY{ entry.A, entry.C }));
+                    break;
+                }
+                case PendingInvalidationType::Screen:
+                    ViewportInvalidate(&vp, ScreenRect{ { entry.X, entry.Y }, { entry.A, entry.B } });
+                    break;
+            }
         }
     }
 }
@@ -886,6 +995,13 @@ static void ViewportRotateSingleInternal(WindowBase& w, int32_t direction)
 
     viewport->rotation = (viewport->rotation + direction) & 3;
 
+    // Invalidations that happened under the old rotation did not touch the
+    // column generations of the new one, so drop all cached columns.
+    if (auto* painter = GetContext()->GetPainter(); painter != nullptr)
+    {
+        painter->ClearPaintColumnCache();
+    }
+
     auto centreLoc = centre_2d_coordinates(coords, viewport);
 
     if (centreLoc.has_value())
@@ -975,6 +1091,51 @@ static void ViewportFillColumn(PaintSession& session)
     PaintSessionArrange(session);
 }
 
+static void ViewportCaptureColumnImposter(Paint::Painter::CachedPaintColumn& column, int32_t gloomPalette)
+{
+    const auto& dpi = column.Session->DPI;
+    const auto width = dpi.zoom_level.ApplyInversedTo(dpi.width);
+    const auto height = dpi.zoom_level.ApplyInversedTo(dpi.height);
+    if (width <= 0 || height <= 0 || dpi.bits == nullptr)
+    {
+        return;
+    }
+
+    column.Imposter.resize(static_cast<size_t>(width) * height);
+    const auto stride = static_cast<size_t>(width) + dpi.pitch;
+    const uint8_t* src = dpi.bits;
+    uint8_t* dst = column.Imposter.data();
+    for (int32_t i = 0; i < height; i++)
+    {
+        std::memcpy(dst, src, width);
+        src += stride;
+        dst += width;
+    }
+    column.ImposterGloom = gloomPalette;
+    column.HasImposter = true;
+}
+
+static void ViewportDrawColumnImposter(const Paint::Painter::CachedPaintColumn& column)
+{
+    const auto& dpi = column.Session->DPI;
+    const auto width = dpi.zoom_level.ApplyInversedTo(dpi.width);
+    const auto height = dpi.zoom_level.ApplyInversedTo(dpi.height);
+    if (column.Imposter.size() != static_cast<size_t>(width) * height)
+    {
+        return;
+    }
+
+    const auto stride = static_cast<size_t>(width) + dpi.pitch;
+    const uint8_t* src = column.Imposter.data();
+    uint8_t* dst = dpi.bits;
+    for (int32_t i = 0; i < height; i++)
+    {
+        std::memcpy(dst, src, width);
+        src += width;
+        dst += stride;
+    }
+}
+
 static void ViewportPaintColumn(PaintSession& session)
 {
     PROFILED_FUNCTION();
@@ -1077,13 +1238,29 @@ static void ViewportPaint(const Viewport* viewport, DrawPixelInfo& dpi, const Sc
         useParallelDrawing = true;
     }
 
-    // Generate and sort columns.
-    for (x = alignedX; x < rightBorder; x += 32)
+    _fillColumns.clear();
+    _imposterColumns.clear();
+
+    auto* painter = GetContext()->GetPainter();
+
+    // At high zoom-out, unchanged columns are composited from cached pixels.
+    // The imposters bake in the weather gloom, so remember the palette they
+    // are captured with; they only work on engines that draw into the bits of
+    // the target DPI on the CPU.
+    const bool useImposters = viewport->zoom >= kImposterMinZoom
+        && (dpi.DrawingEngine->GetFlags() & DEF_PARALLEL_DRAWING) != 0;
+    int32_t gloomPalette = EnumValue(FilterPaletteID::PaletteNull);
+    if (Config::Get().general.RenderWeatherGloom && !gTrackDesignSaveMode && !(viewFlags & VIEWPORT_FLAG_HIDE_ENTITIES)
+        && !(viewFlags & VIEWPORT_FLAG_HIGHLIGHT_PATH_ISSUES))
     {
-        PaintSession* session = PaintSessionAlloc(dpi1, viewFlags, viewport->rotation);
-        _paintColumns.push_back(session);
+        gloomPalette = EnumValue(ClimateGetWeatherGloomPaletteId(GetGameState().ClimateCurrent));
+    }
 
-        DrawPixelInfo& dpi2 = session->DPI;
+    // Set up a session for each column, re-using cached columns that were not
+    // invalidated since the previous frame.
+    for (x = alignedX; x < rightBorder; x += 32)
+    {
+        DrawPixelInfo dpi2 = dpi1;
         if (x >= dpi2.x)
         {
             auto leftPitch = x - dpi2.x;
@@ -1102,42 +1279,103 @@ static void ViewportPaint(const Viewport* viewport, DrawPixelInfo& dpi, const Sc
         }
         dpi2.width = paintRight - dpi2.x;
 
-        if (useMultithreading)
+        const Paint::PaintColumnKey key{
+            dpi2.x, dpi2.y, dpi2.width, dpi2.height, viewFlags, dpi2.zoom_level, viewport->rotation,
+        };
+        if (auto* cached = painter->AcquireCachedColumn(key); cached != nullptr)
         {
-            _paintJobs->AddTask([session]() -> void { ViewportFillColumn(*session); });
+            // The paint structs are in view space and still valid, only the
+            // target pixels may have moved.
+            cached->Session->DPI = dpi2;
+            if (useImposters && cached->HasImposter && cached->ImposterGloom == gloomPalette)
+            {
+                ViewportDrawColumnImposter(*cached);
+                continue;
+            }
+            _paintColumns.push_back(cached->Session);
+            if (useImposters)
+            {
+                _imposterColumns.push_back(cached);
+            }
+            continue;
         }
-        else
+
+        PaintSession* session = PaintSessionAlloc(dpi2, viewFlags, viewport->rotation);
+        _paintColumns.push_back(session);
+        _fillColumns.push_back(session);
+    }
+
+    // Columns are independent of each other, so they can be generated and painted in parallel.
+    // Dispatch them in contiguous strips rather than one task per column, otherwise the queue
+    // overhead dominates on wide (4K+) viewports where there can be hundreds of columns.
+    const auto dispatchStrips = [](const std::vector<PaintSession*>& columns, void (*columnFn)(PaintSession&)) {
+        const size_t numColumns = columns.size();
+        const size_t stripSize = std::max<size_t>(1, numColumns / (_paintJobs->GetThreadCount() * 2));
+        for (size_t i = 0; i < numColumns; i += stripSize)
         {
-            ViewportFillColumn(*session);
+            const size_t end = std::min(numColumns, i + stripSize);
+            _paintJobs->AddTask([&columns, columnFn, i, end]() -> void {
+                for (size_t n = i; n < end; n++)
+                {
+                    columnFn(*columns[n]);
+                }
+            });
         }
-    }
+        _paintJobs->Join();
+    };
 
+    // Surface painting reads a shared per-tile cache; bring it up to date on
+    // this thread before columns start generating in parallel.
+    PaintSurfacePrepareTileCache();
+
+    // Likewise settle the entity tile bounds left dirty by this tick's moves.
+    EntitySpatialBoundsFlush();
+
+    // Generate and sort columns.
     if (useMultithreading)
     {
-        _paintJobs->Join();
+        dispatchStrips(_fillColumns, ViewportFillColumn);
     }
-
-    // Paint columns.
-    for (auto* session : _paintColumns)
+    else
     {
-        if (useParallelDrawing)
+        for (auto* session : _fillColumns)
         {
-            _paintJobs->AddTask([session]() -> void { ViewportPaintColumn(*session); });
+            ViewportFillColumn(*session);
         }
-        else
+    }
+
+    // Paint columns.
+    if (useParallelDrawing)
+    {
+        dispatchStrips(_paintColumns, ViewportPaintColumn);
+    }
+    else
+    {
+        for (auto* session : _paintColumns)
         {
             ViewportPaintColumn(*session);
         }
     }
-    if (useParallelDrawing)
+
+    // Capture imposters of re-painted cached columns before the stores below
+    // can evict their entries.
+    if (useImposters)
     {
-        _paintJobs->Join();
+        for (auto* column : _imposterColumns)
+        {
+            ViewportCaptureColumnImposter(*column, gloomPalette);
+        }
     }
 
-    // Release resources.
-    for (auto* session : _paintColumns)
+    // Hand the freshly generated columns over to the cache, re-used columns
+    // already live there.
+    for (auto* session : _fillColumns)
     {
-        PaintSessionFree(session);
+        auto* column = painter->StoreCachedColumn(session);
+        if (useImposters && column != nullptr)
+        {
+            ViewportCaptureColumnImposter(*column, gloomPalette);
+        }
     }
 }
 
@@ -1790,6 +2028,76 @@ InteractionInfo GetMapCoordinatesFromPos(const ScreenCoordsXY& screenCoords, int
     return GetMapCoordinatesFromPosWindow(window, screenCoords, flags);
 }
 
+// Hover and right-click hit tests used to generate and arrange a fresh one
+// pixel paint session on every mouse move. Instead the last arranged session
+// is retained and covers a small view-space block, so successive queries over
+// the same part of the scene only walk the existing paint structs. The block
+// width matches the 32 unit paint columns so the painter's column generations
+// tell us when the world underneath has changed.
+constexpr int32_t kHitTestBlockSize = 32;
+
+struct HitTestSessionCache
+{
+    PaintSession* Session{};
+    const Viewport* Owner{};
+    int32_t ViewX{};
+    int32_t ViewY{};
+    uint32_t ViewFlags{};
+    ZoomLevel Zoom{ 0 };
+    uint8_t Rotation{};
+    uint32_t ColumnGeneration{};
+};
+static HitTestSessionCache _hitTestCache;
+
+static void HitTestCacheRelease()
+{
+    if (_hitTestCache.Session != nullptr)
+    {
+        PaintSessionFree(_hitTestCache.Session);
+    }
+    _hitTestCache = {};
+}
+
+static void HitTestCacheInvalidateViewport(const Viewport* viewport)
+{
+    if (_hitTestCache.Owner == viewport)
+    {
+        HitTestCacheRelease();
+    }
+}
+
+static PaintSession* GetArrangedSessionForHitTest(const Viewport* viewport, const ScreenCoordsXY& viewLoc)
+{
+    DrawPixelInfo dpi;
+    dpi.x = Floor2(viewLoc.x, kHitTestBlockSize);
+    dpi.y = Floor2(viewLoc.y, kHitTestBlockSize);
+    dpi.width = kHitTestBlockSize;
+    dpi.height = kHitTestBlockSize;
+    dpi.zoom_level = viewport->zoom;
+
+    uint32_t columnGeneration = 0;
+    if (auto* painter = GetContext()->GetPainter(); painter != nullptr)
+    {
+        columnGeneration = painter->GetPaintColumnGeneration(dpi.x, dpi.width);
+    }
+
+    if (_hitTestCache.Session != nullptr && _hitTestCache.Owner == viewport && _hitTestCache.ViewX == dpi.x
+        && _hitTestCache.ViewY == dpi.y && _hitTestCache.ViewFlags == viewport->flags && _hitTestCache.Zoom == viewport->zoom
+        && _hitTestCache.Rotation == viewport->rotation && _hitTestCache.ColumnGeneration == columnGeneration)
+    {
+        return _hitTestCache.Session;
+    }
+
+    HitTestCacheRelease();
+    PaintSession* session = PaintSessionAlloc(dpi, viewport->flags, viewport->rotation);
+    PaintSessionGenerate(*session);
+    PaintSessionArrange(*session);
+    _hitTestCache = {
+        session, viewport, dpi.x, dpi.y, viewport->flags, viewport->zoom, viewport->rotation, columnGeneration,
+    };
+    return session;
+}
+
 InteractionInfo GetMapCoordinatesFromPosWindow(WindowBase* window, const ScreenCoordsXY& screenCoords, int32_t flags)
 {
     InteractionInfo info{};
@@ -1812,18 +2120,14 @@ InteractionInfo GetMapCoordinatesFromPosWindow(WindowBase* window, const ScreenC
             viewLoc.x &= viewport->zoom.ApplyTo(0xFFFFFFFF) & 0xFFFFFFFF;
             viewLoc.y &= viewport->zoom.ApplyTo(0xFFFFFFFF) & 0xFFFFFFFF;
         }
-        DrawPixelInfo dpi;
-        dpi.x = viewLoc.x;
-        dpi.y = viewLoc.y;
-        dpi.height = 1;
-        dpi.zoom_level = viewport->zoom;
-        dpi.width = 1;
-
-        PaintSession* session = PaintSessionAlloc(dpi, viewport->flags, viewport->rotation);
-        PaintSessionGenerate(*session);
-        PaintSessionArrange(*session);
+
+        PaintSession* session = GetArrangedSessionForHitTest(viewport, viewLoc);
+
+        // The interaction walk reads the query point from the session DPI; the
+        // arranged structs themselves are independent of it.
+        session->DPI.x = viewLoc.x;
+        session->DPI.y = viewLoc.y;
         info = SetInteractionInfoFromPaintSession(session, viewport->flags, flags & 0xFFFF);
-        PaintSessionFree(session);
     }
     return info;
 }
@@ -1835,6 +2139,13 @@ void ViewportInvalidate(const Viewport* viewport, const ScreenRect& screenRect)
 {
     PROFILED_FUNCTION();
 
+    // Bump the paint column generations before any visibility check, cached
+    // columns have to go stale even while their window is hidden or covered.
+    if (auto* painter = GetContext()->GetPainter(); painter != nullptr)
+    {
+        painter->InvalidatePaintColumns(screenRect);
+    }
+
     // if unknown viewport visibility, use the containing window to discover the status
     if (viewport->visibility == VisibilityCache::Unknown)
     {
@@ -2012,11 +2323,27 @@ std::optional<CoordsXY> ScreenGetMapXYSideWithZ(const ScreenCoordsXY& screenCoor
     return mapCoords->ToTileStart();
 }
 
-ScreenCoordsXY Translate3DTo2DWithZ(int32_t rotation, const CoordsXYZ& pos)
+void Translate3DTo2DWithZBatch(int32_t rotation, const CoordsXYZ* src, ScreenCoordsXY* dst, size_t count)
 {
-    auto rotated = pos.Rotate(rotation);
-    // Use right shift to avoid issues like #9301
-    return ScreenCoordsXY{ rotated.y - rotated.x, ((rotated.x + rotated.y) >> 1) - pos.z };
+    switch (rotation & 3)
+    {
+        case 0:
+            for (size_t i = 0; i < count; i++)
+                dst[i] = { src[i].y - src[i].x, ((src[i].x + src[i].y) >> 1) - src[i].z };
+            break;
+        case 1:
+            for (size_t i = 0; i < count; i++)
+                dst[i] = { -src[i].x - src[i].y, ((src[i].y - src[i].x) >> 1) - src[i].z };
+            break;
+        case 2:
+            for (size_t i = 0; i < count; i++)
+                dst[i] = { src[i].x - src[i].y, ((-src[i].x - src[i].y) >> 1) - src[i].z };
+            break;
+        case 3:
+            for (size_t i = 0; i < count; i++)
+                dst[i] = { src[i].x + src[i].y, ((src[i].x - src[i].y) >> 1) - src[i].z };
+            break;
+    }
 }
 
 /**
@@ -23,6 +23,7 @@
 #include "../interface/Cursors.h"
 #include "../localisation/Formatting.h"
 #include "../localisation/StringIds.h"
+#include "../paint/Painter.h"
 #include "../platform/Platform.h"
 #include "../ride/RideAudio.h"
 #include "../scenario/Scenario.h"
@@ -518,6 +519,19 @@ void WindowInvalidateAll()
     WindowVisitEach([](WindowBase* w) { w->Invalidate(); });
 }
 
+/**
+ * Marks the damage accumulated by window and widget invalidations on the
+ * drawing engine. Called once per frame, just before the dirty blocks are
+ * painted, so repeated invalidations of the same area coalesce.
+ */
+void WindowFlushPendingInvalidations()
+{
+    for (auto& w : g_window_list)
+    {
+        w->FlushPendingDamage();
+    }
+}
+
 /**
  * Invalidates the specified widget of a window.
  *  rct2: 0x006EC402
@@ -535,18 +549,8 @@ void WidgetInvalidate(WindowBase& w, WidgetIndex widgetIndex)
     if (widget.left == -2)
         return;
 
-    GfxSetDirtyBlocks({ { w.windowPos + ScreenCoordsXY{ widget.left, widget.top } },
-                        { w.windowPos + ScreenCoordsXY{ widget.right + 1, widget.bottom + 1 } } });
-}
-
-template<typename TPred> static void widget_invalidate_by_condition(TPred pred)
-{
-    WindowVisitEach([pred](WindowBase* w) {
-        if (pred(w))
-        {
-            w->Invalidate();
-        }
-    });
+    w.AccumulateDamage({ { w.windowPos + ScreenCoordsXY{ widget.left, widget.top } },
+                         { w.windowPos + ScreenCoordsXY{ widget.right + 1, widget.bottom + 1 } } });
 }
 
 /**
@@ -975,6 +979,14 @@ void WindowZoomSet(WindowBase& w, ZoomLevel zoomLevel, bool atCursor)
     if (v->zoom == zoomLevel)
         return;
 
+    // Zoom filtered invalidations (e.g. grass details) do not bump the paint
+    // column generations for viewports above their zoom threshold, so columns
+    // cached for other zoom levels cannot be trusted any more.
+    if (auto* painter = GetContext()->GetPainter(); painter != nullptr)
+    {
+        painter->ClearPaintColumnCache();
+    }
+
     // Zooming to cursor? Remember where we're pointing at the moment.
     int32_t saved_map_x = 0;
     int32_t saved_map_y = 0;
@@ -559,6 +559,7 @@ void WindowInvalidateByClass(WindowClass cls);
 void WindowInvalidateByNumber(WindowClass cls, rct_windownumber number);
 void WindowInvalidateByNumber(WindowClass cls, EntityId id);
 void WindowInvalidateAll();
+void WindowFlushPendingInvalidations();
 void WidgetInvalidate(WindowBase& w, WidgetIndex widgetIndex);
 void WidgetInvalidateByClass(WindowClass cls, WidgetIndex widgetIndex);
 void WidgetInvalidateByNumber(WindowClass cls, rct_windownumber number, WidgetIndex widgetIndex);
@@ -5,6 +5,8 @@
 #include "Cursors.h"
 #include "Viewport.h"
 
+#include <algorithm>
+
 void WindowBase::SetLocation(const CoordsXYZ& coords)
 {
     WindowScrollToLocation(*this, coords);
@@ -23,9 +25,49 @@ void WindowBase::ScrollToViewport()
         WindowScrollToLocation(*mainWindow, newCoords);
 }
 
+WindowBase::~WindowBase()
+{
+    // Damage is recorded in screen coordinates, so the area the window
+    // occupied can still be marked once the window itself is gone.
+    FlushPendingDamage();
+}
+
 void WindowBase::Invalidate()
 {
-    GfxSetDirtyBlocks({ windowPos, windowPos + ScreenCoordsXY{ width, height } });
+    AccumulateDamage({ windowPos, windowPos + ScreenCoordsXY{ width, height } });
+}
+
+void WindowBase::AccumulateDamage(const ScreenRect& rect)
+{
+    for (size_t i = 0; i < numPendingDamage; i++)
+    {
+        const auto& pending = pendingDamage[i];
+        if (rect.GetLeft() >= pending.GetLeft() && rect.GetTop() >= pending.GetTop()
+            && rect.GetRight() <= pending.GetRight() && rect.GetBottom() <= pending.GetBottom())
+        {
+            return;
+        }
+    }
+
+    if (numPendingDamage < kMaxPendingDamageRects)
+    {
+        pendingDamage[numPendingDamage++] = rect;
+    }
+    else
+    {
+        auto& last = pendingDamage[numPendingDamage - 1];
+        last = { { std::min(last.GetLeft(), rect.GetLeft()), std::min(last.GetTop(), rect.GetTop()) },
+                 { std::max(last.GetRight(), rect.GetRight()), std::max(last.GetBottom(), rect.GetBottom()) } };
+    }
+}
+
+void WindowBase::FlushPendingDamage()
+{
+    for (size_t i = 0; i < numPendingDamage; i++)
+    {
+        GfxSetDirtyBlocks(pendingDamage[i]);
+    }
+    numPendingDamage = 0;
 }
 
 void WindowBase::RemoveViewport()
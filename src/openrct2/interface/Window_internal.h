@@ -70,14 +70,23 @@ struct WindowBase
     VisibilityCache visibility{};
     EntityId viewport_smart_follow_sprite{ EntityId::GetNull() }; // Handles setting viewport target sprite etc
 
+    // Damage rectangles accumulated by invalidation calls, marked dirty on the
+    // drawing engine in one pass just before the next frame is painted. Kept
+    // small: once full, further damage is merged into the last rectangle.
+    static constexpr size_t kMaxPendingDamageRects = 8;
+    ScreenRect pendingDamage[kMaxPendingDamageRects];
+    size_t numPendingDamage{};
+
     void SetLocation(const CoordsXYZ& coords);
     void ScrollToViewport();
     void Invalidate();
+    void AccumulateDamage(const ScreenRect& rect);
+    void FlushPendingDamage();
     void RemoveViewport();
 
     WindowBase() = default;
     WindowBase(WindowBase&) = delete;
-    virtual ~WindowBase() = default;
+    virtual ~WindowBase();
 
     WindowBase& operator=(const WindowBase&) = delete;
 
@@ -9,12 +9,22 @@
 
 #include "FormatCodes.h"
 
-#include "../core/EnumMap.hpp"
-
+#include <algorithm>
+#include <array>
 #include <string>
+#include <string_view>
+
+namespace
+{
+    struct TokenEntry
+    {
+        std::string_view Name;
+        FormatToken Token;
+    };
+} // namespace
 
 // clang-format off
-static const EnumMap<FormatToken> FormatTokenMap = {
+static constexpr std::array<TokenEntry, 45> kTokenEntries = { {
     { "MOVE_X",               FormatToken::Move,                },
     { "NEWLINE",              FormatToken::Newline,             },
     { "NEWLINE_SMALLER",      FormatToken::NewlineSmall,        },
@@ -60,20 +70,39 @@ static const EnumMap<FormatToken> FormatTokenMap = {
     { "LIGHTPINK",            FormatToken::ColourLightPink,     },
     { "PEARLAQUA",            FormatToken::ColourPearlAqua,     },
     { "PALESILVER",           FormatToken::ColourPaleSilver,    },
-};
+} };
 // clang-format on
 
+// The table is fixed at compile time, so both lookup directions are
+// constexpr-sorted copies searched with lower_bound; no dynamic
+// initialisation or allocation happens at start-up.
+static constexpr auto kTokensByName = [] {
+    auto entries = kTokenEntries;
+    std::sort(entries.begin(), entries.end(), [](const TokenEntry& a, const TokenEntry& b) { return a.Name < b.Name; });
+    return entries;
+}();
+
+static constexpr auto kTokensByValue = [] {
+    auto entries = kTokenEntries;
+    std::sort(entries.begin(), entries.end(), [](const TokenEntry& a, const TokenEntry& b) { return a.Token < b.Token; });
+    return entries;
+}();
+
 FormatToken FormatTokenFromString(std::string_view token)
 {
-    auto result = FormatTokenMap.find(token);
-    return result != std::end(FormatTokenMap) ? result->second : FormatToken::Unknown;
+    auto it = std::lower_bound(
+        kTokensByName.begin(), kTokensByName.end(), token,
+        [](const TokenEntry& entry, std::string_view name) { return entry.Name < name; });
+    return it != kTokensByName.end() && it->Name == token ? it->Token : FormatToken::Unknown;
 }
 
 std::string FormatTokenToString(FormatToken token)
 {
-    auto it = FormatTokenMap.find(token);
-    if (it != FormatTokenMap.end())
-        return std::string(it->first);
+    auto it = std::lower_bound(
+        kTokensByValue.begin(), kTokensByValue.end(), token,
+        [](const TokenEntry& entry, FormatToken value) { return entry.Token < value; });
+    if (it != kTokensByValue.end() && it->Token == token)
+        return std::string(it->Name);
 
     return {};
 }
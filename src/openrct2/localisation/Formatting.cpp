@@ -19,8 +19,10 @@
 #include "Localisation.Date.h"
 #include "StringIds.h"
 
+#include <atomic>
 #include <cmath>
 #include <cstdint>
+#include <unordered_map>
 
 namespace OpenRCT2
 {
@@ -640,6 +642,43 @@ namespace OpenRCT2
         return FmtString(fmtc);
     }
 
+    // Compiled format strings: token programs parsed once per string id and then
+    // reused, so the hot formatting paths interpret a flat token vector instead
+    // of re-tokenizing the format codes on every call. The tokens reference the
+    // language pack's string storage, so the cache shares the formatted string
+    // cache's generation counter and is dropped whenever the underlying strings
+    // may have changed or moved.
+    static std::atomic<uint32_t> _formatCacheGeneration{};
+
+    static const std::vector<FmtString::Token>& GetCompiledFmtStringById(StringId id)
+    {
+        struct CompiledFmtStringCache
+        {
+            uint32_t Generation{};
+            std::unordered_map<StringId, std::vector<FmtString::Token>> Entries;
+        };
+        thread_local CompiledFmtStringCache cache;
+
+        auto generation = _formatCacheGeneration.load(std::memory_order_relaxed);
+        if (cache.Generation != generation)
+        {
+            cache.Entries.clear();
+            cache.Generation = generation;
+        }
+
+        auto it = cache.Entries.find(id);
+        if (it == cache.Entries.end())
+        {
+            std::vector<FmtString::Token> tokens;
+            for (const auto& token : GetFmtStringById(id))
+            {
+                tokens.push_back(token);
+            }
+            it = cache.Entries.emplace(id, std::move(tokens)).first;
+        }
+        return it->second;
+    }
+
     FormatBuffer& GetThreadFormatStream()
     {
         thread_local FormatBuffer ss;
@@ -685,7 +724,10 @@ namespace OpenRCT2
         }
     }
 
-    static void FormatStringAny(FormatBuffer& ss, const FmtString& fmt, const std::vector<FormatArg_t>& args, size_t& argIndex)
+    // Interprets a token range; works over both a FmtString, which tokenizes as
+    // it is iterated, and a compiled std::vector<FmtString::Token>.
+    template<typename TTokens>
+    static void FormatStringAny(FormatBuffer& ss, const TTokens& fmt, const std::vector<FormatArg_t>& args, size_t& argIndex)
     {
         for (const auto& token : fmt)
         {
@@ -711,8 +753,7 @@ namespace OpenRCT2
                         }
                         else
                         {
-                            auto subfmt = GetFmtStringById(*stringId);
-                            FormatStringAny(ss, subfmt, args, argIndex);
+                            FormatStringAny(ss, GetCompiledFmtStringById(*stringId), args, argIndex);
                         }
                     }
                 }
@@ -760,7 +801,8 @@ namespace OpenRCT2
         return value;
     }
 
-    static void BuildAnyArgListFromLegacyArgBuffer(const FmtString& fmt, std::vector<FormatArg_t>& anyArgs, const void*& args)
+    template<typename TTokens>
+    static void BuildAnyArgListFromLegacyArgBuffer(const TTokens& fmt, std::vector<FormatArg_t>& anyArgs, const void*& args)
     {
         for (const auto& t : fmt)
         {
@@ -793,7 +835,7 @@ namespace OpenRCT2
                 {
                     auto stringId = ReadFromArgs<StringId>(args);
                     anyArgs.push_back(stringId);
-                    BuildAnyArgListFromLegacyArgBuffer(GetFmtStringById(stringId), anyArgs, args);
+                    BuildAnyArgListFromLegacyArgBuffer(GetCompiledFmtStringById(stringId), anyArgs, args);
                     break;
                 }
                 case FormatToken::String:
@@ -819,7 +861,7 @@ namespace OpenRCT2
         thread_local std::vector<FormatArg_t> tempArgs;
         tempArgs.clear();
 
-        auto fmt = GetFmtStringById(STR_DATE_FORMAT_MY);
+        const auto& fmt = GetCompiledFmtStringById(STR_DATE_FORMAT_MY);
         Formatter ft;
         ft.Add<uint16_t>(month);
         ft.Add<uint16_t>(year);
@@ -829,13 +871,129 @@ namespace OpenRCT2
         FormatStringAny(ss, fmt, tempArgs, argIndex);
     }
 
+    // Cache of formatted strings so that steady state window redraws, which
+    // format the same (string id, arguments) pairs every frame, do not have to
+    // re-parse the format codes each time. The cache is per thread because
+    // formatting runs on the paint worker threads as well as the main thread.
+    struct FormatStringCache
+    {
+        static constexpr size_t kMaxEntries = 2048;
+        uint32_t Generation{};
+        std::unordered_map<uint64_t, std::string> Entries;
+    };
+
+    void InvalidateFormatStringCache()
+    {
+        _formatCacheGeneration.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    static uint64_t FNV1aHash(uint64_t hash, const void* data, size_t len)
+    {
+        auto src = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < len; i++)
+        {
+            hash ^= src[i];
+            hash *= 0x100000001B3ULL;
+        }
+        return hash;
+    }
+
+    template<typename T> static uint64_t FNV1aHashValue(uint64_t hash, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return FNV1aHash(hash, &value, sizeof(T));
+    }
+
+    static uint64_t GetFormatStringCacheKey(StringId id, const std::vector<FormatArg_t>& args)
+    {
+        constexpr uint64_t kFnv1aOffset = 0xCBF29CE484222325ULL;
+        auto hash = FNV1aHashValue(kFnv1aOffset, id);
+
+        // Settings that change the output of format codes without the string
+        // or the arguments changing, so that e.g. switching currency does not
+        // serve stale strings.
+        const auto& config = Config::Get().general;
+        hash = FNV1aHashValue(hash, config.Language);
+        hash = FNV1aHashValue(hash, config.MeasurementFormat);
+        hash = FNV1aHashValue(hash, config.TemperatureFormat);
+        hash = FNV1aHashValue(hash, config.ShowHeightAsUnits);
+        hash = FNV1aHashValue(hash, config.DateFormat);
+        hash = FNV1aHashValue(hash, config.CurrencyFormat);
+        hash = FNV1aHashValue(hash, config.CustomCurrencyRate);
+        hash = FNV1aHashValue(hash, config.CustomCurrencyAffix);
+        hash = FNV1aHash(hash, config.CustomCurrencySymbol.data(), config.CustomCurrencySymbol.size());
+
+        for (const auto& arg : args)
+        {
+            hash = FNV1aHashValue(hash, static_cast<uint8_t>(arg.index()));
+            if (const auto* sz = std::get_if<const char*>(&arg))
+            {
+                // Hash the string contents rather than the pointer, the caller
+                // may reuse the same buffer with different text.
+                if (*sz != nullptr)
+                {
+                    hash = FNV1aHash(hash, *sz, std::strlen(*sz));
+                }
+            }
+            else if (const auto* str = std::get_if<std::string>(&arg))
+            {
+                hash = FNV1aHash(hash, str->data(), str->size());
+            }
+            else if (const auto* value16 = std::get_if<uint16_t>(&arg))
+            {
+                hash = FNV1aHashValue(hash, *value16);
+            }
+            else if (const auto* value32 = std::get_if<int32_t>(&arg))
+            {
+                hash = FNV1aHashValue(hash, *value32);
+            }
+            else if (const auto* value64 = std::get_if<int64_t>(&arg))
+            {
+                hash = FNV1aHashValue(hash, *value64);
+            }
+        }
+        return hash;
+    }
+
     size_t FormatStringLegacy(char* buffer, size_t bufferLen, StringId id, const void* args)
     {
         thread_local std::vector<FormatArg_t> anyArgs;
         anyArgs.clear();
-        auto fmt = GetFmtStringById(id);
+        const auto& fmt = GetCompiledFmtStringById(id);
         BuildAnyArgListFromLegacyArgBuffer(fmt, anyArgs, args);
-        return FormatStringAny(buffer, bufferLen, fmt, anyArgs);
+
+        thread_local FormatStringCache cache;
+        auto generation = _formatCacheGeneration.load(std::memory_order_relaxed);
+        if (cache.Generation != generation)
+        {
+            cache.Entries.clear();
+            cache.Generation = generation;
+        }
+
+        auto key = GetFormatStringCacheKey(id, anyArgs);
+        auto it = cache.Entries.find(key);
+        if (it == cache.Entries.end())
+        {
+            if (cache.Entries.size() >= FormatStringCache::kMaxEntries)
+            {
+                cache.Entries.clear();
+            }
+
+            auto& ss = GetThreadFormatStream();
+            size_t argIndex = 0;
+            FormatStringAny(ss, fmt, anyArgs, argIndex);
+            it = cache.Entries.emplace(key, std::string(ss.data(), ss.size())).first;
+        }
+
+        const auto& result = it->second;
+        if (bufferLen == 0)
+        {
+            return result.size();
+        }
+        auto copyLen = std::min(bufferLen - 1, result.size());
+        std::memcpy(buffer, result.data(), copyLen);
+        buffer[copyLen] = '\0';
+        return result.size();
     }
 
     std::string FormatStringIDLegacy(StringId format, const void* args)
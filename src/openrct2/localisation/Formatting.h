@@ -308,6 +308,10 @@ namespace OpenRCT2
     std::string FormatStringAny(const FmtString& fmt, const std::vector<FormatArg_t>& args);
     size_t FormatStringAny(char* buffer, size_t bufferLen, const FmtString& fmt, const std::vector<FormatArg_t>& args);
 
+    // Drops all cached formatted strings. Must be called whenever the text behind
+    // string ids changes, e.g. when the language changes or object strings are reused.
+    void InvalidateFormatStringCache();
+
     // TODO: the following three functions should not be used in new code.
     size_t FormatStringLegacy(char* buffer, size_t bufferLen, StringId id, const void* args);
     std::string FormatStringIDLegacy(StringId format, const void* args);
@@ -42,12 +42,19 @@ class LanguagePack final : public ILanguagePack
 {
 private:
     uint16_t const _id;
-    std::vector<std::string> _strings;
     std::vector<ScenarioOverride> _scenarioOverrides;
 
+    // Compiled string table: every string is stored NUL terminated in one
+    // contiguous arena and resolved through a flat offset array indexed directly
+    // by string id, making GetString a bounds check and two loads. Offset 0 is
+    // reserved to mean that no string is set for the id.
+    std::vector<char> _stringData;
+    std::vector<uint32_t> _stringOffsets;
+
     ///////////////////////////////////////////////////////////////////////////
     // Parsing work data
     ///////////////////////////////////////////////////////////////////////////
+    std::vector<std::string> _strings;
     std::string _currentGroup;
     ScenarioOverride* _currentScenarioOverride = nullptr;
 
@@ -97,7 +104,10 @@ public:
             ParseLine(&reader);
         }
 
+        CompileStrings();
+
         // Clean up the parsing work data
+        _strings = {};
         _currentGroup.clear();
         _currentScenarioOverride = nullptr;
     }
@@ -109,22 +119,33 @@ public:
 
     uint32_t GetCount() const override
     {
-        return static_cast<uint32_t>(_strings.size());
+        return static_cast<uint32_t>(_stringOffsets.size());
     }
 
     void RemoveString(StringId stringId) override
     {
-        if (_strings.size() > static_cast<size_t>(stringId))
+        if (_stringOffsets.size() > static_cast<size_t>(stringId))
         {
-            _strings[stringId].clear();
+            _stringOffsets[stringId] = 0;
         }
     }
 
     void SetString(StringId stringId, const std::string& str) override
     {
-        if (_strings.size() > static_cast<size_t>(stringId))
+        if (_stringOffsets.size() > static_cast<size_t>(stringId))
         {
-            _strings[stringId] = str;
+            if (str.empty())
+            {
+                _stringOffsets[stringId] = 0;
+                return;
+            }
+
+            // Appending can reallocate the arena, invalidating pointers handed
+            // out by GetString, so callers must not hold onto them across this.
+            auto offset = static_cast<uint32_t>(_stringData.size());
+            _stringData.insert(_stringData.end(), str.begin(), str.end());
+            _stringData.push_back('\0');
+            _stringOffsets[stringId] = offset;
         }
     }
 
@@ -145,9 +166,13 @@ public:
             return nullptr;
         }
 
-        if ((_strings.size() > static_cast<size_t>(stringId)) && !_strings[stringId].empty())
+        if (_stringOffsets.size() > static_cast<size_t>(stringId))
         {
-            return _strings[stringId].c_str();
+            auto offset = _stringOffsets[stringId];
+            if (offset != 0)
+            {
+                return _stringData.data() + offset;
+            }
         }
 
         return nullptr;
@@ -176,6 +201,32 @@ public:
     }
 
 private:
+    void CompileStrings()
+    {
+        size_t dataSize = 1;
+        for (const auto& s : _strings)
+        {
+            if (!s.empty())
+            {
+                dataSize += s.size() + 1;
+            }
+        }
+
+        _stringData.reserve(dataSize);
+        _stringData.push_back('\0');
+        _stringOffsets.resize(_strings.size());
+        for (size_t i = 0; i < _strings.size(); i++)
+        {
+            const auto& s = _strings[i];
+            if (!s.empty())
+            {
+                _stringOffsets[i] = static_cast<uint32_t>(_stringData.size());
+                _stringData.insert(_stringData.end(), s.begin(), s.end());
+                _stringData.push_back('\0');
+            }
+        }
+    }
+
     ScenarioOverride* GetScenarioOverride(const std::string& scenarioIdentifier)
     {
         for (auto& so : _scenarioOverrides)
@@ -247,18 +298,7 @@ private:
 
     static void SkipToEndOfLine(IStringReader* reader)
     {
-        codepoint_t codepoint;
-        while (reader->TryPeek(&codepoint))
-        {
-            if (codepoint != '\r' && codepoint != '\n')
-            {
-                reader->Skip();
-            }
-            else
-            {
-                break;
-            }
-        }
+        reader->ReadUntilNewLine();
     }
 
     void ParseLine(IStringReader* reader)
@@ -437,23 +477,19 @@ private:
             }
         }
 
-        // Rest of the line is the actual string
-        sb.Clear();
-        while (reader->TryPeek(&codepoint) && !IsNewLine(codepoint))
-        {
-            reader->Skip();
-            sb.Append(codepoint);
-        }
+        // Rest of the line is the actual string; take it in one pass rather
+        // than decoding and re-encoding every codepoint.
+        auto rest = reader->ReadUntilNewLine();
 
         std::string s;
         if (LanguagesDescriptors[_id].isRtl)
         {
-            auto ts = std::string(sb.GetBuffer(), sb.GetLength());
+            auto ts = std::string(rest);
             s = FixRTL(ts);
         }
         else
         {
-            s = std::string(sb.GetBuffer(), sb.GetLength());
+            s = std::string(rest);
         }
 
         if (_currentGroup.empty())
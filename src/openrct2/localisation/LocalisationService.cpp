@@ -15,6 +15,7 @@
 #include "../core/Path.hpp"
 #include "../interface/Fonts.h"
 #include "../object/ObjectManager.h"
+#include "Formatting.h"
 #include "Language.h"
 #include "LanguagePack.h"
 #include "StringIds.h"
@@ -89,6 +90,7 @@ std::string_view LocalisationService::GetCurrentLanguageLocale() const
 
 void LocalisationService::OpenLanguage(int32_t id)
 {
+    InvalidateFormatStringCache();
     CloseLanguages();
     if (id == LANGUAGE_UNDEFINED)
     {
@@ -170,6 +172,10 @@ StringId LocalisationService::AllocateObjectString(const std::string& target)
     }
     _objectStrings[index] = target;
 
+    // String ids are reused across loaded parks, so any formatted string cached
+    // under this id may now be stale.
+    InvalidateFormatStringCache();
+
     return stringId;
 }
 
@@ -21,6 +21,8 @@
 #include "../world/Park.h"
 #include "NewsItem.h"
 
+#include <array>
+
 using namespace OpenRCT2;
 
 constexpr uint8_t NEGATIVE = 0;
@@ -73,6 +75,163 @@ bool AwardIsPositive(AwardType type)
 
 #pragma region Award checks
 
+/**
+ * Number of guests in the park whose freshest thought is of each type,
+ * counted in one pass over the guests so the individual award checks read
+ * counters instead of each iterating the guest list themselves.
+ */
+struct FreshThoughtCounts
+{
+    std::array<uint32_t, 256> byType{};
+    uint32_t guestsInPark{};
+
+    uint32_t operator[](PeepThoughtType type) const
+    {
+        return byType[EnumValue(type)];
+    }
+};
+
+static FreshThoughtCounts _freshThoughtCounts;
+static bool _freshThoughtCountsValid;
+
+static const FreshThoughtCounts& GetFreshThoughtCounts()
+{
+    if (!_freshThoughtCountsValid)
+    {
+        _freshThoughtCounts = FreshThoughtCounts{};
+        for (auto peep : EntityList<Guest>())
+        {
+            if (peep->OutsideOfPark)
+                continue;
+
+            _freshThoughtCounts.guestsInPark++;
+            const auto& thought = std::get<0>(peep->Thoughts);
+            if (thought.freshness <= 5 && thought.type != PeepThoughtType::None)
+            {
+                _freshThoughtCounts.byType[EnumValue(thought.type)]++;
+            }
+        }
+        _freshThoughtCountsValid = true;
+    }
+    return _freshThoughtCounts;
+}
+
+/**
+ * Ride tallies used by the award checks, collected in one pass over the ride
+ * manager in the same way as the thought counts above. Several checks used to
+ * make their own pass; they now all read from this.
+ */
+struct RideAwardCounts
+{
+    uint32_t openRollerCoasters{};
+    uint32_t openGentleRides{};
+    uint32_t openWaterRides{};
+    uint32_t openCustomDesignedRides{};
+    uint32_t openFoodShops{};
+    uint32_t uniqueOpenFoodShopTypes{};
+    uint32_t openToilets{};
+    uint32_t ratedRides{};
+    uint32_t disappointingRides{};
+    uint32_t trackedRides{};
+    uint32_t dazzlingTrackedRides{};
+    bool anyRideHasCrashed{};
+};
+
+static RideAwardCounts _rideAwardCounts;
+static bool _rideAwardCountsValid;
+
+static const RideAwardCounts& GetRideAwardCounts()
+{
+    if (!_rideAwardCountsValid)
+    {
+        static constexpr colour_t kDazzlingRideColours[] = {
+            COLOUR_BRIGHT_PURPLE,
+            COLOUR_BRIGHT_GREEN,
+            COLOUR_LIGHT_ORANGE,
+            COLOUR_BRIGHT_PINK,
+        };
+
+        _rideAwardCounts = RideAwardCounts{};
+        uint64_t shopTypes = 0;
+        for (const auto& ride : GetRideManager())
+        {
+            if (ride.last_crash_type != RIDE_CRASH_TYPE_NONE)
+            {
+                _rideAwardCounts.anyRideHasCrashed = true;
+            }
+
+            if (RideHasRatings(ride) && ride.popularity != 0xFF)
+            {
+                _rideAwardCounts.ratedRides++;
+                if (ride.popularity <= 6)
+                {
+                    _rideAwardCounts.disappointingRides++;
+                }
+            }
+
+            const auto& rtd = ride.GetRideTypeDescriptor();
+            if (rtd.HasFlag(RIDE_TYPE_FLAG_HAS_TRACK))
+            {
+                _rideAwardCounts.trackedRides++;
+
+                auto mainTrackColour = ride.track_colour[0].main;
+                for (auto dazzlingRideColour : kDazzlingRideColours)
+                {
+                    if (mainTrackColour == dazzlingRideColour)
+                    {
+                        _rideAwardCounts.dazzlingTrackedRides++;
+                        break;
+                    }
+                }
+            }
+
+            auto rideEntry = ride.GetRideEntry();
+            const bool isOpen = ride.status == RideStatus::Open;
+            const bool isIntact = !(ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED);
+
+            if (isOpen && rtd.HasFlag(RIDE_TYPE_FLAG_IS_TOILET))
+            {
+                _rideAwardCounts.openToilets++;
+            }
+
+            if (isOpen && rtd.HasFlag(RIDE_TYPE_FLAG_SELLS_FOOD))
+            {
+                _rideAwardCounts.openFoodShops++;
+                if (rideEntry != nullptr && !(shopTypes & EnumToFlag(rideEntry->shop_item[0])))
+                {
+                    shopTypes |= EnumToFlag(rideEntry->shop_item[0]);
+                    _rideAwardCounts.uniqueOpenFoodShopTypes++;
+                }
+            }
+
+            if (isOpen && isIntact && rideEntry != nullptr)
+            {
+                if (RideEntryHasCategory(*rideEntry, RIDE_CATEGORY_ROLLERCOASTER))
+                    _rideAwardCounts.openRollerCoasters++;
+                if (RideEntryHasCategory(*rideEntry, RIDE_CATEGORY_GENTLE))
+                    _rideAwardCounts.openGentleRides++;
+                if (RideEntryHasCategory(*rideEntry, RIDE_CATEGORY_WATER))
+                    _rideAwardCounts.openWaterRides++;
+            }
+
+            if (isOpen && isIntact && rtd.HasFlag(RIDE_TYPE_FLAG_HAS_TRACK)
+                && !(ride.lifecycle_flags & RIDE_LIFECYCLE_NOT_CUSTOM_DESIGN)
+                && ride.ratings.excitement >= RIDE_RATING(5, 50))
+            {
+                _rideAwardCounts.openCustomDesignedRides++;
+            }
+        }
+        _rideAwardCountsValid = true;
+    }
+    return _rideAwardCounts;
+}
+
+static uint32_t CountUntidyThoughts(const FreshThoughtCounts& thoughts)
+{
+    return thoughts[PeepThoughtType::BadLitter] + thoughts[PeepThoughtType::PathDisgusting]
+        + thoughts[PeepThoughtType::Vandalism];
+}
+
 /** More than 1/16 of the total guests must be thinking untidy thoughts. */
 static bool AwardIsDeservedMostUntidy(int32_t activeAwardTypes)
 {
@@ -83,22 +242,7 @@ static bool AwardIsDeservedMostUntidy(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(AwardType::MostTidy))
         return false;
 
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
+    const uint32_t negativeCount = CountUntidyThoughts(GetFreshThoughtCounts());
 
     return (negativeCount > GetGameState().NumGuestsInPark / 16);
 }
@@ -111,26 +255,9 @@ static bool AwardIsDeservedMostTidy(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(AwardType::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::VeryClean)
-            positiveCount++;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
+    const auto& thoughts = GetFreshThoughtCounts();
+    const uint32_t positiveCount = thoughts[PeepThoughtType::VeryClean];
+    const uint32_t negativeCount = CountUntidyThoughts(thoughts);
 
     return (negativeCount <= 5 && positiveCount > GetGameState().NumGuestsInPark / 64);
 }
@@ -138,28 +265,7 @@ static bool AwardIsDeservedMostTidy(int32_t activeAwardTypes)
 /** At least 6 open roller coasters. */
 static bool AwardIsDeservedBestRollercoasters([[maybe_unused]] int32_t activeAwardTypes)
 {
-    auto rollerCoasters = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        auto rideEntry = ride.GetRideEntry();
-        if (rideEntry == nullptr)
-        {
-            continue;
-        }
-
-        if (ride.status != RideStatus::Open || (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
-        {
-            continue;
-        }
-
-        if (!RideEntryHasCategory(*rideEntry, RIDE_CATEGORY_ROLLERCOASTER))
-        {
-            continue;
-        }
-
-        rollerCoasters++;
-    }
-    return (rollerCoasters >= 6);
+    return (GetRideAwardCounts().openRollerCoasters >= 6);
 }
 
 /** Entrance fee is 0.10 less than half of the total ride value. */
@@ -193,27 +299,9 @@ static bool AwardIsDeservedMostBeautiful(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(AwardType::MostDisappointing))
         return false;
 
-    uint32_t positiveCount = 0;
-    uint32_t negativeCount = 0;
-    auto list = EntityList<Guest>();
-    for (auto peep : list)
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness > 5)
-            continue;
-
-        if (thought.type == PeepThoughtType::Scenery)
-            positiveCount++;
-
-        if (thought.type == PeepThoughtType::BadLitter || thought.type == PeepThoughtType::PathDisgusting
-            || thought.type == PeepThoughtType::Vandalism)
-        {
-            negativeCount++;
-        }
-    }
+    const auto& thoughts = GetFreshThoughtCounts();
+    const uint32_t positiveCount = thoughts[PeepThoughtType::Scenery];
+    const uint32_t negativeCount = CountUntidyThoughts(thoughts);
 
     return (negativeCount <= 15 && positiveCount > GetGameState().NumGuestsInPark / 128);
 }
@@ -239,30 +327,12 @@ static bool AwardIsDeservedWorstValue(int32_t activeAwardTypes)
 /** No more than 2 people who think the vandalism is bad and no crashes. */
 static bool AwardIsDeservedSafest([[maybe_unused]] int32_t activeAwardTypes)
 {
-    auto peepsWhoDislikeVandalism = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Vandalism)
-            peepsWhoDislikeVandalism++;
-    }
-
+    const uint32_t peepsWhoDislikeVandalism = GetFreshThoughtCounts()[PeepThoughtType::Vandalism];
     if (peepsWhoDislikeVandalism > 2)
         return false;
 
     // Check for rides that have crashed maybe?
-    const auto& rideManager = GetRideManager();
-    if (std::any_of(rideManager.begin(), rideManager.end(), [](const Ride& ride) {
-            return ride.last_crash_type != RIDE_CRASH_TYPE_NONE;
-        }))
-    {
-        return false;
-    }
-
-    return true;
+    return !GetRideAwardCounts().anyRideHasCrashed;
 }
 
 /** All staff types, at least 20 staff, one staff per 32 peeps. */
@@ -283,42 +353,13 @@ static bool AwardIsDeservedBestFood(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(AwardType::WorstFood))
         return false;
 
-    uint32_t shops = 0;
-    uint32_t uniqueShops = 0;
-    uint64_t shopTypes = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        if (ride.status != RideStatus::Open)
-            continue;
-        if (!ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_SELLS_FOOD))
-            continue;
-
-        shops++;
-        auto rideEntry = GetRideEntryByIndex(ride.subtype);
-        if (rideEntry != nullptr)
-        {
-            if (!(shopTypes & EnumToFlag(rideEntry->shop_item[0])))
-            {
-                shopTypes |= EnumToFlag(rideEntry->shop_item[0]);
-                uniqueShops++;
-            }
-        }
-    }
-
-    if (shops < 7 || uniqueShops < 4 || shops < GetGameState().NumGuestsInPark / 128)
+    const auto& rides = GetRideAwardCounts();
+    if (rides.openFoodShops < 7 || rides.uniqueOpenFoodShopTypes < 4
+        || rides.openFoodShops < GetGameState().NumGuestsInPark / 128)
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
+    const uint32_t hungryPeeps = GetFreshThoughtCounts()[PeepThoughtType::Hungry];
     return (hungryPeeps <= 12);
 }
 
@@ -328,54 +369,19 @@ static bool AwardIsDeservedWorstFood(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(AwardType::BestFood))
         return false;
 
-    uint32_t shops = 0;
-    uint32_t uniqueShops = 0;
-    uint64_t shopTypes = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        if (ride.status != RideStatus::Open)
-            continue;
-        if (!ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_SELLS_FOOD))
-            continue;
-
-        shops++;
-        auto rideEntry = ride.GetRideEntry();
-        if (rideEntry != nullptr)
-        {
-            if (!(shopTypes & EnumToFlag(rideEntry->shop_item[0])))
-            {
-                shopTypes |= EnumToFlag(rideEntry->shop_item[0]);
-                uniqueShops++;
-            }
-        }
-    }
-
-    if (uniqueShops > 2 || shops > GetGameState().NumGuestsInPark / 256)
+    const auto& rides = GetRideAwardCounts();
+    if (rides.uniqueOpenFoodShopTypes > 2 || rides.openFoodShops > GetGameState().NumGuestsInPark / 256)
         return false;
 
     // Count hungry peeps
-    auto hungryPeeps = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Hungry)
-            hungryPeeps++;
-    }
+    const uint32_t hungryPeeps = GetFreshThoughtCounts()[PeepThoughtType::Hungry];
     return (hungryPeeps > 15);
 }
 
 /** At least 4 toilets, 1 toilet per 128 guests and no more than 16 guests who think they need the toilet. */
 static bool AwardIsDeservedBestToilets([[maybe_unused]] int32_t activeAwardTypes)
 {
-    // Count open toilets
-    const auto& rideManager = GetRideManager();
-    auto numToilets = static_cast<size_t>(std::count_if(rideManager.begin(), rideManager.end(), [](const Ride& ride) {
-        const auto& rtd = ride.GetRideTypeDescriptor();
-        return rtd.HasFlag(RIDE_TYPE_FLAG_IS_TOILET) && ride.status == RideStatus::Open;
-    }));
+    const uint32_t numToilets = GetRideAwardCounts().openToilets;
 
     // At least 4 open toilets
     if (numToilets < 4)
@@ -386,16 +392,7 @@ static bool AwardIsDeservedBestToilets([[maybe_unused]] int32_t activeAwardTypes
         return false;
 
     // Count number of guests who are thinking they need the toilet
-    auto guestsWhoNeedToilet = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && thought.type == PeepThoughtType::Toilet)
-            guestsWhoNeedToilet++;
-    }
+    const uint32_t guestsWhoNeedToilet = GetFreshThoughtCounts()[PeepThoughtType::Toilet];
     return (guestsWhoNeedToilet <= 16);
 }
 
@@ -407,51 +404,15 @@ static bool AwardIsDeservedMostDisappointing(int32_t activeAwardTypes)
     if (GetGameState().Park.Rating > 650)
         return false;
 
-    // Count the number of disappointing rides
-    auto countedRides = 0;
-    auto disappointingRides = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        if (RideHasRatings(ride) && ride.popularity != 0xFF)
-        {
-            countedRides++;
-            if (ride.popularity <= 6)
-            {
-                disappointingRides++;
-            }
-        }
-    }
-
     // Half of the rides are disappointing
-    return (disappointingRides >= countedRides / 2);
+    const auto& rides = GetRideAwardCounts();
+    return (rides.disappointingRides >= rides.ratedRides / 2);
 }
 
 /** At least 6 open water rides. */
 static bool AwardIsDeservedBestWaterRides([[maybe_unused]] int32_t activeAwardTypes)
 {
-    auto waterRides = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        auto rideEntry = ride.GetRideEntry();
-        if (rideEntry == nullptr)
-        {
-            continue;
-        }
-
-        if (ride.status != RideStatus::Open || (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
-        {
-            continue;
-        }
-
-        if (!RideEntryHasCategory(*rideEntry, RIDE_CATEGORY_WATER))
-        {
-            continue;
-        }
-
-        waterRides++;
-    }
-
-    return (waterRides >= 6);
+    return (GetRideAwardCounts().openWaterRides >= 6);
 }
 
 /** At least 6 custom designed rides. */
@@ -460,75 +421,27 @@ static bool AwardIsDeservedBestCustomDesignedRides(int32_t activeAwardTypes)
     if (activeAwardTypes & EnumToFlag(AwardType::MostDisappointing))
         return false;
 
-    auto customDesignedRides = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        if (!ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_HAS_TRACK))
-            continue;
-        if (ride.lifecycle_flags & RIDE_LIFECYCLE_NOT_CUSTOM_DESIGN)
-            continue;
-        if (ride.ratings.excitement < RIDE_RATING(5, 50))
-            continue;
-        if (ride.status != RideStatus::Open || (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
-            continue;
-
-        customDesignedRides++;
-    }
-
-    return (customDesignedRides >= 6);
+    return (GetRideAwardCounts().openCustomDesignedRides >= 6);
 }
 
 static bool AwardIsDeservedMostDazzlingRideColours(int32_t activeAwardTypes)
 {
     /** At least 5 colourful rides and more than half of the rides are colourful. */
-    static constexpr colour_t dazzling_ride_colours[] = {
-        COLOUR_BRIGHT_PURPLE,
-        COLOUR_BRIGHT_GREEN,
-        COLOUR_LIGHT_ORANGE,
-        COLOUR_BRIGHT_PINK,
-    };
-
     if (activeAwardTypes & EnumToFlag(AwardType::MostDisappointing))
         return false;
 
-    auto countedRides = 0;
-    auto colourfulRides = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        if (!ride.GetRideTypeDescriptor().HasFlag(RIDE_TYPE_FLAG_HAS_TRACK))
-            continue;
+    const auto& rides = GetRideAwardCounts();
+    const uint32_t colourfulRides = rides.dazzlingTrackedRides;
 
-        countedRides++;
-
-        auto mainTrackColour = ride.track_colour[0].main;
-        for (auto dazzling_ride_colour : dazzling_ride_colours)
-        {
-            if (mainTrackColour == dazzling_ride_colour)
-            {
-                colourfulRides++;
-                break;
-            }
-        }
-    }
-
-    return (colourfulRides >= 5 && colourfulRides >= countedRides - colourfulRides);
+    return (colourfulRides >= 5 && colourfulRides >= rides.trackedRides - colourfulRides);
 }
 
 /** At least 10 peeps and more than 1/64 of total guests are lost or can't find something. */
 static bool AwardIsDeservedMostConfusingLayout([[maybe_unused]] int32_t activeAwardTypes)
 {
-    uint32_t peepsCounted = 0;
-    uint32_t peepsLost = 0;
-    for (auto peep : EntityList<Guest>())
-    {
-        if (peep->OutsideOfPark)
-            continue;
-
-        peepsCounted++;
-        const auto& thought = std::get<0>(peep->Thoughts);
-        if (thought.freshness <= 5 && (thought.type == PeepThoughtType::Lost || thought.type == PeepThoughtType::CantFind))
-            peepsLost++;
-    }
+    const auto& thoughts = GetFreshThoughtCounts();
+    const uint32_t peepsCounted = thoughts.guestsInPark;
+    const uint32_t peepsLost = thoughts[PeepThoughtType::Lost] + thoughts[PeepThoughtType::CantFind];
 
     return (peepsLost >= 10 && peepsLost >= peepsCounted / 64);
 }
@@ -536,29 +449,7 @@ static bool AwardIsDeservedMostConfusingLayout([[maybe_unused]] int32_t activeAw
 /** At least 10 open gentle rides. */
 static bool AwardIsDeservedBestGentleRides([[maybe_unused]] int32_t activeAwardTypes)
 {
-    auto gentleRides = 0;
-    for (const auto& ride : GetRideManager())
-    {
-        auto rideEntry = ride.GetRideEntry();
-        if (rideEntry == nullptr)
-        {
-            continue;
-        }
-
-        if (ride.status != RideStatus::Open || (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
-        {
-            continue;
-        }
-
-        if (!RideEntryHasCategory(*rideEntry, RIDE_CATEGORY_GENTLE))
-        {
-            continue;
-        }
-
-        gentleRides++;
-    }
-
-    return (gentleRides >= 10);
+    return (GetRideAwardCounts().openGentleRides >= 10);
 }
 
 using award_deserved_check = bool (*)(int32_t);
@@ -603,6 +494,10 @@ void AwardUpdateAll()
 {
     PROFILED_FUNCTION();
 
+    // Thought and ride counts are rebuilt by the first check that needs them.
+    _freshThoughtCountsValid = false;
+    _rideAwardCountsValid = false;
+
     auto& currentAwards = GetGameState().CurrentAwards;
     // Decrease award times
     for (auto& award : currentAwards)
@@ -40,6 +40,11 @@ static constexpr int32_t dword_988E60[EnumValue(ExpenditureType::Count)] = {
     1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0,
 };
 
+// Running total of each month of the expenditure table. Entry 0 is maintained
+// incrementally by FinancePayment and older entries only change when the table
+// shifts, so summary readers never re-accumulate the table.
+static money64 _expenditureMonthSums[kExpenditureTableMonthCount];
+
 /**
  * Checks the condition if the game is required to use money.
  * @param flags game command flags.
@@ -80,6 +85,7 @@ void FinancePayment(money64 amount, ExpenditureType type)
     gameState.Cash = AddClamp<money64>(gameState.Cash, -amount);
 
     gameState.ExpenditureTable[0][EnumValue(type)] -= amount;
+    _expenditureMonthSums[0] -= amount;
     if (dword_988E60[EnumValue(type)] & 1)
     {
         // Cumulative amount of money spent this day
@@ -198,6 +204,7 @@ void FinanceResetHistory()
         {
             gameState.ExpenditureTable[i][j] = 0;
         }
+        _expenditureMonthSums[i] = 0;
     }
 }
 
@@ -214,6 +221,7 @@ void FinanceInit()
     {
         gameState.ExpenditureTable[0][i] = 0;
     }
+    _expenditureMonthSums[0] = 0;
 
     gameState.CurrentExpenditure = 0;
     gameState.CurrentProfit = 0;
@@ -320,20 +328,18 @@ void FinanceShiftExpenditureTable()
     // If kExpenditureTableMonthCount months have passed then is full, sum the oldest month
     if (GetDate().GetMonthsElapsed() >= kExpenditureTableMonthCount)
     {
-        const money64 sum = std::accumulate(
-            std::cbegin(gameState.ExpenditureTable[kExpenditureTableMonthCount - 1]),
-            std::cend(gameState.ExpenditureTable[kExpenditureTableMonthCount - 1]), money64{});
-
-        GetGameState().HistoricalProfit += sum;
+        // The rollup already holds the sum of the oldest month
+        GetGameState().HistoricalProfit += _expenditureMonthSums[kExpenditureTableMonthCount - 1];
     }
 
-    // Shift the table
+    // Shift the table and its rollups
     for (size_t i = kExpenditureTableMonthCount - 1; i >= 1; i--)
     {
         for (size_t j = 0; j < static_cast<int32_t>(ExpenditureType::Count); j++)
         {
             gameState.ExpenditureTable[i][j] = gameState.ExpenditureTable[i - 1][j];
         }
+        _expenditureMonthSums[i] = _expenditureMonthSums[i - 1];
     }
 
     // Zero the beginning of the table, which is the new month
@@ -341,6 +347,7 @@ void FinanceShiftExpenditureTable()
     {
         gameState.ExpenditureTable[0][i] = 0;
     }
+    _expenditureMonthSums[0] = 0;
 
     WindowInvalidateByClass(WindowClass::Finances);
 }
@@ -372,3 +379,31 @@ money64 FinanceGetLastMonthShopProfit()
     }
     return profit;
 }
+
+money64 FinanceGetExpenditure(uint8_t monthIndex, ExpenditureType type)
+{
+    if (monthIndex >= kExpenditureTableMonthCount)
+    {
+        return 0;
+    }
+    return GetGameState().ExpenditureTable[monthIndex][EnumValue(type)];
+}
+
+money64 FinanceGetExpenditureMonthSum(uint8_t monthIndex)
+{
+    if (monthIndex >= kExpenditureTableMonthCount)
+    {
+        return 0;
+    }
+    return _expenditureMonthSums[monthIndex];
+}
+
+void FinanceRefreshExpenditureSummaries()
+{
+    const auto& gameState = GetGameState();
+    for (uint32_t i = 0; i < kExpenditureTableMonthCount; i++)
+    {
+        _expenditureMonthSums[i] = std::accumulate(
+            std::cbegin(gameState.ExpenditureTable[i]), std::cend(gameState.ExpenditureTable[i]), money64{});
+    }
+}
@@ -57,3 +57,20 @@ money64 FinanceGetMaximumLoan();
 money64 FinanceGetCurrentCash();
 
 money64 FinanceGetLastMonthShopProfit();
+
+/**
+ * Gets an expenditure table entry, monthIndex 0 being the current month.
+ */
+money64 FinanceGetExpenditure(uint8_t monthIndex, ExpenditureType type);
+
+/**
+ * Gets the total expenditure of a month from the running rollups, monthIndex 0
+ * being the current month. Constant time, no re-accumulation of the table.
+ */
+money64 FinanceGetExpenditureMonthSum(uint8_t monthIndex);
+
+/**
+ * Recomputes the expenditure rollups. Call after the expenditure table has
+ * been replaced wholesale, e.g. by a park load or import.
+ */
+void FinanceRefreshExpenditureSummaries();
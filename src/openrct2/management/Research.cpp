@@ -39,6 +39,7 @@
 #include "Finance.h"
 #include "NewsItem.h"
 
+#include <array>
 #include <iterator>
 
 using namespace OpenRCT2;
@@ -50,9 +51,12 @@ static constexpr int32_t _researchRate[] = {
     400,
 };
 
-static bool _researchedRideTypes[RIDE_TYPE_COUNT];
-static bool _researchedRideEntries[MAX_RIDE_OBJECTS];
-static bool _researchedSceneryItems[SCENERY_TYPE_COUNT][UINT16_MAX];
+// Bit-packed so the scenery table is 48 KiB rather than 393 KiB of bools;
+// queries touch one cache line per word and the bulk set/clear operations
+// below work a word at a time.
+static BitSet<RIDE_TYPE_COUNT> _researchedRideTypes;
+static BitSet<MAX_RIDE_OBJECTS> _researchedRideEntries;
+static std::array<BitSet<UINT16_MAX>, SCENERY_TYPE_COUNT> _researchedSceneryItems;
 
 bool gSilentResearch = false;
 
@@ -302,7 +306,9 @@ void ResearchFinishItem(const ResearchItem& researchItem)
 }
 
 /**
- *
+ * Progresses the current research. Runs on a fixed cadence driven by the
+ * scheduled tick event table in GameState.cpp rather than gating itself on the
+ * tick counter.
  *  rct2: 0x00684C7A
  */
 void ResearchUpdate()
@@ -318,10 +324,6 @@ void ResearchUpdate()
     }
 
     auto& gameState = GetGameState();
-    if (gameState.CurrentTicks % 32 != 0)
-    {
-        return;
-    }
 
     if ((gameState.Park.Flags & PARK_FLAGS_NO_MONEY) && gameState.ResearchFundingLevel == RESEARCH_FUNDING_NONE)
     {
@@ -680,7 +682,7 @@ void SetAllSceneryItemsInvented()
 {
     for (auto sceneryType = 0; sceneryType < SCENERY_TYPE_COUNT; sceneryType++)
     {
-        std::fill(std::begin(_researchedSceneryItems[sceneryType]), std::end(_researchedSceneryItems[sceneryType]), true);
+        _researchedSceneryItems[sceneryType].reset().flip();
     }
 }
 
@@ -688,28 +690,28 @@ void SetAllSceneryItemsNotInvented()
 {
     for (auto sceneryType = 0; sceneryType < SCENERY_TYPE_COUNT; sceneryType++)
     {
-        std::fill(std::begin(_researchedSceneryItems[sceneryType]), std::end(_researchedSceneryItems[sceneryType]), false);
+        _researchedSceneryItems[sceneryType].reset();
     }
 }
 
 void SetEveryRideTypeInvented()
 {
-    std::fill(std::begin(_researchedRideTypes), std::end(_researchedRideTypes), true);
+    _researchedRideTypes.reset().flip();
 }
 
 void SetEveryRideTypeNotInvented()
 {
-    std::fill(std::begin(_researchedRideTypes), std::end(_researchedRideTypes), false);
+    _researchedRideTypes.reset();
 }
 
 void SetEveryRideEntryInvented()
 {
-    std::fill(std::begin(_researchedRideEntries), std::end(_researchedRideEntries), true);
+    _researchedRideEntries.reset().flip();
 }
 
 void SetEveryRideEntryNotInvented()
 {
-    std::fill(std::begin(_researchedRideEntries), std::end(_researchedRideEntries), false);
+    _researchedRideEntries.reset();
 }
 
 /**
@@ -31,6 +31,7 @@
 #include "../localisation/LocalisationService.h"
 #include "../park/ParkFile.h"
 #include "../platform/Platform.h"
+#include "../profiling/Tracing.h"
 #include "../scenario/Scenario.h"
 #include "../scripting/ScriptEngine.h"
 #include "../ui/UiContext.h"
@@ -49,7 +50,7 @@ using namespace OpenRCT2;
 // It is used for making sure only compatible builds get connected, even within
 // single OpenRCT2 version.
 
-constexpr uint8_t kNetworkStreamVersion = 0;
+constexpr uint8_t kNetworkStreamVersion = 1;
 
 const std::string kNetworkStreamID = std::string(OPENRCT2_VERSION) + "-" + std::to_string(kNetworkStreamVersion);
 
@@ -62,6 +63,10 @@ static int32_t _pickup_peep_old_x = LOCATION_NULL;
 // with uint16_t and needs some spare room for other data in the packet.
 static constexpr uint32_t CHUNK_SIZE = 1024 * 63;
 
+// Maximum number of advertised map block hashes the server accepts from a
+// client; enough for a map transfer of half a GiB.
+static constexpr uint32_t kMaxAdvertisedMapBlocks = 8192;
+
 // If data is sent fast enough it would halt the entire server, process only a maximum amount.
 // This limit is per connection, the current value was determined by tests with fuzzing.
 static constexpr uint32_t MaxPacketsPerUpdate = 100;
@@ -71,10 +76,13 @@ static constexpr uint32_t MaxPacketsPerUpdate = 100;
 #    include "../Version.h"
 #    include "../actions/GameAction.h"
 #    include "../config/Config.h"
+#    include "../core/ChecksumStream.h"
 #    include "../core/Console.hpp"
+#    include "../core/Crypt.h"
 #    include "../core/FileStream.h"
 #    include "../core/MemoryStream.h"
 #    include "../core/Path.hpp"
+#    include "../core/VectorStream.h"
 #    include "../core/String.hpp"
 #    include "../interface/Chat.h"
 #    include "../interface/Window.h"
@@ -83,6 +91,7 @@ static constexpr uint32_t MaxPacketsPerUpdate = 100;
 #    include "../object/ObjectRepository.h"
 #    include "../scenario/Scenario.h"
 #    include "../util/Util.h"
+#    include "../world/Map.h"
 #    include "../world/Park.h"
 #    include "NetworkAction.h"
 #    include "NetworkConnection.h"
@@ -97,6 +106,7 @@ static constexpr uint32_t MaxPacketsPerUpdate = 100;
 #    include <array>
 #    include <cerrno>
 #    include <cmath>
+#    include <chrono>
 #    include <fstream>
 #    include <functional>
 #    include <list>
@@ -108,6 +118,14 @@ static constexpr uint32_t MaxPacketsPerUpdate = 100;
 
 using namespace OpenRCT2;
 
+static uint64_t MapBlockHash(const uint8_t* data, size_t dataLen)
+{
+    auto hash = Crypt::FNV1a(data, dataLen);
+    uint64_t result{};
+    std::memcpy(&result, hash.data(), sizeof(result));
+    return result;
+}
+
 static void NetworkChatShowConnectedMessage();
 static void NetworkChatShowServerGreeting();
 static u8string NetworkGetKeysDirectory();
@@ -124,6 +142,7 @@ NetworkBase::NetworkBase(OpenRCT2::IContext& context)
 
     client_command_handlers[NetworkCommand::Auth] = &NetworkBase::Client_Handle_AUTH;
     client_command_handlers[NetworkCommand::Map] = &NetworkBase::Client_Handle_MAP;
+    client_command_handlers[NetworkCommand::MapCached] = &NetworkBase::Client_Handle_MAP_CACHED;
     client_command_handlers[NetworkCommand::Chat] = &NetworkBase::Client_Handle_CHAT;
     client_command_handlers[NetworkCommand::GameAction] = &NetworkBase::Client_Handle_GAME_ACTION;
     client_command_handlers[NetworkCommand::Tick] = &NetworkBase::Client_Handle_TICK;
@@ -201,6 +220,7 @@ void NetworkBase::Close()
         CloseConnection();
 
         client_connection_list.clear();
+        _pendingAuthVerifications.clear();
         GameActions::ClearQueue();
         GameActions::ResumeQueue();
         player_list.clear();
@@ -468,6 +488,8 @@ NetworkConnection* NetworkBase::GetPlayerConnection(uint8_t id) const
 
 void NetworkBase::Update()
 {
+    TRACE_SCOPE("NetworkBase::Update");
+
     _closeLock = true;
 
     // Update is not necessarily called per game tick, maintain our own delta time
@@ -530,6 +552,8 @@ void NetworkBase::UpdateServer()
         }
     }
 
+    ProcessAuthVerifications();
+
     uint32_t ticks = Platform::GetTicks();
     if (ticks > last_ping_sent_time + 3000)
     {
@@ -782,6 +806,11 @@ const char* NetworkBase::FormatChat(NetworkPlayer* fromPlayer, const char* text)
     return formatted.c_str();
 }
 
+// NOTE: The simulation is lockstep; entity state is never streamed to
+// clients, each client computes it locally from the shared game action
+// stream. Everything broadcast here is either that stream or small
+// metadata (ticks, checksums, player lists, chat), so per-client interest
+// filtering by viewport has nothing to act on in this model.
 void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, bool gameCmd) const
 {
     for (auto& client_connection : client_connection_list)
@@ -801,6 +830,21 @@ void NetworkBase::SendPacketToClients(const NetworkPacket& packet, bool front, b
     }
 }
 
+// Flat FNV fold over the logical tile content, not the backing array: element
+// order, dead space left by removals and local-only ghosts all differ between
+// the host and a client that imported the map, so the fold is taken over the
+// same tile-ordered ghost-free form a joining client receives.
+static EntitiesChecksum GetTileElementsChecksum()
+{
+    EntitiesChecksum checksum{};
+
+    ChecksumStream ms(checksum.raw);
+    const auto tileElements = GetReorganisedTileElementsWithoutGhosts();
+    ms.Write(tileElements.data(), tileElements.size() * sizeof(TileElement));
+
+    return checksum;
+}
+
 bool NetworkBase::CheckSRAND(uint32_t tick, uint32_t srand0)
 {
     // We have to wait for the map to be loaded first, ticks may match current loaded map.
@@ -816,17 +860,53 @@ bool NetworkBase::CheckSRAND(uint32_t tick, uint32_t srand0)
 
     if (storedTick.srand0 != srand0)
     {
-        LOG_INFO("Srand0 mismatch, client = %08X, server = %08X", srand0, storedTick.srand0);
+        LOG_INFO("Srand0 mismatch at tick %u, client = %08X, server = %08X", tick, srand0, storedTick.srand0);
         return false;
     }
 
-    if (!storedTick.spriteHash.empty())
+    // Compare each subsystem checksum the server sent for this tick so the
+    // report names where the state first diverged.
+    if (!storedTick.peepsHash.empty())
+    {
+        auto clientHash = GetPeepEntitiesChecksum().ToString();
+        if (clientHash != storedTick.peepsHash)
+        {
+            LOG_INFO(
+                "Peep checksum mismatch at tick %u, client = %s, server = %s", tick, clientHash.c_str(),
+                storedTick.peepsHash.c_str());
+            return false;
+        }
+    }
+    if (!storedTick.vehiclesHash.empty())
+    {
+        auto clientHash = GetVehicleEntitiesChecksum().ToString();
+        if (clientHash != storedTick.vehiclesHash)
+        {
+            LOG_INFO(
+                "Vehicle checksum mismatch at tick %u, client = %s, server = %s", tick, clientHash.c_str(),
+                storedTick.vehiclesHash.c_str());
+            return false;
+        }
+    }
+    if (!storedTick.litterHash.empty())
+    {
+        auto clientHash = GetLitterEntitiesChecksum().ToString();
+        if (clientHash != storedTick.litterHash)
+        {
+            LOG_INFO(
+                "Litter checksum mismatch at tick %u, client = %s, server = %s", tick, clientHash.c_str(),
+                storedTick.litterHash.c_str());
+            return false;
+        }
+    }
+    if (!storedTick.tilesHash.empty())
     {
-        EntitiesChecksum checksum = GetAllEntitiesChecksum();
-        std::string clientSpriteHash = checksum.ToString();
-        if (clientSpriteHash != storedTick.spriteHash)
+        auto clientHash = GetTileElementsChecksum().ToString();
+        if (clientHash != storedTick.tilesHash)
         {
-            LOG_INFO("Sprite hash mismatch, client = %s, server = %s", clientSpriteHash.c_str(), storedTick.spriteHash.c_str());
+            LOG_INFO(
+                "Tile checksum mismatch at tick %u, client = %s, server = %s", tick, clientHash.c_str(),
+                storedTick.tilesHash.c_str());
             return false;
         }
     }
@@ -1296,6 +1376,17 @@ void NetworkBase::Client_Send_MAPREQUEST(const std::vector<ObjectEntryDescriptor
             packet.WriteString(name);
         }
     }
+
+    // Advertise block hashes of the last map we fully downloaded so the server
+    // can skip retransmitting the blocks that have not changed since.
+    const uint32_t numBlocks = static_cast<uint32_t>((_lastMapBuffer.size() + (CHUNK_SIZE - 1)) / CHUNK_SIZE);
+    packet << numBlocks;
+    for (uint32_t i = 0; i < numBlocks; i++)
+    {
+        const size_t offset = static_cast<size_t>(i) * CHUNK_SIZE;
+        const size_t blockSize = std::min<size_t>(CHUNK_SIZE, _lastMapBuffer.size() - offset);
+        packet << MapBlockHash(&_lastMapBuffer[offset], blockSize);
+    }
     _serverConnection->QueuePacket(std::move(packet));
 }
 
@@ -1465,7 +1556,19 @@ void NetworkBase::ServerSendMap(NetworkConnection* connection)
         objects = objManager.GetPackableObjects();
     }
 
-    auto header = SaveForNetwork(objects);
+    // Serialising a large park is expensive, so reuse the result when several
+    // clients join on the same tick with the same set of requested objects.
+    // The executed action count also gates reuse: actions allowed while the
+    // game is paused mutate the state without the tick advancing.
+    if (_mapCache.empty() || _mapCacheTick != GetGameState().CurrentTicks
+        || _mapCacheActionCount != GameActions::GetExecutedCount() || _mapCacheObjects != objects)
+    {
+        _mapCache = SaveForNetwork(objects);
+        _mapCacheTick = GetGameState().CurrentTicks;
+        _mapCacheActionCount = GameActions::GetExecutedCount();
+        _mapCacheObjects = objects;
+    }
+    const auto& header = _mapCache;
     if (header.empty())
     {
         if (connection != nullptr)
@@ -1476,9 +1579,27 @@ void NetworkBase::ServerSendMap(NetworkConnection* connection)
         return;
     }
     size_t chunksize = CHUNK_SIZE;
+    size_t numCached = 0;
     for (size_t i = 0; i < header.size(); i += chunksize)
     {
         size_t datasize = std::min(chunksize, header.size() - i);
+
+        // Blocks the client advertised with a matching hash do not need to be
+        // retransmitted; a marker tells it to reuse its local copy instead.
+        if (connection != nullptr)
+        {
+            const size_t blockIndex = i / chunksize;
+            if (blockIndex < connection->AdvertisedMapBlocks.size()
+                && connection->AdvertisedMapBlocks[blockIndex] == MapBlockHash(&header[i], datasize))
+            {
+                NetworkPacket packet(NetworkCommand::MapCached);
+                packet << static_cast<uint32_t>(header.size()) << static_cast<uint32_t>(i);
+                connection->QueuePacket(std::move(packet));
+                numCached++;
+                continue;
+            }
+        }
+
         NetworkPacket packet(NetworkCommand::Map);
         packet << static_cast<uint32_t>(header.size()) << static_cast<uint32_t>(i);
         packet.Write(&header[i], datasize);
@@ -1491,6 +1612,12 @@ void NetworkBase::ServerSendMap(NetworkConnection* connection)
             SendPacketToClients(packet);
         }
     }
+    if (numCached > 0)
+    {
+        LOG_VERBOSE(
+            "Client already has %u of %u map blocks", uint32_t(numCached),
+            uint32_t((header.size() + chunksize - 1) / chunksize));
+    }
 }
 
 std::vector<uint8_t> NetworkBase::SaveForNetwork(const std::vector<const ObjectRepositoryItem*>& objects) const
@@ -1553,21 +1680,31 @@ void NetworkBase::Client_Send_GAME_ACTION(const GameAction* action)
         _gameActionCallbacks.insert(std::make_pair(networkId, action->GetCallback()));
     }
 
-    DataSerialiser stream(true);
+    packet << GetGameState().CurrentTicks << action->GetType();
+
+    // Serialise the action straight into the packet, skipping the
+    // intermediate stream and copy.
+    VectorStream vs(packet.Data);
+    DataSerialiser stream(true, vs);
     action->Serialise(stream);
 
-    packet << GetGameState().CurrentTicks << action->GetType() << stream;
     _serverConnection->QueuePacket(std::move(packet));
+
+    // Dispatch straight away instead of waiting for the next network flush;
+    // every frame shaved off here comes directly out of the visible delay
+    // between a local action and its server-ordered execution.
+    _serverConnection->SendQueuedPackets();
 }
 
 void NetworkBase::ServerSendGameAction(const GameAction* action)
 {
     NetworkPacket packet(NetworkCommand::GameAction);
 
-    DataSerialiser stream(true);
-    action->Serialise(stream);
+    packet << GetGameState().CurrentTicks << action->GetType();
 
-    packet << GetGameState().CurrentTicks << action->GetType() << stream;
+    VectorStream vs(packet.Data);
+    DataSerialiser stream(true, vs);
+    action->Serialise(stream);
 
     SendPacketToClients(packet);
 }
@@ -1577,9 +1714,9 @@ void NetworkBase::ServerSendTick()
     NetworkPacket packet(NetworkCommand::Tick);
     packet << GetGameState().CurrentTicks << ScenarioRandState().s0;
     uint32_t flags = 0;
-    // Simple counter which limits how often a sprite checksum gets sent.
-    // This can get somewhat expensive, so we don't want to push it every tick in release,
-    // but debug version can check more often.
+    // Simple counter which limits how often the entity checksums get sent.
+    // Serialising every entity is somewhat expensive, so we don't want to push
+    // it every tick in release, but debug version can check more often.
     static int32_t checksum_counter = 0;
     checksum_counter++;
     if (checksum_counter >= 100)
@@ -1587,13 +1724,28 @@ void NetworkBase::ServerSendTick()
         checksum_counter = 0;
         flags |= NETWORK_TICK_FLAG_CHECKSUMS;
     }
+    // The tile checksum is a flat fold over the tile element array and cheap
+    // enough to exchange far more often, so tile desyncs are pinned down to a
+    // much smaller tick window.
+    static int32_t tileChecksumCounter = 0;
+    tileChecksumCounter++;
+    if (tileChecksumCounter >= 20)
+    {
+        tileChecksumCounter = 0;
+        flags |= NETWORK_TICK_FLAG_TILE_CHECKSUM;
+    }
     // Send flags always, so we can understand packet structure on the other end,
     // and allow for some expansion.
     packet << flags;
     if (flags & NETWORK_TICK_FLAG_CHECKSUMS)
     {
-        EntitiesChecksum checksum = GetAllEntitiesChecksum();
-        packet.WriteString(checksum.ToString());
+        packet.WriteString(GetPeepEntitiesChecksum().ToString());
+        packet.WriteString(GetVehicleEntitiesChecksum().ToString());
+        packet.WriteString(GetLitterEntitiesChecksum().ToString());
+    }
+    if (flags & NETWORK_TICK_FLAG_TILE_CHECKSUM)
+    {
+        packet.WriteString(GetTileElementsChecksum().ToString());
     }
 
     SendPacketToClients(packet);
@@ -1626,6 +1778,9 @@ void NetworkBase::ServerSendPlayerList()
 void NetworkBase::Client_Send_PING()
 {
     NetworkPacket packet(NetworkCommand::Ping);
+    // Report the tick we have simulated up to so the server can measure how
+    // far each client is lagging behind the authoritative tick.
+    packet << GetGameState().CurrentTicks;
     _serverConnection->QueuePacket(std::move(packet));
 }
 
@@ -2622,6 +2777,17 @@ void NetworkBase::ServerHandleMapRequest(NetworkConnection& connection, NetworkP
         }
     }
 
+    uint32_t numBlocks{};
+    packet >> numBlocks;
+    if (numBlocks <= kMaxAdvertisedMapBlocks)
+    {
+        connection.AdvertisedMapBlocks.resize(numBlocks);
+        for (uint32_t i = 0; i < numBlocks; i++)
+        {
+            packet >> connection.AdvertisedMapBlocks[i];
+        }
+    }
+
     auto player_name = connection.Player->Name.c_str();
     ServerSendMap(&connection);
     ServerSendEventPlayerJoined(player_name);
@@ -2632,7 +2798,15 @@ void NetworkBase::ServerHandleAuth(NetworkConnection& connection, NetworkPacket&
 {
     if (connection.AuthStatus != NetworkAuth::Ok)
     {
-        auto* hostName = connection.Socket->GetHostName();
+        // Ignore further auth packets while a verification is still in flight.
+        for (const auto& pending : _pendingAuthVerifications)
+        {
+            if (pending.ConnectionId == connection.Id)
+            {
+                return;
+            }
+        }
+
         auto gameversion = packet.ReadString();
         auto name = packet.ReadString();
         auto password = packet.ReadString();
@@ -2667,95 +2841,198 @@ void NetworkBase::ServerHandleAuth(NetworkConnection& connection, NetworkPacket&
 
                 std::memcpy(signature.data(), signatureData, sigsize);
 
-                auto ms = MemoryStream(pubkey.data(), pubkey.size());
-                if (!connection.Key.LoadPublic(&ms))
+                // Each in-flight verification owns a worker; during a join
+                // flood any further checks run synchronously instead of
+                // spawning an unbounded number of threads.
+                constexpr size_t kMaxPendingAuthVerifications = 16;
+                if (_pendingAuthVerifications.size() >= kMaxPendingAuthVerifications)
                 {
-                    throw std::runtime_error("Failed to load public key.");
-                }
-
-                bool verified = connection.Key.Verify(connection.Challenge.data(), connection.Challenge.size(), signature);
-                const std::string hash = connection.Key.PublicKeyHash();
-                if (verified)
-                {
-                    LOG_VERBOSE("Connection %s: Signature verification ok. Hash %s", hostName, hash.c_str());
-                    if (Config::Get().network.KnownKeysOnly && _userManager.GetUserByHash(hash) == nullptr)
-                    {
-                        LOG_VERBOSE("Connection %s: Hash %s, not known", hostName, hash.c_str());
-                        connection.AuthStatus = NetworkAuth::UnknownKeyDisallowed;
-                    }
-                    else
+                    NetworkKey key;
+                    auto ms = MemoryStream(pubkey.data(), pubkey.size());
+                    bool verified = false;
+                    std::string hash;
+                    if (key.LoadPublic(&ms))
                     {
-                        connection.AuthStatus = NetworkAuth::Verified;
+                        verified = key.Verify(connection.Challenge.data(), connection.Challenge.size(), signature);
+                        hash = key.PublicKeyHash();
                     }
+                    auto pubkeyCopy = std::string(pubkey);
+                    ServerApplySignatureVerification(connection, pubkeyCopy, verified, hash);
                 }
                 else
                 {
-                    connection.AuthStatus = NetworkAuth::VerificationFailure;
-                    LOG_VERBOSE("Connection %s: Signature verification failed!", hostName);
+                    // The actual crypto runs on a worker thread over copied
+                    // data; the rest of the handshake continues in
+                    // UpdateServer once the result is ready, so joins do not
+                    // stall the tick.
+                    PendingAuthVerification pending;
+                    pending.Connection = &connection;
+                    pending.ConnectionId = connection.Id;
+                    pending.GameVersion = std::string(gameversion);
+                    pending.Name = std::string(name);
+                    pending.Password = std::string(password);
+                    pending.PubKey = std::string(pubkey);
+                    pending.Result = std::async(
+                        std::launch::async,
+                        [pubkeyCopy = pending.PubKey, challenge = connection.Challenge,
+                         signature = std::move(signature)]() -> std::pair<bool, std::string> {
+                            NetworkKey key;
+                            auto ms = MemoryStream(pubkeyCopy.data(), pubkeyCopy.size());
+                            if (!key.LoadPublic(&ms))
+                            {
+                                return { false, std::string() };
+                            }
+                            const bool verified = key.Verify(challenge.data(), challenge.size(), signature);
+                            return { verified, key.PublicKeyHash() };
+                        });
+                    _pendingAuthVerifications.push_back(std::move(pending));
+                    return;
                 }
             }
             catch (const std::exception&)
             {
                 connection.AuthStatus = NetworkAuth::VerificationFailure;
-                LOG_VERBOSE("Connection %s: Signature verification failed, invalid data!", hostName);
+                LOG_VERBOSE(
+                    "Connection %s: Signature verification failed, invalid data!", connection.Socket->GetHostName());
             }
         }
 
-        bool passwordless = false;
-        if (connection.AuthStatus == NetworkAuth::Verified)
+        ServerCompleteAuthentication(connection, std::string(gameversion), std::string(name), std::string(password));
+    }
+}
+
+void NetworkBase::ServerApplySignatureVerification(
+    NetworkConnection& connection, const std::string& pubkey, bool verified, const std::string& hash)
+{
+    auto* hostName = connection.Socket->GetHostName();
+    if (verified)
+    {
+        // Load the key again on the main thread so the connection owns it.
+        auto ms = MemoryStream(pubkey.data(), pubkey.size());
+        connection.Key.LoadPublic(&ms);
+
+        LOG_VERBOSE("Connection %s: Signature verification ok. Hash %s", hostName, hash.c_str());
+        if (Config::Get().network.KnownKeysOnly && _userManager.GetUserByHash(hash) == nullptr)
         {
-            const NetworkGroup* group = GetGroupByID(GetGroupIDByHash(connection.Key.PublicKeyHash()));
-            if (group != nullptr)
-            {
-                passwordless = group->CanPerformAction(NetworkPermission::PasswordlessLogin);
-            }
+            LOG_VERBOSE("Connection %s: Hash %s, not known", hostName, hash.c_str());
+            connection.AuthStatus = NetworkAuth::UnknownKeyDisallowed;
         }
-        if (gameversion != NetworkGetVersion())
+        else
         {
-            connection.AuthStatus = NetworkAuth::BadVersion;
-            LOG_INFO("Connection %s: Bad version.", hostName);
+            connection.AuthStatus = NetworkAuth::Verified;
         }
-        else if (name.empty())
+    }
+    else
+    {
+        connection.AuthStatus = NetworkAuth::VerificationFailure;
+        LOG_VERBOSE("Connection %s: Signature verification failed!", hostName);
+    }
+}
+
+void NetworkBase::ProcessAuthVerifications()
+{
+    for (auto it = _pendingAuthVerifications.begin(); it != _pendingAuthVerifications.end();)
+    {
+        auto& pending = *it;
+
+        // The connection may have been dropped while its signature was being
+        // checked. Liveness is decided by the connection id, not the pointer:
+        // a freed connection's address can be reused by a client accepted in
+        // the same update pass, and the stale entry must not complete the old
+        // client's authentication on the new connection.
+        const bool connectionAlive = std::any_of(
+            client_connection_list.begin(), client_connection_list.end(),
+            [&pending](const auto& conn) { return conn->Id == pending.ConnectionId; });
+        if (!connectionAlive)
         {
-            connection.AuthStatus = NetworkAuth::BadName;
-            LOG_INFO("Connection %s: Bad name.", connection.Socket->GetHostName());
+            it = _pendingAuthVerifications.erase(it);
+            continue;
         }
-        else if (!passwordless)
+
+        if (pending.Result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
         {
-            if (password.empty() && !_password.empty())
-            {
-                connection.AuthStatus = NetworkAuth::RequirePassword;
-                LOG_INFO("Connection %s: Requires password.", hostName);
-            }
-            else if (!password.empty() && _password != password)
-            {
-                connection.AuthStatus = NetworkAuth::BadPassword;
-                LOG_INFO("Connection %s: Bad password.", hostName);
-            }
+            ++it;
+            continue;
         }
 
-        if (GetNumVisiblePlayers() >= Config::Get().network.Maxplayers)
+        auto& connection = *pending.Connection;
+        const auto [verified, hash] = pending.Result.get();
+        ServerApplySignatureVerification(connection, pending.PubKey, verified, hash);
+        ServerCompleteAuthentication(connection, pending.GameVersion, pending.Name, pending.Password);
+        it = _pendingAuthVerifications.erase(it);
+    }
+}
+
+void NetworkBase::ServerCompleteAuthentication(
+    NetworkConnection& connection, const std::string& gameversion, const std::string& name, const std::string& password)
+{
+    auto* hostName = connection.Socket->GetHostName();
+
+    bool passwordless = false;
+    if (connection.AuthStatus == NetworkAuth::Verified)
+    {
+        const NetworkGroup* group = GetGroupByID(GetGroupIDByHash(connection.Key.PublicKeyHash()));
+        if (group != nullptr)
         {
-            connection.AuthStatus = NetworkAuth::Full;
-            LOG_INFO("Connection %s: Server is full.", hostName);
+            passwordless = group->CanPerformAction(NetworkPermission::PasswordlessLogin);
         }
-        else if (connection.AuthStatus == NetworkAuth::Verified)
+    }
+    if (gameversion != NetworkGetVersion())
+    {
+        connection.AuthStatus = NetworkAuth::BadVersion;
+        LOG_INFO("Connection %s: Bad version.", hostName);
+    }
+    else if (name.empty())
+    {
+        connection.AuthStatus = NetworkAuth::BadName;
+        LOG_INFO("Connection %s: Bad name.", connection.Socket->GetHostName());
+    }
+    else if (!passwordless)
+    {
+        if (password.empty() && !_password.empty())
         {
-            const std::string hash = connection.Key.PublicKeyHash();
-            if (ProcessPlayerAuthenticatePluginHooks(connection, name, hash))
-            {
-                connection.AuthStatus = NetworkAuth::Ok;
-                ServerClientJoined(name, hash, connection);
-            }
-            else
-            {
-                connection.AuthStatus = NetworkAuth::VerificationFailure;
-                LOG_INFO("Connection %s: Denied by plugin.", hostName);
-            }
+            connection.AuthStatus = NetworkAuth::RequirePassword;
+            LOG_INFO("Connection %s: Requires password.", hostName);
+        }
+        else if (!password.empty() && _password != password)
+        {
+            connection.AuthStatus = NetworkAuth::BadPassword;
+            LOG_INFO("Connection %s: Bad password.", hostName);
         }
+    }
 
-        ServerSendAuth(connection);
+    if (GetNumVisiblePlayers() >= Config::Get().network.Maxplayers)
+    {
+        connection.AuthStatus = NetworkAuth::Full;
+        LOG_INFO("Connection %s: Server is full.", hostName);
+    }
+    else if (connection.AuthStatus == NetworkAuth::Verified)
+    {
+        const std::string hash = connection.Key.PublicKeyHash();
+        if (ProcessPlayerAuthenticatePluginHooks(connection, name, hash))
+        {
+            connection.AuthStatus = NetworkAuth::Ok;
+            ServerClientJoined(name, hash, connection);
+        }
+        else
+        {
+            connection.AuthStatus = NetworkAuth::VerificationFailure;
+            LOG_INFO("Connection %s: Denied by plugin.", hostName);
+        }
     }
+
+    ServerSendAuth(connection);
+}
+
+void NetworkBase::ClientBeginMapDownload()
+{
+    // Start of a new map load, clear the queue now as we have to buffer them
+    // until the map is fully loaded.
+    GameActions::ClearQueue();
+    GameActions::SuspendQueue();
+
+    _serverTickData.clear();
+    _clientMapLoaded = false;
 }
 
 void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connection, NetworkPacket& packet)
@@ -2769,13 +3046,7 @@ void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connecti
     }
     if (offset == 0)
     {
-        // Start of a new map load, clear the queue now as we have to buffer them
-        // until the map is fully loaded.
-        GameActions::ClearQueue();
-        GameActions::SuspendQueue();
-
-        _serverTickData.clear();
-        _clientMapLoaded = false;
+        ClientBeginMapDownload();
     }
     if (size > chunk_buffer.size())
     {
@@ -2791,49 +3062,91 @@ void NetworkBase::Client_Handle_MAP([[maybe_unused]] NetworkConnection& connecti
     std::memcpy(&chunk_buffer[offset], const_cast<void*>(static_cast<const void*>(packet.Read(chunksize))), chunksize);
     if (offset + chunksize == size)
     {
-        // Allow queue processing of game actions again.
-        GameActions::ResumeQueue();
+        ClientCompleteMapDownload(size);
+    }
+}
 
-        ContextForceCloseWindowByClass(WindowClass::ProgressWindow);
-        GameUnloadScripts();
-        GameNotifyMapChange();
+void NetworkBase::Client_Handle_MAP_CACHED(NetworkConnection& connection, NetworkPacket& packet)
+{
+    uint32_t size, offset;
+    packet >> size >> offset;
+    if (offset >= size)
+    {
+        return;
+    }
+    const uint32_t chunksize = std::min<uint32_t>(CHUNK_SIZE, size - offset);
+    if (static_cast<size_t>(offset) + chunksize > _lastMapBuffer.size())
+    {
+        // The server referenced a block we never advertised; the map can not
+        // be assembled from local data.
+        connection.SetLastDisconnectReason(STR_MULTIPLAYER_CONNECTION_CLOSED);
+        connection.Disconnect();
+        return;
+    }
+    if (offset == 0)
+    {
+        ClientBeginMapDownload();
+    }
+    if (size > chunk_buffer.size())
+    {
+        chunk_buffer.resize(size);
+    }
 
-        bool has_to_free = false;
-        uint8_t* data = &chunk_buffer[0];
-        size_t data_size = size;
-        auto ms = MemoryStream(data, data_size);
-        if (LoadMap(&ms))
-        {
-            GameLoadInit();
-            GameLoadScripts();
-            GameNotifyMapChanged();
-            _serverState.tick = GetGameState().CurrentTicks;
-            // NetworkStatusOpen("Loaded new map from network");
-            _serverState.state = NetworkServerStatus::Ok;
-            _clientMapLoaded = true;
-            gFirstTimeSaving = true;
-
-            // Notify user he is now online and which shortcut key enables chat
-            NetworkChatShowConnectedMessage();
-
-            // Fix invalid vehicle sprite sizes, thus preventing visual corruption of sprites
-            FixInvalidVehicleSpriteSizes();
-
-            // NOTE: Game actions are normally processed before processing the player list.
-            // Given that during map load game actions are buffered we have to process the
-            // player list first to have valid players for the queued game actions.
-            ProcessPlayerList();
-        }
-        else
-        {
-            // Something went wrong, game is not loaded. Return to main screen.
-            auto loadOrQuitAction = LoadOrQuitAction(LoadOrQuitModes::OpenSavePrompt, PromptMode::SaveBeforeQuit);
-            GameActions::Execute(&loadOrQuitAction);
-        }
-        if (has_to_free)
-        {
-            free(data);
-        }
+    std::memcpy(&chunk_buffer[offset], &_lastMapBuffer[offset], chunksize);
+    if (offset + chunksize == size)
+    {
+        ClientCompleteMapDownload(size);
+    }
+}
+
+void NetworkBase::ClientCompleteMapDownload(uint32_t size)
+{
+    // Allow queue processing of game actions again.
+    GameActions::ResumeQueue();
+
+    // Keep the raw bytes so the next map request can advertise what we
+    // already hold and unchanged blocks are not retransmitted.
+    _lastMapBuffer.assign(chunk_buffer.begin(), chunk_buffer.begin() + size);
+
+    ContextForceCloseWindowByClass(WindowClass::ProgressWindow);
+    GameUnloadScripts();
+    GameNotifyMapChange();
+
+    bool has_to_free = false;
+    uint8_t* data = &chunk_buffer[0];
+    size_t data_size = size;
+    auto ms = MemoryStream(data, data_size);
+    if (LoadMap(&ms))
+    {
+        GameLoadInit();
+        GameLoadScripts();
+        GameNotifyMapChanged();
+        _serverState.tick = GetGameState().CurrentTicks;
+        // NetworkStatusOpen("Loaded new map from network");
+        _serverState.state = NetworkServerStatus::Ok;
+        _clientMapLoaded = true;
+        gFirstTimeSaving = true;
+
+        // Notify user he is now online and which shortcut key enables chat
+        NetworkChatShowConnectedMessage();
+
+        // Fix invalid vehicle sprite sizes, thus preventing visual corruption of sprites
+        FixInvalidVehicleSpriteSizes();
+
+        // NOTE: Game actions are normally processed before processing the player list.
+        // Given that during map load game actions are buffered we have to process the
+        // player list first to have valid players for the queued game actions.
+        ProcessPlayerList();
+    }
+    else
+    {
+        // Something went wrong, game is not loaded. Return to main screen.
+        auto loadOrQuitAction = LoadOrQuitAction(LoadOrQuitModes::OpenSavePrompt, PromptMode::SaveBeforeQuit);
+        GameActions::Execute(&loadOrQuitAction);
+    }
+    if (has_to_free)
+    {
+        free(data);
     }
 }
 
@@ -2873,6 +3186,9 @@ bool NetworkBase::SaveMap(IStream* stream, const std::vector<const ObjectReposit
     {
         auto exporter = std::make_unique<ParkFileExporter>();
         exporter->ExportObjectsList = objects;
+        // The export happens on the game thread while clients wait; a faster,
+        // slightly larger stream is the better trade here.
+        exporter->FastCompression = true;
 
         auto& gameState = GetGameState();
         exporter->Export(gameState, *stream);
@@ -2936,6 +3252,15 @@ void NetworkBase::ServerHandleChat(NetworkConnection& connection, NetworkPacket&
     if (szText.empty())
         return;
 
+    // Drop flood traffic before the plugin hooks, formatting and relay run;
+    // past this point a message costs work proportional to the player count.
+    if (!connection.CheckChatRateLimit())
+        return;
+
+    // Clients enforce the message length in their input box, but the wire is
+    // not trusted to have done so.
+    szText = String::UTF8TruncateCodePoints(szText, kChatMaxMessageLength);
+
     if (connection.Player != nullptr)
     {
         NetworkGroup* group = GetGroupByID(connection.Player->Group);
@@ -3082,11 +3407,13 @@ void NetworkBase::Client_Handle_TICK([[maybe_unused]] NetworkConnection& connect
 
     if (flags & NETWORK_TICK_FLAG_CHECKSUMS)
     {
-        auto text = packet.ReadString();
-        if (!text.empty())
-        {
-            tickData.spriteHash = text;
-        }
+        tickData.peepsHash = packet.ReadString();
+        tickData.vehiclesHash = packet.ReadString();
+        tickData.litterHash = packet.ReadString();
+    }
+    if (flags & NETWORK_TICK_FLAG_TILE_CHECKSUM)
+    {
+        tickData.tilesHash = packet.ReadString();
     }
 
     // Don't let the history grow too much.
@@ -3133,8 +3460,11 @@ void NetworkBase::Client_Handle_PING([[maybe_unused]] NetworkConnection& connect
     Client_Send_PING();
 }
 
-void NetworkBase::ServerHandlePing(NetworkConnection& connection, [[maybe_unused]] NetworkPacket& packet)
+void NetworkBase::ServerHandlePing(NetworkConnection& connection, NetworkPacket& packet)
 {
+    uint32_t clientTick{};
+    packet >> clientTick;
+
     int32_t ping = Platform::GetTicks() - connection.PingTime;
     if (ping < 0)
     {
@@ -3143,6 +3473,7 @@ void NetworkBase::ServerHandlePing(NetworkConnection& connection, [[maybe_unused
     if (connection.Player != nullptr)
     {
         connection.Player->Ping = ping;
+        connection.Player->LastTick = clientTick;
         WindowInvalidateByNumber(WindowClass::Player, connection.Player->Id);
     }
 }
@@ -3379,6 +3710,14 @@ int32_t NetworkGetPlayerPing(uint32_t index)
     return network.player_list[index]->Ping;
 }
 
+uint32_t NetworkGetPlayerLastTick(uint32_t index)
+{
+    auto& network = OpenRCT2::GetContext()->GetNetwork();
+    Guard::IndexInRange(index, network.player_list);
+
+    return network.player_list[index]->LastTick;
+}
+
 int32_t NetworkGetPlayerID(uint32_t index)
 {
     auto& network = OpenRCT2::GetContext()->GetNetwork();
@@ -4153,6 +4492,10 @@ int32_t NetworkGetPlayerPing(uint32_t index)
 {
     return 0;
 }
+uint32_t NetworkGetPlayerLastTick(uint32_t index)
+{
+    return 0;
+}
 int32_t NetworkGetPlayerID(uint32_t index)
 {
     return 0;
@@ -11,6 +11,7 @@
 #include "NetworkUser.h"
 
 #include <fstream>
+#include <future>
 #include <memory>
 
 #ifndef DISABLE_NETWORK
@@ -113,6 +114,11 @@ public: // Server
     void ServerHandleGameInfo(NetworkConnection& connection, NetworkPacket& packet);
     void ServerHandleToken(NetworkConnection& connection, NetworkPacket& packet);
     void ServerHandleMapRequest(NetworkConnection& connection, NetworkPacket& packet);
+    void ServerCompleteAuthentication(
+        NetworkConnection& connection, const std::string& gameversion, const std::string& name, const std::string& password);
+    void ServerApplySignatureVerification(
+        NetworkConnection& connection, const std::string& pubkey, bool verified, const std::string& hash);
+    void ProcessAuthVerifications();
 
 public: // Client
     void Reconnect();
@@ -148,6 +154,7 @@ public: // Client
     // Handlers.
     void Client_Handle_AUTH(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_MAP(NetworkConnection& connection, NetworkPacket& packet);
+    void Client_Handle_MAP_CACHED(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_CHAT(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_GAME_ACTION(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_TICK(NetworkConnection& connection, NetworkPacket& packet);
@@ -165,6 +172,8 @@ public: // Client
     void Client_Handle_SCRIPTS_HEADER(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_SCRIPTS_DATA(NetworkConnection& connection, NetworkPacket& packet);
     void Client_Handle_GAMESTATE(NetworkConnection& connection, NetworkPacket& packet);
+    void ClientBeginMapDownload();
+    void ClientCompleteMapDownload(uint32_t totalSize);
 
     std::vector<uint8_t> _challenge;
     std::map<uint32_t, GameAction::Callback_t> _gameActionCallbacks;
@@ -186,6 +195,9 @@ private: // Common Data
     using CommandHandler = void (NetworkBase::*)(NetworkConnection& connection, NetworkPacket& packet);
 
     std::vector<uint8_t> chunk_buffer;
+    // Last fully downloaded map, kept so a later map request can advertise its
+    // block hashes and reuse the blocks the server reports as unchanged.
+    std::vector<uint8_t> _lastMapBuffer;
     std::ofstream _chat_log_fs;
     uint32_t _lastUpdateTime = 0;
     uint32_t _currentDeltaTime = 0;
@@ -204,6 +216,30 @@ private: // Server Data
     std::ofstream _server_log_fs;
     uint16_t listening_port = 0;
     bool _playerListInvalidated = false;
+    // Signature checks of joining clients run on a worker thread over copied
+    // data; results are applied in UpdateServer, so a burst of joins does not
+    // stall the tick for everyone already connected.
+    struct PendingAuthVerification
+    {
+        NetworkConnection* Connection{};
+        // Identity of the connection when the verification was queued. The
+        // pointer alone is not a liveness proof: a freed connection's heap
+        // address can be reused by the next accepted client within the same
+        // update pass.
+        uint64_t ConnectionId{};
+        std::string GameVersion;
+        std::string Name;
+        std::string Password;
+        std::string PubKey;
+        std::future<std::pair<bool, std::string>> Result; // verified, key hash
+    };
+    std::list<PendingAuthVerification> _pendingAuthVerifications;
+    // Serialised map cache so several clients joining on the same tick share a
+    // single export.
+    std::vector<uint8_t> _mapCache;
+    std::vector<const ObjectRepositoryItem*> _mapCacheObjects;
+    uint32_t _mapCacheTick = 0;
+    uint64_t _mapCacheActionCount = 0;
 
 private: // Client Data
     struct PlayerListUpdate
@@ -215,7 +251,10 @@ private: // Client Data
     {
         uint32_t srand0;
         uint32_t tick;
-        std::string spriteHash;
+        std::string peepsHash;
+        std::string vehiclesHash;
+        std::string litterHash;
+        std::string tilesHash;
     };
 
     struct ServerScriptsData
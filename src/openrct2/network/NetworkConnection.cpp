@@ -20,7 +20,16 @@
 constexpr size_t NETWORK_DISCONNECT_REASON_BUFFER_SIZE = 256;
 constexpr size_t NetworkBufferSize = 1024 * 64; // 64 KiB, maximum packet size.
 
+// Chat rate limit: a connection may burst this many messages, then earns one
+// more per interval. Generous for humans, cheap to enforce against floods.
+constexpr uint32_t kChatTokenBurst = 5;
+constexpr uint32_t kChatTokenRefillMs = 1000;
+
+static uint64_t _nextConnectionId = 0;
+
 NetworkConnection::NetworkConnection() noexcept
+    : Id(++_nextConnectionId)
+    , _chatTokens(kChatTokenBurst)
 {
     ResetLastPacketTime();
 }
@@ -94,35 +103,21 @@ NetworkReadPacket NetworkConnection::ReadPacket()
     return NetworkReadPacket::MoreData;
 }
 
-bool NetworkConnection::SendPacket(NetworkPacket& packet)
+void NetworkConnection::SerialisePacket(NetworkPacket& packet)
 {
     auto header = packet.Header;
 
-    std::vector<uint8_t> buffer;
-    buffer.reserve(sizeof(header) + header.Size);
-
     // NOTE: For compatibility reasons for the master server we need to add sizeof(Header.Id) to the size.
     // Previously the Id field was not part of the header rather part of the body.
     header.Size += sizeof(header.Id);
     header.Size = Convert::HostToNetwork(header.Size);
     header.Id = ByteSwapBE(header.Id);
 
-    buffer.insert(buffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
-    buffer.insert(buffer.end(), packet.Data.begin(), packet.Data.end());
-
-    size_t bufferSize = buffer.size() - packet.BytesTransferred;
-    size_t sent = Socket->SendData(buffer.data() + packet.BytesTransferred, bufferSize);
-    if (sent > 0)
-    {
-        packet.BytesTransferred += sent;
-    }
+    _outboundBuffer.insert(
+        _outboundBuffer.end(), reinterpret_cast<uint8_t*>(&header), reinterpret_cast<uint8_t*>(&header) + sizeof(header));
+    _outboundBuffer.insert(_outboundBuffer.end(), packet.Data.begin(), packet.Data.end());
 
-    bool sendComplete = packet.BytesTransferred == buffer.size();
-    if (sendComplete)
-    {
-        RecordPacketStats(packet, true);
-    }
-    return sendComplete;
+    RecordPacketStats(packet, true);
 }
 
 void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
@@ -132,17 +127,10 @@ void NetworkConnection::QueuePacket(NetworkPacket&& packet, bool front)
         packet.Header.Size = static_cast<uint16_t>(packet.Data.size());
         if (front)
         {
-            // If the first packet was already partially sent add new packet to second position
-            if (!_outboundPackets.empty() && _outboundPackets.front().BytesTransferred > 0)
-            {
-                auto it = _outboundPackets.begin();
-                it++; // Second position
-                _outboundPackets.insert(it, std::move(packet));
-            }
-            else
-            {
-                _outboundPackets.push_front(std::move(packet));
-            }
+            // Packets are only serialised wholesale in SendQueuedPackets, so
+            // nothing in the queue is ever partially sent; anything already
+            // serialised stays ahead of this packet regardless.
+            _outboundPackets.push_front(std::move(packet));
         }
         else
         {
@@ -163,9 +151,30 @@ bool NetworkConnection::IsValid() const
 
 void NetworkConnection::SendQueuedPackets()
 {
-    while (!_outboundPackets.empty() && SendPacket(_outboundPackets.front()))
+    // Coalesce every queued packet into the outbound buffer so the backlog
+    // leaves in as few socket writes as possible; with TCP_NODELAY set this
+    // also packs small packets into shared segments.
+    for (auto& packet : _outboundPackets)
+    {
+        SerialisePacket(packet);
+    }
+    _outboundPackets.clear();
+
+    if (_outboundBuffer.empty())
     {
-        _outboundPackets.pop_front();
+        return;
+    }
+
+    size_t remaining = _outboundBuffer.size() - _outboundBufferOffset;
+    size_t sent = Socket->SendData(_outboundBuffer.data() + _outboundBufferOffset, remaining);
+    if (sent > 0)
+    {
+        _outboundBufferOffset += sent;
+    }
+    if (_outboundBufferOffset == _outboundBuffer.size())
+    {
+        _outboundBuffer.clear();
+        _outboundBufferOffset = 0;
     }
 }
 
@@ -185,6 +194,23 @@ bool NetworkConnection::ReceivedPacketRecently() const noexcept
     return true;
 }
 
+bool NetworkConnection::CheckChatRateLimit() noexcept
+{
+    const auto now = Platform::GetTicks();
+    const auto earned = (now - _chatTokensLastRefill) / kChatTokenRefillMs;
+    if (earned > 0)
+    {
+        _chatTokens = std::min<uint32_t>(kChatTokenBurst, _chatTokens + static_cast<uint32_t>(earned));
+        _chatTokensLastRefill = now;
+    }
+    if (_chatTokens == 0)
+    {
+        return false;
+    }
+    _chatTokens--;
+    return true;
+}
+
 const utf8* NetworkConnection::GetLastDisconnectReason() const noexcept
 {
     return this->_lastDisconnectReason.c_str();
@@ -36,7 +36,15 @@ public:
     NetworkKey Key;
     std::vector<uint8_t> Challenge;
     std::vector<const ObjectRepositoryItem*> RequestedObjects;
+    // Block hashes of the map the client already holds from a previous
+    // session, advertised with its map request so unchanged blocks are not
+    // retransmitted.
+    std::vector<uint64_t> AdvertisedMapBlocks;
     bool ShouldDisconnect = false;
+    // Monotonically increasing identity of this connection object. Unlike the
+    // heap address it is never reused, so deferred work queued against a
+    // connection can detect that it has since been replaced.
+    const uint64_t Id;
 
     NetworkConnection() noexcept;
 
@@ -57,17 +65,29 @@ public:
     void ResetLastPacketTime() noexcept;
     bool ReceivedPacketRecently() const noexcept;
 
+    // Token-bucket limit on inbound chat. Returns false when the connection
+    // has exhausted its allowance and the message should be dropped before
+    // any further processing.
+    bool CheckChatRateLimit() noexcept;
+
     const utf8* GetLastDisconnectReason() const noexcept;
     void SetLastDisconnectReason(std::string_view src);
     void SetLastDisconnectReason(const StringId string_id, void* args = nullptr);
 
 private:
     std::deque<NetworkPacket> _outboundPackets;
+    // Wire-format bytes of already serialised packets; the whole backlog is
+    // flushed to the socket with a single send per call rather than one
+    // syscall per packet.
+    std::vector<uint8_t> _outboundBuffer;
+    size_t _outboundBufferOffset = 0;
     uint32_t _lastPacketTime = 0;
+    uint32_t _chatTokens;
+    uint32_t _chatTokensLastRefill = 0;
     std::string _lastDisconnectReason;
 
     void RecordPacketStats(const NetworkPacket& packet, bool sending);
-    bool SendPacket(NetworkPacket& packet);
+    void SerialisePacket(NetworkPacket& packet);
 };
 
 #endif // DISABLE_NETWORK
@@ -25,6 +25,8 @@ public:
     uint8_t Id = 0;
     std::string Name;
     uint16_t Ping = 0;
+    // Latest game tick this client reported in its ping reply; server side only.
+    uint32_t LastTick = 0;
     uint8_t Flags = 0;
     uint8_t Group = 0;
     money64 MoneySpent = 0.00_GBP;
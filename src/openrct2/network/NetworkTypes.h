@@ -22,6 +22,7 @@ enum
 enum
 {
     NETWORK_TICK_FLAG_CHECKSUMS = 1 << 0,
+    NETWORK_TICK_FLAG_TILE_CHECKSUM = 1 << 1,
 };
 
 enum
@@ -83,6 +84,7 @@ enum class NetworkCommand : uint32_t
     ScriptsHeader,
     ScriptsData,
     Heartbeat,
+    MapCached,
     Max,
     Invalid = static_cast<uint32_t>(-1),
 };
@@ -59,6 +59,7 @@ void NetworkFlush();
 [[nodiscard]] const char* NetworkGetPlayerName(uint32_t index);
 [[nodiscard]] uint32_t NetworkGetPlayerFlags(uint32_t index);
 [[nodiscard]] int32_t NetworkGetPlayerPing(uint32_t index);
+[[nodiscard]] uint32_t NetworkGetPlayerLastTick(uint32_t index);
 [[nodiscard]] int32_t NetworkGetPlayerID(uint32_t index);
 [[nodiscard]] money64 NetworkGetPlayerMoneySpent(uint32_t index);
 [[nodiscard]] std::string NetworkGetPlayerIPAddress(uint32_t id);
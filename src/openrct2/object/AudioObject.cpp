@@ -32,7 +32,7 @@ void AudioObject::Load()
         assetManager->LoadSamplesForObject(GetIdentifier(), _loadedSampleTable);
     }
 
-    _loadedSampleTable.Load();
+    // Samples are decoded lazily by GetSample when first triggered
 }
 
 void AudioObject::Unload()
@@ -47,7 +47,7 @@ void AudioObject::ReadJson(IReadObjectContext* context, json_t& root)
     PopulateTablesFromJson(context, root);
 }
 
-IAudioSource* AudioObject::GetSample(uint32_t index) const
+IAudioSource* AudioObject::GetSample(uint32_t index)
 {
     return _loadedSampleTable.GetSample(index);
 }
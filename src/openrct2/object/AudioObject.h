@@ -27,6 +27,6 @@ public:
     void Load() override;
     void Unload() override;
 
-    OpenRCT2::Audio::IAudioSource* GetSample(uint32_t index) const;
+    OpenRCT2::Audio::IAudioSource* GetSample(uint32_t index);
     int32_t GetSampleModifier(uint32_t index) const;
 };
@@ -12,6 +12,7 @@
 #include "../Context.h"
 #include "../PlatformEnvironment.h"
 #include "../audio/AudioContext.h"
+#include "../audio/AudioPrefetch.h"
 #include "../core/File.h"
 #include "../core/Json.hpp"
 #include "../core/Path.hpp"
@@ -20,6 +21,11 @@
 using namespace OpenRCT2;
 using namespace OpenRCT2::Audio;
 
+AudioSampleTable::~AudioSampleTable()
+{
+    Audio::CancelPrefetches(this);
+}
+
 std::vector<AudioSampleTable::Entry>& AudioSampleTable::GetEntries()
 {
     return _entries;
@@ -123,6 +129,7 @@ void AudioSampleTable::Load()
 
 void AudioSampleTable::Unload()
 {
+    Audio::CancelPrefetches(this);
     for (auto& entry : _entries)
     {
         if (entry.Source != nullptr)
@@ -138,15 +145,52 @@ size_t AudioSampleTable::GetCount() const
     return _entries.size();
 }
 
-IAudioSource* AudioSampleTable::GetSample(uint32_t index) const
+IAudioSource* AudioSampleTable::GetSample(uint32_t index)
 {
     if (index < _entries.size())
     {
-        return _entries[index].Source;
+        auto& entry = _entries[index];
+        if (entry.Source == nullptr)
+        {
+            entry.Source = LoadSample(index);
+        }
+        return entry.Source;
     }
     return nullptr;
 }
 
+IAudioSource* AudioSampleTable::TakeOrLoadSample(uint32_t index)
+{
+    if (index < _entries.size())
+    {
+        auto& entry = _entries[index];
+        if (entry.Source != nullptr)
+        {
+            auto* source = entry.Source;
+            entry.Source = nullptr;
+            return source;
+        }
+    }
+    return LoadSample(index);
+}
+
+bool AudioSampleTable::IsSampleLoaded(uint32_t index) const
+{
+    return index < _entries.size() && _entries[index].Source != nullptr;
+}
+
+void AudioSampleTable::InstallSample(uint32_t index, IAudioSource* source)
+{
+    if (index < _entries.size() && _entries[index].Source == nullptr)
+    {
+        _entries[index].Source = source;
+    }
+    else if (source != nullptr)
+    {
+        source->Release();
+    }
+}
+
 IAudioSource* AudioSampleTable::LoadSample(uint32_t index) const
 {
     IAudioSource* result{};
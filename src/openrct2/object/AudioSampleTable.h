@@ -33,6 +33,8 @@ private:
     std::vector<Entry> _entries;
 
 public:
+    ~AudioSampleTable();
+
     std::vector<Entry>& GetEntries();
 
     /**
@@ -56,7 +58,27 @@ public:
     void Unload();
 
     size_t GetCount() const;
-    OpenRCT2::Audio::IAudioSource* GetSample(uint32_t index) const;
+
+    /**
+     * Gets the sample, loading it on first use. Many effect samples never
+     * play at all, so nothing is decoded until a sample is first triggered.
+     */
+    OpenRCT2::Audio::IAudioSource* GetSample(uint32_t index);
     OpenRCT2::Audio::IAudioSource* LoadSample(uint32_t index) const;
+
+    /**
+     * Takes the loaded sample out of the entry if there is one, e.g. placed
+     * there by a background prefetch, otherwise decodes a fresh instance.
+     */
+    OpenRCT2::Audio::IAudioSource* TakeOrLoadSample(uint32_t index);
+
+    bool IsSampleLoaded(uint32_t index) const;
+
+    /**
+     * Installs a sample decoded elsewhere, releasing it instead if the entry
+     * has been loaded in the meantime. Main thread only.
+     */
+    void InstallSample(uint32_t index, OpenRCT2::Audio::IAudioSource* source);
+
     int32_t GetSampleModifier(uint32_t index) const;
 };
@@ -26,6 +26,8 @@
 
 #include <memory>
 #include <stdexcept>
+#include <string_view>
+#include <unordered_map>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
@@ -403,12 +405,9 @@ std::string ImageTable::FindLegacyObject(const std::string& name)
 
 ImageTable::~ImageTable()
 {
-    if (_data == nullptr)
+    for (size_t i = _dataCount; i < _entries.size(); i++)
     {
-        for (auto& entry : _entries)
-        {
-            delete[] entry.offset;
-        }
+        delete[] _entries[i].offset;
     }
 }
 
@@ -472,7 +471,9 @@ void ImageTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream)
         }
 
         _data = std::move(data);
+        _dataSize = dataSize;
         _entries.insert(_entries.end(), newEntries.begin(), newEntries.end());
+        _dataCount = _entries.size();
     }
     catch (const std::exception&)
     {
@@ -605,11 +606,64 @@ bool ImageTable::ReadJson(IReadObjectContext* context, json_t& root)
         }
     }
 
+    PackEntries();
+
     _objDataCache.clear();
 
     return usesFallbackSprites;
 }
 
+void ImageTable::PackEntries()
+{
+    // Parsing allocates each image's pixels separately, leaving thousands of
+    // small heap blocks alive for the object's lifetime. Consolidate them into
+    // a single buffer like the legacy table reader uses, storing byte-identical
+    // images only once; sprite packs commonly repeat frames across objects.
+    if (_data != nullptr || _entries.empty())
+    {
+        return;
+    }
+
+    std::unordered_map<std::string_view, size_t> uniqueOffsets;
+    std::vector<size_t> entryOffsets(_entries.size());
+    size_t totalSize = 0;
+    for (size_t i = 0; i < _entries.size(); i++)
+    {
+        const auto& entry = _entries[i];
+        if (entry.offset == nullptr)
+        {
+            continue;
+        }
+
+        auto length = G1CalculateDataSize(&entry);
+        auto key = std::string_view(reinterpret_cast<const char*>(entry.offset), length);
+        auto [it, inserted] = uniqueOffsets.emplace(key, totalSize);
+        if (inserted)
+        {
+            totalSize += length;
+        }
+        entryOffsets[i] = it->second;
+    }
+
+    auto data = std::make_unique<uint8_t[]>(totalSize);
+    for (const auto& [bytes, offset] : uniqueOffsets)
+    {
+        std::memcpy(data.get() + offset, bytes.data(), bytes.size());
+    }
+    for (size_t i = 0; i < _entries.size(); i++)
+    {
+        auto& entry = _entries[i];
+        if (entry.offset != nullptr)
+        {
+            delete[] entry.offset;
+            entry.offset = data.get() + entryOffsets[i];
+        }
+    }
+    _data = std::move(data);
+    _dataSize = totalSize;
+    _dataCount = _entries.size();
+}
+
 void ImageTable::AddImage(const G1Element* g1)
 {
     G1Element newg1 = *g1;
@@ -26,7 +26,13 @@ class ImageTable
 {
 private:
     std::unique_ptr<uint8_t[]> _data;
+    size_t _dataSize = 0;
     std::vector<G1Element> _entries;
+    // Number of leading entries whose pixel data lives inside _data; any entries
+    // added after packing own their pixel allocations individually.
+    size_t _dataCount = 0;
+
+    void PackEntries();
 
     /**
      * Container for a G1 image, additional information and RAII. Used by ReadJson
@@ -66,5 +72,9 @@ public:
     {
         return static_cast<uint32_t>(_entries.size());
     }
+    size_t GetDataSize() const
+    {
+        return _dataSize;
+    }
     void AddImage(const G1Element* g1);
 };
@@ -14,6 +14,7 @@
 #include "../OpenRCT2.h"
 #include "../PlatformEnvironment.h"
 #include "../audio/AudioContext.h"
+#include "../audio/AudioPrefetch.h"
 #include "../audio/AudioSource.h"
 #include "../core/IStream.hpp"
 #include "../core/Json.hpp"
@@ -217,9 +218,14 @@ const MusicObjectTrack* MusicObject::GetTrack(size_t trackIndex) const
     return {};
 }
 
-IAudioSource* MusicObject::GetTrackSample(size_t trackIndex) const
+IAudioSource* MusicObject::GetTrackSample(size_t trackIndex)
 {
-    return _loadedSampleTable.LoadSample(static_cast<uint32_t>(trackIndex));
+    return _loadedSampleTable.TakeOrLoadSample(static_cast<uint32_t>(trackIndex));
+}
+
+void MusicObject::PrefetchTrack(size_t trackIndex)
+{
+    Audio::PrefetchSample(_loadedSampleTable, static_cast<uint32_t>(trackIndex));
 }
 
 ObjectAsset MusicObject::GetAsset(IReadObjectContext& context, std::string_view path)
@@ -66,7 +66,14 @@ public:
     bool SupportsRideType(ride_type_t rideType);
     size_t GetTrackCount() const;
     const MusicObjectTrack* GetTrack(size_t trackIndex) const;
-    OpenRCT2::Audio::IAudioSource* GetTrackSample(size_t trackIndex) const;
+    OpenRCT2::Audio::IAudioSource* GetTrackSample(size_t trackIndex);
+
+    /**
+     * Queues background decode of the given track so it is ready by the time
+     * the ride becomes audible.
+     */
+    void PrefetchTrack(size_t trackIndex);
+
     constexpr MusicNiceFactor GetNiceFactor() const
     {
         return _niceFactor;
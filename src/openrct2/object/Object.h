@@ -203,10 +203,6 @@ protected:
     {
         return _stringTable;
     }
-    const StringTable& GetStringTable() const
-    {
-        return _stringTable;
-    }
     ImageTable& GetImageTable()
     {
         return _imageTable;
@@ -318,6 +314,10 @@ public:
     {
         return _imageTable;
     }
+    const StringTable& GetStringTable() const
+    {
+        return _stringTable;
+    }
 
     ObjectEntryDescriptor GetScgPathXHeader() const;
     RCTObjectEntry CreateHeader(const char name[9], uint32_t flags, uint32_t checksum);
@@ -0,0 +1,66 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "ObjectLoadStats.h"
+
+#include "../core/Json.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
+namespace OpenRCT2::ObjectLoadStats
+{
+    // Object loading runs on multiple worker threads
+    static std::mutex _statsMutex;
+    static std::unordered_map<std::string, ObjectStats> _stats;
+
+    void Record(std::string identifier, uint64_t loadTimeUs, uint64_t imageBytes, uint64_t stringBytes)
+    {
+        std::lock_guard<std::mutex> guard(_statsMutex);
+        auto& entry = _stats[identifier];
+        entry.Identifier = std::move(identifier);
+        entry.LoadTimeUs = loadTimeUs;
+        entry.ImageBytes = imageBytes;
+        entry.StringBytes = stringBytes;
+    }
+
+    std::vector<ObjectStats> GetAll()
+    {
+        std::vector<ObjectStats> result;
+        {
+            std::lock_guard<std::mutex> guard(_statsMutex);
+            result.reserve(_stats.size());
+            for (const auto& [identifier, stats] : _stats)
+            {
+                result.push_back(stats);
+            }
+        }
+        std::sort(result.begin(), result.end(), [](const ObjectStats& a, const ObjectStats& b) {
+            return a.LoadTimeUs > b.LoadTimeUs;
+        });
+        return result;
+    }
+
+    std::string ToJson()
+    {
+        json_t jsonStats = json_t::array();
+        for (const auto& stats : GetAll())
+        {
+            json_t jsonObject = {
+                { "identifier", stats.Identifier },
+                { "loadTimeUs", stats.LoadTimeUs },
+                { "imageBytes", stats.ImageBytes },
+                { "stringBytes", stats.StringBytes },
+            };
+            jsonStats.push_back(jsonObject);
+        }
+        return jsonStats.dump();
+    }
+} // namespace OpenRCT2::ObjectLoadStats
@@ -0,0 +1,34 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace OpenRCT2::ObjectLoadStats
+{
+    struct ObjectStats
+    {
+        std::string Identifier;
+        uint64_t LoadTimeUs{};
+        uint64_t ImageBytes{};
+        uint64_t StringBytes{};
+    };
+
+    void Record(std::string identifier, uint64_t loadTimeUs, uint64_t imageBytes, uint64_t stringBytes);
+
+    /**
+     * Returns the stats of every object loaded this session, slowest first.
+     */
+    std::vector<ObjectStats> GetAll();
+
+    std::string ToJson();
+} // namespace OpenRCT2::ObjectLoadStats
@@ -36,7 +36,9 @@
 #include <array>
 #include <memory>
 #include <mutex>
+#include <deque>
 #include <thread>
+#include <unordered_map>
 #include <unordered_set>
 
 using namespace OpenRCT2;
@@ -55,9 +57,20 @@ struct ObjectToLoad
 class ObjectManager final : public IObjectManager
 {
 private:
+    // Maximum number of unloaded objects to keep alive for reuse by a later park.
+    static constexpr size_t kMaxRetainedObjects = 1024;
+
     IObjectRepository& _objectRepository;
 
     std::array<std::vector<Object*>, EnumValue(ObjectType::Count)> _loadedObjects;
+
+    // Transient objects retired by the last park switch. They stay fully loaded
+    // so that a subsequent park which references them again can revive them
+    // instead of reading and constructing them from scratch. Keyed by the
+    // object descriptor; _retiredOrder tracks retirement order for eviction and
+    // may contain keys that have since been revived.
+    std::unordered_map<std::string, std::shared_ptr<Object>> _retiredObjects;
+    std::deque<std::string> _retiredOrder;
     std::array<std::vector<ObjectEntryIndex>, RIDE_TYPE_COUNT> _rideTypeToObjectMap;
 
     // Used to return a safe empty vector back from GetAllRideEntries, can be removed when std::span is available
@@ -239,6 +252,9 @@ public:
 
     void ResetObjects() override
     {
+        // Retired objects would keep image and string allocations made before
+        // the reset, so they cannot be revived afterwards.
+        FlushRetiredObjects();
         for (auto& list : _loadedObjects)
         {
             for (auto* loadedObject : list)
@@ -323,11 +339,22 @@ private:
                 auto& list = GetObjectList(type);
                 for (auto* loadedObject : list)
                 {
-                    UnloadObject(loadedObject);
+                    if (onlyTransient)
+                    {
+                        RetireObject(loadedObject);
+                    }
+                    else
+                    {
+                        UnloadObject(loadedObject);
+                    }
                 }
                 list.clear();
             }
         }
+        if (!onlyTransient)
+        {
+            FlushRetiredObjects();
+        }
         UpdateSceneryGroupIndexes();
         ResetTypeToRideEntryIndexMap();
     }
@@ -432,6 +459,77 @@ private:
         }
     }
 
+    /**
+     * Removes the object from the entry lists and the repository registration,
+     * but keeps the instance loaded so a later park can revive it. Consecutive
+     * parks often share most of their objects, so this avoids reconstructing
+     * them on every switch.
+     */
+    void RetireObject(Object* object)
+    {
+        if (object == nullptr)
+            return;
+
+        const auto* ori = _objectRepository.FindObject(object->GetDescriptor());
+        if (ori == nullptr || ori->LoadedObject.get() != object)
+        {
+            // Not the registered instance, so it cannot be revived later
+            UnloadObject(object);
+            return;
+        }
+
+        auto retired = ori->LoadedObject;
+        _objectRepository.UnregisterLoadedObject(ori, object);
+
+        // Clear every slot the object occupies; revival assigns fresh slots
+        auto& list = GetObjectList(object->GetObjectType());
+        std::replace(list.begin(), list.end(), object, static_cast<Object*>(nullptr));
+
+        auto [it, inserted] = _retiredObjects.emplace(object->GetDescriptor().ToString(), std::move(retired));
+        if (inserted)
+        {
+            _retiredOrder.push_back(it->first);
+            EvictRetiredObjects(kMaxRetainedObjects);
+        }
+        else
+        {
+            object->Unload();
+        }
+    }
+
+    std::shared_ptr<Object> ReviveObject(const ObjectEntryDescriptor& descriptor)
+    {
+        auto it = _retiredObjects.find(descriptor.ToString());
+        if (it == _retiredObjects.end())
+            return nullptr;
+
+        auto object = std::move(it->second);
+        _retiredObjects.erase(it);
+        return object;
+    }
+
+    void EvictRetiredObjects(size_t maxCount)
+    {
+        while (_retiredObjects.size() > maxCount)
+        {
+            // Oldest first; keys revived in the meantime are simply skipped
+            auto key = std::move(_retiredOrder.front());
+            _retiredOrder.pop_front();
+            auto it = _retiredObjects.find(key);
+            if (it != _retiredObjects.end())
+            {
+                it->second->Unload();
+                _retiredObjects.erase(it);
+            }
+        }
+    }
+
+    void FlushRetiredObjects()
+    {
+        EvictRetiredObjects(0);
+        _retiredOrder.clear();
+    }
+
     void UnloadObjectsExcept(const std::vector<Object*>& newLoadedObjects)
     {
         // Build a hash set for quick checking
@@ -460,7 +558,7 @@ private:
                     totalObjectsLoaded++;
                     if (exceptSet.find(object) == exceptSet.end())
                     {
-                        UnloadObject(object);
+                        RetireObject(object);
                         object = nullptr;
                         numObjectsUnloaded++;
                     }
@@ -471,7 +569,8 @@ private:
         LOG_VERBOSE("%u / %u objects unloaded", numObjectsUnloaded, totalObjectsLoaded);
     }
 
-    template<typename T> void UpdateSceneryGroupIndexes(ObjectType type)
+    template<typename T>
+    void UpdateSceneryGroupIndexes(ObjectType type, const std::unordered_map<const Object*, ObjectEntryIndex>& entryIndexMap)
     {
         auto& list = GetObjectList(type);
         for (auto* loadedObject : list)
@@ -479,18 +578,40 @@ private:
             if (loadedObject != nullptr)
             {
                 auto* sceneryEntry = static_cast<T*>(loadedObject->GetLegacyData());
-                sceneryEntry->scenery_tab_id = GetPrimarySceneryGroupEntryIndex(loadedObject);
+                sceneryEntry->scenery_tab_id = GetPrimarySceneryGroupEntryIndex(loadedObject, entryIndexMap);
             }
         }
     }
 
+    // Builds a reverse map of loaded object to entry index; resolving group
+    // membership through GetLoadedObjectEntryIndex instead would rescan the
+    // object lists for every member.
+    std::unordered_map<const Object*, ObjectEntryIndex> BuildEntryIndexMap()
+    {
+        std::unordered_map<const Object*, ObjectEntryIndex> result;
+        for (auto objectType : getAllObjectTypes())
+        {
+            auto& list = GetObjectList(objectType);
+            for (size_t i = 0; i < list.size(); i++)
+            {
+                if (list[i] != nullptr)
+                {
+                    // Keep the first slot when an object occupies several
+                    result.emplace(list[i], static_cast<ObjectEntryIndex>(i));
+                }
+            }
+        }
+        return result;
+    }
+
     void UpdateSceneryGroupIndexes()
     {
-        UpdateSceneryGroupIndexes<SmallSceneryEntry>(ObjectType::SmallScenery);
-        UpdateSceneryGroupIndexes<LargeSceneryEntry>(ObjectType::LargeScenery);
-        UpdateSceneryGroupIndexes<WallSceneryEntry>(ObjectType::Walls);
-        UpdateSceneryGroupIndexes<BannerSceneryEntry>(ObjectType::Banners);
-        UpdateSceneryGroupIndexes<PathAdditionEntry>(ObjectType::PathAdditions);
+        auto entryIndexMap = BuildEntryIndexMap();
+        UpdateSceneryGroupIndexes<SmallSceneryEntry>(ObjectType::SmallScenery, entryIndexMap);
+        UpdateSceneryGroupIndexes<LargeSceneryEntry>(ObjectType::LargeScenery, entryIndexMap);
+        UpdateSceneryGroupIndexes<WallSceneryEntry>(ObjectType::Walls, entryIndexMap);
+        UpdateSceneryGroupIndexes<BannerSceneryEntry>(ObjectType::Banners, entryIndexMap);
+        UpdateSceneryGroupIndexes<PathAdditionEntry>(ObjectType::PathAdditions, entryIndexMap);
 
         auto& list = GetObjectList(ObjectType::SceneryGroup);
         for (auto* loadedObject : list)
@@ -498,7 +619,7 @@ private:
             auto sgObject = static_cast<SceneryGroupObject*>(loadedObject);
             if (sgObject != nullptr)
             {
-                sgObject->UpdateEntryIndexes();
+                sgObject->UpdateEntryIndexes(entryIndexMap);
             }
         }
 
@@ -507,7 +628,8 @@ private:
         WindowCloseByClass(WindowClass::Scenery);
     }
 
-    ObjectEntryIndex GetPrimarySceneryGroupEntryIndex(Object* loadedObject)
+    ObjectEntryIndex GetPrimarySceneryGroupEntryIndex(
+        Object* loadedObject, const std::unordered_map<const Object*, ObjectEntryIndex>& entryIndexMap)
     {
         auto* sceneryObject = dynamic_cast<SceneryObject*>(loadedObject);
         const auto& primarySGEntry = sceneryObject->GetPrimarySceneryGroup();
@@ -516,7 +638,11 @@ private:
         auto entryIndex = OBJECT_ENTRY_INDEX_NULL;
         if (sgObject != nullptr)
         {
-            entryIndex = GetLoadedObjectEntryIndex(sgObject);
+            auto kvp = entryIndexMap.find(sgObject);
+            if (kvp != entryIndexMap.end())
+            {
+                entryIndex = kvp->second;
+            }
         }
         return entryIndex;
     }
@@ -588,7 +714,17 @@ private:
             auto* loadedObject = repositoryItem->LoadedObject.get();
             if (loadedObject == nullptr)
             {
-                objectsToLoad.push_back(repositoryItem);
+                // Consecutive parks usually share most of their objects, so
+                // revive a retired instance rather than loading it again.
+                auto revived = ReviveObject(ObjectEntryDescriptor(*repositoryItem));
+                if (revived != nullptr)
+                {
+                    _objectRepository.RegisterLoadedObject(repositoryItem, std::move(revived));
+                }
+                else
+                {
+                    objectsToLoad.push_back(repositoryItem);
+                }
             }
         }
 
@@ -708,6 +844,15 @@ private:
         if (loadedObject != nullptr)
             return loadedObject;
 
+        // Revive a retired instance if we have one, it is still loaded
+        auto revived = ReviveObject(ObjectEntryDescriptor(*ori));
+        if (revived != nullptr)
+        {
+            loadedObject = revived.get();
+            _objectRepository.RegisterLoadedObject(ori, std::move(revived));
+            return loadedObject;
+        }
+
         // Try to load object
         auto object = _objectRepository.LoadObject(ori);
         if (object != nullptr)
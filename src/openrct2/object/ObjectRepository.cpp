@@ -28,6 +28,7 @@
 #include "../object/Object.h"
 #include "../park/Legacy.h"
 #include "../platform/Platform.h"
+#include "../profiling/AllocationTracker.h"
 #include "../rct12/SawyerChunkReader.h"
 #include "../rct12/SawyerChunkWriter.h"
 #include "../scenario/ScenarioRepository.h"
@@ -36,9 +37,11 @@
 #include "Object.h"
 #include "ObjectFactory.h"
 #include "ObjectList.h"
+#include "ObjectLoadStats.h"
 #include "ObjectManager.h"
 #include "RideObject.h"
 
+#include <chrono>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -263,20 +266,38 @@ public:
     {
         Guard::ArgumentNotNull(ori, GUARD_LINE);
 
+        AllocationTracker::TagScope allocScope(AllocationTracker::AllocTag::ObjectLoad);
+        auto startTime = std::chrono::steady_clock::now();
+
+        std::unique_ptr<Object> object;
         auto extension = Path::GetExtension(ori->Path);
         if (String::IEquals(extension, ".json"))
         {
-            return ObjectFactory::CreateObjectFromJsonFile(*this, ori->Path, !gOpenRCT2NoGraphics);
+            object = ObjectFactory::CreateObjectFromJsonFile(*this, ori->Path, !gOpenRCT2NoGraphics);
         }
-        if (String::IEquals(extension, ".parkobj"))
+        else if (String::IEquals(extension, ".parkobj"))
         {
-            return ObjectFactory::CreateObjectFromZipFile(*this, ori->Path, !gOpenRCT2NoGraphics);
+            object = ObjectFactory::CreateObjectFromZipFile(*this, ori->Path, !gOpenRCT2NoGraphics);
+        }
+        else
+        {
+            object = ObjectFactory::CreateObjectFromLegacyFile(*this, ori->Path.c_str(), !gOpenRCT2NoGraphics);
         }
 
-        return ObjectFactory::CreateObjectFromLegacyFile(*this, ori->Path.c_str(), !gOpenRCT2NoGraphics);
+        if (object != nullptr)
+        {
+            auto loadTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(
+                                  std::chrono::steady_clock::now() - startTime)
+                                  .count();
+            const auto& constObject = *object;
+            ObjectLoadStats::Record(
+                ObjectEntryDescriptor(*ori).ToString(), static_cast<uint64_t>(loadTimeUs),
+                constObject.GetImageTable().GetDataSize(), constObject.GetStringTable().GetDataSize());
+        }
+        return object;
     }
 
-    void RegisterLoadedObject(const ObjectRepositoryItem* ori, std::unique_ptr<Object>&& object) override
+    void RegisterLoadedObject(const ObjectRepositoryItem* ori, std::shared_ptr<Object>&& object) override
     {
         ObjectRepositoryItem* item = &_items[ori->Id];
 
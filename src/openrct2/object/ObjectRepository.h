@@ -90,7 +90,7 @@ struct IObjectRepository
     [[nodiscard]] virtual const ObjectRepositoryItem* FindObject(const ObjectEntryDescriptor& oed) const = 0;
 
     [[nodiscard]] virtual std::unique_ptr<Object> LoadObject(const ObjectRepositoryItem* ori) = 0;
-    virtual void RegisterLoadedObject(const ObjectRepositoryItem* ori, std::unique_ptr<Object>&& object) = 0;
+    virtual void RegisterLoadedObject(const ObjectRepositoryItem* ori, std::shared_ptr<Object>&& object) = 0;
     virtual void UnregisterLoadedObject(const ObjectRepositoryItem* ori, Object* object) = 0;
 
     virtual void AddObject(const RCTObjectEntry* objectEntry, const void* data, size_t dataSize) = 0;
@@ -97,11 +97,10 @@ static std::optional<uint8_t> GetSceneryType(const ObjectType type)
     }
 }
 
-void SceneryGroupObject::UpdateEntryIndexes()
+void SceneryGroupObject::UpdateEntryIndexes(const std::unordered_map<const Object*, ObjectEntryIndex>& entryIndexMap)
 {
     auto context = GetContext();
     auto& objectRepository = context->GetObjectRepository();
-    auto& objectManager = context->GetObjectManager();
 
     _legacyType.SceneryEntries.clear();
     for (const auto& objectEntry : _items)
@@ -112,13 +111,14 @@ void SceneryGroupObject::UpdateEntryIndexes()
         if (ori->LoadedObject == nullptr)
             continue;
 
-        auto entryIndex = objectManager.GetLoadedObjectEntryIndex(ori->LoadedObject.get());
-        if (entryIndex == OBJECT_ENTRY_INDEX_NULL)
+        auto kvp = entryIndexMap.find(ori->LoadedObject.get());
+        if (kvp == entryIndexMap.end())
         {
             // Some parks have manually deleted objects from the save so they might not be loaded
             // silently remove the object from the SceneryGroupObject
             continue;
         }
+        auto entryIndex = kvp->second;
 
         auto sceneryType = GetSceneryType(ori->Type);
         if (sceneryType.has_value())
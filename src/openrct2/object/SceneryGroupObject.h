@@ -12,6 +12,7 @@
 #include "Object.h"
 #include "SceneryGroupEntry.h"
 
+#include <unordered_map>
 #include <vector>
 
 struct ObjectRepositoryItem;
@@ -34,7 +35,11 @@ public:
     void ReadLegacy(IReadObjectContext* context, OpenRCT2::IStream* stream) override;
     void Load() override;
     void Unload() override;
-    void UpdateEntryIndexes();
+    /**
+     * Resolves the group's members against the given reverse map of loaded
+     * object to entry index, so membership does not rescan the object lists.
+     */
+    void UpdateEntryIndexes(const std::unordered_map<const Object*, ObjectEntryIndex>& entryIndexMap);
 
     void DrawPreview(DrawPixelInfo& dpi, int32_t width, int32_t height) const override;
 
@@ -17,6 +17,22 @@
 #include "../rct12/CSStringConverter.h"
 #include "Object.h"
 
+#include <mutex>
+#include <unordered_set>
+
+// Process-wide intern pool for object strings. Interned strings are never
+// freed so entries stay valid for the lifetime of the process; object loading
+// runs on multiple threads, hence the mutex. Insertion does not invalidate
+// references to existing elements.
+static std::mutex _internMutex;
+static std::unordered_set<std::string> _internedStrings;
+
+static const std::string* InternString(std::string&& text)
+{
+    std::lock_guard<std::mutex> guard(_internMutex);
+    return &*_internedStrings.insert(std::move(text)).first;
+}
+
 static constexpr uint8_t RCT2ToOpenRCT2LanguageId[] = {
     LANGUAGE_ENGLISH_UK,
     LANGUAGE_ENGLISH_US,
@@ -65,7 +81,7 @@ void StringTable::Read(IReadObjectContext* context, OpenRCT2::IStream* stream, O
                 StringTableEntry entry{};
                 entry.Id = id;
                 entry.LanguageId = languageId;
-                entry.Text = std::move(stringAsUtf8);
+                entry.Text = InternString(std::move(stringAsUtf8));
                 _strings.push_back(std::move(entry));
             }
         }
@@ -123,7 +139,7 @@ std::string StringTable::GetString(ObjectStringID id) const
     {
         if (string.Id == id)
         {
-            return string.Text;
+            return *string.Text;
         }
     }
     return std::string();
@@ -135,18 +151,28 @@ std::string StringTable::GetString(uint8_t language, ObjectStringID id) const
     {
         if (string.LanguageId == language && string.Id == id)
         {
-            return string.Text;
+            return *string.Text;
         }
     }
     return std::string();
 }
 
+size_t StringTable::GetDataSize() const
+{
+    size_t result = 0;
+    for (const auto& string : _strings)
+    {
+        result += string.Text->size();
+    }
+    return result;
+}
+
 void StringTable::SetString(ObjectStringID id, uint8_t language, const std::string& text)
 {
     StringTableEntry entry;
     entry.Id = id;
     entry.LanguageId = language;
-    entry.Text = text;
+    entry.Text = InternString(std::string(text));
     _strings.push_back(std::move(entry));
 }
 
@@ -158,7 +184,12 @@ void StringTable::Sort()
         {
             if (a.LanguageId == b.LanguageId)
             {
-                return String::Compare(a.Text, b.Text, true) < 0;
+                // Interned strings make equality a pointer compare
+                if (a.Text == b.Text)
+                {
+                    return false;
+                }
+                return String::Compare(*a.Text, *b.Text, true) < 0;
             }
 
             for (const auto& language : languageOrder)
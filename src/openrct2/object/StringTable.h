@@ -37,7 +37,9 @@ struct StringTableEntry
 {
     ObjectStringID Id = ObjectStringID::UNKNOWN;
     uint8_t LanguageId = LANGUAGE_UNDEFINED;
-    std::string Text;
+    // Points into the process-wide intern pool; most strings repeat across
+    // object variants so entries share one stored copy. Never null.
+    const std::string* Text = nullptr;
 };
 
 class StringTable
@@ -59,5 +61,6 @@ public:
     void Sort();
     std::string GetString(ObjectStringID id) const;
     std::string GetString(uint8_t language, ObjectStringID id) const;
+    size_t GetDataSize() const;
     void SetString(ObjectStringID id, uint8_t language, const std::string& text);
 };
@@ -29,9 +29,73 @@
 #include "../world/MapAnimation.h"
 #include "../world/Park.h"
 #include "Paint.h"
+#include "PaintStats.h"
 
+#include <algorithm>
 #include <cassert>
 
+static void PaintSingleEntity(PaintSession& session, EntityBase* spr, const CoordsXYZ& entityPos)
+{
+    int32_t image_direction = session.CurrentRotation;
+    image_direction <<= 3;
+    image_direction += spr->Orientation;
+    image_direction &= 0x1F;
+
+    session.CurrentlyDrawnEntity = spr;
+    session.SpritePosition.x = entityPos.x;
+    session.SpritePosition.y = entityPos.y;
+    session.InteractionType = ViewportInteractionItem::Entity;
+
+    OpenRCT2::Paint::PaintStatsTimer statsTimer(OpenRCT2::Paint::PaintStatCategory::Entity);
+    switch (spr->Type)
+    {
+        case EntityType::Vehicle:
+            spr->As<Vehicle>()->Paint(session, image_direction);
+            if (LightFXForVehiclesIsAvailable())
+            {
+                LightFXAddLightsMagicVehicle(spr->As<Vehicle>());
+            }
+            break;
+        case EntityType::Guest:
+        case EntityType::Staff:
+            spr->As<Peep>()->Paint(session, image_direction);
+            break;
+        case EntityType::SteamParticle:
+            spr->As<SteamParticle>()->Paint(session, image_direction);
+            break;
+        case EntityType::MoneyEffect:
+            spr->As<MoneyEffect>()->Paint(session, image_direction);
+            break;
+        case EntityType::CrashedVehicleParticle:
+            spr->As<VehicleCrashParticle>()->Paint(session, image_direction);
+            break;
+        case EntityType::ExplosionCloud:
+            spr->As<ExplosionCloud>()->Paint(session, image_direction);
+            break;
+        case EntityType::CrashSplash:
+            spr->As<CrashSplashParticle>()->Paint(session, image_direction);
+            break;
+        case EntityType::ExplosionFlare:
+            spr->As<ExplosionFlare>()->Paint(session, image_direction);
+            break;
+        case EntityType::JumpingFountain:
+            spr->As<JumpingFountain>()->Paint(session, image_direction);
+            break;
+        case EntityType::Balloon:
+            spr->As<Balloon>()->Paint(session, image_direction);
+            break;
+        case EntityType::Duck:
+            spr->As<Duck>()->Paint(session, image_direction);
+            break;
+        case EntityType::Litter:
+            spr->As<Litter>()->Paint(session, image_direction);
+            break;
+        default:
+            assert(false);
+            break;
+    }
+}
+
 /**
  * Paint Quadrant
  *  rct2: 0x0069E8B0
@@ -54,8 +118,67 @@ void EntityPaintSetup(PaintSession& session, const CoordsXY& pos)
         return;
     }
 
+    if (GetEntityTileList(pos).empty())
+    {
+        return;
+    }
+
+    // Bulk-reject the whole tile when the conservative bounds over its
+    // entities cannot intersect the target area, so crowded but offscreen
+    // tiles never iterate their entity lists.
+    const auto& tileBounds = GetEntityTileBounds(pos);
+    {
+        const auto baseCoords = Translate3DTo2DWithZ(session.CurrentRotation, CoordsXYZ{ pos, 0 });
+        const auto tileRect = ScreenRect(
+            baseCoords - ScreenCoordsXY{ 64 + tileBounds.MaxWidth, 32 + tileBounds.MaxZ + tileBounds.MaxHeightMin },
+            baseCoords + ScreenCoordsXY{ 64 + tileBounds.MaxWidth, 32 - tileBounds.MinZ + tileBounds.MaxHeightMax });
+
+        if (session.DPI.y + session.DPI.height <= tileRect.GetTop() || tileRect.GetBottom() <= session.DPI.y
+            || session.DPI.x + session.DPI.width <= tileRect.GetLeft() || tileRect.GetRight() <= session.DPI.x)
+        {
+            return;
+        }
+    }
+
     const bool highlightPathIssues = (session.ViewFlags & VIEWPORT_FLAG_HIGHLIGHT_PATH_ISSUES);
 
+    // Entity LOD: beyond the configured zoom level a guest covers only a
+    // couple of pixels, so a tile full of them collapses into one
+    // representative sprite - a crowded tile still reads as crowded while the
+    // remaining guests skip projection and paint entirely.
+    const bool clusterGuests = session.DPI.zoom_level
+        > ZoomLevel{ static_cast<int8_t>(std::clamp(session.Config.EntityLodZoomLevel, 0, 2)) };
+    bool tileGuestPainted = false;
+
+    // Project the tile's candidates in batches so the screen bounds tests run
+    // as one linear sweep over flat arrays rather than a scattered transform
+    // and branch per entity, then paint the survivors in list order.
+    constexpr size_t kEntityBatchSize = 64;
+    EntityBase* candidates[kEntityBatchSize];
+    CoordsXYZ worldPositions[kEntityBatchSize];
+    ScreenCoordsXY screenPositions[kEntityBatchSize];
+    size_t numCandidates = 0;
+
+    auto paintBatch = [&]() {
+        Translate3DTo2DWithZBatch(session.CurrentRotation, worldPositions, screenPositions, numCandidates);
+        for (size_t i = 0; i < numCandidates; i++)
+        {
+            auto* spr = candidates[i];
+            const auto spriteRect = ScreenRect(
+                screenPositions[i] - ScreenCoordsXY{ spr->SpriteData.Width, spr->SpriteData.HeightMin },
+                screenPositions[i] + ScreenCoordsXY{ spr->SpriteData.Width, spr->SpriteData.HeightMax });
+
+            if (session.DPI.y + session.DPI.height <= spriteRect.GetTop() || spriteRect.GetBottom() <= session.DPI.y
+                || session.DPI.x + session.DPI.width <= spriteRect.GetLeft() || spriteRect.GetRight() <= session.DPI.x)
+            {
+                continue;
+            }
+
+            PaintSingleEntity(session, spr, worldPositions[i]);
+        }
+        numCandidates = 0;
+    };
+
     for (auto* spr : EntityTileList(pos))
     {
         if (highlightPathIssues)
@@ -74,6 +197,15 @@ void EntityPaintSetup(PaintSession& session, const CoordsXY& pos)
             }
         }
 
+        if (clusterGuests && spr->Type == EntityType::Guest)
+        {
+            if (tileGuestPainted)
+            {
+                continue;
+            }
+            tileGuestPainted = true;
+        }
+
         const auto entityPos = spr->GetLocation();
 
         // Only paint sprites that are below the clip height and inside the clip selection.
@@ -96,73 +228,13 @@ void EntityPaintSetup(PaintSession& session, const CoordsXY& pos)
             }
         }
 
-        auto screenCoords = Translate3DTo2DWithZ(session.CurrentRotation, spr->GetLocation());
-        auto spriteRect = ScreenRect(
-            screenCoords - ScreenCoordsXY{ spr->SpriteData.Width, spr->SpriteData.HeightMin },
-            screenCoords + ScreenCoordsXY{ spr->SpriteData.Width, spr->SpriteData.HeightMax });
-
-        if (session.DPI.y + session.DPI.height <= spriteRect.GetTop() || spriteRect.GetBottom() <= session.DPI.y
-            || session.DPI.x + session.DPI.width <= spriteRect.GetLeft() || spriteRect.GetRight() <= session.DPI.x)
-        {
-            continue;
-        }
-
-        int32_t image_direction = session.CurrentRotation;
-        image_direction <<= 3;
-        image_direction += spr->Orientation;
-        image_direction &= 0x1F;
-
-        session.CurrentlyDrawnEntity = spr;
-        session.SpritePosition.x = entityPos.x;
-        session.SpritePosition.y = entityPos.y;
-        session.InteractionType = ViewportInteractionItem::Entity;
-
-        switch (spr->Type)
+        candidates[numCandidates] = spr;
+        worldPositions[numCandidates] = entityPos;
+        numCandidates++;
+        if (numCandidates == kEntityBatchSize)
         {
-            case EntityType::Vehicle:
-                spr->As<Vehicle>()->Paint(session, image_direction);
-                if (LightFXForVehiclesIsAvailable())
-                {
-                    LightFXAddLightsMagicVehicle(spr->As<Vehicle>());
-                }
-                break;
-            case EntityType::Guest:
-            case EntityType::Staff:
-                spr->As<Peep>()->Paint(session, image_direction);
-                break;
-            case EntityType::SteamParticle:
-                spr->As<SteamParticle>()->Paint(session, image_direction);
-                break;
-            case EntityType::MoneyEffect:
-                spr->As<MoneyEffect>()->Paint(session, image_direction);
-                break;
-            case EntityType::CrashedVehicleParticle:
-                spr->As<VehicleCrashParticle>()->Paint(session, image_direction);
-                break;
-            case EntityType::ExplosionCloud:
-                spr->As<ExplosionCloud>()->Paint(session, image_direction);
-                break;
-            case EntityType::CrashSplash:
-                spr->As<CrashSplashParticle>()->Paint(session, image_direction);
-                break;
-            case EntityType::ExplosionFlare:
-                spr->As<ExplosionFlare>()->Paint(session, image_direction);
-                break;
-            case EntityType::JumpingFountain:
-                spr->As<JumpingFountain>()->Paint(session, image_direction);
-                break;
-            case EntityType::Balloon:
-                spr->As<Balloon>()->Paint(session, image_direction);
-                break;
-            case EntityType::Duck:
-                spr->As<Duck>()->Paint(session, image_direction);
-                break;
-            case EntityType::Litter:
-                spr->As<Litter>()->Paint(session, image_direction);
-                break;
-            default:
-                assert(false);
-                break;
+            paintBatch();
         }
     }
+    paintBatch();
 }
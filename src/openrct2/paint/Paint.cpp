@@ -28,6 +28,9 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <limits>
+#include <utility>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -36,6 +39,24 @@ uint8_t gClipHeight = 128; // Default to middle value
 CoordsXY gClipSelectionA = { 0, 0 };
 CoordsXY gClipSelectionB = { MAXIMUM_TILE_START_XY, MAXIMUM_TILE_START_XY };
 
+static PaintConfigSnapshot _paintConfigSnapshot{};
+static uint32_t _paintConfigGeneration = std::numeric_limits<uint32_t>::max();
+
+const PaintConfigSnapshot& GetPaintConfigSnapshot()
+{
+    // Refreshed lazily against the config generation, so option changes take
+    // effect on the next created session without per-field re-reads here.
+    const auto generation = Config::GetGeneration();
+    if (_paintConfigGeneration != generation)
+    {
+        const auto& general = Config::Get().general;
+        _paintConfigSnapshot = { general.PaintFlatSort,    general.UpperCaseBanners,  general.LandscapeSmoothing,
+                                 general.TransparentWater, general.VirtualFloorStyle, general.EntityLodZoomLevel };
+        _paintConfigGeneration = generation;
+    }
+    return _paintConfigSnapshot;
+}
+
 static constexpr uint8_t BoundBoxDebugColours[] = {
     0,   // NONE
     102, // TERRAIN
@@ -508,6 +529,207 @@ constexpr std::array _paintArrangeFuncs = {
     PaintSessionArrangeImpl<3>,
 };
 
+// Alternative arrangement engine that gathers the quadrant buckets into flat
+// arrays before sorting. The sort itself is the same partial order as the
+// classic engine (a pure key sort cannot express the pairwise bounding box
+// relation), but the bounds and links live in contiguous scratch storage so
+// the comparison loop does not chase cold PaintStruct pointers.
+namespace
+{
+    constexpr int32_t kFlatNullIndex = -1;
+
+    struct FlatArrangeScratch
+    {
+        std::vector<PaintStruct*> Entries;
+        std::vector<PaintStructBoundBox> Bounds;
+        std::vector<uint16_t> Quadrant;
+        std::vector<uint8_t> Flags;
+        std::vector<int32_t> Next;
+    };
+
+    // Columns are arranged in parallel, so each worker gets its own scratch.
+    thread_local FlatArrangeScratch _flatArrangeScratch;
+} // namespace
+
+static int32_t FlatFirstInQuadrant(const FlatArrangeScratch& s, int32_t psNext, uint16_t quadrantIndex)
+{
+    int32_t ps;
+    do
+    {
+        ps = psNext;
+        psNext = s.Next[psNext];
+        if (psNext == kFlatNullIndex)
+            return ps;
+    } while (quadrantIndex > s.Quadrant[psNext]);
+    return ps;
+}
+
+static void FlatInitializeSort(FlatArrangeScratch& s, int32_t ps, uint16_t quadrantIndex, uint8_t flag)
+{
+    do
+    {
+        ps = s.Next[ps];
+        if (ps == kFlatNullIndex)
+            break;
+
+        if (s.Quadrant[ps] > quadrantIndex + 1)
+        {
+            s.Flags[ps] = PaintSortFlags::OutsideQuadrant;
+        }
+        else if (s.Quadrant[ps] == quadrantIndex + 1)
+        {
+            s.Flags[ps] = PaintSortFlags::Neighbour | PaintSortFlags::PendingVisit;
+        }
+        else if (s.Quadrant[ps] == quadrantIndex)
+        {
+            s.Flags[ps] = flag | PaintSortFlags::PendingVisit;
+        }
+    } while (s.Quadrant[ps] <= quadrantIndex + 1);
+}
+
+static std::pair<int32_t, int32_t> FlatGetNextPending(const FlatArrangeScratch& s, int32_t ps)
+{
+    int32_t psNext;
+    while (true)
+    {
+        psNext = s.Next[ps];
+        if (psNext == kFlatNullIndex)
+        {
+            return { kFlatNullIndex, kFlatNullIndex };
+        }
+        if (s.Flags[psNext] & PaintSortFlags::OutsideQuadrant)
+        {
+            return { kFlatNullIndex, kFlatNullIndex };
+        }
+        if (s.Flags[psNext] & PaintSortFlags::PendingVisit)
+        {
+            break;
+        }
+        ps = psNext;
+    }
+    return { ps, psNext };
+}
+
+template<int TRotation> static void FlatSortQuadrant(FlatArrangeScratch& s, int32_t parent, int32_t child)
+{
+    s.Flags[child] &= ~PaintSortFlags::PendingVisit;
+
+    const PaintStructBoundBox initialBBox = s.Bounds[child];
+    for (;;)
+    {
+        const int32_t ps = child;
+        child = s.Next[child];
+
+        if (child == kFlatNullIndex || (s.Flags[child] & PaintSortFlags::OutsideQuadrant))
+        {
+            break;
+        }
+        if (!(s.Flags[child] & PaintSortFlags::Neighbour))
+        {
+            continue;
+        }
+
+        if (CheckBoundingBox<TRotation>(initialBBox, s.Bounds[child]))
+        {
+            // Child node intersects with current node, move behind.
+            s.Next[ps] = s.Next[child];
+
+            const int32_t psTemp = s.Next[parent];
+            s.Next[parent] = child;
+            s.Next[child] = psTemp;
+            child = ps;
+        }
+    }
+}
+
+template<int TRotation>
+static int32_t FlatArrangeStructsHelper(FlatArrangeScratch& s, int32_t psQuadrantEntry, uint16_t quadrantIndex, uint8_t flag)
+{
+    psQuadrantEntry = FlatFirstInQuadrant(s, psQuadrantEntry, quadrantIndex);
+    FlatInitializeSort(s, psQuadrantEntry, quadrantIndex, flag);
+
+    for (int32_t ps = psQuadrantEntry; ps != kFlatNullIndex;)
+    {
+        const auto [parent, child] = FlatGetNextPending(s, ps);
+        if (parent == kFlatNullIndex)
+        {
+            break;
+        }
+
+        FlatSortQuadrant<TRotation>(s, parent, child);
+        ps = parent;
+    }
+
+    return psQuadrantEntry;
+}
+
+template<int TRotation> static void PaintSessionArrangeFlatImpl(PaintSessionCore& session)
+{
+    uint32_t quadrantIndex = session.QuadrantBackIndex;
+    if (quadrantIndex == UINT32_MAX)
+    {
+        return;
+    }
+
+    auto& s = _flatArrangeScratch;
+    s.Entries.clear();
+    s.Bounds.clear();
+    s.Quadrant.clear();
+    s.Flags.clear();
+
+    // Index 0 is the head sentinel, it takes the place of psHead in the
+    // classic engine and is not part of the result.
+    s.Entries.push_back(nullptr);
+    s.Bounds.push_back({});
+    s.Quadrant.push_back(0);
+    s.Flags.push_back(0);
+
+    for (uint32_t i = session.QuadrantBackIndex; i <= session.QuadrantFrontIndex; i++)
+    {
+        for (auto* ps = session.Quadrants[i]; ps != nullptr; ps = ps->NextQuadrantEntry)
+        {
+            s.Entries.push_back(ps);
+            s.Bounds.push_back(ps->Bounds);
+            s.Quadrant.push_back(static_cast<uint16_t>(i));
+            s.Flags.push_back(PaintSortFlags::None);
+        }
+    }
+
+    const auto numEntries = static_cast<int32_t>(s.Entries.size());
+    s.Next.resize(numEntries);
+    for (int32_t i = 0; i < numEntries - 1; i++)
+    {
+        s.Next[i] = i + 1;
+    }
+    s.Next[numEntries - 1] = kFlatNullIndex;
+
+    int32_t psNextQuadrant = FlatArrangeStructsHelper<TRotation>(
+        s, 0, session.QuadrantBackIndex & 0xFFFF, PaintSortFlags::Neighbour);
+
+    while (++quadrantIndex < session.QuadrantFrontIndex)
+    {
+        psNextQuadrant = FlatArrangeStructsHelper<TRotation>(s, psNextQuadrant, quadrantIndex & 0xFFFF, PaintSortFlags::None);
+    }
+
+    // Write the final order back as the NextQuadrantEntry chain.
+    PaintStruct* head = nullptr;
+    PaintStruct** link = &head;
+    for (int32_t i = s.Next[0]; i != kFlatNullIndex; i = s.Next[i])
+    {
+        *link = s.Entries[i];
+        link = &s.Entries[i]->NextQuadrantEntry;
+    }
+    *link = nullptr;
+    session.PaintHead = head;
+}
+
+constexpr std::array _paintArrangeFlatFuncs = {
+    PaintSessionArrangeFlatImpl<0>,
+    PaintSessionArrangeFlatImpl<1>,
+    PaintSessionArrangeFlatImpl<2>,
+    PaintSessionArrangeFlatImpl<3>,
+};
+
 /**
  *
  *  rct2: 0x00688217
@@ -515,6 +737,10 @@ constexpr std::array _paintArrangeFuncs = {
 void PaintSessionArrange(PaintSessionCore& session)
 {
     PROFILED_FUNCTION();
+    if (session.Config.PaintFlatSort)
+    {
+        return _paintArrangeFlatFuncs[session.CurrentRotation](session);
+    }
     return _paintArrangeFuncs[session.CurrentRotation](session);
 }
 
@@ -954,6 +1180,18 @@ PaintEntryPool::Chain& PaintEntryPool::Chain::operator=(Chain&& chain) noexcept
 }
 
 PaintEntry* PaintEntryPool::Chain::Allocate()
+{
+    // Fast path, the current node still has capacity. This is a plain bump
+    // allocation, anything else is handled out of line.
+    auto* node = Current;
+    if (node != nullptr && node->Count < NodeSize)
+    {
+        return &node->PaintStructs[node->Count++];
+    }
+    return AllocateSlow();
+}
+
+PaintEntry* PaintEntryPool::Chain::AllocateSlow()
 {
     if (Pool == nullptr)
     {
@@ -971,14 +1209,18 @@ PaintEntry* PaintEntryPool::Chain::Allocate()
         }
         Current = Head;
     }
-    else if (Current->Count >= NodeSize)
+    else
     {
-        // We need another node
-        Current->Next = Pool->AllocateNode();
+        // Re-use a node kept alive by Reset() if there is one, otherwise
+        // take a new node from the pool.
         if (Current->Next == nullptr)
         {
-            // Unable to allocate any more nodes
-            return nullptr;
+            Current->Next = Pool->AllocateNode();
+            if (Current->Next == nullptr)
+            {
+                // Unable to allocate any more nodes
+                return nullptr;
+            }
         }
         Current = Current->Next;
     }
@@ -987,6 +1229,17 @@ PaintEntry* PaintEntryPool::Chain::Allocate()
     return &Current->PaintStructs[Current->Count++];
 }
 
+void PaintEntryPool::Chain::Reset() noexcept
+{
+    // Rewind the chain without giving the nodes back to the pool, the next
+    // frame allocates over the same memory again.
+    for (auto* node = Head; node != nullptr; node = node->Next)
+    {
+        node->Count = 0;
+    }
+    Current = Head;
+}
+
 void PaintEntryPool::Chain::Clear()
 {
     if (Pool != nullptr)
@@ -1011,15 +1264,6 @@ size_t PaintEntryPool::Chain::GetCount() const
     return count;
 }
 
-PaintEntryPool::~PaintEntryPool()
-{
-    for (auto node : _available)
-    {
-        delete node;
-    }
-    _available.clear();
-}
-
 PaintEntryPool::Node* PaintEntryPool::AllocateNode()
 {
     std::lock_guard<std::mutex> lock(_mutex);
@@ -1032,7 +1276,18 @@ PaintEntryPool::Node* PaintEntryPool::AllocateNode()
     }
     else
     {
-        result = new (std::nothrow) PaintEntryPool::Node();
+        // Nodes are never freed individually, they cycle through _available
+        // and their storage lives as long as the pool, so a bump arena is the
+        // natural backing store. Keep the old nothrow contract: callers treat
+        // a null node as "stop painting", not as a fatal error.
+        try
+        {
+            result = _arena.Create<PaintEntryPool::Node>();
+        }
+        catch (const std::bad_alloc&)
+        {
+            result = nullptr;
+        }
     }
     return result;
 }
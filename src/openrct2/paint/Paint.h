@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "../core/ArenaAllocator.hpp"
 #include "../drawing/Drawing.h"
 #include "../interface/Colour.h"
 #include "../world/Location.hpp"
@@ -24,6 +25,7 @@ struct TileElement;
 struct SurfaceElement;
 enum class RailingEntrySupportType : uint8_t;
 enum class ViewportInteractionItem : uint8_t;
+enum class VirtualFloorStyles : int32_t;
 
 struct AttachedPaintStruct
 {
@@ -126,7 +128,8 @@ static constexpr int32_t MaxPaintQuadrants = kMaximumMapSizeTechnical * 2;
  * The internal implementation uses an unrolled linked list so that each
  * paint session can quickly allocate a new paint entry until it requires
  * another node / block of paint entries. Only the node allocation needs to
- * be thread safe.
+ * be thread safe. Node storage comes from an arena owned by the pool, so
+ * it is reclaimed wholesale when the pool is destroyed.
  */
 class PaintEntryPool
 {
@@ -154,23 +157,44 @@ public:
         Chain& operator=(Chain&& chain) noexcept;
 
         PaintEntry* Allocate();
+        void Reset() noexcept;
         void Clear();
         size_t GetCount() const;
+
+    private:
+        PaintEntry* AllocateSlow();
     };
 
 private:
+    OpenRCT2::ArenaAllocator _arena;
     std::vector<Node*> _available;
     std::mutex _mutex;
 
     Node* AllocateNode();
 
 public:
-    ~PaintEntryPool();
-
     Chain Create();
     void FreeNodes(Node* head);
 };
 
+/**
+ * Configuration values read while generating and arranging a paint session,
+ * captured once when the session is created. Painters read plain fields from
+ * the session instead of going back to the config store per element, and
+ * worker threads arranging sessions never touch the live config at all.
+ */
+struct PaintConfigSnapshot
+{
+    bool PaintFlatSort;
+    bool UpperCaseBanners;
+    bool LandscapeSmoothing;
+    bool TransparentWater;
+    VirtualFloorStyles VirtualFloorStyle;
+    int32_t EntityLodZoomLevel;
+};
+
+const PaintConfigSnapshot& GetPaintConfigSnapshot();
+
 struct PaintSessionCore
 {
     PaintStruct* PaintHead;
@@ -204,6 +228,7 @@ struct PaintSessionCore
     uint8_t CurrentRotation;
     uint8_t Flags;
     ViewportInteractionItem InteractionType;
+    PaintConfigSnapshot Config;
 };
 
 struct PaintSession : public PaintSessionCore
@@ -0,0 +1,98 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "PaintStats.h"
+
+#include <atomic>
+#include <sstream>
+
+namespace OpenRCT2::Paint
+{
+    // Paint session generation runs on multiple threads, so the per-frame
+    // accumulators are atomic; the snapshot is only touched by the painter
+    // between frames.
+    static std::atomic<bool> _paintStatsEnabled{ false };
+    static std::array<std::atomic<uint64_t>, kPaintStatCategoryCount> _counts{};
+    static std::array<std::atomic<uint64_t>, kPaintStatCategoryCount> _timesNs{};
+    static PaintStatsFrame _lastFrame{};
+
+    static constexpr const char* kCategoryNames[kPaintStatCategoryCount] = {
+        "surface", "path", "track", "small_scenery", "large_scenery", "wall", "entrance", "banner", "entity",
+    };
+
+    bool PaintStatsAreEnabled()
+    {
+        return _paintStatsEnabled.load(std::memory_order_relaxed);
+    }
+
+    void PaintStatsSetEnabled(bool enable)
+    {
+        _paintStatsEnabled.store(enable, std::memory_order_relaxed);
+    }
+
+    void PaintStatsFrameBegin()
+    {
+        if (!PaintStatsAreEnabled())
+        {
+            return;
+        }
+        for (size_t i = 0; i < kPaintStatCategoryCount; i++)
+        {
+            _counts[i].store(0, std::memory_order_relaxed);
+            _timesNs[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void PaintStatsFrameEnd()
+    {
+        if (!PaintStatsAreEnabled())
+        {
+            return;
+        }
+        for (size_t i = 0; i < kPaintStatCategoryCount; i++)
+        {
+            _lastFrame.Categories[i].Count = _counts[i].load(std::memory_order_relaxed);
+            _lastFrame.Categories[i].TimeUs = _timesNs[i].load(std::memory_order_relaxed) / 1000;
+        }
+    }
+
+    PaintStatsFrame PaintStatsGetLastFrame()
+    {
+        return _lastFrame;
+    }
+
+    void PaintStatsAdd(PaintStatCategory category, uint64_t timeNs)
+    {
+        const auto index = static_cast<size_t>(category);
+        _counts[index].fetch_add(1, std::memory_order_relaxed);
+        _timesNs[index].fetch_add(timeNs, std::memory_order_relaxed);
+    }
+
+    const char* PaintStatCategoryName(PaintStatCategory category)
+    {
+        return kCategoryNames[static_cast<size_t>(category)];
+    }
+
+    std::string PaintStatsToJson(const PaintStatsFrame& frame)
+    {
+        std::ostringstream sb;
+        sb << "{\"categories\":{";
+        for (size_t i = 0; i < kPaintStatCategoryCount; i++)
+        {
+            if (i != 0)
+            {
+                sb << ",";
+            }
+            const auto& entry = frame.Categories[i];
+            sb << "\"" << kCategoryNames[i] << "\":{\"count\":" << entry.Count << ",\"time_us\":" << entry.TimeUs << "}";
+        }
+        sb << "}}";
+        return sb.str();
+    }
+} // namespace OpenRCT2::Paint
@@ -0,0 +1,101 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace OpenRCT2::Paint
+{
+    /**
+     * The paint subsystem a timed contribution is attributed to. Unlike the
+     * generic function profiler this groups by what is being painted, so a
+     * regression can be narrowed down to e.g. track or entity painting from
+     * the console without attaching an external profiler.
+     */
+    enum class PaintStatCategory : uint8_t
+    {
+        Surface,
+        Path,
+        Track,
+        SmallScenery,
+        LargeScenery,
+        Wall,
+        Entrance,
+        Banner,
+        Entity,
+        Count
+    };
+
+    constexpr size_t kPaintStatCategoryCount = static_cast<size_t>(PaintStatCategory::Count);
+
+    struct PaintStatsFrame
+    {
+        struct Entry
+        {
+            uint64_t Count{};
+            uint64_t TimeUs{};
+        };
+
+        std::array<Entry, kPaintStatCategoryCount> Categories{};
+    };
+
+    bool PaintStatsAreEnabled();
+    void PaintStatsSetEnabled(bool enable);
+
+    // Called by the painter at the start and end of each frame; FrameEnd
+    // snapshots the accumulators so the last completed frame can be queried
+    // while the next one is being painted.
+    void PaintStatsFrameBegin();
+    void PaintStatsFrameEnd();
+
+    PaintStatsFrame PaintStatsGetLastFrame();
+    void PaintStatsAdd(PaintStatCategory category, uint64_t timeNs);
+    const char* PaintStatCategoryName(PaintStatCategory category);
+    std::string PaintStatsToJson(const PaintStatsFrame& frame);
+
+    /**
+     * Times one paint contribution and attributes it to a category. Cheap
+     * enough to leave in the paint loops permanently; only reads a flag when
+     * collection is disabled.
+     */
+    class PaintStatsTimer
+    {
+    public:
+        explicit PaintStatsTimer(PaintStatCategory category)
+            : _category(category)
+            , _enabled(PaintStatsAreEnabled())
+        {
+            if (_enabled)
+            {
+                _start = std::chrono::high_resolution_clock::now();
+            }
+        }
+
+        ~PaintStatsTimer()
+        {
+            if (_enabled)
+            {
+                const auto elapsed = std::chrono::high_resolution_clock::now() - _start;
+                PaintStatsAdd(_category, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+            }
+        }
+
+        PaintStatsTimer(const PaintStatsTimer&) = delete;
+        PaintStatsTimer& operator=(const PaintStatsTimer&) = delete;
+
+    private:
+        PaintStatCategory _category;
+        bool _enabled;
+        std::chrono::high_resolution_clock::time_point _start;
+    };
+} // namespace OpenRCT2::Paint
@@ -19,21 +19,42 @@
 #include "../interface/Chat.h"
 #include "../interface/InteractiveConsole.h"
 #include "../interface/Widget.h"
+#include "../interface/Viewport.h"
+#include "../interface/Window.h"
 #include "../localisation/FormatCodes.h"
 #include "../localisation/Formatting.h"
 #include "../localisation/Language.h"
 #include "../paint/Paint.h"
+#include "../paint/PaintStats.h"
+#include "../profiling/AllocationTracker.h"
+#include "../profiling/PerfCounters.h"
 #include "../profiling/Profiling.h"
+#include "../profiling/Tracing.h"
 #include "../scenes/intro/IntroScene.h"
 #include "../scenes/title/TitleScene.h"
 #include "../ui/UiContext.h"
+#include "../util/Math.hpp"
 #include "../world/TileInspector.h"
 
+#include <chrono>
+
 using namespace OpenRCT2;
 using namespace OpenRCT2::Drawing;
 using namespace OpenRCT2::Paint;
 using namespace OpenRCT2::Ui;
 
+size_t PaintColumnKeyHasher::operator()(const PaintColumnKey& key) const noexcept
+{
+    size_t hash = static_cast<uint32_t>(key.X);
+    hash = hash * 0x9E3779B1u + static_cast<uint32_t>(key.Y);
+    hash = hash * 0x9E3779B1u + static_cast<uint32_t>(key.Width);
+    hash = hash * 0x9E3779B1u + static_cast<uint32_t>(key.Height);
+    hash = hash * 0x9E3779B1u + key.ViewFlags;
+    hash = hash * 0x9E3779B1u + static_cast<uint8_t>(static_cast<int8_t>(key.Zoom));
+    hash = hash * 0x9E3779B1u + key.Rotation;
+    return hash;
+}
+
 Painter::Painter(const std::shared_ptr<IUiContext>& uiContext)
     : _uiContext(uiContext)
 {
@@ -42,6 +63,11 @@ Painter::Painter(const std::shared_ptr<IUiContext>& uiContext)
 void Painter::Paint(IDrawingEngine& de)
 {
     PROFILED_FUNCTION();
+    TRACE_SCOPE("Painter::Paint");
+    AllocationTracker::TagScope allocScope(AllocationTracker::AllocTag::Paint);
+
+    PaintStatsFrameBegin();
+    const auto paintStart = std::chrono::steady_clock::now();
 
     auto dpi = de.GetDrawingPixelInfo();
 
@@ -51,6 +77,8 @@ void Painter::Paint(IDrawingEngine& de)
     }
     else
     {
+        ViewportsFlushPendingInvalidations();
+        WindowFlushPendingInvalidations();
         de.PaintWindows();
 
         UpdatePaletteEffects();
@@ -79,6 +107,10 @@ void Painter::Paint(IDrawingEngine& de)
     {
         PaintFPS(*dpi);
     }
+
+    PaintStatsFrameEnd();
+    PerfCounters::RecordPaintTime(
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - paintStart).count());
     gCurrentDrawCount++;
 }
 
@@ -173,9 +205,13 @@ PaintSession* Painter::CreateSession(DrawPixelInfo& dpi, uint32_t viewFlags, uin
     session->ViewFlags = viewFlags;
     session->QuadrantBackIndex = std::numeric_limits<uint32_t>::max();
     session->QuadrantFrontIndex = 0;
-    session->PaintEntryChain = _paintStructPool.Create();
+    if (session->PaintEntryChain.Pool == nullptr)
+    {
+        session->PaintEntryChain = _paintStructPool.Create();
+    }
     session->Flags = 0;
     session->CurrentRotation = rotation;
+    session->Config = GetPaintConfigSnapshot();
 
     std::fill(std::begin(session->Quadrants), std::end(session->Quadrants), nullptr);
     session->PaintHead = nullptr;
@@ -196,15 +232,98 @@ void Painter::ReleaseSession(PaintSession* session)
 {
     PROFILED_FUNCTION();
 
-    session->PaintEntryChain.Clear();
+    // Keep the nodes on the session so the next frame can allocate from the
+    // same memory again, only the counts are rewound.
+    session->PaintEntryChain.Reset();
     _freePaintSessions.push_back(session);
 }
 
+static size_t PaintColumnGenerationIndex(int32_t viewX)
+{
+    constexpr size_t kMask = 4096 - 1;
+    return static_cast<size_t>(Floor2(viewX, 32) / 32) & kMask;
+}
+
+uint32_t Painter::GetPaintColumnGeneration(int32_t viewX, int32_t width) const
+{
+    static_assert(kPaintColumnGenerationCount == 4096);
+
+    uint32_t generation = 0;
+    const auto last = Floor2(viewX + std::max(width, 1) - 1, 32);
+    for (auto x = Floor2(viewX, 32); x <= last; x += 32)
+    {
+        generation += _columnGenerations[PaintColumnGenerationIndex(x)];
+    }
+    return generation;
+}
+
+Painter::CachedPaintColumn* Painter::AcquireCachedColumn(const PaintColumnKey& key)
+{
+    auto it = _paintColumnCache.find(key);
+    if (it == _paintColumnCache.end())
+    {
+        return nullptr;
+    }
+    if (it->second.Generation != GetPaintColumnGeneration(key.X, key.Width))
+    {
+        // Something was invalidated in this column since it was generated.
+        ReleaseSession(it->second.Session);
+        _paintColumnCache.erase(it);
+        return nullptr;
+    }
+    return &it->second;
+}
+
+Painter::CachedPaintColumn* Painter::StoreCachedColumn(PaintSession* session)
+{
+    if (_paintColumnCache.size() >= kMaxCachedPaintColumns)
+    {
+        ClearPaintColumnCache();
+    }
+
+    const auto& dpi = session->DPI;
+    const PaintColumnKey key{
+        dpi.x, dpi.y, dpi.width, dpi.height, session->ViewFlags, dpi.zoom_level, session->CurrentRotation,
+    };
+    CachedPaintColumn column{ session, GetPaintColumnGeneration(key.X, key.Width) };
+
+    auto [it, inserted] = _paintColumnCache.try_emplace(key, std::move(column));
+    if (!inserted)
+    {
+        // An equivalent column is already cached, keep the newer one.
+        ReleaseSession(it->second.Session);
+        it->second = std::move(column);
+    }
+    return &it->second;
+}
+
+void Painter::InvalidatePaintColumns(const ScreenRect& viewRect)
+{
+    const auto left = Floor2(viewRect.GetLeft(), 32);
+    const auto right = Floor2(viewRect.GetRight(), 32);
+    const auto numColumns = std::min<int64_t>(
+        (static_cast<int64_t>(right) - left) / 32 + 1, static_cast<int64_t>(kPaintColumnGenerationCount));
+    for (int64_t i = 0; i < numColumns; i++)
+    {
+        _columnGenerations[PaintColumnGenerationIndex(left + static_cast<int32_t>(i) * 32)]++;
+    }
+}
+
+void Painter::ClearPaintColumnCache()
+{
+    for (auto& [key, column] : _paintColumnCache)
+    {
+        ReleaseSession(column.Session);
+    }
+    _paintColumnCache.clear();
+}
+
 Painter::~Painter()
 {
+    // The chains have to be released before the pool is destroyed.
     for (auto&& session : _paintSessionPool)
     {
-        ReleaseSession(session.get());
+        session->PaintEntryChain.Clear();
     }
     _paintSessionPool.clear();
 }
@@ -11,8 +11,10 @@
 
 #include "Paint.h"
 
+#include <array>
 #include <ctime>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 struct DrawPixelInfo;
@@ -31,13 +33,55 @@ namespace OpenRCT2
 
     namespace Paint
     {
+        /**
+         * Identifies a generated viewport column, all fields are in view space.
+         * Two columns with the same key show the same content provided no
+         * invalidation touched the covered view columns in between.
+         */
+        struct PaintColumnKey
+        {
+            int32_t X{};
+            int32_t Y{};
+            int32_t Width{};
+            int32_t Height{};
+            uint32_t ViewFlags{};
+            ZoomLevel Zoom{};
+            uint8_t Rotation{};
+
+            bool operator==(const PaintColumnKey&) const = default;
+        };
+
+        struct PaintColumnKeyHasher
+        {
+            size_t operator()(const PaintColumnKey& key) const noexcept;
+        };
+
         struct Painter final
         {
+        public:
+            struct CachedPaintColumn
+            {
+                PaintSession* Session{};
+                uint32_t Generation{};
+                // Composited pixels of the whole column ("imposter"), used at
+                // high zoom-out where copying the handful of pixels is cheaper
+                // than redrawing the structs. Weather gloom is baked in, so
+                // the gloom palette it was captured with is recorded.
+                std::vector<uint8_t> Imposter;
+                int32_t ImposterGloom{};
+                bool HasImposter{};
+            };
+
         private:
+            static constexpr size_t kMaxCachedPaintColumns = 256;
+            static constexpr size_t kPaintColumnGenerationCount = 4096;
+
             std::shared_ptr<Ui::IUiContext> const _uiContext;
             std::vector<std::unique_ptr<PaintSession>> _paintSessionPool;
             std::vector<PaintSession*> _freePaintSessions;
             PaintEntryPool _paintStructPool;
+            std::unordered_map<PaintColumnKey, CachedPaintColumn, PaintColumnKeyHasher> _paintColumnCache;
+            std::array<uint32_t, kPaintColumnGenerationCount> _columnGenerations{};
             time_t _lastSecond = 0;
             int32_t _currentFPS = 0;
             int32_t _frames = 0;
@@ -48,6 +92,21 @@ namespace OpenRCT2
 
             PaintSession* CreateSession(DrawPixelInfo& dpi, uint32_t viewFlags, uint8_t rotation);
             void ReleaseSession(PaintSession* session);
+
+            // Returns the cached column if it is present and no invalidation
+            // touched it since its session was generated.
+            CachedPaintColumn* AcquireCachedColumn(const PaintColumnKey& key);
+            // Hands a freshly generated and arranged column session over to
+            // the cache and returns its entry.
+            CachedPaintColumn* StoreCachedColumn(PaintSession* session);
+            // Marks all view columns intersecting the given view space rectangle as modified.
+            void InvalidatePaintColumns(const ScreenRect& viewRect);
+            void ClearPaintColumnCache();
+            // Sums the generations of the view columns intersecting the given
+            // view space range, for callers keeping their own arranged
+            // sessions valid.
+            uint32_t GetPaintColumnGeneration(int32_t viewX, int32_t width) const;
+
             ~Painter();
 
         private:
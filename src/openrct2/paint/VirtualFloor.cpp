@@ -13,7 +13,6 @@
 #include "../Diagnostic.h"
 #include "../GameState.h"
 #include "../Input.h"
-#include "../config/Config.h"
 #include "../interface/Viewport.h"
 #include "../profiling/Profiling.h"
 #include "../sprites.h"
@@ -406,7 +405,7 @@ void VirtualFloorPaint(PaintSession& session)
             { { 5, 5, _virtualFloorHeight + ((dullEdges & EDGE_NW) ? -2 : 0) }, { 0, 0, 1 } });
     }
 
-    if (Config::Get().general.VirtualFloorStyle != VirtualFloorStyles::Glassy)
+    if (session.Config.VirtualFloorStyle != VirtualFloorStyles::Glassy)
         return;
 
     if (!weAreOccupied && !weAreLit && weAreAboveGround && weAreOwned)
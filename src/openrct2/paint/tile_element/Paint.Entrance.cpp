@@ -12,7 +12,6 @@
 #include "../../Context.h"
 #include "../../Game.h"
 #include "../../GameState.h"
-#include "../../config/Config.h"
 #include "../../drawing/LightFX.h"
 #include "../../interface/Viewport.h"
 #include "../../localisation/Formatter.h"
@@ -62,7 +61,7 @@ static void PaintRideEntranceExitScrollingText(
     }
 
     char text[256];
-    if (Config::Get().general.UpperCaseBanners)
+    if (session.Config.UpperCaseBanners)
     {
         FormatStringToUpper(text, sizeof(text), STR_BANNER_TEXT_FORMAT, ft.Data());
     }
@@ -234,7 +233,7 @@ static void PaintParkEntranceScrollingText(
     }
 
     char text[256];
-    if (Config::Get().general.UpperCaseBanners)
+    if (session.Config.UpperCaseBanners)
     {
         FormatStringToUpper(text, sizeof(text), STR_BANNER_TEXT_FORMAT, ft.Data());
     }
@@ -11,7 +11,6 @@
 
 #include "../../Game.h"
 #include "../../GameState.h"
-#include "../../config/Config.h"
 #include "../../core/Numerics.hpp"
 #include "../../core/String.hpp"
 #include "../../core/UTF8.h"
@@ -316,7 +315,7 @@ static void PaintLargeSceneryScrollingText(
     banner->FormatTextTo(ft);
 
     char text[256];
-    if (Config::Get().general.UpperCaseBanners)
+    if (session.Config.UpperCaseBanners)
     {
         FormatStringToUpper(text, sizeof(text), STR_SCROLLING_SIGN_TEXT, ft.Data());
     }
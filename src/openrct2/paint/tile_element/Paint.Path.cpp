@@ -12,7 +12,6 @@
 #include "../../Context.h"
 #include "../../Game.h"
 #include "../../GameState.h"
-#include "../../config/Config.h"
 #include "../../core/Numerics.hpp"
 #include "../../entity/PatrolArea.h"
 #include "../../interface/Viewport.h"
@@ -163,7 +162,7 @@ static void PathPaintQueueBanner(
         }
 
         utf8 bannerBuffer[512]{};
-        if (Config::Get().general.UpperCaseBanners)
+        if (session.Config.UpperCaseBanners)
         {
             FormatStringToUpper(bannerBuffer, sizeof(bannerBuffer), STR_BANNER_TEXT_FORMAT, ft.Data());
         }
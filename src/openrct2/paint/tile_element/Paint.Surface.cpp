@@ -12,7 +12,6 @@
 #include "../../Cheats.h"
 #include "../../GameState.h"
 #include "../../OpenRCT2.h"
-#include "../../config/Config.h"
 #include "../../core/Numerics.hpp"
 #include "../../drawing/Drawing.h"
 #include "../../entity/EntityRegistry.h"
@@ -27,6 +26,7 @@
 #include "../../profiling/Profiling.h"
 #include "../../ride/TrackDesign.h"
 #include "../../sprites.h"
+#include "../../world/Map.h"
 #include "../../world/Surface.h"
 #include "../../world/tile_element/Slope.h"
 #include "../Boundbox.h"
@@ -37,6 +37,7 @@
 #include <cassert>
 #include <cstring>
 #include <iterator>
+#include <vector>
 
 using namespace OpenRCT2;
 
@@ -283,6 +284,59 @@ static constexpr TileSurfaceBoundaryData _tileSurfaceBoundaries[4] = {
     },
 };
 
+struct SurfaceTileCacheEntry
+{
+    const SurfaceElement* element;
+    const TerrainSurfaceObject* surfaceObject;
+    const TerrainEdgeObject* edgeObject;
+};
+
+// Surface painting resolves the surface element and terrain objects of a tile
+// and its four neighbours on every paint, even though those lookups only
+// change when the tile element storage or a terrain style changes. They are
+// captured here once per tile element generation instead. The cache is
+// rebuilt on the main thread before any paint column is generated; sessions
+// generated without the prepass fall back to the live lookups.
+static std::vector<SurfaceTileCacheEntry> _surfaceTileCache;
+static TileCoordsXY _surfaceTileCacheSize;
+static uint32_t _surfaceTileCacheGeneration;
+
+void PaintSurfacePrepareTileCache()
+{
+    const auto generation = MapGetTileElementGeneration();
+    if (!_surfaceTileCache.empty() && _surfaceTileCacheGeneration == generation)
+        return;
+
+    const auto mapSize = GetGameState().MapSize;
+    _surfaceTileCacheSize = mapSize;
+    _surfaceTileCache.assign(static_cast<size_t>(mapSize.x) * mapSize.y, SurfaceTileCacheEntry{});
+    for (int32_t tileY = 0; tileY < mapSize.y; tileY++)
+    {
+        for (int32_t tileX = 0; tileX < mapSize.x; tileX++)
+        {
+            auto* surfaceElement = MapGetSurfaceElementAt(TileCoordsXY{ tileX, tileY });
+            if (surfaceElement == nullptr)
+                continue;
+
+            auto& entry = _surfaceTileCache[tileX + (tileY * mapSize.x)];
+            entry.element = surfaceElement;
+            entry.surfaceObject = surfaceElement->GetSurfaceObject();
+            entry.edgeObject = surfaceElement->GetEdgeObject();
+        }
+    }
+    _surfaceTileCacheGeneration = generation;
+}
+
+static const SurfaceTileCacheEntry* GetSurfaceTileCacheEntry(const TileCoordsXY& coords)
+{
+    if (coords.x >= _surfaceTileCacheSize.x || coords.y >= _surfaceTileCacheSize.y
+        || _surfaceTileCacheGeneration != MapGetTileElementGeneration())
+        return nullptr;
+
+    const auto& entry = _surfaceTileCache[coords.x + (coords.y * _surfaceTileCacheSize.x)];
+    return entry.element != nullptr ? &entry : nullptr;
+}
+
 static ImageId GetSurfacePattern(const TerrainSurfaceObject* surfaceObject, int32_t offset)
 {
     ImageId image;
@@ -993,8 +1047,18 @@ void PaintSurface(PaintSession& session, uint8_t direction, uint16_t height, con
     const CornerHeight& cornerHeights = corner_heights[surfaceShape];
     const TileElement* elementPtr = &reinterpret_cast<const TileElement&>(tileElement);
 
-    const auto* surfaceObject = tileElement.GetSurfaceObject();
-    const auto* edgeObject = tileElement.GetEdgeObject();
+    const TerrainSurfaceObject* surfaceObject;
+    const TerrainEdgeObject* edgeObject;
+    if (const auto* cacheEntry = GetSurfaceTileCacheEntry(TileCoordsXY(base)); cacheEntry != nullptr)
+    {
+        surfaceObject = cacheEntry->surfaceObject;
+        edgeObject = cacheEntry->edgeObject;
+    }
+    else
+    {
+        surfaceObject = tileElement.GetSurfaceObject();
+        edgeObject = tileElement.GetEdgeObject();
+    }
 
     const auto selfDescriptor = TileDescriptor{
         TileCoordsXY(base),
@@ -1024,10 +1088,21 @@ void PaintSurface(PaintSession& session, uint8_t direction, uint16_t height, con
             continue;
         }
 
-        auto surfaceElement = MapGetSurfaceElementAt(position);
-        if (surfaceElement == nullptr)
+        const SurfaceElement* surfaceElement;
+        const TerrainSurfaceObject* neighbourSurfaceObject;
+        if (const auto* cacheEntry = GetSurfaceTileCacheEntry(TileCoordsXY{ position }); cacheEntry != nullptr)
         {
-            continue;
+            surfaceElement = cacheEntry->element;
+            neighbourSurfaceObject = cacheEntry->surfaceObject;
+        }
+        else
+        {
+            surfaceElement = MapGetSurfaceElementAt(position);
+            if (surfaceElement == nullptr)
+            {
+                continue;
+            }
+            neighbourSurfaceObject = surfaceElement->GetSurfaceObject();
         }
 
         const uint32_t surfaceSlope = ViewportSurfacePaintSetupGetRelativeSlope(*surfaceElement, rotation);
@@ -1035,8 +1110,8 @@ void PaintSurface(PaintSession& session, uint8_t direction, uint16_t height, con
         const CornerHeight& ch = corner_heights[surfaceSlope];
 
         descriptor.tile_coords = TileCoordsXY{ position };
-        descriptor.tile_element = reinterpret_cast<TileElement*>(surfaceElement);
-        descriptor.surfaceObject = surfaceElement->GetSurfaceObject();
+        descriptor.tile_element = reinterpret_cast<const TileElement*>(surfaceElement);
+        descriptor.surfaceObject = neighbourSurfaceObject;
         descriptor.slope = surfaceSlope;
         descriptor.corner_heights.top = baseHeight + ch.top;
         descriptor.corner_heights.right = baseHeight + ch.right;
@@ -1250,7 +1325,7 @@ void PaintSurface(PaintSession& session, uint8_t direction, uint16_t height, con
     }
 
     if (zoomLevel <= ZoomLevel{ 0 } && has_surface && !(session.ViewFlags & VIEWPORT_FLAG_UNDERGROUND_INSIDE)
-        && !(session.ViewFlags & VIEWPORT_FLAG_HIDE_BASE) && Config::Get().general.LandscapeSmoothing)
+        && !(session.ViewFlags & VIEWPORT_FLAG_HIDE_BASE) && session.Config.LandscapeSmoothing)
     {
         ViewportSurfaceSmoothenEdge(session, EDGE_TOPLEFT, selfDescriptor, tileDescriptors[2]);
         ViewportSurfaceSmoothenEdge(session, EDGE_TOPRIGHT, selfDescriptor, tileDescriptors[3]);
@@ -1299,7 +1374,7 @@ void PaintSurface(PaintSession& session, uint8_t direction, uint16_t height, con
         const auto image_id = ImageId(SPR_WATER_MASK + image_offset, FilterPaletteID::PaletteWater).WithBlended(true);
         PaintAddImageAsParent(session, image_id, { 0, 0, waterHeight }, { 32, 32, -1 });
 
-        const bool transparent = !IsCsgLoaded() || Config::Get().general.TransparentWater
+        const bool transparent = !IsCsgLoaded() || session.Config.TransparentWater
             || (session.ViewFlags & VIEWPORT_FLAG_UNDERGROUND_INSIDE);
         const uint32_t overlayStart = transparent ? SPR_WATER_OVERLAY : SPR_RCT1_WATER_OVERLAY;
         PaintAttachToPreviousPS(session, ImageId(overlayStart + image_offset), 0, 0);
@@ -107,3 +107,8 @@ enum
 };
 
 std::optional<colour_t> GetPatrolAreaTileColour(const CoordsXY& pos);
+
+// Rebuilds the per-tile surface lookup cache if the tile element generation
+// has changed. Must be called from the main thread before paint sessions are
+// generated; the paint columns only read the cache.
+void PaintSurfacePrepareTileCache();
@@ -11,7 +11,6 @@
 
 #include "../../Game.h"
 #include "../../Input.h"
-#include "../../config/Config.h"
 #include "../../core/Numerics.hpp"
 #include "../../drawing/Drawing.h"
 #include "../../interface/Viewport.h"
@@ -29,6 +28,7 @@
 #include "../../world/tile_element/Slope.h"
 #include "../Paint.SessionFlags.h"
 #include "../Paint.h"
+#include "../PaintStats.h"
 #include "../VirtualFloor.h"
 #include "Paint.Surface.h"
 #include "Segment.h"
@@ -38,6 +38,30 @@ using namespace OpenRCT2;
 static void BlankTilesPaint(PaintSession& session, int32_t x, int32_t y);
 static void PaintTileElementBase(PaintSession& session, const CoordsXY& origCoords);
 
+static Paint::PaintStatCategory PaintStatCategoryForElement(TileElementType type)
+{
+    switch (type)
+    {
+        case TileElementType::Surface:
+            return Paint::PaintStatCategory::Surface;
+        case TileElementType::Path:
+            return Paint::PaintStatCategory::Path;
+        case TileElementType::Track:
+            return Paint::PaintStatCategory::Track;
+        case TileElementType::SmallScenery:
+            return Paint::PaintStatCategory::SmallScenery;
+        case TileElementType::Entrance:
+            return Paint::PaintStatCategory::Entrance;
+        case TileElementType::Wall:
+            return Paint::PaintStatCategory::Wall;
+        case TileElementType::LargeScenery:
+            return Paint::PaintStatCategory::LargeScenery;
+        case TileElementType::Banner:
+        default:
+            return Paint::PaintStatCategory::Banner;
+    }
+}
+
 /**
  *
  *  rct2: 0x0068B35F
@@ -139,7 +163,7 @@ static void PaintTileElementBase(PaintSession& session, const CoordsXY& origCoor
 
     bool partOfVirtualFloor = false;
 
-    if (Config::Get().general.VirtualFloorStyle != VirtualFloorStyles::Off)
+    if (session.Config.VirtualFloorStyle != VirtualFloorStyles::Off)
     {
         partOfVirtualFloor = VirtualFloorTileIsFloor(session.MapPosition);
     }
@@ -254,38 +278,41 @@ static void PaintTileElementBase(PaintSession& session, const CoordsXY& origCoor
 
         CoordsXY mapPosition = session.MapPosition;
         session.CurrentlyDrawnTileElement = tile_element;
-        // Setup the painting of for example: the underground, signs, rides, scenery, etc.
-        switch (tile_element->GetType())
         {
-            case TileElementType::Surface:
-                PaintSurface(session, direction, baseZ, *(tile_element->AsSurface()));
-                break;
-            case TileElementType::Path:
-                PaintPath(session, baseZ, *(tile_element->AsPath()));
-                break;
-            case TileElementType::Track:
-                PaintTrack(session, direction, baseZ, *(tile_element->AsTrack()));
-                break;
-            case TileElementType::SmallScenery:
-                PaintSmallScenery(session, direction, baseZ, *(tile_element->AsSmallScenery()));
-                break;
-            case TileElementType::Entrance:
-                PaintEntrance(session, direction, baseZ, *(tile_element->AsEntrance()));
-                break;
-            case TileElementType::Wall:
-                PaintWall(session, direction, baseZ, *(tile_element->AsWall()));
-                break;
-            case TileElementType::LargeScenery:
-                PaintLargeScenery(session, direction, baseZ, *(tile_element->AsLargeScenery()));
-                break;
-            case TileElementType::Banner:
-                PaintBanner(session, direction, baseZ, *(tile_element->AsBanner()));
-                break;
+            Paint::PaintStatsTimer statsTimer(PaintStatCategoryForElement(tile_element->GetType()));
+            // Setup the painting of for example: the underground, signs, rides, scenery, etc.
+            switch (tile_element->GetType())
+            {
+                case TileElementType::Surface:
+                    PaintSurface(session, direction, baseZ, *(tile_element->AsSurface()));
+                    break;
+                case TileElementType::Path:
+                    PaintPath(session, baseZ, *(tile_element->AsPath()));
+                    break;
+                case TileElementType::Track:
+                    PaintTrack(session, direction, baseZ, *(tile_element->AsTrack()));
+                    break;
+                case TileElementType::SmallScenery:
+                    PaintSmallScenery(session, direction, baseZ, *(tile_element->AsSmallScenery()));
+                    break;
+                case TileElementType::Entrance:
+                    PaintEntrance(session, direction, baseZ, *(tile_element->AsEntrance()));
+                    break;
+                case TileElementType::Wall:
+                    PaintWall(session, direction, baseZ, *(tile_element->AsWall()));
+                    break;
+                case TileElementType::LargeScenery:
+                    PaintLargeScenery(session, direction, baseZ, *(tile_element->AsLargeScenery()));
+                    break;
+                case TileElementType::Banner:
+                    PaintBanner(session, direction, baseZ, *(tile_element->AsBanner()));
+                    break;
+            }
         }
         session.MapPosition = mapPosition;
     } while (!(tile_element++)->IsLastForTile());
 
-    if (Config::Get().general.VirtualFloorStyle != VirtualFloorStyles::Off && partOfVirtualFloor)
+    if (session.Config.VirtualFloorStyle != VirtualFloorStyles::Off && partOfVirtualFloor)
     {
         VirtualFloorPaint(session);
     }
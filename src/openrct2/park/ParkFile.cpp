@@ -44,6 +44,7 @@
 #include "../object/ObjectManager.h"
 #include "../object/ObjectRepository.h"
 #include "../peep/RideUseSystem.h"
+#include "../profiling/Tracing.h"
 #include "../ride/ShopItem.h"
 #include "../ride/Vehicle.h"
 #include "../scenario/Scenario.h"
@@ -60,6 +61,7 @@
 #include <cassert>
 #include <cstdint>
 #include <ctime>
+#include <future>
 #include <numeric>
 #include <optional>
 #include <string_view>
@@ -102,6 +104,8 @@ namespace OpenRCT2
     public:
         ObjectList RequiredObjects;
         std::vector<const ObjectRepositoryItem*> ExportObjectsList;
+        GzipLevel CompressionLevel{ GzipLevel::Default };
+        uint32_t Compression{ OrcaStream::COMPRESSION_GZIP };
         bool OmitTracklessRides{};
 
     private:
@@ -136,16 +140,25 @@ namespace OpenRCT2
 
         void Load(IStream& stream)
         {
+            TRACE_SCOPE("ParkFile::Load");
+
             _os = std::make_unique<OrcaStream>(stream, OrcaStream::Mode::READING);
             ThrowIfIncompatibleVersion();
 
             RequiredObjects = {};
             ReadWriteObjectsChunk(*_os);
             ReadWritePackedObjectsChunk(*_os);
+
+            // The checksum has been computed on a worker while the object
+            // chunks were being read; surface a mismatch before anything is
+            // imported into the game state.
+            _os->VerifyIntegrity();
         }
 
         void Import(GameState_t& gameState)
         {
+            TRACE_SCOPE("ParkFile::Import");
+
             auto& os = *_os;
             ReadWriteTilesChunk(gameState, os);
             ReadWriteBannersChunk(gameState, os);
@@ -172,7 +185,7 @@ namespace OpenRCT2
 
         void Save(GameState_t& gameState, IStream& stream)
         {
-            OrcaStream os(stream, OrcaStream::Mode::WRITING);
+            OrcaStream os(stream, OrcaStream::Mode::WRITING, CompressionLevel, Compression);
 
             auto& header = os.GetHeader();
             header.Magic = PARK_FILE_MAGIC;
@@ -828,6 +841,7 @@ namespace OpenRCT2
                                 gameState.ExpenditureTable[i][j] = cs.Read<money64>();
                             }
                         }
+                        FinanceRefreshExpenditureSummaries();
                     }
                     else
                     {
@@ -2527,6 +2541,10 @@ void ParkFileExporter::Export(GameState_t& gameState, IStream& stream)
 {
     auto parkFile = std::make_unique<OpenRCT2::ParkFile>();
     parkFile->ExportObjectsList = ExportObjectsList;
+    if (FastCompression)
+    {
+        parkFile->CompressionLevel = GzipLevel::Fast;
+    }
     parkFile->Save(gameState, stream);
 }
 
@@ -2537,6 +2555,14 @@ enum : uint32_t
     S6_SAVE_FLAG_AUTOMATIC = 1u << 31,
 };
 
+// Pending background autosave write; its destructor waits, so a write in
+// flight always completes before the process exits.
+static std::future<void> _autosaveWriteFuture;
+
+// Content hash of the last autosave, used to skip rewriting an unchanged
+// park on our fixed autosave cadence.
+static Crypt::FNV1aAlgorithm::Result _lastAutosaveHash{};
+
 int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
 {
     if (flags & S6_SAVE_FLAG_SCENARIO)
@@ -2574,7 +2600,52 @@ int32_t ScenarioSave(GameState_t& gameState, u8string_view path, int32_t flags)
         {
             // s6exporter->SaveGame(path);
         }
-        parkFile->Save(gameState, path);
+        if (gIsAutosave)
+        {
+            // Serialise without compression on the game thread, then compress
+            // and write on a background thread so the tick does not stall on
+            // deflate or disk I/O. Only one autosave write runs at a time;
+            // with autosaves minutes apart the wait below is effectively free.
+            if (_autosaveWriteFuture.valid())
+            {
+                _autosaveWriteFuture.wait();
+            }
+            parkFile->Compression = OrcaStream::COMPRESSION_NONE;
+            auto buffer = std::make_shared<MemoryStream>();
+            parkFile->Save(gameState, *buffer);
+
+            // The authoring chunk embeds the export time, so compare the
+            // remaining content and skip the write entirely when nothing else
+            // changed since the previous autosave (e.g. a paused park).
+            const auto contentHash = OrcaStream::ContentHash(*buffer, OpenRCT2::ParkFileChunkType::AUTHORING);
+            if (contentHash != _lastAutosaveHash)
+            {
+                _autosaveWriteFuture = std::async(std::launch::async, [buffer, contentHash, savePath = u8string(path)]() {
+                    try
+                    {
+                        FileStream fs(savePath, FILE_MODE_WRITE);
+                        OrcaStream::Compress(*buffer, fs);
+                        // Only remember the content as autosaved once it is
+                        // on disk; a failed write (disk full, permissions)
+                        // must not suppress the next attempt. The game thread
+                        // reads the hash only after waiting on this future.
+                        _lastAutosaveHash = contentHash;
+                    }
+                    catch (const std::exception& e)
+                    {
+                        LOG_ERROR("Unable to write autosave: %s", e.what());
+                    }
+                });
+            }
+            else
+            {
+                LOG_VERBOSE("Park is unchanged since the previous autosave, skipping write");
+            }
+        }
+        else
+        {
+            parkFile->Save(gameState, path);
+        }
         result = true;
     }
     catch (const std::exception& e)
@@ -30,6 +30,10 @@ class ParkFileExporter
 public:
     std::vector<const ObjectRepositoryItem*> ExportObjectsList;
 
+    // Trade a slightly larger file for a much faster export; used for
+    // transient streams such as the multiplayer map transfer.
+    bool FastCompression{};
+
     void Export(OpenRCT2::GameState_t& gameState, std::string_view path);
     void Export(OpenRCT2::GameState_t& gameState, OpenRCT2::IStream& stream);
 };
@@ -14,6 +14,7 @@
 #include "../core/Guard.hpp"
 #include "../entity/Guest.h"
 #include "../entity/Staff.h"
+#include "../profiling/PerfCounters.h"
 #include "../profiling/Profiling.h"
 #include "../ride/RideData.h"
 #include "../ride/Station.h"
@@ -22,11 +23,15 @@
 #include "../util/Util.h"
 #include "../world/Entrance.h"
 #include "../world/Footpath.h"
+#include "../world/Map.h"
 
+#include <algorithm>
 #include <bit>
 #include <bitset>
 #include <cassert>
 #include <cstring>
+#include <optional>
+#include <unordered_map>
 
 bool gPeepPathFindIgnoreForeignQueues;
 RideId gPeepPathFindQueueRideIndex;
@@ -37,6 +42,88 @@ namespace OpenRCT2::PathFinding
     static int8_t _peepPathFindMaxJunctions;
     static int32_t _peepPathFindTilesChecked;
 
+    /* A whole-tick budget on heuristic search tile expansions, shared by
+     * every peep. Mass repath events (a ride closing, a path being removed)
+     * can otherwise make hundreds of peeps each run a full-limit search on
+     * the same tick. */
+    constexpr int32_t kPathFindTilesPerTick = 120000;
+    /* Once the shared budget is spent, the per-search limit of any further
+     * searches this tick is reduced by this divisor; every peep still gets
+     * an answer, just from a shallower search. */
+    constexpr int32_t kPathFindExhaustedDivisor = 8;
+    static int32_t _peepPathFindTickBudget = kPathFindTilesPerTick;
+
+    /* A shared cache of whole heuristic search results. When many guests head
+     * for the same goal - the park entrance at closing time, a newly opened
+     * ride - those standing on the same tile run identical searches, because
+     * a search with a completely null pathfind history depends only on the
+     * inputs below and the map. Guests whose history has entries must not use
+     * the cache, since the search consults remembered junctions. The cache
+     * lives for a single tick - hits skip the search without charging the
+     * tick budget, so entries surviving the tick would drain the budget at
+     * different points on differently warmed machines - and is also dropped
+     * mid-tick if the tile elements change. */
+    struct PathFindCacheKey
+    {
+        TileCoordsXYZ Location;
+        TileCoordsXYZ Goal;
+        uint8_t Edges;
+        uint8_t MaxJunctions;
+        RideId QueueRideIndex;
+        bool IgnoreForeignQueues;
+
+        bool operator==(const PathFindCacheKey&) const = default;
+    };
+
+    struct PathFindCacheKeyHasher
+    {
+        size_t operator()(const PathFindCacheKey& key) const noexcept
+        {
+            uint64_t hash = 0xCBF29CE484222325uLL;
+            const auto combine = [&hash](uint64_t value) { hash = (hash ^ value) * 0x100000001B3uLL; };
+            combine(key.Location.x);
+            combine(key.Location.y);
+            combine(key.Location.z);
+            combine(key.Goal.x);
+            combine(key.Goal.y);
+            combine(key.Goal.z);
+            combine(key.Edges);
+            combine(key.MaxJunctions);
+            combine(key.QueueRideIndex.ToUnderlying());
+            combine(key.IgnoreForeignQueues);
+            return static_cast<size_t>(hash);
+        }
+    };
+
+    // Mass repath events only need one entry per occupied tile, so this is plenty.
+    constexpr size_t kPathFindCacheMaxEntries = 4096;
+    static std::unordered_map<PathFindCacheKey, Direction, PathFindCacheKeyHasher> _pathFindCache;
+    static uint32_t _pathFindCacheGeneration;
+
+    static std::optional<Direction> PathFindCacheLookup(const PathFindCacheKey& key)
+    {
+        if (_pathFindCacheGeneration != MapGetTileElementGeneration())
+        {
+            _pathFindCache.clear();
+            _pathFindCacheGeneration = MapGetTileElementGeneration();
+            return std::nullopt;
+        }
+
+        auto it = _pathFindCache.find(key);
+        if (it == _pathFindCache.end())
+            return std::nullopt;
+        return it->second;
+    }
+
+    static void PathFindCacheStore(const PathFindCacheKey& key, Direction chosenEdge)
+    {
+        if (_pathFindCache.size() >= kPathFindCacheMaxEntries)
+        {
+            _pathFindCache.clear();
+        }
+        _pathFindCache[key] = chosenEdge;
+    }
+
     static int32_t GuestSurfacePathFinding(Peep& peep);
 
     /* A junction history for the peep pathfinding heuristic search
@@ -339,6 +426,27 @@ namespace OpenRCT2::PathFinding
         }
 
         loc += TileDirectionDelta[chosenDirection];
+
+        // The connectivity cache answers this for most tiles without scanning
+        // the element list; only tiles it cannot summarise are scanned below.
+        if (const auto* tileNodes = FootpathGetTileNodes(TileCoordsXY{ loc.x, loc.y }))
+        {
+            for (uint8_t i = 0; i < tileNodes->Count; i++)
+            {
+                const auto& node = tileNodes->Nodes[i];
+                if (!node.IsValidZAndDirection(loc.z, chosenDirection))
+                    continue;
+                if (node.Flags & kFootpathNodeFlagWide)
+                    return PathSearchResult::Wide;
+                // Only queue tiles that are connected to a ride are returned as ride queues.
+                if (node.Flags & kFootpathNodeFlagQueueHasRide)
+                    return PathSearchResult::RideQueue;
+
+                return PathSearchResult::Other;
+            }
+            return PathSearchResult::Failed;
+        }
+
         nextTileElement = MapGetFirstElementAt(loc);
         do
         {
@@ -722,6 +830,7 @@ namespace OpenRCT2::PathFinding
 
         ++numSteps;
         _peepPathFindTilesChecked--;
+        PerfCounters::PathfindingExpansions.fetch_add(1, std::memory_order_relaxed);
 
         /* If this is where the search started this is a search loop and the
          * current search path ends here.
@@ -1207,6 +1316,26 @@ namespace OpenRCT2::PathFinding
         }
     }
 
+    void ResetTickBudget()
+    {
+        /* The budget must be a pure function of the current tick's synced
+         * work: it is not serialised in the park file, so carrying overdraft
+         * across ticks would leave a mid-game joiner (or a resumed replay)
+         * with a fresh budget while the host is overdrawn, and their searches
+         * would degrade on different ticks. A search may still overdraw by up
+         * to its own limit, but the overdraft is forgiven at the boundary. */
+        _peepPathFindTickBudget = kPathFindTilesPerTick;
+
+        /* The cache must go cold at the same boundary. A cache hit skips the
+         * search and so never charges the budget; if entries survived the
+         * tick, a machine with a warm cache would drain the budget later than
+         * one that joined cold, and their searches would degrade at different
+         * points within the tick. Cleared every tick it still collapses the
+         * same-tick mass-repath spike, which is where the win is. */
+        _pathFindCache.clear();
+        _pathFindCacheGeneration = MapGetTileElementGeneration();
+    }
+
     /**
      * Returns:
      *   -1   - no direction chosen
@@ -1225,6 +1354,17 @@ namespace OpenRCT2::PathFinding
          * Mainly to limit the performance impact of the path finding. */
         int32_t maxTilesChecked = (peep.Is<Staff>()) ? 50000 : 15000;
 
+        /* Searches started after the shared per-tick budget has run out get a
+         * much smaller limit, trading path quality on busy ticks for a bounded
+         * total cost. The budget is reset at every tick boundary and then
+         * only depends on the tick's synced searches, so every client -
+         * including one that joined mid-game - degrades the same searches. */
+        const bool budgetExhausted = _peepPathFindTickBudget <= 0;
+        if (budgetExhausted)
+        {
+            maxTilesChecked /= kPathFindExhaustedDivisor;
+        }
+
         LogPathfinding(&peep, "Choose direction for goal %d,%d,%d from %d,%d,%d", goal.x, goal.y, goal.z, loc.x, loc.y, loc.z);
 
         // Get the path element at this location
@@ -1359,6 +1499,40 @@ namespace OpenRCT2::PathFinding
         // Peep has multiple edges still to try.
         if (edges & ~(1 << chosenEdge))
         {
+            /* A guest whose pathfind history is completely null runs a search
+             * that depends only on the cache key inputs, so the result can be
+             * shared with every other such guest making the same decision.
+             * Searches running under the degraded post-budget limit are
+             * excluded entirely: their results are not interchangeable with
+             * full-limit results for the same key, and a cached entry must
+             * always equal what a fresh search - e.g. on a mid-game joiner
+             * whose cache is empty - would compute. */
+            const bool cacheable = !budgetExhausted && peep.Is<Guest>()
+                && std::all_of(std::begin(peep.PathfindHistory), std::end(peep.PathfindHistory),
+                               [](const TileCoordsXYZD& entry) { return entry.IsNull(); });
+            const PathFindCacheKey cacheKey = { loc,
+                                                goal,
+                                                edges,
+                                                static_cast<uint8_t>(_peepPathFindMaxJunctions),
+                                                gPeepPathFindQueueRideIndex,
+                                                gPeepPathFindIgnoreForeignQueues };
+            bool foundInCache = false;
+            if (cacheable)
+            {
+                if (const auto cachedEdge = PathFindCacheLookup(cacheKey); cachedEdge.has_value())
+                {
+                    PerfCounters::PathfindCacheHits.fetch_add(1, std::memory_order_relaxed);
+                    if (!DirectionValid(*cachedEdge))
+                        return INVALID_DIRECTION;
+                    chosenEdge = *cachedEdge;
+                    foundInCache = true;
+                }
+                else
+                {
+                    PerfCounters::PathfindCacheMisses.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+
             uint8_t bestJunctions = 0;
             TileCoordsXYZ bestJunctionList[16];
             uint8_t bestDirectionList[16];
@@ -1375,7 +1549,7 @@ namespace OpenRCT2::PathFinding
              * or for different edges with equal value, the edge with the
              * least steps (best_sub). */
             int32_t numEdges = std::popcount(edges);
-            for (int32_t testEdge = chosenEdge; testEdge != -1; testEdge = UtilBitScanForward(edges))
+            for (int32_t testEdge = chosenEdge; !foundInCache && testEdge != -1; testEdge = UtilBitScanForward(edges))
             {
                 edges &= ~(1 << testEdge);
                 uint8_t height = loc.z;
@@ -1443,6 +1617,9 @@ namespace OpenRCT2::PathFinding
                     { loc.x, loc.y, height }, goal, peep, firstTileElement, inPatrolArea, 0, &score, testEdge, &endJunctions,
                     endJunctionList, endDirectionList, &endXYZ, &endSteps);
 
+                // Charge the tiles this edge actually expanded against the shared per-tick budget.
+                _peepPathFindTickBudget -= (maxTilesChecked / numEdges) - _peepPathFindTilesChecked;
+
                 if constexpr (kLogPathfinding)
                 {
                     LogPathfinding(
@@ -1482,12 +1659,21 @@ namespace OpenRCT2::PathFinding
             /* Check if the heuristic search failed. e.g. all connected
              * paths are within the search limits and none reaches the
              * goal. */
-            if (bestScore == 0xFFFF)
+            if (!foundInCache && bestScore == 0xFFFF)
             {
                 LogPathfinding(&peep, "Pathfind heuristic search failed.");
+                if (cacheable)
+                {
+                    PathFindCacheStore(cacheKey, INVALID_DIRECTION);
+                }
                 return INVALID_DIRECTION;
             }
 
+            if (cacheable && !foundInCache)
+            {
+                PathFindCacheStore(cacheKey, static_cast<Direction>(chosenEdge));
+            }
+
             if constexpr (kLogPathfinding)
             {
                 LogPathfinding(&peep, "Pathfind best edge %d with score %d steps %d", chosenEdge, bestScore, bestSub);
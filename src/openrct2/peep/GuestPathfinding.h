@@ -33,6 +33,10 @@ extern bool gPeepPathFindIgnoreForeignQueues;
 
 namespace OpenRCT2::PathFinding
 {
+    // Refills the shared per-tick search expansion budget, carrying over any
+    // overdraft. Called once per tick before the peeps are updated.
+    void ResetTickBudget();
+
     Direction ChooseDirection(const TileCoordsXYZ& loc, const TileCoordsXYZ& goal, Peep& peep);
 
     int32_t CalculateNextDestination(Guest& peep);
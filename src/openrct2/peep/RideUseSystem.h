@@ -8,13 +8,219 @@
  *****************************************************************************/
 
 #pragma once
-#include "../core/GroupVector.hpp"
+#include "../Identifiers.h"
 #include "../ride/RideTypes.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
 namespace OpenRCT2::RideUse
 {
-    using RideHistory = GroupVector<EntityId, RideId>;
-    using RideTypeHistory = GroupVector<EntityId, uint16_t>;
+    /**
+     * Ride history for one kind of value (ride ids or ride types), stored two
+     * ways: per-guest vectors for enumeration and (de)serialisation, plus an
+     * open-addressing set of (guest, value) keys packed into 32 bits so the
+     * membership checks inside guest decision loops are a short linear probe
+     * over flat memory with no pointer chasing.
+     */
+    template<typename V> class History
+    {
+        std::vector<std::vector<V>> _values;
+        std::vector<uint32_t> _keys;
+        size_t _count{};
+
+        // The null guest id paired with a null value, which never describes a real entry.
+        static constexpr uint32_t kEmptyKey = 0xFFFFFFFFu;
+        static constexpr size_t kMinCapacity = 8192;
+
+        static constexpr uint32_t ValueBits(V value)
+        {
+            if constexpr (std::is_integral_v<V>)
+                return static_cast<uint16_t>(value);
+            else
+                return value.ToUnderlying();
+        }
+
+        static constexpr uint32_t MakeKey(EntityId handle, V value)
+        {
+            return (static_cast<uint32_t>(handle.ToUnderlying()) << 16) | ValueBits(value);
+        }
+
+        static constexpr size_t HashKey(uint32_t key)
+        {
+            return key * 0x9E3779B1u;
+        }
+
+        bool ContainsKey(uint32_t key) const
+        {
+            if (_keys.empty())
+                return false;
+
+            const auto mask = _keys.size() - 1;
+            for (auto pos = HashKey(key) & mask; _keys[pos] != kEmptyKey; pos = (pos + 1) & mask)
+            {
+                if (_keys[pos] == key)
+                    return true;
+            }
+            return false;
+        }
+
+        void InsertKey(uint32_t key)
+        {
+            // Keep the load factor under 3/4 so probe chains stay short.
+            if (_keys.empty() || (_count + 1) * 4 >= _keys.size() * 3)
+            {
+                Rehash(std::max(kMinCapacity, _keys.size() * 2));
+            }
+
+            const auto mask = _keys.size() - 1;
+            auto pos = HashKey(key) & mask;
+            while (_keys[pos] != kEmptyKey)
+            {
+                if (_keys[pos] == key)
+                    return;
+                pos = (pos + 1) & mask;
+            }
+            _keys[pos] = key;
+            _count++;
+        }
+
+        void EraseKey(uint32_t key)
+        {
+            if (_keys.empty())
+                return;
+
+            const auto mask = _keys.size() - 1;
+            auto pos = HashKey(key) & mask;
+            while (_keys[pos] != key)
+            {
+                if (_keys[pos] == kEmptyKey)
+                    return;
+                pos = (pos + 1) & mask;
+            }
+
+            // Backward-shift deletion keeps probe chains intact without tombstones.
+            auto hole = pos;
+            auto next = (hole + 1) & mask;
+            while (_keys[next] != kEmptyKey)
+            {
+                const auto ideal = HashKey(_keys[next]) & mask;
+                if (((next - ideal) & mask) >= ((next - hole) & mask))
+                {
+                    _keys[hole] = _keys[next];
+                    hole = next;
+                }
+                next = (next + 1) & mask;
+            }
+            _keys[hole] = kEmptyKey;
+            _count--;
+        }
+
+        void Rehash(size_t newCapacity)
+        {
+            auto oldKeys = std::move(_keys);
+            _keys.assign(newCapacity, kEmptyKey);
+            const auto mask = newCapacity - 1;
+            for (auto key : oldKeys)
+            {
+                if (key == kEmptyKey)
+                    continue;
+                auto pos = HashKey(key) & mask;
+                while (_keys[pos] != kEmptyKey)
+                {
+                    pos = (pos + 1) & mask;
+                }
+                _keys[pos] = key;
+            }
+        }
+
+    public:
+        bool Contains(EntityId handle, V value) const
+        {
+            return ContainsKey(MakeKey(handle, value));
+        }
+
+        void Add(EntityId handle, V value)
+        {
+            if (Contains(handle, value))
+                return;
+
+            const auto index = static_cast<size_t>(handle.ToUnderlying());
+            if (index >= _values.size())
+            {
+                _values.resize(index + 1);
+            }
+            _values[index].push_back(value);
+            InsertKey(MakeKey(handle, value));
+        }
+
+        void Set(EntityId handle, std::vector<V>&& values)
+        {
+            const auto index = static_cast<size_t>(handle.ToUnderlying());
+            if (index >= _values.size())
+            {
+                _values.resize(index + 1);
+            }
+            for (auto value : _values[index])
+            {
+                EraseKey(MakeKey(handle, value));
+            }
+            _values[index] = values;
+            for (auto value : _values[index])
+            {
+                InsertKey(MakeKey(handle, value));
+            }
+        }
+
+        std::vector<V>* GetAll(EntityId handle)
+        {
+            const auto index = static_cast<size_t>(handle.ToUnderlying());
+            if (index < _values.size())
+            {
+                return &_values[index];
+            }
+            return nullptr;
+        }
+
+        void Clear()
+        {
+            _values.clear();
+            _keys.clear();
+            _count = 0;
+        }
+
+        void RemoveHandle(EntityId handle)
+        {
+            const auto index = static_cast<size_t>(handle.ToUnderlying());
+            if (index < _values.size())
+            {
+                for (auto value : _values[index])
+                {
+                    EraseKey(MakeKey(handle, value));
+                }
+                _values[index].clear();
+            }
+        }
+
+        void RemoveValue(V value)
+        {
+            for (size_t index = 0; index < _values.size(); index++)
+            {
+                auto& values = _values[index];
+                const auto it = std::remove_if(values.begin(), values.end(), [value](auto v) { return v == value; });
+                if (it != values.end())
+                {
+                    values.erase(it, values.end());
+                    EraseKey(MakeKey(EntityId::FromUnderlying(static_cast<uint16_t>(index)), value));
+                }
+            }
+        }
+    };
+
+    using RideHistory = History<RideId>;
+    using RideTypeHistory = History<uint16_t>;
 
     RideHistory& GetHistory();
     RideTypeHistory& GetTypeHistory();
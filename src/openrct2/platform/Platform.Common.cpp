@@ -202,4 +202,42 @@ namespace Platform
         return false;
     }
 
+    bool AVX512Available()
+    {
+#ifdef OPENRCT2_X86
+#    if defined(OpenRCT2_CPUID_GNUC_X86) && (!defined(__FreeBSD__) || (__FreeBSD__ > 10))
+        return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")
+            && __builtin_cpu_supports("avx512vl");
+#    else
+        // The mask path needs Foundation (16th bit), BW (30th bit) and VL (31st bit)
+        // of EBX with CPUID(EAX = 7, ECX = 0).
+        uint32_t regs[4] = { 0 };
+        if (CPUIDX86(regs, 7))
+        {
+            constexpr uint32_t kRequiredFeatures = (1u << 16) | (1u << 30) | (1u << 31);
+            bool avx512CPUSupport = (regs[1] & kRequiredFeatures) == kRequiredFeatures;
+            if (avx512CPUSupport)
+            {
+                // The OS must save the opmask and ZMM state on top of xmm/ymm.
+                // This check has to be conditional, otherwise INVALID_INSTRUCTION exception.
+                uint64_t xcrFeatureMask = _xgetbv(_XCR_XFEATURE_ENABLED_MASK);
+                avx512CPUSupport = (xcrFeatureMask & 0xE6) == 0xE6;
+            }
+            return avx512CPUSupport;
+        }
+#    endif
+#endif
+        return false;
+    }
+
+    bool NeonAvailable()
+    {
+#if defined(__aarch64__) || defined(_M_ARM64)
+        // Advanced SIMD is a mandatory part of AArch64.
+        return true;
+#else
+        return false;
+#endif
+    }
+
 } // namespace Platform
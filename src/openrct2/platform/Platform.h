@@ -127,6 +127,8 @@ namespace Platform
 
     bool SSE41Available();
     bool AVX2Available();
+    bool AVX512Available();
+    bool NeonAvailable();
 } // namespace Platform
 
 #ifdef __ANDROID__
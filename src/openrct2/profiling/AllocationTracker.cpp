@@ -0,0 +1,171 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "AllocationTracker.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+namespace OpenRCT2::AllocationTracker
+{
+    struct LiveAllocation
+    {
+        size_t Size;
+        AllocTag Tag;
+    };
+
+    static std::atomic<bool> _enabled{};
+    static thread_local AllocTag _currentTag = AllocTag::Untagged;
+
+    // One lock covers both the live map and the counters; tracking is an
+    // opt-in diagnostic, so contention is accepted for simplicity here.
+    static std::mutex _mutex;
+    static std::unordered_map<const void*, LiveAllocation> _liveAllocations;
+    static std::array<TagCounters, kAllocTagCount> _counters;
+
+    static constexpr const char* kAllocTagNames[] = {
+        "untagged",
+        "simulation",
+        "paint",
+        "object_load",
+    };
+    static_assert(std::size(kAllocTagNames) == kAllocTagCount);
+
+    bool IsEnabled()
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    void SetEnabled(bool enable)
+    {
+        _enabled.store(enable, std::memory_order_relaxed);
+    }
+
+    void Reset()
+    {
+        std::lock_guard guard(_mutex);
+        _liveAllocations.clear();
+        _counters.fill({});
+    }
+
+    TagCounters GetCounters(AllocTag tag)
+    {
+        std::lock_guard guard(_mutex);
+        return _counters[static_cast<size_t>(tag)];
+    }
+
+    const char* AllocTagName(AllocTag tag)
+    {
+        return kAllocTagNames[static_cast<size_t>(tag)];
+    }
+
+    AllocTag GetCurrentTag()
+    {
+        return _currentTag;
+    }
+
+    AllocTag SetCurrentTag(AllocTag tag)
+    {
+        const auto previous = _currentTag;
+        _currentTag = tag;
+        return previous;
+    }
+
+    static void RecordAllocationLocked(const void* ptr, size_t size)
+    {
+        auto& counters = _counters[static_cast<size_t>(_currentTag)];
+        counters.Count++;
+        counters.Bytes += size;
+        counters.LiveBytes += size;
+        counters.PeakLiveBytes = std::max(counters.PeakLiveBytes, counters.LiveBytes);
+        _liveAllocations[ptr] = { size, _currentTag };
+    }
+
+    static void RecordFreeLocked(const void* ptr)
+    {
+        auto it = _liveAllocations.find(ptr);
+        if (it == _liveAllocations.end())
+            return;
+
+        // Credit the tag that made the allocation, not the one freeing it.
+        auto& counters = _counters[static_cast<size_t>(it->second.Tag)];
+        counters.LiveBytes -= std::min<uint64_t>(counters.LiveBytes, it->second.Size);
+        _liveAllocations.erase(it);
+    }
+
+    void RecordAllocation(const void* ptr, size_t size)
+    {
+        if (!IsEnabled() || ptr == nullptr)
+            return;
+
+        std::lock_guard guard(_mutex);
+        RecordAllocationLocked(ptr, size);
+    }
+
+    void RecordReallocation(const void* oldPtr, const void* newPtr, size_t size)
+    {
+        if (!IsEnabled() || newPtr == nullptr)
+            return;
+
+        std::lock_guard guard(_mutex);
+        if (oldPtr != nullptr)
+        {
+            RecordFreeLocked(oldPtr);
+        }
+        RecordAllocationLocked(newPtr, size);
+    }
+
+    void RecordFree(const void* ptr)
+    {
+        if (!IsEnabled() || ptr == nullptr)
+            return;
+
+        std::lock_guard guard(_mutex);
+        RecordFreeLocked(ptr);
+    }
+
+    void RecordArenaAllocation(size_t size)
+    {
+        if (!IsEnabled())
+            return;
+
+        std::lock_guard guard(_mutex);
+        auto& counters = _counters[static_cast<size_t>(_currentTag)];
+        counters.ArenaCount++;
+        counters.ArenaBytes += size;
+    }
+
+    std::string ToJson()
+    {
+        std::lock_guard guard(_mutex);
+
+        std::ostringstream sb;
+        sb << "{";
+        for (size_t i = 0; i < kAllocTagCount; i++)
+        {
+            if (i != 0)
+                sb << ",";
+            const auto& counters = _counters[i];
+            sb << "\"" << kAllocTagNames[i] << "\":{";
+            sb << "\"count\":" << counters.Count;
+            sb << ",\"bytes\":" << counters.Bytes;
+            sb << ",\"live_bytes\":" << counters.LiveBytes;
+            sb << ",\"peak_live_bytes\":" << counters.PeakLiveBytes;
+            sb << ",\"arena_count\":" << counters.ArenaCount;
+            sb << ",\"arena_bytes\":" << counters.ArenaBytes;
+            sb << "}";
+        }
+        sb << "}";
+        return sb.str();
+    }
+} // namespace OpenRCT2::AllocationTracker
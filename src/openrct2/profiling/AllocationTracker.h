@@ -0,0 +1,90 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace OpenRCT2::AllocationTracker
+{
+    /**
+     * The subsystem an allocation is attributed to. The tag is a thread-local
+     * set by the innermost TagScope; allocations made outside any scope are
+     * counted as untagged.
+     */
+    enum class AllocTag : uint8_t
+    {
+        Untagged,
+        Simulation,
+        Paint,
+        ObjectLoad,
+        Count
+    };
+
+    constexpr size_t kAllocTagCount = static_cast<size_t>(AllocTag::Count);
+
+    struct TagCounters
+    {
+        uint64_t Count{};
+        uint64_t Bytes{};
+        uint64_t LiveBytes{};
+        uint64_t PeakLiveBytes{};
+        uint64_t ArenaCount{};
+        uint64_t ArenaBytes{};
+    };
+
+    bool IsEnabled();
+    void SetEnabled(bool enable);
+    void Reset();
+
+    TagCounters GetCounters(AllocTag tag);
+    const char* AllocTagName(AllocTag tag);
+    std::string ToJson();
+
+    // Called from the allocation paths in core; each is a no-op apart from a
+    // flag test while tracking is disabled. Frees of allocations made before
+    // tracking was enabled are ignored.
+    void RecordAllocation(const void* ptr, size_t size);
+    void RecordReallocation(const void* oldPtr, const void* newPtr, size_t size);
+    void RecordFree(const void* ptr);
+
+    // Arena allocations are reclaimed wholesale rather than freed, so they
+    // only contribute to the cumulative arena counters of the current tag.
+    void RecordArenaAllocation(size_t size);
+
+    AllocTag GetCurrentTag();
+    // Returns the previously active tag.
+    AllocTag SetCurrentTag(AllocTag tag);
+
+    /**
+     * Attributes all allocations on the current thread to the given tag for
+     * the lifetime of the scope.
+     */
+    class TagScope
+    {
+    public:
+        explicit TagScope(AllocTag tag)
+            : _previous(SetCurrentTag(tag))
+        {
+        }
+
+        ~TagScope()
+        {
+            SetCurrentTag(_previous);
+        }
+
+        TagScope(const TagScope&) = delete;
+        TagScope& operator=(const TagScope&) = delete;
+
+    private:
+        AllocTag _previous;
+    };
+} // namespace OpenRCT2::AllocationTracker
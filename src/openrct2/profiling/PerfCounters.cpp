@@ -0,0 +1,200 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "PerfCounters.h"
+
+#include "../entity/EntityList.h"
+#include "../network/network.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace OpenRCT2::PerfCounters
+{
+    std::atomic<uint64_t> GameTicks{};
+    std::atomic<uint64_t> PathfindingExpansions{};
+    std::atomic<uint64_t> PathfindCacheHits{};
+    std::atomic<uint64_t> PathfindCacheMisses{};
+
+    // Paint frame times are written into a fixed ring with a relaxed index so
+    // the paint thread never takes a lock; the export copies what is there.
+    static constexpr size_t kPaintSampleCount = 256;
+    static std::array<std::atomic<double>, kPaintSampleCount> _paintSamplesMs{};
+    static std::atomic<uint64_t> _paintFrames{};
+
+    static constexpr const char* kEntityTypeNames[] = {
+        "vehicle",        "guest",           "staff",        "litter",          "steam_particle",
+        "money_effect",   "crashed_vehicle", "explosion",    "crash_splash",    "explosion_flare",
+        "fountain",       "balloon",         "duck",
+    };
+    static_assert(std::size(kEntityTypeNames) == EnumValue(EntityType::Count));
+
+    void RecordPaintTime(double ms)
+    {
+        const auto frame = _paintFrames.fetch_add(1, std::memory_order_relaxed);
+        _paintSamplesMs[frame % kPaintSampleCount].store(ms, std::memory_order_relaxed);
+    }
+
+    // Tick pipeline stages accumulate totals rather than sampling; the export
+    // derives the average so both long-run totals and per-tick cost are
+    // available per stage.
+    static constexpr size_t kMaxTickStages = 32;
+    struct TickStageCounter
+    {
+        std::atomic<const char*> Name{};
+        std::atomic<double> TotalMs{};
+        std::atomic<uint64_t> Count{};
+    };
+    static std::array<TickStageCounter, kMaxTickStages> _tickStages{};
+
+    void RecordTickStageTime(size_t stageIndex, const char* name, double ms)
+    {
+        if (stageIndex >= kMaxTickStages)
+            return;
+        auto& stage = _tickStages[stageIndex];
+        stage.Name.store(name, std::memory_order_relaxed);
+        stage.TotalMs.fetch_add(ms, std::memory_order_relaxed);
+        stage.Count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Startup milestones are recorded a handful of times from the
+    // initialisation threads and then only read, so a mutex is fine here.
+    struct StartupMilestone
+    {
+        const char* Name;
+        double Ms;
+    };
+    static std::vector<StartupMilestone> _startupMilestones;
+    static std::mutex _startupMilestonesMutex;
+
+    void RecordStartupMilestone(const char* name, double ms)
+    {
+        std::scoped_lock lock(_startupMilestonesMutex);
+        _startupMilestones.push_back({ name, ms });
+    }
+
+    static double GetPercentile(const std::vector<double>& sortedSamples, size_t percentile)
+    {
+        const auto index = (sortedSamples.size() - 1) * percentile / 100;
+        return sortedSamples[index];
+    }
+
+    std::string ExportJson()
+    {
+        // Rates are derived from the change since the previous export.
+        static uint64_t _lastTicks;
+        static uint64_t _lastFrames;
+        static std::chrono::steady_clock::time_point _lastExport;
+
+        const auto now = std::chrono::steady_clock::now();
+        const auto ticks = GameTicks.load(std::memory_order_relaxed);
+        const auto frames = _paintFrames.load(std::memory_order_relaxed);
+        const auto seconds = std::chrono::duration<double>(now - _lastExport).count();
+
+        double ticksPerSecond = 0;
+        double framesPerSecond = 0;
+        if (_lastExport.time_since_epoch().count() != 0 && seconds > 0)
+        {
+            ticksPerSecond = (ticks - _lastTicks) / seconds;
+            framesPerSecond = (frames - _lastFrames) / seconds;
+        }
+        _lastTicks = ticks;
+        _lastFrames = frames;
+        _lastExport = now;
+
+        std::vector<double> paintMs;
+        const auto numSamples = std::min<uint64_t>(frames, kPaintSampleCount);
+        paintMs.reserve(numSamples);
+        for (size_t i = 0; i < numSamples; i++)
+        {
+            paintMs.push_back(_paintSamplesMs[i].load(std::memory_order_relaxed));
+        }
+        std::sort(paintMs.begin(), paintMs.end());
+
+        std::ostringstream sb;
+        sb << "{";
+        sb << "\"game_ticks\":" << ticks;
+        sb << ",\"ticks_per_second\":" << ticksPerSecond;
+        sb << ",\"paint_frames\":" << frames;
+        sb << ",\"frames_per_second\":" << framesPerSecond;
+        if (!paintMs.empty())
+        {
+            sb << ",\"paint_ms\":{";
+            sb << "\"p50\":" << GetPercentile(paintMs, 50);
+            sb << ",\"p95\":" << GetPercentile(paintMs, 95);
+            sb << ",\"p99\":" << GetPercentile(paintMs, 99);
+            sb << ",\"max\":" << paintMs.back();
+            sb << "}";
+        }
+        sb << ",\"pathfinding_expansions\":" << PathfindingExpansions.load(std::memory_order_relaxed);
+        sb << ",\"pathfind_cache_hits\":" << PathfindCacheHits.load(std::memory_order_relaxed);
+        sb << ",\"pathfind_cache_misses\":" << PathfindCacheMisses.load(std::memory_order_relaxed);
+
+        {
+            bool first = true;
+            for (const auto& stage : _tickStages)
+            {
+                const auto* name = stage.Name.load(std::memory_order_relaxed);
+                const auto count = stage.Count.load(std::memory_order_relaxed);
+                if (name == nullptr || count == 0)
+                    continue;
+                sb << (first ? ",\"tick_stage_ms\":{" : ",");
+                const auto total = stage.TotalMs.load(std::memory_order_relaxed);
+                sb << "\"" << name << "\":{\"total\":" << total << ",\"avg\":" << total / count << "}";
+                first = false;
+            }
+            if (!first)
+            {
+                sb << "}";
+            }
+        }
+
+        {
+            std::scoped_lock lock(_startupMilestonesMutex);
+            if (!_startupMilestones.empty())
+            {
+                sb << ",\"startup_ms\":{";
+                for (size_t i = 0; i < _startupMilestones.size(); i++)
+                {
+                    if (i != 0)
+                        sb << ",";
+                    sb << "\"" << _startupMilestones[i].Name << "\":" << _startupMilestones[i].Ms;
+                }
+                sb << "}";
+            }
+        }
+
+        sb << ",\"entities\":{";
+        for (uint8_t i = 0; i < EnumValue(EntityType::Count); i++)
+        {
+            if (i != 0)
+                sb << ",";
+            sb << "\"" << kEntityTypeNames[i] << "\":" << GetEntityListCount(static_cast<EntityType>(i));
+        }
+        sb << "}";
+
+        const auto networkStats = NetworkGetStats();
+        uint64_t bytesReceived = 0;
+        uint64_t bytesSent = 0;
+        for (size_t i = 0; i < EnumValue(NetworkStatisticsGroup::Max); i++)
+        {
+            bytesReceived += networkStats.bytesReceived[i];
+            bytesSent += networkStats.bytesSent[i];
+        }
+        sb << ",\"network_bytes_received\":" << bytesReceived;
+        sb << ",\"network_bytes_sent\":" << bytesSent;
+
+        sb << "}";
+        return sb.str();
+    }
+} // namespace OpenRCT2::PerfCounters
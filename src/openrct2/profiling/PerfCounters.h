@@ -0,0 +1,59 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace OpenRCT2::PerfCounters
+{
+    /**
+     * Always-on performance counters. Each counter is a single relaxed atomic
+     * increment at its recording site, so they are compiled into release
+     * builds and cost next to nothing while nobody reads them. Gauges such as
+     * entity counts and network byte totals are sampled at export time rather
+     * than maintained.
+     */
+
+    // Game simulation ticks executed.
+    extern std::atomic<uint64_t> GameTicks;
+
+    // Tiles expanded by the guest/staff pathfinding heuristic search.
+    extern std::atomic<uint64_t> PathfindingExpansions;
+
+    // Outcomes of shared pathfind cache probes by cacheable searches; the hit
+    // ratio shows how much duplicate search work the cache absorbs.
+    extern std::atomic<uint64_t> PathfindCacheHits;
+    extern std::atomic<uint64_t> PathfindCacheMisses;
+
+    // Records the wall-clock cost of one painted frame into a small sample
+    // ring used for the exported percentiles.
+    void RecordPaintTime(double ms);
+
+    // Accumulates the wall-clock cost of one run of a tick pipeline stage.
+    // The name must be a static string; stages appear in the export under
+    // "tick_stage_ms" once they have run at least once.
+    void RecordTickStageTime(size_t stageIndex, const char* name, double ms);
+
+    // Records the time at which a named startup milestone was reached,
+    // measured from the start of Context::Initialise. Exported under
+    // "startup_ms" so cold and warm start regressions show up on the same
+    // surface as the runtime counters.
+    void RecordStartupMilestone(const char* name, double ms);
+
+    /**
+     * Serialises the counters, paint time percentiles, current entity counts
+     * by type and network byte totals as JSON. Rates (ticks and frames per
+     * second) are derived from the change since the previous export, so a
+     * scraper polling this gets both raw totals and rates.
+     */
+    std::string ExportJson();
+} // namespace OpenRCT2::PerfCounters
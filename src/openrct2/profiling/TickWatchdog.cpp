@@ -0,0 +1,253 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TickWatchdog.h"
+
+#include "../Context.h"
+#include "../Diagnostic.h"
+#include "../GameState.h"
+#include "../actions/GameAction.h"
+#include "PerfCounters.h"
+
+#ifdef ENABLE_SCRIPTING
+    #include "../scripting/HookEngine.h"
+    #include "../scripting/Plugin.h"
+    #include "../scripting/ScriptEngine.h"
+#endif
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <sstream>
+#include <string_view>
+#include <vector>
+
+namespace OpenRCT2::TickWatchdog
+{
+    // How many overrun captures are kept; the oldest is dropped once full so
+    // a long-running server holds on to the most recent incidents.
+    static constexpr size_t kMaxCaptures = 16;
+
+    // Queued actions listed per capture, the rest is summarised by the depth.
+    static constexpr size_t kMaxCapturedActions = 16;
+
+    static constexpr size_t kMaxCapturedHooks = 5;
+
+    static double _budgetMs = 0;
+    static bool _enabled = false;
+
+    static std::array<uint64_t, kTickPhaseCount> _phaseTimesNs{};
+    static std::chrono::high_resolution_clock::time_point _tickStart;
+    static uint64_t _pathfindingAtTickBegin;
+    static std::deque<std::string> _captures;
+
+#ifdef ENABLE_SCRIPTING
+    // Cumulative hook times at the start of the tick, keyed by hook cookie,
+    // so the capture can report how much each hook contributed to this tick.
+    static std::vector<std::pair<uint32_t, uint64_t>> _hookTimesAtBegin;
+#endif
+
+    static constexpr const char* kTickPhaseNames[] = {
+        "network",      "date",         "scenario",     "map_tiles", "peeps",     "vehicles",
+        "misc_entities", "rides",       "park",         "scheduled", "ride_ratings",
+        "measurements", "ambience",     "game_actions", "script_hooks",
+    };
+    static_assert(std::size(kTickPhaseNames) == kTickPhaseCount);
+
+    bool IsEnabled()
+    {
+        return _enabled;
+    }
+
+    double GetBudgetMs()
+    {
+        return _budgetMs;
+    }
+
+    void SetBudgetMs(double budgetMs)
+    {
+        _budgetMs = std::max(budgetMs, 0.0);
+        _enabled = _budgetMs > 0;
+    }
+
+    const char* TickPhaseName(TickPhase phase)
+    {
+        return kTickPhaseNames[static_cast<size_t>(phase)];
+    }
+
+    void AddPhaseTime(TickPhase phase, uint64_t timeNs)
+    {
+        _phaseTimesNs[static_cast<size_t>(phase)] += timeNs;
+    }
+
+    size_t GetCaptureCount()
+    {
+        return _captures.size();
+    }
+
+    std::string GetCapturesJson()
+    {
+        std::string result;
+        for (const auto& capture : _captures)
+        {
+            result += capture;
+            result += '\n';
+        }
+        return result;
+    }
+
+    void ClearCaptures()
+    {
+        _captures.clear();
+    }
+
+    static void WriteJsonString(std::ostringstream& sb, std::string_view value)
+    {
+        sb << '"';
+        for (char c : value)
+        {
+            if (c == '"' || c == '\\')
+                sb << '\\' << c;
+            else if (static_cast<uint8_t>(c) >= 0x20)
+                sb << c;
+        }
+        sb << '"';
+    }
+
+    void TickBegin()
+    {
+        if (!_enabled)
+            return;
+
+        _phaseTimesNs.fill(0);
+        _pathfindingAtTickBegin = PerfCounters::PathfindingExpansions.load(std::memory_order_relaxed);
+
+#ifdef ENABLE_SCRIPTING
+        _hookTimesAtBegin.clear();
+        auto& hookEngine = GetContext()->GetScriptEngine().GetHookEngine();
+        for (const auto& hookList : hookEngine.GetAllHookLists())
+        {
+            for (const auto& hook : hookList.Hooks)
+            {
+                _hookTimesAtBegin.emplace_back(hook.Cookie, hook.TotalTimeUs);
+            }
+        }
+#endif
+
+        _tickStart = std::chrono::high_resolution_clock::now();
+    }
+
+    void TickEnd()
+    {
+        if (!_enabled)
+            return;
+
+        const auto elapsed = std::chrono::high_resolution_clock::now() - _tickStart;
+        const auto totalMs = std::chrono::duration<double, std::milli>(elapsed).count();
+        if (totalMs <= _budgetMs)
+            return;
+
+        uint64_t phaseSumNs = 0;
+        auto slowestPhase = TickPhase::Network;
+        for (size_t i = 0; i < kTickPhaseCount; i++)
+        {
+            phaseSumNs += _phaseTimesNs[i];
+            if (_phaseTimesNs[i] > _phaseTimesNs[static_cast<size_t>(slowestPhase)])
+                slowestPhase = static_cast<TickPhase>(i);
+        }
+        const auto totalNs = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+        std::ostringstream sb;
+        sb << "{";
+        sb << "\"tick\":" << GetGameState().CurrentTicks;
+        sb << ",\"total_ms\":" << totalMs;
+        sb << ",\"budget_ms\":" << _budgetMs;
+        sb << ",\"slowest_phase\":\"" << TickPhaseName(slowestPhase) << "\"";
+
+        sb << ",\"phases_ms\":{";
+        for (size_t i = 0; i < kTickPhaseCount; i++)
+        {
+            sb << "\"" << kTickPhaseNames[i] << "\":" << _phaseTimesNs[i] / 1e6 << ",";
+        }
+        sb << "\"other\":" << (totalNs > phaseSumNs ? (totalNs - phaseSumNs) / 1e6 : 0.0);
+        sb << "}";
+
+        const auto pathfindingExpansions = PerfCounters::PathfindingExpansions.load(std::memory_order_relaxed)
+            - _pathfindingAtTickBegin;
+        sb << ",\"pathfinding_expansions\":" << pathfindingExpansions;
+
+        const auto queuedActions = GameActions::GetQueueInfo();
+        sb << ",\"action_queue_depth\":" << queuedActions.size();
+        sb << ",\"action_queue\":[";
+        for (size_t i = 0; i < std::min(queuedActions.size(), kMaxCapturedActions); i++)
+        {
+            if (i != 0)
+                sb << ",";
+            sb << "{\"name\":";
+            WriteJsonString(sb, queuedActions[i].name);
+            sb << ",\"tick\":" << queuedActions[i].tick << "}";
+        }
+        sb << "]";
+
+#ifdef ENABLE_SCRIPTING
+        struct HookTime
+        {
+            uint64_t TimeUs;
+            std::string_view PluginName;
+            std::string_view HookName;
+        };
+        std::vector<HookTime> hookTimes;
+        auto& hookEngine = GetContext()->GetScriptEngine().GetHookEngine();
+        for (const auto& hookList : hookEngine.GetAllHookLists())
+        {
+            for (const auto& hook : hookList.Hooks)
+            {
+                auto timeUs = hook.TotalTimeUs;
+                auto it = std::find_if(
+                    _hookTimesAtBegin.begin(), _hookTimesAtBegin.end(),
+                    [&](const auto& entry) { return entry.first == hook.Cookie; });
+                if (it != _hookTimesAtBegin.end())
+                    timeUs -= it->second;
+                if (timeUs > 0)
+                {
+                    hookTimes.push_back(
+                        { timeUs, hook.Owner->GetMetadata().Name, Scripting::GetHookName(hookList.Type) });
+                }
+            }
+        }
+        std::sort(hookTimes.begin(), hookTimes.end(), [](const auto& a, const auto& b) { return a.TimeUs > b.TimeUs; });
+
+        sb << ",\"top_hooks\":[";
+        for (size_t i = 0; i < std::min(hookTimes.size(), kMaxCapturedHooks); i++)
+        {
+            if (i != 0)
+                sb << ",";
+            sb << "{\"plugin\":";
+            WriteJsonString(sb, hookTimes[i].PluginName);
+            sb << ",\"hook\":";
+            WriteJsonString(sb, hookTimes[i].HookName);
+            sb << ",\"ms\":" << hookTimes[i].TimeUs / 1e3 << "}";
+        }
+        sb << "]";
+#endif
+
+        sb << "}";
+
+        if (_captures.size() >= kMaxCaptures)
+        {
+            _captures.pop_front();
+        }
+        _captures.push_back(sb.str());
+
+        LOG_WARNING(
+            "Game tick %u took %.2f ms (budget %.2f ms), slowest phase: %s", GetGameState().CurrentTicks, totalMs, _budgetMs,
+            TickPhaseName(slowestPhase));
+    }
+} // namespace OpenRCT2::TickWatchdog
@@ -0,0 +1,100 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace OpenRCT2::TickWatchdog
+{
+    /**
+     * The game update phases the watchdog attributes time to. The order
+     * mirrors the blocks in gameStateUpdateLogic(); anything not covered by a
+     * phase scope is reported as "other".
+     */
+    enum class TickPhase : uint8_t
+    {
+        Network,
+        Date,
+        Scenario,
+        MapTiles,
+        Peeps,
+        Vehicles,
+        MiscEntities,
+        Rides,
+        Park,
+        Scheduled,
+        RideRatings,
+        Measurements,
+        Ambience,
+        GameActions,
+        ScriptHooks,
+        Count
+    };
+
+    constexpr size_t kTickPhaseCount = static_cast<size_t>(TickPhase::Count);
+
+    bool IsEnabled();
+
+    // A budget of zero (the default) disables the watchdog entirely.
+    double GetBudgetMs();
+    void SetBudgetMs(double budgetMs);
+
+    // Called by gameStateUpdateLogic() around each tick. TickEnd compares the
+    // elapsed time against the budget and captures a diagnostic on overrun.
+    void TickBegin();
+    void TickEnd();
+
+    void AddPhaseTime(TickPhase phase, uint64_t timeNs);
+    const char* TickPhaseName(TickPhase phase);
+
+    size_t GetCaptureCount();
+    // The most recent overrun captures as one JSON document per line, oldest
+    // first.
+    std::string GetCapturesJson();
+    void ClearCaptures();
+
+    /**
+     * Times one phase of the game tick. Only reads a flag when the watchdog
+     * is disabled, so the scopes can stay in gameStateUpdateLogic()
+     * permanently.
+     */
+    class PhaseScope
+    {
+    public:
+        explicit PhaseScope(TickPhase phase)
+            : _phase(phase)
+            , _enabled(IsEnabled())
+        {
+            if (_enabled)
+            {
+                _start = std::chrono::high_resolution_clock::now();
+            }
+        }
+
+        ~PhaseScope()
+        {
+            if (_enabled)
+            {
+                const auto elapsed = std::chrono::high_resolution_clock::now() - _start;
+                AddPhaseTime(_phase, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+            }
+        }
+
+        PhaseScope(const PhaseScope&) = delete;
+        PhaseScope& operator=(const PhaseScope&) = delete;
+
+    private:
+        TickPhase _phase;
+        bool _enabled;
+        std::chrono::high_resolution_clock::time_point _start;
+    };
+} // namespace OpenRCT2::TickWatchdog
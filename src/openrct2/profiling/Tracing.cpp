@@ -0,0 +1,127 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "Tracing.h"
+
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace OpenRCT2::Tracing
+{
+    namespace Detail
+    {
+        std::atomic_bool _recording{};
+
+        struct Event
+        {
+            const char* Name;
+            uint64_t StartNs;
+            uint64_t DurationNs;
+        };
+
+        // Each thread records into its own fixed ring so tracing never blocks
+        // the traced code; old events are overwritten once the ring is full.
+        struct ThreadBuffer
+        {
+            uint32_t ThreadId{};
+            std::array<Event, 16384> Events{};
+            uint64_t WriteCount{};
+        };
+
+        // Buffers are owned by the registry rather than the threads so that a
+        // capture can still be exported after a worker thread has exited.
+        static std::mutex _registryMutex;
+        static std::vector<std::unique_ptr<ThreadBuffer>> _registry;
+        static thread_local ThreadBuffer* _tlsBuffer;
+
+        uint64_t Now()
+        {
+            using Clock = std::chrono::high_resolution_clock;
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+        }
+
+        void RecordEvent(const char* name, uint64_t startNs, uint64_t durationNs)
+        {
+            auto* buffer = _tlsBuffer;
+            if (buffer == nullptr)
+            {
+                std::scoped_lock lock(_registryMutex);
+                auto newBuffer = std::make_unique<ThreadBuffer>();
+                newBuffer->ThreadId = static_cast<uint32_t>(_registry.size());
+                buffer = newBuffer.get();
+                _registry.push_back(std::move(newBuffer));
+                _tlsBuffer = buffer;
+            }
+            auto& ev = buffer->Events[buffer->WriteCount % buffer->Events.size()];
+            ev.Name = name;
+            ev.StartNs = startNs;
+            ev.DurationNs = durationNs;
+            buffer->WriteCount++;
+        }
+    } // namespace Detail
+
+    void Start()
+    {
+        Detail::_recording = true;
+    }
+
+    void Stop()
+    {
+        Detail::_recording = false;
+    }
+
+    void Clear()
+    {
+        std::scoped_lock lock(Detail::_registryMutex);
+        for (auto& buffer : Detail::_registry)
+        {
+            buffer->WriteCount = 0;
+        }
+    }
+
+    bool ExportTrace(const std::string& filePath)
+    {
+        std::ofstream out(filePath);
+        if (!out.is_open())
+            return false;
+
+        out << "{\"traceEvents\":[";
+
+        std::scoped_lock lock(Detail::_registryMutex);
+        bool first = true;
+        for (const auto& buffer : Detail::_registry)
+        {
+            const auto capacity = buffer->Events.size();
+            const auto numEvents = std::min<uint64_t>(buffer->WriteCount, capacity);
+            const auto start = buffer->WriteCount - numEvents;
+            for (uint64_t i = start; i < buffer->WriteCount; i++)
+            {
+                const auto& ev = buffer->Events[i % capacity];
+                if (!first)
+                    out << ",";
+                first = false;
+
+                // Chrome trace timestamps and durations are in microseconds;
+                // the nanosecond remainder is kept as zero-padded decimals.
+                out << "{\"name\":\"" << ev.Name << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->ThreadId
+                    << ",\"ts\":" << (ev.StartNs / 1000) << "." << std::setw(3) << std::setfill('0') << (ev.StartNs % 1000)
+                    << std::setfill(' ') << ",\"dur\":" << (ev.DurationNs / 1000) << "." << std::setw(3) << std::setfill('0')
+                    << (ev.DurationNs % 1000) << std::setfill(' ') << "}";
+            }
+        }
+
+        out << "]}";
+        return true;
+    }
+} // namespace OpenRCT2::Tracing
@@ -0,0 +1,82 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace OpenRCT2::Tracing
+{
+    // Scoped trace events recorded into per-thread ring buffers while a
+    // capture is running, exported as Chrome trace JSON (chrome://tracing,
+    // Perfetto). Unlike the aggregating profiler this keeps the individual
+    // events with their timestamps, so stutter shows up as what ran long on
+    // which frame rather than as a shifted average. When no capture is
+    // running a scope costs one relaxed atomic load.
+
+    void Start();
+    void Stop();
+    void Clear();
+
+    namespace Detail
+    {
+        extern std::atomic_bool _recording;
+
+        uint64_t Now();
+        void RecordEvent(const char* name, uint64_t startNs, uint64_t durationNs);
+    } // namespace Detail
+
+    inline bool IsRecording()
+    {
+        return Detail::_recording.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Records the lifetime of the enclosing scope as one trace event.
+     * The name must be a string literal or otherwise outlive the capture.
+     */
+    class ScopedEvent
+    {
+    public:
+        explicit ScopedEvent(const char* name)
+            : _name(IsRecording() ? name : nullptr)
+        {
+            if (_name != nullptr)
+            {
+                _start = Detail::Now();
+            }
+        }
+
+        ~ScopedEvent()
+        {
+            if (_name != nullptr)
+            {
+                Detail::RecordEvent(_name, _start, Detail::Now() - _start);
+            }
+        }
+
+        ScopedEvent(const ScopedEvent&) = delete;
+        ScopedEvent& operator=(const ScopedEvent&) = delete;
+
+    private:
+        const char* _name;
+        uint64_t _start{};
+    };
+
+    /**
+     * Writes the recorded events as Chrome trace JSON to the given path.
+     */
+    bool ExportTrace(const std::string& filePath);
+
+#define TRACE_CONCAT2(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT2(a, b)
+#define TRACE_SCOPE(name) ::OpenRCT2::Tracing::ScopedEvent TRACE_CONCAT(_traceScope, __LINE__)(name)
+
+} // namespace OpenRCT2::Tracing
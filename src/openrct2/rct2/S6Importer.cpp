@@ -298,6 +298,7 @@ namespace RCT2
                     gameState.ExpenditureTable[i][j] = ToMoney64(_s6.ExpenditureTable[i][j]);
                 }
             }
+            FinanceRefreshExpenditureSummaries();
 
             gameState.NumGuestsInParkLastWeek = _s6.LastGuestsInPark;
             // Pad01357BCA
@@ -232,6 +232,11 @@ bool Vehicle::CableLiftUpdateTrackMotionForwards()
     if (curRide == nullptr)
         return false;
 
+    // Invariant per call; the track progress total only changes when the car
+    // crosses onto the next piece, so refresh it there rather than every step.
+    const int32_t vehicleZOffset = GetRideTypeDescriptor(curRide->type).Heights.VehicleZOffset;
+    uint16_t trackTotalProgress = GetTrackProgress();
+
     for (; remaining_distance >= 13962; _vehicleUnkF64E10++)
     {
         auto trackType = GetTrackType();
@@ -242,7 +247,6 @@ bool Vehicle::CableLiftUpdateTrackMotionForwards()
 
         uint16_t trackProgress = track_progress + 1;
 
-        uint16_t trackTotalProgress = GetTrackProgress();
         if (trackProgress >= trackTotalProgress)
         {
             TileElement* trackElement = MapGetTrackElementAtOfTypeSeq(TrackLocation, trackType, 0);
@@ -263,6 +267,7 @@ bool Vehicle::CableLiftUpdateTrackMotionForwards()
             SetTrackDirection(outputDirection);
             SetTrackType(output.element->AsTrack()->GetTrackType());
             trackProgress = 0;
+            trackTotalProgress = GetTrackProgress();
         }
 
         track_progress = trackProgress;
@@ -270,7 +275,7 @@ bool Vehicle::CableLiftUpdateTrackMotionForwards()
         auto nextVehiclePosition = CoordsXYZ{ moveInfo->x, moveInfo->y, moveInfo->z } + TrackLocation;
 
         uint8_t remainingDistanceFlags = 0;
-        nextVehiclePosition.z += GetRideTypeDescriptor(curRide->type).Heights.VehicleZOffset;
+        nextVehiclePosition.z += vehicleZOffset;
         if (nextVehiclePosition.x != _vehicleCurPosition.x)
             remainingDistanceFlags |= (1 << 0);
         if (nextVehiclePosition.y != _vehicleCurPosition.y)
@@ -301,6 +306,8 @@ bool Vehicle::CableLiftUpdateTrackMotionBackwards()
     if (curRide == nullptr)
         return false;
 
+    const int32_t vehicleZOffset = GetRideTypeDescriptor(curRide->type).Heights.VehicleZOffset;
+
     for (; remaining_distance < 0; _vehicleUnkF64E10++)
     {
         uint16_t trackProgress = track_progress - 1;
@@ -336,7 +343,7 @@ bool Vehicle::CableLiftUpdateTrackMotionBackwards()
         auto unk = CoordsXYZ{ moveInfo->x, moveInfo->y, moveInfo->z } + TrackLocation;
 
         uint8_t remainingDistanceFlags = 0;
-        unk.z += GetRideTypeDescriptor(curRide->type).Heights.VehicleZOffset;
+        unk.z += vehicleZOffset;
         if (unk.x != _vehicleCurPosition.x)
             remainingDistanceFlags |= (1 << 0);
         if (unk.y != _vehicleCurPosition.y)
@@ -81,6 +81,7 @@
 #include <iterator>
 #include <limits>
 #include <optional>
+#include <vector>
 
 using namespace OpenRCT2;
 using namespace OpenRCT2::TrackMetaData;
@@ -119,7 +120,7 @@ struct StationIndexWithMessage
 };
 
 // Static function declarations
-Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspection);
+Staff* FindClosestMechanic(const CoordsXY& entrancePosition, uint16_t targetComponent, int32_t forInspection);
 static void RideBreakdownStatusUpdate(Ride& ride);
 static void RideBreakdownUpdate(Ride& ride);
 static void RideCallClosestMechanic(Ride& ride);
@@ -131,6 +132,14 @@ static void RideMechanicStatusUpdate(Ride& ride, int32_t mechanicStatus);
 static void RideMusicUpdate(Ride& ride);
 static void RideShopConnected(const Ride& ride);
 
+// Maintenance due flags, computed once per tick in Ride::UpdateAll so that the
+// per-ride update loop only enters the breakdown/inspection paths on ticks
+// where they are actually due, instead of every ride re-testing the global
+// tick masks.
+static bool _breakdownUpdateDue;
+static bool _inspectionUpdateDue;
+static uint8_t _breakdownStatusUpdateRideByte;
+
 RideManager GetRideManager()
 {
     return {};
@@ -359,20 +368,6 @@ Guest* Ride::GetQueueHeadGuest(StationIndex stationIndex) const
     return result;
 }
 
-void Ride::UpdateQueueLength(StationIndex stationIndex)
-{
-    uint16_t count = 0;
-    Guest* peep;
-    auto& station = GetStation(stationIndex);
-    auto spriteIndex = station.LastPeepInQueue;
-    while ((peep = TryGetEntity<Guest>(spriteIndex)) != nullptr)
-    {
-        spriteIndex = peep->GuestNextInQueue;
-        count++;
-    }
-    station.QueueLength = count;
-}
-
 void Ride::QueueInsertGuestAtFront(StationIndex stationIndex, Guest* peep)
 {
     assert(stationIndex.ToUnderlying() < OpenRCT2::Limits::kMaxStationsPerRide);
@@ -388,18 +383,21 @@ void Ride::QueueInsertGuestAtFront(StationIndex stationIndex, Guest* peep)
     {
         queueHeadGuest->GuestNextInQueue = peep->Id;
     }
-    UpdateQueueLength(peep->CurrentRideStation);
+    // Counters are maintained incrementally at every join and leave; the
+    // weekly audit recounts the chains and heals any drift.
+    GetStation(peep->CurrentRideStation).QueueLength++;
 }
 
 /**
+ * The favourite counters are maintained incrementally by
+ * Guest::SetFavouriteRide; this weekly pass audits them against the guests,
+ * logging and healing any drift an unconverted write path may have caused.
  *
  *  rct2: 0x006AC916
  */
 void RideUpdateFavouritedStat()
 {
-    for (auto& ride : GetRideManager())
-        ride.guests_favourite = 0;
-
+    std::array<uint16_t, OpenRCT2::Limits::kMaxRidesInPark> counts{};
     for (auto peep : EntityList<Guest>())
     {
         if (!peep->FavouriteRide.IsNull())
@@ -407,15 +405,58 @@ void RideUpdateFavouritedStat()
             auto ride = GetRide(peep->FavouriteRide);
             if (ride != nullptr)
             {
-                ride->guests_favourite++;
-                ride->window_invalidate_flags |= RIDE_INVALIDATE_RIDE_CUSTOMER;
+                counts[ride->id.ToUnderlying()]++;
             }
         }
     }
 
+    for (auto& ride : GetRideManager())
+    {
+        auto count = counts[ride.id.ToUnderlying()];
+        if (ride.guests_favourite != count)
+        {
+            LOG_WARNING(
+                "Favourite count for ride %u drifted (%u stored, %u counted)", ride.id.ToUnderlying(),
+                ride.guests_favourite, count);
+            ride.guests_favourite = count;
+            ride.window_invalidate_flags |= RIDE_INVALIDATE_RIDE_CUSTOMER;
+        }
+    }
+
     WindowInvalidateByClass(WindowClass::RideList);
 }
 
+/**
+ * Weekly audit of the incrementally maintained per-station queue lengths:
+ * recounts the queue chains and logs and heals any drift, replacing the full
+ * recount that used to run on every front-of-queue insert.
+ */
+void RideAuditQueueLengths()
+{
+    for (auto& ride : GetRideManager())
+    {
+        for (const auto& station : ride.GetStations())
+        {
+            uint16_t count = 0;
+            Guest* peep;
+            auto spriteIndex = station.LastPeepInQueue;
+            while ((peep = TryGetEntity<Guest>(spriteIndex)) != nullptr)
+            {
+                spriteIndex = peep->GuestNextInQueue;
+                count++;
+            }
+            if (station.QueueLength != count)
+            {
+                auto stationIndex = ride.GetStationIndex(&station);
+                LOG_WARNING(
+                    "Queue length for ride %u station %u drifted (%u stored, %u counted)", ride.id.ToUnderlying(),
+                    stationIndex.ToUnderlying(), station.QueueLength, count);
+                ride.GetStation(stationIndex).QueueLength = count;
+            }
+        }
+    }
+}
+
 /**
  *
  *  rct2: 0x006AC3AB
@@ -1016,6 +1057,12 @@ void Ride::UpdateAll()
 
     WindowUpdateViewportRideMusic();
 
+    const auto currentTicks = GetGameState().CurrentTicks;
+    const bool trackDesigner = (gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) != 0;
+    _breakdownUpdateDue = (currentTicks & 255) == 0 && !trackDesigner;
+    _inspectionUpdateDue = (currentTicks & 2047) == 0 && !trackDesigner;
+    _breakdownStatusUpdateRideByte = static_cast<uint8_t>((currentTicks / 2) & 0xFF);
+
     // Update rides
     for (auto& ride : GetRideManager())
         ride.Update();
@@ -1139,7 +1186,8 @@ void Ride::Update()
     if (rtd.RideUpdate != nullptr)
         rtd.RideUpdate(*this);
 
-    RideBreakdownUpdate(*this);
+    if (_breakdownUpdateDue)
+        RideBreakdownUpdate(*this);
 
     // Various things include news messages
     if (lifecycle_flags & (RIDE_LIFECYCLE_BREAKDOWN_PENDING | RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_DUE_INSPECTION))
@@ -1147,12 +1195,12 @@ void Ride::Update()
         // Breakdown updates originally were performed when (id == (gCurrentTicks / 2) & 0xFF)
         // with the increased MAX_RIDES the update is tied to the first byte of the id this allows
         // for identical balance with vanilla.
-        const auto updatingRideByte = static_cast<uint8_t>((GetGameState().CurrentTicks / 2) & 0xFF);
-        if (updatingRideByte == static_cast<uint8_t>(id.ToUnderlying()))
+        if (_breakdownStatusUpdateRideByte == static_cast<uint8_t>(id.ToUnderlying()))
             RideBreakdownStatusUpdate(*this);
     }
 
-    RideInspectionUpdate(*this);
+    if (_inspectionUpdateDue)
+        RideInspectionUpdate(*this);
 
     // If ride is simulating but crashed, reset the vehicles
     if (status == RideStatus::Simulating && (lifecycle_flags & RIDE_LIFECYCLE_CRASHED))
@@ -1331,11 +1379,7 @@ static uint8_t _breakdownProblemProbabilities[] = {
  */
 static void RideInspectionUpdate(Ride& ride)
 {
-    if (GetGameState().CurrentTicks & 2047)
-        return;
-    if (gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER)
-        return;
-
+    // Only called on ticks where _inspectionUpdateDue was set by Ride::UpdateAll.
     ride.last_inspection++;
     if (ride.last_inspection == 0)
         ride.last_inspection--;
@@ -1396,12 +1440,8 @@ static int32_t GetAgePenalty(const Ride& ride)
  */
 static void RideBreakdownUpdate(Ride& ride)
 {
+    // Only called on ticks where _breakdownUpdateDue was set by Ride::UpdateAll.
     const auto currentTicks = GetGameState().CurrentTicks;
-    if (currentTicks & 255)
-        return;
-
-    if (gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER)
-        return;
 
     if (ride.lifecycle_flags & (RIDE_LIFECYCLE_BROKEN_DOWN | RIDE_LIFECYCLE_CRASHED))
         ride.downtime_history[0]++;
@@ -1793,7 +1833,12 @@ Staff* RideFindClosestMechanic(const Ride& ride, int32_t forInspection)
     // Set x,y to centre of the station exit for the mechanic search.
     auto centreMapLocation = mapLocation.ToTileCentre();
 
-    return FindClosestMechanic(centreMapLocation, forInspection);
+    // Component of the path tile the exit opens onto; mechanics on a
+    // different component cannot reach this ride at all.
+    auto pathPosition = mapLocation + CoordsXYZ{ CoordsDirectionDelta[tileElement->GetDirection()], 0 };
+    auto targetComponent = FootpathGetConnectedComponent(pathPosition);
+
+    return FindClosestMechanic(centreMapLocation, targetComponent, forInspection);
 }
 
 /**
@@ -1801,7 +1846,7 @@ Staff* RideFindClosestMechanic(const Ride& ride, int32_t forInspection)
  *  rct2: 0x006B774B (forInspection = 0)
  *  rct2: 0x006B78C3 (forInspection = 1)
  */
-Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspection)
+Staff* FindClosestMechanic(const CoordsXY& entrancePosition, uint16_t targetComponent, int32_t forInspection)
 {
     Staff* closestMechanic = nullptr;
     uint32_t closestDistance = std::numeric_limits<uint32_t>::max();
@@ -1838,6 +1883,17 @@ Staff* FindClosestMechanic(const CoordsXY& entrancePosition, int32_t forInspecti
         if (peep->x == LOCATION_NULL)
             continue;
 
+        // Skip mechanics on a footpath component the target is not on; they
+        // would be dispatched only to fail trial pathfinding over and over.
+        // Either component being unknown (off-path, stacked-path overflow
+        // tile) falls back to considering the mechanic.
+        if (targetComponent != kFootpathComponentNone)
+        {
+            auto mechanicComponent = FootpathGetConnectedComponent(peep->NextLoc);
+            if (mechanicComponent != kFootpathComponentNone && mechanicComponent != targetComponent)
+                continue;
+        }
+
         // Manhattan distance
         uint32_t distance = std::abs(peep->x - entrancePosition.x) + std::abs(peep->y - entrancePosition.y);
         if (distance < closestDistance)
@@ -2009,6 +2065,30 @@ static void RideMusicUpdate(Ride& ride)
 
 #pragma region Measurement functions
 
+// Retired measurement buffers are kept around for reuse; at roughly 19 kB each
+// this avoids repeated large allocations as players inspect different rides.
+static std::vector<std::unique_ptr<RideMeasurement>> _measurementPool;
+
+static std::unique_ptr<RideMeasurement> RideMeasurementAllocate()
+{
+    if (!_measurementPool.empty())
+    {
+        auto measurement = std::move(_measurementPool.back());
+        _measurementPool.pop_back();
+        *measurement = RideMeasurement{};
+        return measurement;
+    }
+    return std::make_unique<RideMeasurement>();
+}
+
+static void RideMeasurementRetire(std::unique_ptr<RideMeasurement>&& measurement)
+{
+    if (_measurementPool.size() < kMaxRideMeasurements)
+    {
+        _measurementPool.push_back(std::move(measurement));
+    }
+}
+
 /**
  *
  *  rct2: 0x006B64F2
@@ -2103,6 +2183,17 @@ void RideMeasurementsUpdate()
         auto measurement = ride.measurement.get();
         if (measurement != nullptr && (ride.lifecycle_flags & RIDE_LIFECYCLE_ON_TRACK) && ride.status != RideStatus::Simulating)
         {
+            // Recording is subscription driven: GetMeasurement refreshes last_use_tick
+            // whenever a graph window or plugin reads the data, so once nothing has
+            // looked for a while, keep the last recorded lap cached and skip the
+            // per-tick work. Clearing the running flag makes a later subscription
+            // restart cleanly from the next departure rather than mid-circuit.
+            if (GetGameState().CurrentTicks - measurement->last_use_tick > kRideMeasurementStaleTicks)
+            {
+                measurement->flags &= ~RIDE_MEASUREMENT_FLAG_RUNNING;
+                continue;
+            }
+
             if (measurement->flags & RIDE_MEASUREMENT_FLAG_RUNNING)
             {
                 RideMeasurementUpdate(ride, *measurement);
@@ -2156,6 +2247,7 @@ static void RideFreeOldMeasurements()
         }
         if (numRideMeasurements > kMaxRideMeasurements && lruRide != nullptr)
         {
+            RideMeasurementRetire(std::move(lruRide->measurement));
             lruRide->measurement = {};
             numRideMeasurements--;
         }
@@ -2175,7 +2267,7 @@ std::pair<RideMeasurement*, OpenRCT2String> Ride::GetMeasurement()
     // Check if a measurement already exists for this ride
     if (measurement == nullptr)
     {
-        measurement = std::make_unique<RideMeasurement>();
+        measurement = RideMeasurementAllocate();
         if (rtd.HasFlag(RIDE_TYPE_FLAG_HAS_G_FORCES))
         {
             measurement->flags |= RIDE_MEASUREMENT_FLAG_G_FORCES;
@@ -75,6 +75,13 @@ struct RideStation
     uint16_t QueueLength{};
     EntityId LastPeepInQueue{ EntityId::GetNull() };
 
+    // Transient cache of the station start track element, validated against
+    // the tile element generation before use. Not serialised; mutable so the
+    // per-tick dispatch checks on a const ride can refresh it.
+    mutable TileElement* CachedStartElement{};
+    mutable uint32_t CachedStartGeneration{};
+    mutable CoordsXYZ CachedStartLocation{};
+
     int32_t GetBaseZ() const;
     void SetBaseZ(int32_t newZ);
     CoordsXYZ GetStart() const;
@@ -308,7 +315,6 @@ public:
 
 private:
     void Update();
-    void UpdateQueueLength(StationIndex stationIndex);
     ResultWithMessage CreateVehicles(const CoordsXYE& element, bool isApplying);
     void MoveTrainsToBlockBrakes(const CoordsXYZ& firstBlockPosition, TrackElement& firstBlock);
     money64 CalculateIncomePerHour() const;
@@ -885,6 +891,9 @@ enum
 };
 
 constexpr uint8_t kMaxRideMeasurements = 8;
+// Recording stops once nothing has read a ride's measurement for this many
+// ticks; the buffer keeps the last recorded lap for when interest returns.
+constexpr uint32_t kRideMeasurementStaleTicks = 512;
 constexpr money64 RIDE_VALUE_UNDEFINED = kMoney64Undefined;
 constexpr uint16_t kRideInitialReliability = ((100 << 8) | 0xFF); // Upper byte is percentage, lower byte is "decimal".
 
@@ -998,6 +1007,7 @@ int32_t RideGetCount();
 void RideInitAll();
 void ResetAllRideBuildDates();
 void RideUpdateFavouritedStat();
+void RideAuditQueueLengths();
 void RideCheckAllReachable();
 
 bool RideTryGetOriginElement(const Ride& ride, CoordsXYE* output);
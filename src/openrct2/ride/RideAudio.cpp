@@ -14,6 +14,7 @@
 #include "../audio/AudioChannel.h"
 #include "../audio/AudioContext.h"
 #include "../audio/AudioMixer.h"
+#include "../audio/AudioPrefetch.h"
 #include "../audio/audio.h"
 #include "../config/Config.h"
 #include "../interface/Viewport.h"
@@ -33,6 +34,18 @@ namespace OpenRCT2::RideAudio
 {
     constexpr size_t MAX_RIDE_MUSIC_CHANNELS = 32;
 
+    // Volume thresholds for voice culling. A new channel is only started once
+    // the computed volume is clearly audible; an existing channel keeps
+    // playing until it drops below the quieter stop threshold, so rides
+    // hovering at the edge of audibility do not flap channels on and off.
+    constexpr int16_t kVoiceStartVolume = -3800;
+    constexpr int16_t kVoiceStopVolume = -4000;
+
+    // Rides between this and the start volume are close enough that their
+    // music is likely to become audible soon; their track is decoded in the
+    // background so the channel starts without a decode hitch.
+    constexpr int16_t kVoicePrefetchVolume = -4600;
+
     /**
      * Represents an audio channel to play a particular ride's music track.
      */
@@ -261,6 +274,8 @@ namespace OpenRCT2::RideAudio
         if (gGameSoundsOff || !Config::Get().sound.RideMusicEnabled)
             return;
 
+        Audio::InstallReadySamples();
+
         StopInactiveRideMusicChannels();
         for (const auto& instance : _musicInstances)
         {
@@ -364,6 +379,23 @@ namespace OpenRCT2::RideAudio
         }
     }
 
+    static void PrefetchRideMusic(const Ride& ride)
+    {
+        auto& objManager = GetContext()->GetObjectManager();
+        auto musicObj = static_cast<MusicObject*>(objManager.GetLoadedObject(ObjectType::Music, ride.music));
+        if (musicObj != nullptr && ride.music_tune_id < musicObj->GetTrackCount())
+        {
+            musicObj->PrefetchTrack(ride.music_tune_id);
+        }
+    }
+
+    static bool HasPlayingChannel(const Ride& ride)
+    {
+        return std::any_of(_musicChannels.begin(), _musicChannels.end(), [&ride](const auto& channel) {
+            return channel.RideId == ride.id && channel.TrackIndex == ride.music_tune_id;
+        });
+    }
+
     static uint8_t CalculateVolume(int32_t pan)
     {
         uint8_t result = 255;
@@ -418,7 +450,13 @@ namespace OpenRCT2::RideAudio
                 }
 
                 int16_t newVolume = -((static_cast<uint8_t>(-volXY - 1) * static_cast<uint8_t>(-volXY - 1)) / 16) - 700;
-                if (volXY != 0 && newVolume >= -4000)
+                auto hasChannel = HasPlayingChannel(ride);
+                auto cullVolume = hasChannel ? kVoiceStopVolume : kVoiceStartVolume;
+                if (volXY != 0 && !hasChannel && newVolume >= kVoicePrefetchVolume && newVolume < cullVolume)
+                {
+                    PrefetchRideMusic(ride);
+                }
+                if (volXY != 0 && newVolume >= cullVolume)
                 {
                     auto newPan = std::clamp(panX, -10000, 10000);
                     RideUpdateMusicPosition(ride, newVolume, newPan, sampleRate);
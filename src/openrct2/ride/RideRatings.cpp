@@ -267,6 +267,17 @@ static RideId GetNextRideToUpdate(RideId currentRide)
         return RideId::GetNull();
     }
 
+    // Rides whose ratings were invalidated by a layout change are served
+    // before the round-robin continues, in ride id order so that every
+    // client picks the same one.
+    for (auto& ride : rm)
+    {
+        if (ride.ratings.isNull() && !ShouldSkipRatingCalculation(ride))
+        {
+            return ride.id;
+        }
+    }
+
     auto it = rm.get(currentRide);
     if (it == rm.end())
     {
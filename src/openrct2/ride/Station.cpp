@@ -339,7 +339,19 @@ static void RideInvalidateStationStart(Ride& ride, StationIndex stationIndex, bo
 
 TileElement* RideGetStationStartTrackElement(const Ride& ride, StationIndex stationIndex)
 {
-    auto stationStart = ride.GetStation(stationIndex).GetStart();
+    auto& station = ride.GetStation(stationIndex);
+    auto stationStart = station.GetStart();
+
+    // Station starts only move through construction, which also restructures
+    // the tile element storage, so the cached element stays valid as long as
+    // the generation and location both match. This keeps the per-tick
+    // dispatch checks off the tile walk below.
+    const auto generation = MapGetTileElementGeneration();
+    if (station.CachedStartElement != nullptr && station.CachedStartGeneration == generation
+        && station.CachedStartLocation == stationStart)
+    {
+        return station.CachedStartElement;
+    }
 
     // Find the station track element
     TileElement* tileElement = MapGetFirstElementAt(stationStart);
@@ -348,7 +360,12 @@ TileElement* RideGetStationStartTrackElement(const Ride& ride, StationIndex stat
     do
     {
         if (tileElement->GetType() == TileElementType::Track && stationStart.z == tileElement->GetBaseZ())
+        {
+            station.CachedStartElement = tileElement;
+            station.CachedStartGeneration = generation;
+            station.CachedStartLocation = stationStart;
             return tileElement;
+        }
 
     } while (!(tileElement++)->IsLastForTile());
 
@@ -615,34 +615,6 @@ bool TrackElement::IsStation() const
     return TrackTypeIsStation(GetTrackType());
 }
 
-bool TrackTypeIsStation(track_type_t trackType)
-{
-    switch (trackType)
-    {
-        case TrackElemType::EndStation:
-        case TrackElemType::BeginStation:
-        case TrackElemType::MiddleStation:
-            return true;
-        default:
-            return false;
-    }
-}
-
-bool TrackTypeIsBrakes(track_type_t trackType)
-{
-    return (trackType == TrackElemType::Brakes) || (trackType == TrackElemType::DiagBrakes);
-}
-
-bool TrackTypeIsBlockBrakes(track_type_t trackType)
-{
-    return (trackType == TrackElemType::BlockBrakes) || (trackType == TrackElemType::DiagBlockBrakes);
-}
-
-bool TrackTypeIsBooster(track_type_t trackType)
-{
-    return trackType == TrackElemType::Booster;
-}
-
 bool TrackElementIsCovered(track_type_t trackElementType)
 {
     switch (trackElementType)
@@ -719,11 +691,6 @@ track_type_t UncoverTrackElement(track_type_t trackElementType)
     }
 }
 
-bool TrackTypeHasSpeedSetting(track_type_t trackType)
-{
-    return TrackTypeIsBooster(trackType) || TrackTypeIsBrakes(trackType) || TrackTypeIsBlockBrakes(trackType);
-}
-
 bool TrackTypeIsHelix(track_type_t trackType)
 {
     if (trackType >= TrackElemType::LeftHalfBankedHelixUpSmall && trackType <= TrackElemType::RightHalfBankedHelixDownLarge)
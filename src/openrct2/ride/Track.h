@@ -680,10 +680,41 @@ void TrackGetFront(const CoordsXYE& input, CoordsXYE* output);
 
 bool TrackElementIsCovered(track_type_t trackElementType);
 track_type_t UncoverTrackElement(track_type_t trackElementType);
-bool TrackTypeIsStation(track_type_t trackType);
-bool TrackTypeIsBrakes(track_type_t trackType);
-bool TrackTypeIsBlockBrakes(track_type_t trackType);
-bool TrackTypeIsBooster(track_type_t trackType);
+
+// These classify the track type a vehicle is on every motion tick, so they
+// are constexpr to keep each check an inline comparison.
+constexpr bool TrackTypeIsStation(track_type_t trackType)
+{
+    switch (trackType)
+    {
+        case TrackElemType::EndStation:
+        case TrackElemType::BeginStation:
+        case TrackElemType::MiddleStation:
+            return true;
+        default:
+            return false;
+    }
+}
+
+constexpr bool TrackTypeIsBrakes(track_type_t trackType)
+{
+    return (trackType == TrackElemType::Brakes) || (trackType == TrackElemType::DiagBrakes);
+}
+
+constexpr bool TrackTypeIsBlockBrakes(track_type_t trackType)
+{
+    return (trackType == TrackElemType::BlockBrakes) || (trackType == TrackElemType::DiagBlockBrakes);
+}
+
+constexpr bool TrackTypeIsBooster(track_type_t trackType)
+{
+    return trackType == TrackElemType::Booster;
+}
+
+constexpr bool TrackTypeHasSpeedSetting(track_type_t trackType)
+{
+    return TrackTypeIsBooster(trackType) || TrackTypeIsBrakes(trackType) || TrackTypeIsBlockBrakes(trackType);
+}
 
 std::optional<CoordsXYZ> GetTrackElementOriginAndApplyChanges(
     const CoordsXYZD& location, track_type_t type, uint16_t extra_params, TileElement** output_element, uint16_t flags);
@@ -695,7 +726,6 @@ TrackRoll TrackGetActualBank3(bool useInvertedSprites, TileElement* tileElement)
 ResultWithMessage TrackAddStationElement(CoordsXYZD loc, RideId rideIndex, int32_t flags, bool fromTrackDesign);
 ResultWithMessage TrackRemoveStationElement(const CoordsXYZD& loc, RideId rideIndex, int32_t flags);
 
-bool TrackTypeHasSpeedSetting(track_type_t trackType);
 bool TrackTypeIsHelix(track_type_t trackType);
 std::optional<CoordsXYZD> GetTrackSegmentOrigin(const CoordsXYE& posEl);
 
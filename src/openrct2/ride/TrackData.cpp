@@ -8018,14 +8018,8 @@ namespace OpenRCT2
             return res;
         }
 
-        static constexpr auto _trackElementDescriptors = BuildDescriptorTable();
-
-        const TrackElementDescriptor& GetTrackElementDescriptor(const uint32_t type)
-        {
-            if (type >= _trackElementDescriptors.size())
-                return _trackElementDescriptors[0];
-            return _trackElementDescriptors[type];
-        }
+        constinit const std::array<TrackElementDescriptor, TrackElemType::Count> kTrackElementDescriptors
+            = BuildDescriptorTable();
 
     } // namespace TrackMetaData
 } // namespace OpenRCT2
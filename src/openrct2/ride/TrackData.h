@@ -110,6 +110,18 @@ namespace OpenRCT2
 {
     namespace TrackMetaData
     {
-        const TrackElementDescriptor& GetTrackElementDescriptor(const uint32_t type);
+        // Built at compile time from the per-attribute tables in TrackData.cpp;
+        // constinit keeps the whole table in read-only data.
+        extern const std::array<TrackElementDescriptor, TrackElemType::Count> kTrackElementDescriptors;
+
+        // Inline so the per-tick vehicle and per-paint track queries compile
+        // down to a bounds check and one indexed load rather than a call into
+        // another translation unit.
+        inline const TrackElementDescriptor& GetTrackElementDescriptor(const uint32_t type)
+        {
+            if (type >= kTrackElementDescriptors.size())
+                return kTrackElementDescriptors[0];
+            return kTrackElementDescriptors[type];
+        }
     } // namespace TrackMetaData
 } // namespace OpenRCT2
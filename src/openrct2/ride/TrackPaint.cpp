@@ -34,6 +34,10 @@
 #include "TrackData.h"
 #include "TrackDesign.h"
 
+#include <array>
+#include <memory>
+#include <vector>
+
 using namespace OpenRCT2;
 using namespace OpenRCT2::TrackMetaData;
 
@@ -193,6 +197,24 @@ bool TrackPaintUtilShouldPaintSupports(const CoordsXY& position)
     return false;
 }
 
+/* Canonical painter for straight flat pieces such as brakes and boosters that
+ * only differ between ride types by sprite base and support/tunnel style. */
+void TrackPaintUtilStraightFlatPiecePaint(
+    PaintSession& session, Direction direction, int32_t height, uint32_t spriteBase, MetalSupportType supportType,
+    TunnelType tunnelType)
+{
+    PaintAddImageAsParentRotated(
+        session, direction, session.TrackColours.WithIndex(spriteBase + (direction & 1)), { 0, 0, height },
+        { { 0, 6, height }, { 32, 20, 3 } });
+    if (TrackPaintUtilShouldPaintSupports(session.MapPosition))
+    {
+        MetalASupportsPaintSetup(session, supportType, MetalSupportPlace::Centre, 0, height, session.SupportColours);
+    }
+    PaintUtilPushTunnelRotated(session, direction, height, tunnelType);
+    PaintUtilSetSegmentSupportHeight(session, PaintUtilRotateSegments(BlockedSegments::kStraightFlat, direction), 0xFFFF, 0);
+    PaintUtilSetGeneralSupportHeight(session, height + kDefaultGeneralSupportHeight);
+}
+
 static void TrackPaintUtilDrawStationImpl(
     PaintSession& session, const Ride& ride, Direction direction, uint16_t height, uint16_t coverHeight,
     const TrackElement& trackElement, int32_t fenceOffsetA, int32_t fenceOffsetB);
@@ -1950,6 +1972,54 @@ ImageId GetShopSupportColourScheme(PaintSession& session, const TrackElement& tr
     return ShopSupportColour;
 }
 
+namespace
+{
+    // Each TRACK_PAINT_FUNCTION_GETTER is a switch over every track type, so
+    // resolving a drawer walks cold per-coaster dispatch code for every painted
+    // element. The first time a getter is seen on a paint thread its switch is
+    // expanded into a flat table; later elements then resolve with one indexed
+    // load. The tables are thread local so the multithreaded painter needs no
+    // locking.
+    struct ResolvedTrackDrawer
+    {
+        TRACK_PAINT_FUNCTION_GETTER Getter{};
+        std::array<TRACK_PAINT_FUNCTION, TrackElemType::Count> Functions{};
+    };
+
+    TRACK_PAINT_FUNCTION ResolveTrackPaintFunction(TRACK_PAINT_FUNCTION_GETTER getter, track_type_t trackType)
+    {
+        static thread_local std::vector<std::unique_ptr<ResolvedTrackDrawer>> _resolvedDrawers;
+        static thread_local const ResolvedTrackDrawer* _lastDrawer = nullptr;
+
+        if (trackType >= TrackElemType::Count)
+            return getter(trackType);
+
+        if (_lastDrawer == nullptr || _lastDrawer->Getter != getter)
+        {
+            _lastDrawer = nullptr;
+            for (const auto& drawer : _resolvedDrawers)
+            {
+                if (drawer->Getter == getter)
+                {
+                    _lastDrawer = drawer.get();
+                    break;
+                }
+            }
+            if (_lastDrawer == nullptr)
+            {
+                auto drawer = std::make_unique<ResolvedTrackDrawer>();
+                drawer->Getter = getter;
+                for (track_type_t i = 0; i < TrackElemType::Count; i++)
+                {
+                    drawer->Functions[i] = getter(i);
+                }
+                _lastDrawer = _resolvedDrawers.emplace_back(std::move(drawer)).get();
+            }
+        }
+        return _lastDrawer->Functions[trackType];
+    }
+} // namespace
+
 /**
  *
  *  rct2: 0x006C4794
@@ -1964,6 +2034,15 @@ void PaintTrack(PaintSession& session, Direction direction, int32_t height, cons
         return;
     }
 
+    if (ride->type >= RIDE_TYPE_COUNT)
+    {
+        return;
+    }
+
+    // Looked up once per element; the height marker, light FX and colour
+    // blocks below all read from the same descriptor.
+    const auto& rideRtd = ride->GetRideTypeDescriptor();
+
     if ((!gTrackDesignSaveMode || rideIndex == gTrackDesignSaveRideIndex)
         && !(session.ViewFlags & VIEWPORT_FLAG_HIGHLIGHT_PATH_ISSUES))
     {
@@ -1977,7 +2056,7 @@ void PaintTrack(PaintSession& session, Direction direction, int32_t height, cons
             const auto& ted = GetTrackElementDescriptor(trackType);
             if (ted.HeightMarkerPositions & (1 << trackSequence))
             {
-                uint16_t ax = ride->GetRideTypeDescriptor().Heights.VehicleZOffset;
+                uint16_t ax = rideRtd.Heights.VehicleZOffset;
                 // 0x1689 represents 0 height there are -127 to 128 heights above and below it
                 // There are 3 arrays of 256 heights (units, m, ft) chosen with the GetHeightMarkerOffset()
                 auto heightNum = (height + 8) / 16 - kMapBaseZ;
@@ -1990,14 +2069,13 @@ void PaintTrack(PaintSession& session, Direction direction, int32_t height, cons
         if (LightFXIsAvailable())
         {
             uint8_t zOffset = 16;
-            const auto& rtd = ride->GetRideTypeDescriptor();
-            if (rtd.HasFlag(RIDE_TYPE_FLAG_IS_TOILET) || rtd.HasFlag(RIDE_TYPE_FLAG_IS_FIRST_AID)
-                || rtd.HasFlag(RIDE_TYPE_FLAG_IS_CASH_MACHINE))
+            if (rideRtd.HasFlag(RIDE_TYPE_FLAG_IS_TOILET) || rideRtd.HasFlag(RIDE_TYPE_FLAG_IS_FIRST_AID)
+                || rideRtd.HasFlag(RIDE_TYPE_FLAG_IS_CASH_MACHINE))
                 zOffset = 23;
 
             if (ride->type == RIDE_TYPE_INFORMATION_KIOSK)
                 LightFxAddKioskLights(session.MapPosition, height, zOffset);
-            else if (RideTypeDescriptors[ride->type].HasFlag(RIDE_TYPE_FLAG_IS_SHOP_OR_FACILITY))
+            else if (rideRtd.HasFlag(RIDE_TYPE_FLAG_IS_SHOP_OR_FACILITY))
                 LightFxAddShopLights(session.MapPosition, trackElement.GetDirection(), height, zOffset);
         }
 
@@ -2018,11 +2096,6 @@ void PaintTrack(PaintSession& session, Direction direction, int32_t height, cons
             session.SupportColours = ConstructionMarker;
         }
 
-        if (ride->type >= RIDE_TYPE_COUNT)
-        {
-            return;
-        }
-
         const auto& rtd = GetRideTypeDescriptor(trackElement.GetRideType());
         bool isInverted = trackElement.IsInverted() && rtd.HasFlag(RIDE_TYPE_FLAG_HAS_ALTERNATIVE_TRACK_TYPE);
         const auto trackDrawerEntry = getTrackDrawerEntry(rtd, isInverted, TrackElementIsCovered(trackType));
@@ -2030,7 +2103,7 @@ void PaintTrack(PaintSession& session, Direction direction, int32_t height, cons
         if (trackDrawerEntry.Drawer != nullptr)
         {
             trackType = UncoverTrackElement(trackType);
-            TRACK_PAINT_FUNCTION paintFunction = trackDrawerEntry.Drawer(trackType);
+            TRACK_PAINT_FUNCTION paintFunction = ResolveTrackPaintFunction(trackDrawerEntry.Drawer, trackType);
             if (paintFunction != nullptr)
             {
                 paintFunction(session, *ride, trackSequence, direction, height, trackElement);
@@ -433,6 +433,9 @@ void TrackPaintUtilDrawStationInverted(
     PaintSession& session, const Ride& ride, Direction direction, int32_t height, const TrackElement& trackElement,
     uint8_t stationVariant);
 bool TrackPaintUtilShouldPaintSupports(const CoordsXY& position);
+void TrackPaintUtilStraightFlatPiecePaint(
+    PaintSession& session, Direction direction, int32_t height, uint32_t spriteBase, MetalSupportType supportType,
+    TunnelType tunnelType);
 void TrackPaintUtilDrawPier(
     PaintSession& session, const Ride& ride, const StationObject* stationObject, const CoordsXY& position, Direction direction,
     int32_t height, const TrackElement& trackElement, uint8_t rotation);
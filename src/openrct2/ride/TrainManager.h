@@ -9,9 +9,9 @@
 #pragma once
 
 #include "../Identifiers.h"
+#include "../entity/EntityList.h"
 
 #include <cstdint>
-#include <list>
 
 struct Vehicle;
 
@@ -21,17 +21,17 @@ namespace TrainManager
     class View
     {
     private:
-        const std::list<EntityId>* vec;
+        const EntityIdList* vec;
 
         class Iterator
         {
         private:
-            std::list<EntityId>::const_iterator iter;
-            std::list<EntityId>::const_iterator end;
+            EntityIdList::const_iterator iter;
+            EntityIdList::const_iterator end;
             Vehicle* Entity = nullptr;
 
         public:
-            Iterator(std::list<EntityId>::const_iterator _iter, std::list<EntityId>::const_iterator _end)
+            Iterator(EntityIdList::const_iterator _iter, EntityIdList::const_iterator _end)
                 : iter(_iter)
                 , end(_end)
             {
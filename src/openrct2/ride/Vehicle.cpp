@@ -473,72 +473,18 @@ static void InvokeVehicleCrashHook(const EntityId vehicleId, const std::string_v
 }
 #endif
 
-static bool vehicle_move_info_valid(
-    VehicleTrackSubposition trackSubposition, track_type_t type, uint8_t direction, int32_t offset)
-{
-    uint16_t typeAndDirection = (type << 2) | (direction & 3);
-
-    if (trackSubposition >= VehicleTrackSubposition{ std::size(gTrackVehicleInfo) })
-    {
-        return false;
-    }
-    int32_t size = 0;
-    switch (trackSubposition)
-    {
-        case VehicleTrackSubposition::Default:
-            size = VehicleTrackSubpositionSizeDefault;
-            break;
-        case VehicleTrackSubposition::ChairliftGoingOut:
-            size = 692;
-            break;
-        case VehicleTrackSubposition::ChairliftGoingBack:
-        case VehicleTrackSubposition::ChairliftEndBullwheel:
-        case VehicleTrackSubposition::ChairliftStartBullwheel:
-            size = 404;
-            break;
-        case VehicleTrackSubposition::GoKartsLeftLane:
-        case VehicleTrackSubposition::GoKartsRightLane:
-        case VehicleTrackSubposition::GoKartsMovingToRightLane:
-        case VehicleTrackSubposition::GoKartsMovingToLeftLane:
-            size = 208;
-            break;
-        case VehicleTrackSubposition::MiniGolfPathA9: // VehicleTrackSubposition::MiniGolfStart9
-        case VehicleTrackSubposition::MiniGolfBallPathA10:
-        case VehicleTrackSubposition::MiniGolfPathB11:
-        case VehicleTrackSubposition::MiniGolfBallPathB12:
-        case VehicleTrackSubposition::MiniGolfPathC13:
-        case VehicleTrackSubposition::MiniGolfBallPathC14:
-            size = 824;
-            break;
-        case VehicleTrackSubposition::ReverserRCFrontBogie:
-        case VehicleTrackSubposition::ReverserRCRearBogie:
-            size = 868;
-            break;
-        default:
-            break;
-    }
-    if (typeAndDirection >= size)
-    {
-        return false;
-    }
-    if (offset >= gTrackVehicleInfo[EnumValue(trackSubposition)][typeAndDirection]->size)
-    {
-        return false;
-    }
-    return true;
-}
-
 static const VehicleInfo* vehicle_get_move_info(
     VehicleTrackSubposition trackSubposition, track_type_t type, uint8_t direction, int32_t offset)
 {
     uint16_t typeAndDirection = (type << 2) | (direction & 3);
 
-    if (!vehicle_move_info_valid(trackSubposition, type, direction, offset))
+    const auto* list = VehicleGetTrackSubpositionInfoList(trackSubposition, typeAndDirection);
+    if (list == nullptr || offset >= static_cast<int32_t>(list->size))
     {
         static constexpr VehicleInfo zero = {};
         return &zero;
     }
-    return &gTrackVehicleInfo[EnumValue(trackSubposition)][typeAndDirection]->info[offset];
+    return &list->info[offset];
 }
 
 const VehicleInfo* Vehicle::GetMoveInfo() const
@@ -550,11 +496,8 @@ uint16_t VehicleGetMoveInfoSize(VehicleTrackSubposition trackSubposition, track_
 {
     uint16_t typeAndDirection = (type << 2) | (direction & 3);
 
-    if (!vehicle_move_info_valid(trackSubposition, type, direction, 0))
-    {
-        return 0;
-    }
-    return gTrackVehicleInfo[EnumValue(trackSubposition)][typeAndDirection]->size;
+    const auto* list = VehicleGetTrackSubpositionInfoList(trackSubposition, typeAndDirection);
+    return list != nullptr ? list->size : 0;
 }
 
 uint16_t Vehicle::GetTrackProgress() const
@@ -601,8 +544,17 @@ void VehicleUpdateAll()
     if ((gScreenFlags & SCREEN_FLAGS_TRACK_DESIGNER) && GetGameState().EditorStep != EditorStep::RollercoasterDesigner)
         return;
 
+    // Crashed trains only advance their flame and smoke animation, so they
+    // run at a quarter cadence, staggered by entity id to keep the remaining
+    // work and particle spawns spread across ticks. Everything else -
+    // including trains waiting at a station, whose departure timers count in
+    // ticks - still updates every tick.
+    const auto currentTicks = GetGameState().CurrentTicks;
     for (auto vehicle : TrainManager::View())
     {
+        if (vehicle->status == Vehicle::Status::Crashed && ((currentTicks + vehicle->Id.ToUnderlying()) & 3) != 0)
+            continue;
+
         vehicle->Update();
     }
 }
@@ -4575,6 +4527,7 @@ void Vehicle::KillPassengers(const Ride& curRide)
         {
             DecrementGuestsInPark();
             auto intent = Intent(INTENT_ACTION_UPDATE_GUEST_COUNT);
+            intent.PutExtra(INTENT_EXTRA_PEEP_ID, curPeep->Id);
             ContextBroadcastIntent(&intent);
         }
         PeepEntityRemove(curPeep);
@@ -5495,6 +5448,23 @@ void Vehicle::CheckAndApplyBlockSectionStopSite()
 
     auto trackType = GetTrackType();
 
+    // Only the block section piece types handled below read the tile element,
+    // so skip the tile walk entirely for every other piece.
+    switch (trackType)
+    {
+        case TrackElemType::BlockBrakes:
+        case TrackElemType::DiagBlockBrakes:
+        case TrackElemType::EndStation:
+        case TrackElemType::Up25ToFlat:
+        case TrackElemType::Up60ToFlat:
+        case TrackElemType::CableLiftHill:
+        case TrackElemType::DiagUp25ToFlat:
+        case TrackElemType::DiagUp60ToFlat:
+            break;
+        default:
+            return;
+    }
+
     TileElement* trackElement = MapGetTrackElementAtOfType(TrackLocation, trackType);
 
     if (trackElement == nullptr)
@@ -6001,8 +5971,7 @@ void Vehicle::UpdateAnimationAnimalFlying()
 
     if (animation_frame == 0)
     {
-        auto trackType = GetTrackType();
-        TileElement* trackElement = MapGetTrackElementAtOfTypeSeq(TrackLocation, trackType, 0);
+        TileElement* trackElement = GetCurrentTrackElement();
         if (trackElement != nullptr && trackElement->AsTrack()->HasChain())
         {
             // start flapping, bird
@@ -6829,7 +6798,7 @@ uint8_t Vehicle::ChooseBrakeSpeed() const
 {
     if (!TrackTypeIsBrakes(GetTrackType()))
         return brake_speed;
-    auto trackElement = MapGetTrackElementAtOfTypeSeq(TrackLocation, GetTrackType(), 0);
+    auto trackElement = GetCurrentTrackElement();
     if (trackElement != nullptr)
     {
         if (trackElement->AsTrack()->IsBrakeClosed())
@@ -7814,7 +7783,7 @@ Loc6DC462:
         uint16_t trackTotalProgress = GetTrackProgress();
         if (track_progress + 1 >= trackTotalProgress)
         {
-            tileElement = MapGetTrackElementAtOfTypeSeq(TrackLocation, GetTrackType(), 0);
+            tileElement = GetCurrentTrackElement();
             {
                 CoordsXYE output;
                 int32_t outZ{};
@@ -8035,7 +8004,7 @@ Loc6DC462:
 Loc6DCA9A:
     if (track_progress == 0)
     {
-        tileElement = MapGetTrackElementAtOfTypeSeq(TrackLocation, GetTrackType(), 0);
+        tileElement = GetCurrentTrackElement();
         {
             TrackBeginEnd trackBeginEnd;
             if (!TrackBlockGetPrevious({ TrackLocation, tileElement }, &trackBeginEnd))
@@ -8741,6 +8710,26 @@ Ride* Vehicle::GetRide() const
     return ::GetRide(ride);
 }
 
+TileElement* Vehicle::GetCurrentTrackElement() const
+{
+    const auto trackType = GetTrackType();
+    if (CachedTrackElement != nullptr && CachedTrackGeneration == MapGetTileElementGeneration()
+        && CachedTrackLocation == TrackLocation && CachedTrackType == trackType)
+    {
+        return CachedTrackElement;
+    }
+
+    auto* trackElement = MapGetTrackElementAtOfTypeSeq(TrackLocation, trackType, 0);
+    CachedTrackElement = trackElement;
+    if (trackElement != nullptr)
+    {
+        CachedTrackGeneration = MapGetTileElementGeneration();
+        CachedTrackLocation = TrackLocation;
+        CachedTrackType = trackType;
+    }
+    return trackElement;
+}
+
 int32_t Vehicle::NumPeepsUntilTrainTail() const
 {
     int32_t numPeeps = 0;
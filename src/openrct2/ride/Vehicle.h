@@ -211,6 +211,13 @@ struct Vehicle : EntityBase
     CoordsXY BoatLocation;
     uint8_t BlockBrakeSpeed;
 
+    // Transient cache of the track element under TrackLocation, revalidated
+    // against the tile element generation. Not serialised.
+    mutable TileElement* CachedTrackElement;
+    mutable uint32_t CachedTrackGeneration;
+    mutable CoordsXYZ CachedTrackLocation;
+    mutable track_type_t CachedTrackType;
+
     constexpr bool IsHead() const
     {
         return SubType == Vehicle::Type::Head;
@@ -238,6 +245,12 @@ struct Vehicle : EntityBase
      * Instantly moves the specific car forward or backwards along the track.
      */
     void MoveRelativeDistance(int32_t distance);
+    /**
+     * Returns the track element at TrackLocation for the vehicle's current
+     * track type, caching the lookup until the tile element generation moves
+     * on or the vehicle moves to another piece.
+     */
+    TileElement* GetCurrentTrackElement() const;
     track_type_t GetTrackType() const
     {
         return TrackTypeAndDirection >> 2;
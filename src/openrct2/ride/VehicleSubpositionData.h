@@ -49,4 +49,10 @@ struct VehicleInfoList
     const VehicleInfo* info;
 };
 
-extern const VehicleInfoList* const* const gTrackVehicleInfo[EnumValue(VehicleTrackSubposition::Count)];
+/**
+ * Returns the subposition steps for one track element, indexed by
+ * (trackType << 2) | direction, or nullptr when out of range. The tables are
+ * stored delta-compressed and decoded on first use; see
+ * VehicleSubpositionData.cpp for the encoding.
+ */
+const VehicleInfoList* VehicleGetTrackSubpositionInfoList(VehicleTrackSubposition subposition, uint16_t typeAndDirection);
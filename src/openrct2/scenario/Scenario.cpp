@@ -323,6 +323,7 @@ static void ScenarioWeekUpdate()
     PeepProblemWarningsUpdate();
     RideCheckAllReachable();
     RideUpdateFavouritedStat();
+    RideAuditQueueLengths();
 
     auto water_type = OpenRCT2::ObjectManager::GetObjectEntry<WaterObjectEntry>(0);
 
@@ -14,6 +14,7 @@
 #    include "../core/EnumMap.hpp"
 #    include "ScriptEngine.h"
 
+#    include <chrono>
 #    include <unordered_map>
 
 using namespace OpenRCT2::Scripting;
@@ -34,6 +35,7 @@ static const EnumMap<HOOK_TYPE> HooksLookupTable({
     { "map.change", HOOK_TYPE::MAP_CHANGE },
     { "map.changed", HOOK_TYPE::MAP_CHANGED },
     { "map.save", HOOK_TYPE::MAP_SAVE },
+    { "worker.message", HOOK_TYPE::WORKER_MESSAGE },
 });
 
 HOOK_TYPE OpenRCT2::Scripting::GetHookType(const std::string& name)
@@ -42,10 +44,32 @@ HOOK_TYPE OpenRCT2::Scripting::GetHookType(const std::string& name)
     return (result != HooksLookupTable.end()) ? result->second : HOOK_TYPE::UNDEFINED;
 }
 
+std::string_view OpenRCT2::Scripting::GetHookName(HOOK_TYPE type)
+{
+    auto result = HooksLookupTable.find(type);
+    return (result != HooksLookupTable.end()) ? result->first : std::string_view();
+}
+
+static bool ShouldSkipHook(const Hook& hook, bool isGameStateMutable)
+{
+    // Game state mutating hooks run in lockstep on every client and must not
+    // be skipped, otherwise multiplayer games would desynchronise.
+    return !isGameStateMutable && hook.Owner->IsThrottled();
+}
+
+template<typename TFunc> static void TimeHookCall(Hook& hook, const TFunc& func)
+{
+    auto startTime = std::chrono::steady_clock::now();
+    func();
+    auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime)
+                         .count();
+    hook.CallCount++;
+    hook.TotalTimeUs += static_cast<uint64_t>(elapsedUs);
+}
+
 HookEngine::HookEngine(ScriptEngine& scriptEngine)
     : _scriptEngine(scriptEngine)
 {
-    _hookMap.resize(NUM_HOOK_TYPES);
     for (size_t i = 0; i < NUM_HOOK_TYPES; i++)
     {
         _hookMap[i].Type = static_cast<HOOK_TYPE>(i);
@@ -93,12 +117,6 @@ void HookEngine::UnsubscribeAll()
     }
 }
 
-bool HookEngine::HasSubscriptions(HOOK_TYPE type) const
-{
-    auto& hookList = GetHookList(type);
-    return !hookList.Hooks.empty();
-}
-
 bool HookEngine::IsValidHookForPlugin(HOOK_TYPE type, Plugin& plugin) const
 {
     if (type == HOOK_TYPE::MAP_CHANGED && plugin.GetMetadata().Type != PluginType::Intransient)
@@ -108,69 +126,69 @@ bool HookEngine::IsValidHookForPlugin(HOOK_TYPE type, Plugin& plugin) const
     return true;
 }
 
-void HookEngine::Call(HOOK_TYPE type, bool isGameStateMutable)
+void HookEngine::CallHooks(HOOK_TYPE type, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, {}, isGameStateMutable);
+        if (ShouldSkipHook(hook, isGameStateMutable))
+            continue;
+
+        TimeHookCall(hook, [&]() { _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, {}, isGameStateMutable); });
     }
 }
 
-void HookEngine::Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable)
+void HookEngine::CallHooks(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable)
 {
     auto& hookList = GetHookList(type);
     for (auto& hook : hookList.Hooks)
     {
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable);
+        if (ShouldSkipHook(hook, isGameStateMutable))
+            continue;
+
+        TimeHookCall(
+            hook, [&]() { _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, { arg }, isGameStateMutable); });
     }
 }
 
-void HookEngine::Call(
+void HookEngine::CallHooks(
     HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable)
 {
-    auto& hookList = GetHookList(type);
-    for (auto& hook : hookList.Hooks)
-    {
-        auto ctx = _scriptEngine.GetContext();
+    auto ctx = _scriptEngine.GetContext();
 
-        // Convert key/value pairs into an object
-        auto objIdx = duk_push_object(ctx);
-        for (const auto& arg : args)
+    // Convert key/value pairs into an object, shared by every subscriber
+    auto objIdx = duk_push_object(ctx);
+    for (const auto& arg : args)
+    {
+        if (arg.second.type() == typeid(int32_t))
         {
-            if (arg.second.type() == typeid(int32_t))
-            {
-                auto val = std::any_cast<int32_t>(arg.second);
-                duk_push_int(ctx, val);
-            }
-            else if (arg.second.type() == typeid(std::string))
-            {
-                const auto& val = std::any_cast<std::string>(arg.second);
-                duk_push_string(ctx, val.c_str());
-            }
-            else
-            {
-                throw std::runtime_error("Not implemented");
-            }
-            duk_put_prop_string(ctx, objIdx, arg.first.data());
+            auto val = std::any_cast<int32_t>(arg.second);
+            duk_push_int(ctx, val);
         }
-
-        std::vector<DukValue> dukArgs;
-        dukArgs.push_back(DukValue::take_from_stack(ctx));
-        _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable);
+        else if (arg.second.type() == typeid(std::string))
+        {
+            const auto& val = std::any_cast<std::string>(arg.second);
+            duk_push_string(ctx, val.c_str());
+        }
+        else
+        {
+            throw std::runtime_error("Not implemented");
+        }
+        duk_put_prop_string(ctx, objIdx, arg.first.data());
     }
-}
 
-HookList& HookEngine::GetHookList(HOOK_TYPE type)
-{
-    auto index = static_cast<size_t>(type);
-    return _hookMap[index];
-}
+    std::vector<DukValue> dukArgs;
+    dukArgs.push_back(DukValue::take_from_stack(ctx));
 
-const HookList& HookEngine::GetHookList(HOOK_TYPE type) const
-{
-    auto index = static_cast<size_t>(type);
-    return _hookMap[index];
+    auto& hookList = GetHookList(type);
+    for (auto& hook : hookList.Hooks)
+    {
+        if (ShouldSkipHook(hook, isGameStateMutable))
+            continue;
+
+        TimeHookCall(
+            hook, [&]() { _scriptEngine.ExecutePluginCall(hook.Owner, hook.Function, dukArgs, isGameStateMutable); });
+    }
 }
 
 #endif
@@ -14,6 +14,7 @@
 #    include "Duktape.hpp"
 
 #    include <any>
+#    include <array>
 #    include <memory>
 #    include <string>
 #    include <tuple>
@@ -42,17 +43,21 @@ namespace OpenRCT2::Scripting
         MAP_CHANGE,
         MAP_CHANGED,
         MAP_SAVE,
+        WORKER_MESSAGE,
         COUNT,
         UNDEFINED = -1,
     };
     constexpr size_t NUM_HOOK_TYPES = static_cast<size_t>(HOOK_TYPE::COUNT);
     HOOK_TYPE GetHookType(const std::string& name);
+    std::string_view GetHookName(HOOK_TYPE type);
 
     struct Hook
     {
         uint32_t Cookie;
         std::shared_ptr<Plugin> Owner;
         DukValue Function;
+        uint64_t CallCount{};
+        uint64_t TotalTimeUs{};
 
         Hook() = default;
         Hook(uint32_t cookie, std::shared_ptr<Plugin> owner, const DukValue& function)
@@ -77,7 +82,7 @@ namespace OpenRCT2::Scripting
     {
     private:
         ScriptEngine& _scriptEngine;
-        std::vector<HookList> _hookMap;
+        std::array<HookList, NUM_HOOK_TYPES> _hookMap;
         uint32_t _nextCookie = 1;
 
     public:
@@ -87,16 +92,50 @@ namespace OpenRCT2::Scripting
         void Unsubscribe(HOOK_TYPE type, uint32_t cookie);
         void UnsubscribeAll(std::shared_ptr<const Plugin> owner);
         void UnsubscribeAll();
-        bool HasSubscriptions(HOOK_TYPE type) const;
         bool IsValidHookForPlugin(HOOK_TYPE type, Plugin& plugin) const;
-        void Call(HOOK_TYPE type, bool isGameStateMutable);
-        void Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable);
+        const std::array<HookList, NUM_HOOK_TYPES>& GetAllHookLists() const
+        {
+            return _hookMap;
+        }
+
+        bool HasSubscriptions(HOOK_TYPE type) const
+        {
+            return !GetHookList(type).Hooks.empty();
+        }
+
+        // The empty check is inlined at the call sites so that an event with no
+        // subscribers costs no more than a vector empty test.
+        void Call(HOOK_TYPE type, bool isGameStateMutable)
+        {
+            if (HasSubscriptions(type))
+                CallHooks(type, isGameStateMutable);
+        }
+        void Call(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable)
+        {
+            if (HasSubscriptions(type))
+                CallHooks(type, arg, isGameStateMutable);
+        }
         void Call(
-            HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable);
+            HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable)
+        {
+            if (HasSubscriptions(type))
+                CallHooks(type, args, isGameStateMutable);
+        }
 
     private:
-        HookList& GetHookList(HOOK_TYPE type);
-        const HookList& GetHookList(HOOK_TYPE type) const;
+        void CallHooks(HOOK_TYPE type, bool isGameStateMutable);
+        void CallHooks(HOOK_TYPE type, const DukValue& arg, bool isGameStateMutable);
+        void CallHooks(
+            HOOK_TYPE type, const std::initializer_list<std::pair<std::string_view, std::any>>& args, bool isGameStateMutable);
+
+        HookList& GetHookList(HOOK_TYPE type)
+        {
+            return _hookMap[static_cast<size_t>(type)];
+        }
+        const HookList& GetHookList(HOOK_TYPE type) const
+        {
+            return _hookMap[static_cast<size_t>(type)];
+        }
     };
 } // namespace OpenRCT2::Scripting
 
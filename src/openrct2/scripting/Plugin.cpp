@@ -11,17 +11,65 @@
 
 #    include "Plugin.h"
 
+#    include "../Context.h"
 #    include "../Diagnostic.h"
 #    include "../OpenRCT2.h"
+#    include "../PlatformEnvironment.h"
+#    include "../core/Crypt.h"
 #    include "../core/File.h"
+#    include "../core/Path.hpp"
 #    include "Duktape.hpp"
 #    include "ScriptEngine.h"
 
+#    include <cstdio>
+#    include <cstring>
 #    include <fstream>
 #    include <memory>
 
 using namespace OpenRCT2::Scripting;
 
+static duk_ret_t DukLoadFunctionSafe(duk_context* ctx, void*)
+{
+    duk_load_function(ctx);
+    return 1;
+}
+
+static duk_ret_t DukDumpFunctionSafe(duk_context* ctx, void*)
+{
+    duk_dump_function(ctx);
+    return 1;
+}
+
+static u8string GetBytecodeCachePath(std::string_view code)
+{
+    auto context = OpenRCT2::GetContext();
+    if (context == nullptr)
+        return {};
+    auto env = context->GetPlatformEnvironment();
+    if (env == nullptr)
+        return {};
+
+    // Key the cache file on the script contents and the duktape release so that
+    // stale bytecode can never be loaded into a different engine version.
+    auto alg = Crypt::CreateSHA1();
+    uint32_t dukVersion = DUK_VERSION;
+    alg->Update(&dukVersion, sizeof(dukVersion));
+    alg->Update(code.data(), code.size());
+    auto hash = alg->Finish();
+
+    std::string filename;
+    filename.reserve((hash.size() * 2) + 5);
+    for (auto b : hash)
+    {
+        char buf[3];
+        snprintf(buf, sizeof(buf), "%02x", b);
+        filename += buf;
+    }
+    filename += ".dukb";
+
+    return Path::Combine(env->GetDirectoryPath(OpenRCT2::DIRBASE::CACHE), "plugin", filename);
+}
+
 Plugin::Plugin(duk_context* context, std::string_view path)
     : _context(context)
     , _path(path)
@@ -48,22 +96,49 @@ void Plugin::Load()
 
     // Wrap the script in a function and pass the global objects as variables
     // so that if the script modifies them, they are not modified for other scripts.
+    // The wrapper is compiled as a function rather than evaluated directly so
+    // that its bytecode can be cached.
 
     // clang-format off
-    auto code = _code;
-    code =
-        "     (function(" + projectedVariables + ") {"
+    auto code =
+        "     function(" + projectedVariables + ") {"
         "         var __metadata__ = null;"
         "         var registerPlugin = function(m) { __metadata__ = m };"
         "         (function(__metadata__) {"
-                      + code +
+                      + _code +
         "         })();"
         "         return __metadata__;"
-        "     })(" + projectedVariables + ");";
+        "     }";
     // clang-format on
 
-    auto flags = DUK_COMPILE_EVAL | DUK_COMPILE_SAFE | DUK_COMPILE_NOSOURCE | DUK_COMPILE_NOFILENAME;
-    auto result = duk_eval_raw(_context, code.c_str(), code.size(), flags);
+    auto cachePath = GetBytecodeCachePath(code);
+    if (!LoadFromBytecodeCache(cachePath))
+    {
+        if (duk_pcompile_lstring(_context, DUK_COMPILE_FUNCTION, code.c_str(), code.size()) != DUK_ERR_NONE)
+        {
+            auto val = std::string(duk_safe_to_string(_context, -1));
+            duk_pop(_context);
+            throw std::runtime_error("Failed to load plug-in script: " + val + " at " + _path);
+        }
+        SaveToBytecodeCache(cachePath);
+    }
+
+    // Call the wrapper with the projected globals as arguments
+    duk_idx_t numArgs = 0;
+    size_t pos = 0;
+    while (pos <= projectedVariables.size())
+    {
+        auto end = projectedVariables.find(',', pos);
+        if (end == std::string::npos)
+        {
+            end = projectedVariables.size();
+        }
+        duk_get_global_lstring(_context, projectedVariables.c_str() + pos, end - pos);
+        numArgs++;
+        pos = end + 1;
+    }
+
+    auto result = duk_pcall(_context, numArgs);
     if (result != DUK_ERR_NONE)
     {
         auto val = std::string(duk_safe_to_string(_context, -1));
@@ -75,6 +150,65 @@ void Plugin::Load()
     _hasLoaded = true;
 }
 
+bool Plugin::LoadFromBytecodeCache(const std::string& cachePath)
+{
+    if (cachePath.empty() || !File::Exists(cachePath))
+    {
+        return false;
+    }
+
+    try
+    {
+        auto blob = File::ReadAllBytes(cachePath);
+        if (blob.empty())
+        {
+            return false;
+        }
+
+        auto* buffer = duk_push_fixed_buffer(_context, blob.size());
+        std::memcpy(buffer, blob.data(), blob.size());
+        if (duk_safe_call(_context, DukLoadFunctionSafe, nullptr, 1, 1) != DUK_ERR_NONE)
+        {
+            // Corrupt or incompatible bytecode, fall back to compiling
+            duk_pop(_context);
+            return false;
+        }
+        return true;
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+}
+
+void Plugin::SaveToBytecodeCache(const std::string& cachePath)
+{
+    if (cachePath.empty())
+    {
+        return;
+    }
+
+    duk_dup_top(_context);
+    if (duk_safe_call(_context, DukDumpFunctionSafe, nullptr, 1, 1) == DUK_ERR_NONE)
+    {
+        duk_size_t size{};
+        const auto* data = duk_get_buffer_data(_context, -1, &size);
+        if (data != nullptr && size != 0)
+        {
+            try
+            {
+                Path::CreateDirectory(Path::GetDirectory(cachePath));
+                File::WriteAllBytes(cachePath, data, size);
+            }
+            catch (const std::exception&)
+            {
+                // Failing to write the cache is not fatal
+            }
+        }
+    }
+    duk_pop(_context);
+}
+
 void Plugin::Start()
 {
     if (!_hasLoaded)
@@ -201,6 +335,8 @@ PluginType Plugin::ParsePluginType(std::string_view type)
         return PluginType::Remote;
     if (type == "intransient")
         return PluginType::Intransient;
+    if (type == "worker")
+        return PluginType::Worker;
     throw std::invalid_argument("Unknown plugin type.");
 }
 
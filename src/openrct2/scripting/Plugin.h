@@ -39,6 +39,26 @@ namespace OpenRCT2::Scripting
          * park changes.
          */
         Intransient,
+
+        /**
+         * Scripts that run on a worker thread with an isolated script heap and no access to the
+         * game state, communicating with main thread plugins via message passing.
+         */
+        Worker,
+    };
+
+    struct PluginPerformance
+    {
+        uint64_t CallCount{};
+        uint64_t TotalTimeUs{};
+        // Time spent executing plugin code during the current tick, reset by
+        // the script engine once budgets have been checked.
+        uint64_t TickTimeUs{};
+        uint64_t PeakTickTimeUs{};
+        uint32_t ConsecutiveOverruns{};
+        // Remaining ticks for which hooks and intervals of the plugin are
+        // skipped because it exceeded its tick budget.
+        uint32_t ThrottledTicks{};
     };
 
     struct PluginMetadata
@@ -59,6 +79,7 @@ namespace OpenRCT2::Scripting
         std::string _path;
         PluginMetadata _metadata{};
         std::string _code;
+        PluginPerformance _performance{};
         bool _hasLoaded{};
         bool _hasStarted{};
         bool _isStopping{};
@@ -84,11 +105,32 @@ namespace OpenRCT2::Scripting
             return _code;
         }
 
+        PluginPerformance& GetPerformance()
+        {
+            return _performance;
+        }
+
+        const PluginPerformance& GetPerformance() const
+        {
+            return _performance;
+        }
+
+        bool IsThrottled() const
+        {
+            return _performance.ThrottledTicks > 0;
+        }
+
         bool HasStarted() const
         {
             return _hasStarted;
         }
 
+        // Used for worker plugins, which execute on a worker thread rather than via Start().
+        void MarkAsStarted()
+        {
+            _hasStarted = true;
+        }
+
         bool IsStopping() const
         {
             return _isStopping;
@@ -119,6 +161,8 @@ namespace OpenRCT2::Scripting
 
     private:
         void LoadCodeFromFile();
+        bool LoadFromBytecodeCache(const std::string& cachePath);
+        void SaveToBytecodeCache(const std::string& cachePath);
 
         static PluginMetadata GetMetadata(const DukValue& dukMetadata);
         static PluginType ParsePluginType(std::string_view type);
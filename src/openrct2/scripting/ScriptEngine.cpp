@@ -60,6 +60,7 @@
 #    include "bindings/world/ScTileElement.hpp"
 
 #    include <cassert>
+#    include <chrono>
 #    include <iostream>
 #    include <memory>
 #    include <stdexcept>
@@ -68,6 +69,13 @@
 using namespace OpenRCT2;
 using namespace OpenRCT2::Scripting;
 
+// Number of consecutive over-budget ticks before a plugin's hooks and
+// intervals are throttled, how many ticks a throttle lasts, and how many
+// accumulated overruns suspend the plugin entirely.
+static constexpr uint32_t kPluginBudgetThrottleThreshold = 5;
+static constexpr uint32_t kPluginThrottleDurationTicks = 20;
+static constexpr uint32_t kPluginBudgetStopThreshold = 50;
+
 struct ExpressionStringifier final
 {
 private:
@@ -392,6 +400,7 @@ ScriptEngine::ScriptEngine(InteractiveConsole& console, IPlatformEnvironment& en
     : _console(console)
     , _env(env)
     , _hookEngine(*this)
+    , _workerEngine(*this)
 {
 }
 
@@ -742,6 +751,16 @@ void ScriptEngine::StartPlugin(std::shared_ptr<Plugin> plugin)
 {
     if (!plugin->HasStarted() && ShouldStartPlugin(plugin))
     {
+        if (plugin->GetMetadata().Type == PluginType::Worker)
+        {
+            // Worker plugins execute on their own thread against an isolated
+            // script heap rather than in the main context.
+            LogPluginInfo(plugin, "Started (worker)");
+            plugin->MarkAsStarted();
+            _workerEngine.StartWorker(plugin);
+            return;
+        }
+
         ScriptExecutionInfo::PluginScope scope(_execInfo, plugin, false);
         try
         {
@@ -768,6 +787,7 @@ void ScriptEngine::StopPlugin(std::shared_ptr<Plugin> plugin)
         RemoveCustomGameActions(plugin);
         RemoveIntervals(plugin);
         RemoveSockets(plugin);
+        _workerEngine.StopWorker(plugin);
         _hookEngine.UnsubscribeAll(plugin);
 
         plugin->StopEnd();
@@ -924,8 +944,68 @@ void ScriptEngine::Tick()
     CheckAndStartPlugins();
     UpdateIntervals();
     UpdateSockets();
+    _workerEngine.DispatchMessages();
     ProcessREPL();
     DoAutoReloadPluginCheck();
+    UpdatePluginPerformance();
+}
+
+void ScriptEngine::UpdatePluginPerformance()
+{
+    const auto budgetMs = Config::Get().plugin.TickBudgetMs;
+    const auto budgetUs = static_cast<uint64_t>(budgetMs) * 1000;
+
+    std::vector<std::shared_ptr<Plugin>> pluginsToStop;
+    for (auto& plugin : _plugins)
+    {
+        auto& perf = plugin->GetPerformance();
+        perf.PeakTickTimeUs = std::max(perf.PeakTickTimeUs, perf.TickTimeUs);
+
+        if (perf.ThrottledTicks > 0)
+        {
+            perf.ThrottledTicks--;
+        }
+
+        if (budgetMs > 0 && plugin->HasStarted())
+        {
+            if (perf.TickTimeUs > budgetUs)
+            {
+                perf.ConsecutiveOverruns++;
+                if (perf.ConsecutiveOverruns >= kPluginBudgetStopThreshold
+                    && plugin->GetMetadata().Type != PluginType::Remote)
+                {
+                    // Remote plugins are shared with all multiplayer clients;
+                    // stopping them on one machine only would desynchronise.
+                    LogPluginInfo(
+                        plugin,
+                        "Repeatedly exceeded the " + std::to_string(budgetMs) + " ms tick budget, suspending plugin");
+                    pluginsToStop.push_back(plugin);
+                }
+                else if (perf.ConsecutiveOverruns >= kPluginBudgetThrottleThreshold)
+                {
+                    if (perf.ConsecutiveOverruns == kPluginBudgetThrottleThreshold)
+                    {
+                        LogPluginInfo(
+                            plugin,
+                            "Exceeded the " + std::to_string(budgetMs)
+                                + " ms tick budget, throttling hooks and intervals");
+                    }
+                    perf.ThrottledTicks = kPluginThrottleDurationTicks;
+                }
+            }
+            else if (perf.ThrottledTicks == 0)
+            {
+                perf.ConsecutiveOverruns = 0;
+            }
+        }
+
+        perf.TickTimeUs = 0;
+    }
+
+    for (auto& plugin : pluginsToStop)
+    {
+        StopPlugin(plugin);
+    }
 }
 
 void ScriptEngine::CheckAndStartPlugins()
@@ -1002,7 +1082,14 @@ DukValue ScriptEngine::ExecutePluginCall(
         {
             arg.push();
         }
+        auto startTime = std::chrono::steady_clock::now();
         auto result = duk_pcall_method(_context, static_cast<duk_idx_t>(args.size()));
+        auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime)
+                             .count();
+        auto& perf = plugin->GetPerformance();
+        perf.CallCount++;
+        perf.TotalTimeUs += static_cast<uint64_t>(elapsedUs);
+        perf.TickTimeUs += static_cast<uint64_t>(elapsedUs);
         if (result == DUK_EXEC_SUCCESS)
         {
             return DukValue::take_from_stack(_context);
@@ -1718,6 +1805,12 @@ void ScriptEngine::UpdateIntervals()
             continue;
         }
 
+        if (interval.Owner->IsThrottled())
+        {
+            // Over its tick budget; the interval fires once the throttle expires
+            continue;
+        }
+
         ExecutePluginCall(interval.Owner, interval.Callback, {}, false);
 
         interval.LastTimestamp = timestamp;
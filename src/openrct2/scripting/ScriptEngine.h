@@ -17,6 +17,7 @@
 #    include "../world/Location.hpp"
 #    include "HookEngine.h"
 #    include "Plugin.h"
+#    include "WorkerEngine.h"
 
 #    include <future>
 #    include <list>
@@ -151,6 +152,7 @@ namespace OpenRCT2::Scripting
         std::vector<std::shared_ptr<Plugin>> _plugins;
         uint32_t _lastHotReloadCheckTick{};
         HookEngine _hookEngine;
+        WorkerEngine _workerEngine;
         ScriptExecutionInfo _execInfo;
         DukValue _sharedStorage;
         DukValue _parkStorage;
@@ -189,6 +191,10 @@ namespace OpenRCT2::Scripting
         {
             return _hookEngine;
         }
+        WorkerEngine& GetWorkerEngine()
+        {
+            return _workerEngine;
+        }
         ScriptExecutionInfo& GetExecInfo()
         {
             return _execInfo;
@@ -297,6 +303,7 @@ namespace OpenRCT2::Scripting
 
         IntervalHandle AllocateHandle();
         void UpdateIntervals();
+        void UpdatePluginPerformance();
         void RemoveIntervals(const std::shared_ptr<Plugin>& plugin);
 
         void UpdateSockets();
@@ -0,0 +1,312 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#ifdef ENABLE_SCRIPTING
+
+#    include "WorkerEngine.h"
+
+#    include "../core/Console.hpp"
+#    include "Duktape.hpp"
+#    include "HookEngine.h"
+#    include "Plugin.h"
+#    include "ScriptEngine.h"
+
+#    include <algorithm>
+#    include <atomic>
+#    include <condition_variable>
+#    include <mutex>
+#    include <queue>
+#    include <thread>
+
+namespace OpenRCT2::Scripting
+{
+    struct WorkerInstance
+    {
+        std::string PluginName;
+        std::string Code;
+        std::shared_ptr<Plugin> Owner;
+
+        std::thread Thread;
+        std::atomic<bool> Running{ true };
+
+        std::mutex Mutex;
+        std::condition_variable Condition;
+        std::queue<std::string> Inbox;
+        std::queue<std::string> Outbox;
+    };
+
+    /**
+     * Worker side counterpart of ScContext. Together with the console this is
+     * the only API projected into a worker heap.
+     */
+    class ScWorkerContext
+    {
+    private:
+        WorkerInstance& _worker;
+        DukValue _onMessage;
+
+    public:
+        ScWorkerContext(WorkerInstance& worker)
+            : _worker(worker)
+        {
+        }
+
+        void postMessage(DukValue message)
+        {
+            auto ctx = message.context();
+            message.push();
+            const auto* json = duk_json_encode(ctx, -1);
+            auto payload = json != nullptr ? std::string(json) : std::string("null");
+            duk_pop(ctx);
+            {
+                std::lock_guard guard(_worker.Mutex);
+                _worker.Outbox.push(std::move(payload));
+            }
+        }
+
+        void onMessage(const DukValue& callback)
+        {
+            _onMessage = callback;
+        }
+
+        const DukValue& GetMessageCallback() const
+        {
+            return _onMessage;
+        }
+
+        static void Register(duk_context* ctx)
+        {
+            dukglue_register_method(ctx, &ScWorkerContext::postMessage, "postMessage");
+            dukglue_register_method(ctx, &ScWorkerContext::onMessage, "onMessage");
+        }
+    };
+
+    /**
+     * Worker side console, writes to stdout rather than the in-game console
+     * which is not safe to use off the main thread.
+     */
+    class ScWorkerConsole
+    {
+    public:
+        duk_ret_t log(duk_context* ctx)
+        {
+            std::string line;
+            auto nargs = duk_get_top(ctx);
+            for (duk_idx_t i = 0; i < nargs; i++)
+            {
+                auto arg = DukValue::copy_from_stack(ctx, i);
+                auto argsz = Stringify(arg);
+                if (i != 0)
+                {
+                    line.push_back(' ');
+                }
+                line += argsz;
+            }
+            Console::WriteLine("%s", line.c_str());
+            return 0;
+        }
+
+        static void Register(duk_context* ctx)
+        {
+            dukglue_register_method_varargs(ctx, &ScWorkerConsole::log, "log");
+        }
+    };
+
+    static duk_ret_t DukJsonDecodeSafe(duk_context* ctx, void*)
+    {
+        duk_json_decode(ctx, -1);
+        return 1;
+    }
+
+    static void WorkerThreadMain(WorkerInstance& worker)
+    {
+        DukContext context;
+        auto ctx = static_cast<duk_context*>(context);
+
+        ScWorkerConsole::Register(ctx);
+        ScWorkerContext::Register(ctx);
+
+        auto workerContext = std::make_shared<ScWorkerContext>(worker);
+        dukglue_register_global(ctx, std::make_shared<ScWorkerConsole>(), "console");
+        dukglue_register_global(ctx, workerContext, "context");
+
+        // The plugin wrapper projects the full set of globals, define the ones
+        // not available to workers so that referencing them yields undefined
+        // rather than a ReferenceError.
+        for (const auto* name : { "date", "map", "network", "park", "profiler", "ui" })
+        {
+            duk_push_undefined(ctx);
+            duk_put_global_string(ctx, name);
+        }
+
+        try
+        {
+            Plugin plugin(ctx, {});
+            plugin.SetCode(worker.Code);
+            plugin.Load();
+            plugin.Start();
+        }
+        catch (const std::exception& e)
+        {
+            Console::Error::WriteLine("[%s] %s", worker.PluginName.c_str(), e.what());
+        }
+
+        while (worker.Running)
+        {
+            std::string payload;
+            {
+                std::unique_lock lock(worker.Mutex);
+                worker.Condition.wait(lock, [&worker]() { return !worker.Running || !worker.Inbox.empty(); });
+                if (!worker.Running)
+                    break;
+                payload = std::move(worker.Inbox.front());
+                worker.Inbox.pop();
+            }
+
+            const auto& callback = workerContext->GetMessageCallback();
+            if (callback.context() == nullptr)
+                continue;
+
+            duk_push_lstring(ctx, payload.c_str(), payload.size());
+            if (duk_safe_call(ctx, DukJsonDecodeSafe, nullptr, 1, 1) != DUK_ERR_NONE)
+            {
+                Console::Error::WriteLine("[%s] %s", worker.PluginName.c_str(), duk_safe_to_string(ctx, -1));
+                duk_pop(ctx);
+                continue;
+            }
+            auto message = DukValue::take_from_stack(ctx);
+
+            callback.push();
+            message.push();
+            if (duk_pcall(ctx, 1) != DUK_ERR_NONE)
+            {
+                Console::Error::WriteLine("[%s] %s", worker.PluginName.c_str(), duk_safe_to_string(ctx, -1));
+            }
+            duk_pop(ctx);
+        }
+    }
+
+    WorkerEngine::WorkerEngine(ScriptEngine& scriptEngine)
+        : _scriptEngine(scriptEngine)
+    {
+    }
+
+    WorkerEngine::~WorkerEngine()
+    {
+        StopAll();
+    }
+
+    void WorkerEngine::StartWorker(const std::shared_ptr<Plugin>& plugin)
+    {
+        const auto& metadata = plugin->GetMetadata();
+        auto existing = std::find_if(_workers.begin(), _workers.end(), [&plugin](const std::unique_ptr<WorkerInstance>& w) {
+            return w->Owner == plugin;
+        });
+        if (existing != _workers.end())
+        {
+            return;
+        }
+
+        auto worker = std::make_unique<WorkerInstance>();
+        worker->PluginName = metadata.Name;
+        worker->Code = plugin->GetCode();
+        worker->Owner = plugin;
+
+        auto* workerPtr = worker.get();
+        worker->Thread = std::thread([workerPtr]() { WorkerThreadMain(*workerPtr); });
+        _workers.push_back(std::move(worker));
+    }
+
+    void WorkerEngine::StopWorker(const std::shared_ptr<Plugin>& plugin)
+    {
+        auto it = std::find_if(_workers.begin(), _workers.end(), [&plugin](const std::unique_ptr<WorkerInstance>& w) {
+            return w->Owner == plugin;
+        });
+        if (it != _workers.end())
+        {
+            auto& worker = **it;
+            {
+                std::lock_guard guard(worker.Mutex);
+                worker.Running = false;
+            }
+            worker.Condition.notify_all();
+            worker.Thread.join();
+            _workers.erase(it);
+        }
+    }
+
+    void WorkerEngine::StopAll()
+    {
+        for (auto& worker : _workers)
+        {
+            {
+                std::lock_guard guard(worker->Mutex);
+                worker->Running = false;
+            }
+            worker->Condition.notify_all();
+            worker->Thread.join();
+        }
+        _workers.clear();
+    }
+
+    bool WorkerEngine::PostMessageToWorker(std::string_view pluginName, std::string&& payload)
+    {
+        for (auto& worker : _workers)
+        {
+            if (worker->PluginName == pluginName)
+            {
+                {
+                    std::lock_guard guard(worker->Mutex);
+                    worker->Inbox.push(std::move(payload));
+                }
+                worker->Condition.notify_all();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void WorkerEngine::DispatchMessages()
+    {
+        auto& hookEngine = _scriptEngine.GetHookEngine();
+        auto ctx = _scriptEngine.GetContext();
+        for (auto& worker : _workers)
+        {
+            std::queue<std::string> outbox;
+            {
+                std::lock_guard guard(worker->Mutex);
+                outbox.swap(worker->Outbox);
+            }
+            while (!outbox.empty())
+            {
+                auto payload = std::move(outbox.front());
+                outbox.pop();
+                if (!hookEngine.HasSubscriptions(HOOK_TYPE::WORKER_MESSAGE))
+                {
+                    continue;
+                }
+
+                duk_push_lstring(ctx, payload.c_str(), payload.size());
+                if (duk_safe_call(ctx, DukJsonDecodeSafe, nullptr, 1, 1) != DUK_ERR_NONE)
+                {
+                    duk_pop(ctx);
+                    continue;
+                }
+                auto message = DukValue::take_from_stack(ctx);
+
+                DukObject obj(ctx);
+                obj.Set("worker", worker->PluginName);
+                obj.Set("message", message);
+                hookEngine.Call(HOOK_TYPE::WORKER_MESSAGE, obj.Take(), false);
+            }
+        }
+    }
+} // namespace OpenRCT2::Scripting
+
+#endif
@@ -0,0 +1,59 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#pragma once
+
+#ifdef ENABLE_SCRIPTING
+
+#    include <memory>
+#    include <string>
+#    include <string_view>
+#    include <vector>
+
+namespace OpenRCT2::Scripting
+{
+    class Plugin;
+    class ScriptEngine;
+    struct WorkerInstance;
+
+    /**
+     * Runs worker plugins, each on its own thread with an isolated duktape heap.
+     * Workers have no access to the game state; they exchange JSON messages with
+     * main thread plugins instead.
+     */
+    class WorkerEngine
+    {
+    private:
+        ScriptEngine& _scriptEngine;
+        std::vector<std::unique_ptr<WorkerInstance>> _workers;
+
+    public:
+        WorkerEngine(ScriptEngine& scriptEngine);
+        WorkerEngine(const WorkerEngine&) = delete;
+        ~WorkerEngine();
+
+        void StartWorker(const std::shared_ptr<Plugin>& plugin);
+        void StopWorker(const std::shared_ptr<Plugin>& plugin);
+        void StopAll();
+
+        /**
+         * Queues an already JSON encoded message for the named worker plugin.
+         * Returns false if no such worker is running.
+         */
+        bool PostMessageToWorker(std::string_view pluginName, std::string&& payload);
+
+        /**
+         * Delivers queued worker messages to main thread plugins via the
+         * worker.message hook. Must be called from the main thread.
+         */
+        void DispatchMessages();
+    };
+} // namespace OpenRCT2::Scripting
+
+#endif
@@ -542,11 +542,11 @@ namespace OpenRCT2::Scripting
             if (value.type() == DukValue::Type::NUMBER && value.as_uint() < GetGameState().Rides.size()
                 && GetGameState().Rides[value.as_uint()].type != RIDE_TYPE_NULL)
             {
-                peep->FavouriteRide = RideId::FromUnderlying(value.as_uint());
+                peep->SetFavouriteRide(RideId::FromUnderlying(value.as_uint()));
             }
             else
             {
-                peep->FavouriteRide = RideId::GetNull();
+                peep->SetFavouriteRide(RideId::GetNull());
             }
         }
     }
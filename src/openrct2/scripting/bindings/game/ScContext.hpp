@@ -310,6 +310,17 @@ namespace OpenRCT2::Scripting
             return CreateSubscription(hookType, callback);
         }
 
+        bool postMessageToWorker(const std::string& worker, DukValue message)
+        {
+            auto& scriptEngine = GetContext()->GetScriptEngine();
+            auto ctx = message.context();
+            message.push();
+            const auto* json = duk_json_encode(ctx, -1);
+            auto payload = json != nullptr ? std::string(json) : std::string("null");
+            duk_pop(ctx);
+            return scriptEngine.GetWorkerEngine().PostMessageToWorker(worker, std::move(payload));
+        }
+
         void queryAction(const std::string& action, const DukValue& args, const DukValue& callback)
         {
             QueryOrExecuteAction(action, args, callback, false);
@@ -454,6 +465,7 @@ namespace OpenRCT2::Scripting
             dukglue_register_method(ctx, &ScContext::getRandom, "getRandom");
             dukglue_register_method_varargs(ctx, &ScContext::formatString, "formatString");
             dukglue_register_method(ctx, &ScContext::subscribe, "subscribe");
+            dukglue_register_method(ctx, &ScContext::postMessageToWorker, "postMessageToWorker");
             dukglue_register_method(ctx, &ScContext::queryAction, "queryAction");
             dukglue_register_method(ctx, &ScContext::executeAction, "executeAction");
             dukglue_register_method(ctx, &ScContext::registerAction, "registerAction");
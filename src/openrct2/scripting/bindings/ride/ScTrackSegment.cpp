@@ -182,14 +182,17 @@ uint16_t ScTrackSegment::getSubpositionLength(uint8_t trackSubposition, uint8_t
 std::vector<DukValue> ScTrackSegment::getSubpositions(uint8_t trackSubposition, uint8_t direction) const
 {
     const auto ctx = GetContext()->GetScriptEngine().GetContext();
-    const uint16_t size = getSubpositionLength(trackSubposition, direction);
     const uint16_t typeAndDirection = (_type << 2) | (direction & 3);
+    const auto* list = VehicleGetTrackSubpositionInfoList(
+        static_cast<VehicleTrackSubposition>(trackSubposition), typeAndDirection);
 
     std::vector<DukValue> result;
+    if (list == nullptr)
+        return result;
 
-    for (auto idx = 0; idx < size; idx++)
+    for (uint16_t idx = 0; idx < list->size; idx++)
     {
-        result.push_back(ToDuk<VehicleInfo>(ctx, gTrackVehicleInfo[trackSubposition][typeAndDirection]->info[idx]));
+        result.push_back(ToDuk<VehicleInfo>(ctx, list->info[idx]));
     }
     return result;
 }
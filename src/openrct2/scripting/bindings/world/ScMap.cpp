@@ -34,6 +34,11 @@
 #    include "../ride/ScRide.hpp"
 #    include "../ride/ScTrackIterator.h"
 #    include "../world/ScTile.hpp"
+#    include "../world/ScTileElement.hpp"
+
+#    include <algorithm>
+#    include <cstring>
+#    include <optional>
 
 namespace OpenRCT2::Scripting
 {
@@ -57,32 +62,223 @@ namespace OpenRCT2::Scripting
         return MAX_ENTITIES;
     }
 
-    std::vector<std::shared_ptr<ScRide>> ScMap::rides_get() const
+    std::vector<DukValue> ScMap::rides_get() const
     {
-        std::vector<std::shared_ptr<ScRide>> result;
+        std::vector<DukValue> result;
         auto rideManager = GetRideManager();
+        result.reserve(rideManager.size());
         for (const auto& ride : rideManager)
         {
-            result.push_back(std::make_shared<ScRide>(ride.id));
+            result.push_back(GetRideAsDukValue(ride.id));
         }
         return result;
     }
 
-    std::shared_ptr<ScRide> ScMap::getRide(int32_t id) const
+    DukValue ScMap::getRide(int32_t id) const
     {
         auto rideManager = GetRideManager();
         auto ride = rideManager[RideId::FromUnderlying(id)];
         if (ride != nullptr)
         {
-            return std::make_shared<ScRide>(ride->id);
+            return GetRideAsDukValue(ride->id);
         }
-        return {};
+        duk_push_null(_context);
+        return DukValue::take_from_stack(_context);
     }
 
-    std::shared_ptr<ScTile> ScMap::getTile(int32_t x, int32_t y) const
+    DukValue ScMap::getTile(int32_t x, int32_t y) const
     {
+        auto key = (static_cast<uint32_t>(x & 0xFFFF) << 16) | static_cast<uint32_t>(y & 0xFFFF);
+        auto it = _tileWrappers.find(key);
+        if (it != _tileWrappers.end())
+        {
+            return it->second;
+        }
+
+        // Tile wrappers are position keyed and never become stale, but there
+        // are too many tiles to cache them all.
+        if (_tileWrappers.size() >= kMaxCachedTileWrappers)
+        {
+            _tileWrappers.clear();
+        }
+
         auto coords = TileCoordsXY(x, y).ToCoordsXY();
-        return std::make_shared<ScTile>(coords);
+        auto wrapper = GetObjectAsDukValue(_context, std::make_shared<ScTile>(coords));
+        _tileWrappers.emplace(key, wrapper);
+        return wrapper;
+    }
+
+    static MapRange GetClampedRange(const DukValue& dukRange)
+    {
+        auto range = FromDuk<MapRange>(dukRange).Normalise();
+        auto maxXY = GetMapSizeMaxXY();
+        auto left = std::clamp(range.GetLeft(), 0, maxXY.x);
+        auto top = std::clamp(range.GetTop(), 0, maxXY.y);
+        auto right = std::clamp(range.GetRight(), 0, maxXY.x);
+        auto bottom = std::clamp(range.GetBottom(), 0, maxXY.y);
+        return MapRange(left, top, right, bottom);
+    }
+
+    static std::optional<TileElementType> TileElementTypeFromString(const std::string& value)
+    {
+        if (value == "surface")
+            return TileElementType::Surface;
+        if (value == "footpath")
+            return TileElementType::Path;
+        if (value == "track")
+            return TileElementType::Track;
+        if (value == "small_scenery")
+            return TileElementType::SmallScenery;
+        if (value == "entrance")
+            return TileElementType::Entrance;
+        if (value == "wall")
+            return TileElementType::Wall;
+        if (value == "large_scenery")
+            return TileElementType::LargeScenery;
+        if (value == "banner")
+            return TileElementType::Banner;
+        return std::nullopt;
+    }
+
+    static RideId GetTileElementRideIndex(const TileElement& element)
+    {
+        switch (element.GetType())
+        {
+            case TileElementType::Path:
+                return element.AsPath()->GetRideIndex();
+            case TileElementType::Track:
+                return element.AsTrack()->GetRideIndex();
+            case TileElementType::Entrance:
+                return element.AsEntrance()->GetRideIndex();
+            default:
+                return RideId::GetNull();
+        }
+    }
+
+    DukValue ScMap::getTileDataInRegion(const DukValue& range) const
+    {
+        auto mapRange = GetClampedRange(range);
+        auto tilesWide = ((mapRange.GetRight() - mapRange.GetLeft()) / COORDS_XY_STEP) + 1;
+        auto tilesHigh = ((mapRange.GetBottom() - mapRange.GetTop()) / COORDS_XY_STEP) + 1;
+
+        // First pass: count the elements on each tile so both buffers can be allocated up front.
+        std::vector<uint32_t> counts;
+        counts.reserve(static_cast<size_t>(tilesWide) * tilesHigh);
+        size_t numElements = 0;
+        for (int32_t y = mapRange.GetTop(); y <= mapRange.GetBottom(); y += COORDS_XY_STEP)
+        {
+            for (int32_t x = mapRange.GetLeft(); x <= mapRange.GetRight(); x += COORDS_XY_STEP)
+            {
+                uint32_t count = 0;
+                auto* element = MapGetFirstElementAt(CoordsXY(x, y));
+                if (element != nullptr)
+                {
+                    do
+                    {
+                        count++;
+                    } while (!(element++)->IsLastForTile());
+                }
+                counts.push_back(count);
+                numElements += count;
+            }
+        }
+
+        auto countsLen = counts.size() * sizeof(uint32_t);
+        auto* countsData = duk_push_fixed_buffer(_context, countsLen);
+        std::memcpy(countsData, counts.data(), countsLen);
+        duk_push_buffer_object(_context, -1, 0, countsLen, DUK_BUFOBJ_UINT32ARRAY);
+        auto dukCounts = DukValue::take_from_stack(_context);
+
+        // Second pass: copy the raw element data, one contiguous run per tile.
+        auto dataLen = numElements * sizeof(TileElement);
+        auto* data = static_cast<uint8_t*>(duk_push_fixed_buffer(_context, dataLen));
+        size_t tileIndex = 0;
+        size_t offset = 0;
+        for (int32_t y = mapRange.GetTop(); y <= mapRange.GetBottom(); y += COORDS_XY_STEP)
+        {
+            for (int32_t x = mapRange.GetLeft(); x <= mapRange.GetRight(); x += COORDS_XY_STEP)
+            {
+                auto count = counts[tileIndex++];
+                if (count != 0)
+                {
+                    auto* first = MapGetFirstElementAt(CoordsXY(x, y));
+                    std::memcpy(data + offset, first, count * sizeof(TileElement));
+                    offset += count * sizeof(TileElement);
+                }
+            }
+        }
+        duk_push_buffer_object(_context, -1, 0, dataLen, DUK_BUFOBJ_UINT8ARRAY);
+        auto dukData = DukValue::take_from_stack(_context);
+
+        DukObject obj(_context);
+        obj.Set("x", mapRange.GetLeft() / COORDS_XY_STEP);
+        obj.Set("y", mapRange.GetTop() / COORDS_XY_STEP);
+        obj.Set("width", tilesWide);
+        obj.Set("height", tilesHigh);
+        obj.Set("counts", dukCounts);
+        obj.Set("data", dukData);
+        return obj.Take();
+    }
+
+    std::vector<DukValue> ScMap::getTileElementsInRegion(const DukValue& range, const DukValue& filter) const
+    {
+        auto mapRange = GetClampedRange(range);
+
+        std::optional<TileElementType> filterType;
+        std::optional<uint8_t> filterOwner;
+        std::optional<RideId> filterRide;
+        if (filter.type() == DukValue::Type::OBJECT)
+        {
+            auto dukType = filter["type"];
+            if (dukType.type() == DukValue::Type::STRING)
+            {
+                filterType = TileElementTypeFromString(dukType.as_string());
+                if (!filterType.has_value())
+                {
+                    duk_error(_context, DUK_ERR_ERROR, "Invalid element type: %s", dukType.as_string().c_str());
+                }
+            }
+            auto dukOwner = filter["owner"];
+            if (dukOwner.type() == DukValue::Type::NUMBER)
+            {
+                filterOwner = static_cast<uint8_t>(dukOwner.as_uint());
+            }
+            auto dukRide = filter["ride"];
+            if (dukRide.type() == DukValue::Type::NUMBER)
+            {
+                filterRide = RideId::FromUnderlying(static_cast<uint16_t>(dukRide.as_uint()));
+            }
+        }
+
+        std::vector<DukValue> result;
+        for (int32_t y = mapRange.GetTop(); y <= mapRange.GetBottom(); y += COORDS_XY_STEP)
+        {
+            for (int32_t x = mapRange.GetLeft(); x <= mapRange.GetRight(); x += COORDS_XY_STEP)
+            {
+                CoordsXY coords(x, y);
+                auto* element = MapGetFirstElementAt(coords);
+                if (element == nullptr)
+                    continue;
+
+                uint32_t elementIndex = 0;
+                do
+                {
+                    if ((!filterType.has_value() || element->GetType() == *filterType)
+                        && (!filterOwner.has_value() || element->GetOwner() == *filterOwner)
+                        && (!filterRide.has_value() || GetTileElementRideIndex(*element) == *filterRide))
+                    {
+                        DukObject obj(_context);
+                        obj.Set("x", x / COORDS_XY_STEP);
+                        obj.Set("y", y / COORDS_XY_STEP);
+                        obj.Set("elementIndex", elementIndex);
+                        obj.Set("element", GetObjectAsDukValue(_context, std::make_shared<ScTileElement>(coords, element)));
+                        result.push_back(obj.Take());
+                    }
+                    elementIndex++;
+                } while (!(element++)->IsLastForTile());
+            }
+        }
+        return result;
     }
 
     DukValue ScMap::getEntity(int32_t id) const
@@ -107,7 +303,7 @@ namespace OpenRCT2::Scripting
         {
             for (auto sprite : EntityList<Balloon>())
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScEntity>(sprite->Id)));
+                result.push_back(GetEntityAsDukValue(sprite));
             }
         }
         else if (type == "car")
@@ -117,7 +313,7 @@ namespace OpenRCT2::Scripting
                 for (auto carId = trainHead->Id; !carId.IsNull();)
                 {
                     auto car = GetEntity<Vehicle>(carId);
-                    result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScVehicle>(carId)));
+                    result.push_back(GetEntityAsDukValue(car));
                     carId = car->next_vehicle_on_train;
                 }
             }
@@ -126,46 +322,46 @@ namespace OpenRCT2::Scripting
         {
             for (auto sprite : EntityList<Litter>())
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScLitter>(sprite->Id)));
+                result.push_back(GetEntityAsDukValue(sprite));
             }
         }
         else if (type == "duck")
         {
             for (auto sprite : EntityList<Duck>())
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScEntity>(sprite->Id)));
+                result.push_back(GetEntityAsDukValue(sprite));
             }
         }
         else if (type == "peep")
         {
             for (auto sprite : EntityList<Guest>())
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScGuest>(sprite->Id)));
+                result.push_back(GetEntityAsDukValue(sprite));
             }
             for (auto sprite : EntityList<Staff>())
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScStaff>(sprite->Id)));
+                result.push_back(GetEntityAsDukValue(sprite));
             }
         }
         else if (type == "guest")
         {
             for (auto sprite : EntityList<Guest>())
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScGuest>(sprite->Id)));
+                result.push_back(GetEntityAsDukValue(sprite));
             }
         }
         else if (type == "staff")
         {
             for (auto sprite : EntityList<Staff>())
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScStaff>(sprite->Id)));
+                result.push_back(GetEntityAsDukValue(sprite));
             }
         }
         else if (type == "crashed_vehicle_particle")
         {
             for (auto sprite : EntityList<VehicleCrashParticle>())
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScCrashedVehicleParticle>(sprite->Id)));
+                result.push_back(GetEntityAsDukValue(sprite));
             }
         }
         else
@@ -190,49 +386,49 @@ namespace OpenRCT2::Scripting
         {
             for (auto sprite : EntityTileList<Balloon>(pos))
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScEntity>(sprite->Id)));
+                result.push_back(GetEntityAsDukValue(sprite));
             }
         }
         else if (type == "car")
         {
             for (auto sprite : EntityTileList<Vehicle>(pos))
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScVehicle>(sprite->Id)));
+                result.push_back(GetEntityAsDukValue(sprite));
             }
         }
         else if (type == "litter")
         {
             for (auto sprite : EntityTileList<Litter>(pos))
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScLitter>(sprite->Id)));
+                result.push_back(GetEntityAsDukValue(sprite));
             }
         }
         else if (type == "duck")
         {
             for (auto sprite : EntityTileList<Duck>(pos))
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScEntity>(sprite->Id)));
+                result.push_back(GetEntityAsDukValue(sprite));
             }
         }
         else if (type == "guest")
         {
             for (auto sprite : EntityTileList<Guest>(pos))
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScGuest>(sprite->Id)));
+                result.push_back(GetEntityAsDukValue(sprite));
             }
         }
         else if (type == "staff")
         {
             for (auto sprite : EntityTileList<Staff>(pos))
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScStaff>(sprite->Id)));
+                result.push_back(GetEntityAsDukValue(sprite));
             }
         }
         else if (type == "crashed_vehicle_particle")
         {
             for (auto sprite : EntityTileList<VehicleCrashParticle>(pos))
             {
-                result.push_back(GetObjectAsDukValue(_context, std::make_shared<ScCrashedVehicleParticle>(sprite->Id)));
+                result.push_back(GetEntityAsDukValue(sprite));
             }
         }
         else
@@ -244,6 +440,12 @@ namespace OpenRCT2::Scripting
         return result;
     }
 
+    int32_t ScMap::getGuestDensity(const DukValue& tilePos) const
+    {
+        const auto pos = FromDuk<CoordsXY>(tilePos);
+        return GetGuestDensity(pos);
+    }
+
     template<typename TEntityType, typename TScriptType>
     DukValue createEntityType(duk_context* ctx, const DukValue& initializer)
     {
@@ -342,31 +544,70 @@ namespace OpenRCT2::Scripting
         dukglue_register_property(ctx, &ScMap::rides_get, nullptr, "rides");
         dukglue_register_method(ctx, &ScMap::getRide, "getRide");
         dukglue_register_method(ctx, &ScMap::getTile, "getTile");
+        dukglue_register_method(ctx, &ScMap::getTileDataInRegion, "getTileDataInRegion");
+        dukglue_register_method(ctx, &ScMap::getTileElementsInRegion, "getTileElementsInRegion");
         dukglue_register_method(ctx, &ScMap::getEntity, "getEntity");
         dukglue_register_method(ctx, &ScMap::getAllEntities, "getAllEntities");
         dukglue_register_method(ctx, &ScMap::getAllEntitiesOnTile, "getAllEntitiesOnTile");
+        dukglue_register_method(ctx, &ScMap::getGuestDensity, "getGuestDensity");
         dukglue_register_method(ctx, &ScMap::createEntity, "createEntity");
         dukglue_register_method(ctx, &ScMap::getTrackIterator, "getTrackIterator");
     }
 
+    DukValue ScMap::GetRideAsDukValue(RideId id) const
+    {
+        auto key = static_cast<int32_t>(id.ToUnderlying());
+        auto it = _rideWrappers.find(key);
+        if (it != _rideWrappers.end())
+        {
+            return it->second;
+        }
+
+        auto wrapper = GetObjectAsDukValue(_context, std::make_shared<ScRide>(id));
+        _rideWrappers.emplace(key, wrapper);
+        return wrapper;
+    }
+
     DukValue ScMap::GetEntityAsDukValue(const EntityBase* sprite) const
     {
         auto spriteId = sprite->Id;
+        auto key = static_cast<int32_t>(spriteId.ToUnderlying());
+        auto it = _entityWrappers.find(key);
+        if (it != _entityWrappers.end())
+        {
+            // Entity slots are reused; replace the wrapper if the slot now
+            // holds an entity of a different type.
+            if (it->second.Type == static_cast<uint8_t>(sprite->Type))
+            {
+                return it->second.Value;
+            }
+            _entityWrappers.erase(it);
+        }
+
+        DukValue wrapper;
         switch (sprite->Type)
         {
             case EntityType::Vehicle:
-                return GetObjectAsDukValue(_context, std::make_shared<ScVehicle>(spriteId));
+                wrapper = GetObjectAsDukValue(_context, std::make_shared<ScVehicle>(spriteId));
+                break;
             case EntityType::Staff:
-                return GetObjectAsDukValue(_context, std::make_shared<ScStaff>(spriteId));
+                wrapper = GetObjectAsDukValue(_context, std::make_shared<ScStaff>(spriteId));
+                break;
             case EntityType::Guest:
-                return GetObjectAsDukValue(_context, std::make_shared<ScGuest>(spriteId));
+                wrapper = GetObjectAsDukValue(_context, std::make_shared<ScGuest>(spriteId));
+                break;
             case EntityType::Litter:
-                return GetObjectAsDukValue(_context, std::make_shared<ScLitter>(spriteId));
+                wrapper = GetObjectAsDukValue(_context, std::make_shared<ScLitter>(spriteId));
+                break;
             case EntityType::CrashedVehicleParticle:
-                return GetObjectAsDukValue(_context, std::make_shared<ScCrashedVehicleParticle>(spriteId));
+                wrapper = GetObjectAsDukValue(_context, std::make_shared<ScCrashedVehicleParticle>(spriteId));
+                break;
             default:
-                return GetObjectAsDukValue(_context, std::make_shared<ScEntity>(spriteId));
+                wrapper = GetObjectAsDukValue(_context, std::make_shared<ScEntity>(spriteId));
+                break;
         }
+        _entityWrappers.emplace(key, EntityWrapper{ static_cast<uint8_t>(sprite->Type), wrapper });
+        return wrapper;
     }
 
 } // namespace OpenRCT2::Scripting
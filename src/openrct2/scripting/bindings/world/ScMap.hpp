@@ -16,6 +16,8 @@
 #    include "../ride/ScTrackIterator.h"
 #    include "../world/ScTile.hpp"
 
+#    include <unordered_map>
+
 namespace OpenRCT2::Scripting
 {
     class ScMap
@@ -23,6 +25,18 @@ namespace OpenRCT2::Scripting
     private:
         duk_context* _context;
 
+        // Cached script wrappers for hot objects so that repeated lookups and
+        // loops over map.rides do not allocate a fresh wrapper per access.
+        static constexpr size_t kMaxCachedTileWrappers = 4096;
+        struct EntityWrapper
+        {
+            uint8_t Type{};
+            DukValue Value;
+        };
+        mutable std::unordered_map<int32_t, DukValue> _rideWrappers;
+        mutable std::unordered_map<int32_t, EntityWrapper> _entityWrappers;
+        mutable std::unordered_map<uint32_t, DukValue> _tileWrappers;
+
     public:
         ScMap(duk_context* ctx);
 
@@ -32,11 +46,15 @@ namespace OpenRCT2::Scripting
 
         int32_t numEntities_get() const;
 
-        std::vector<std::shared_ptr<ScRide>> rides_get() const;
+        std::vector<DukValue> rides_get() const;
+
+        DukValue getRide(int32_t id) const;
 
-        std::shared_ptr<ScRide> getRide(int32_t id) const;
+        DukValue getTile(int32_t x, int32_t y) const;
 
-        std::shared_ptr<ScTile> getTile(int32_t x, int32_t y) const;
+        DukValue getTileDataInRegion(const DukValue& range) const;
+
+        std::vector<DukValue> getTileElementsInRegion(const DukValue& range, const DukValue& filter) const;
 
         DukValue getEntity(int32_t id) const;
 
@@ -44,6 +62,8 @@ namespace OpenRCT2::Scripting
 
         std::vector<DukValue> getAllEntitiesOnTile(const std::string& type, const DukValue& tilePos) const;
 
+        int32_t getGuestDensity(const DukValue& tilePos) const;
+
         DukValue createEntity(const std::string& type, const DukValue& initializer);
 
         DukValue getTrackIterator(const DukValue& position, int32_t elementIndex) const;
@@ -51,6 +71,7 @@ namespace OpenRCT2::Scripting
         static void Register(duk_context* ctx);
 
     private:
+        DukValue GetRideAsDukValue(RideId id) const;
         DukValue GetEntityAsDukValue(const EntityBase* sprite) const;
     };
 
@@ -20,6 +20,7 @@
 #    include "../../../ride/RideData.h"
 #    include "../../../ride/Track.h"
 #    include "../../../world/Footpath.h"
+#    include "../../../world/Map.h"
 #    include "../../../world/Scenery.h"
 #    include "../../../world/Surface.h"
 #    include "../../Duktape.hpp"
@@ -88,6 +89,7 @@ namespace OpenRCT2::Scripting
             return;
         }
         CreateBannerEntryIfNeeded();
+        MapInvalidateCompactElementIndex();
         Invalidate();
     }
 
@@ -99,6 +101,7 @@ namespace OpenRCT2::Scripting
     {
         ThrowIfGameStateNotMutable();
         _element->BaseHeight = newBaseHeight;
+        MapInvalidateCompactElementIndex();
         Invalidate();
     }
 
@@ -110,6 +113,7 @@ namespace OpenRCT2::Scripting
     {
         ThrowIfGameStateNotMutable();
         _element->SetBaseZ(value);
+        MapInvalidateCompactElementIndex();
         Invalidate();
     }
 
@@ -121,6 +125,7 @@ namespace OpenRCT2::Scripting
     {
         ThrowIfGameStateNotMutable();
         _element->ClearanceHeight = newClearanceHeight;
+        MapInvalidateCompactElementIndex();
         Invalidate();
     }
 
@@ -132,6 +137,7 @@ namespace OpenRCT2::Scripting
     {
         ThrowIfGameStateNotMutable();
         _element->SetClearanceZ(value);
+        MapInvalidateCompactElementIndex();
         Invalidate();
     }
 
@@ -34,8 +34,16 @@ uint32_t UtilRand();
 float UtilRandNormalDistributed();
 
 bool UtilGzipCompress(FILE* source, FILE* dest);
-std::vector<uint8_t> Gzip(const void* data, const size_t dataLen);
-std::vector<uint8_t> Ungzip(const void* data, const size_t dataLen);
+
+// Compression effort for Gzip(); trades output size for encoding speed.
+enum class GzipLevel : int32_t
+{
+    Default = -1, // zlib default, preferred for archival saves
+    Fast = 1,     // fastest deflate, for transient streams such as network transfers
+};
+
+std::vector<uint8_t> Gzip(const void* data, const size_t dataLen, GzipLevel level = GzipLevel::Default);
+std::vector<uint8_t> Ungzip(const void* data, const size_t dataLen, const size_t sizeHint = 0);
 
 template<typename T> constexpr T AddClamp(T value, T valueToAdd)
 {
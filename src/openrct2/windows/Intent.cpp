@@ -28,6 +28,11 @@ Intent::Intent(IntentAction intentAction)
 {
 }
 
+bool Intent::HasExtra(uint32_t key) const
+{
+    return _Data.count(key) != 0;
+}
+
 Intent* Intent::PutExtra(uint32_t key, uint32_t value)
 {
     IntentData data = {};
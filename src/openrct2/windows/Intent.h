@@ -90,6 +90,7 @@ public:
     WindowClass GetWindowClass() const;
     WindowDetail GetWindowDetail() const;
     IntentAction GetAction() const;
+    bool HasExtra(uint32_t key) const;
     void* GetPointerExtra(uint32_t key) const;
     std::string GetStringExtra(uint32_t key) const;
     uint32_t GetUIntExtra(uint32_t key) const;
@@ -131,4 +132,5 @@ enum
     INTENT_EXTRA_PROGRESS_OFFSET,
     INTENT_EXTRA_PROGRESS_TOTAL,
     INTENT_EXTRA_STRING_ID,
+    INTENT_EXTRA_PEEP_ID,
 };
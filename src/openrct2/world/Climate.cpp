@@ -19,6 +19,7 @@
 #include "../audio/audio.h"
 #include "../config/Config.h"
 #include "../drawing/Drawing.h"
+#include "../interface/Viewport.h"
 #include "../interface/Window.h"
 #include "../localisation/Localisation.Date.h"
 #include "../profiling/Profiling.h"
@@ -164,7 +165,9 @@ void ClimateUpdate()
                 {
                     gameState.ClimateCurrent.WeatherGloom = ClimateStepWeatherLevel(
                         gameState.ClimateCurrent.WeatherGloom, gameState.ClimateNext.WeatherGloom);
-                    GfxInvalidateScreen();
+                    // The gloom filter only darkens world pixels, so repaint the
+                    // viewports rather than the whole screen.
+                    ViewportsInvalidateAll();
                 }
             }
             else
@@ -213,8 +216,8 @@ void ClimateForceWeather(WeatherType weather)
 
     ClimateUpdate();
 
-    // In case of change in gloom level force a complete redraw
-    GfxInvalidateScreen();
+    // In case of change in gloom level force a redraw of the world
+    ViewportsInvalidateAll();
 }
 
 void ClimateUpdateSound()
@@ -152,10 +152,18 @@ GameActions::Result MapCanConstructWithClearAt(
         return res;
     }
 
+    // Broadphase: when the tile's occupancy summary proves that no non-surface
+    // element can overlap the queried z-range, the per-element collision tests
+    // are skipped and only the surface checks need to run.
+    const bool occupancyMayIntersect = MapTileOccupancyMayIntersect(pos);
+
     do
     {
         if (tileElement->GetType() != TileElementType::Surface)
         {
+            if (!occupancyMayIntersect)
+                continue;
+
             if (pos.baseZ < tileElement->GetClearanceZ() && pos.clearanceZ > tileElement->GetBaseZ()
                 && !(tileElement->IsGhost()))
             {
@@ -47,6 +47,8 @@
 
 #include <bit>
 #include <iterator>
+#include <unordered_map>
+#include <vector>
 
 using namespace OpenRCT2::TrackMetaData;
 
@@ -122,6 +124,222 @@ static bool entrance_has_direction(const EntranceElement& entranceElement, int32
     return entranceElement.GetDirections() & (1 << (direction & 3));
 }
 
+// Footpath connectivity cache. Pathfinding classifies neighbouring tiles
+// (PathIsThinJunction, FootpathElementNextInDirection) constantly and used to
+// rediscover the same path elements by scanning the tile element list each
+// time. Tiles are summarised on first query and the whole cache is dropped
+// when the tile element generation changes; path element setters that feed
+// the summary bump the generation only when a value actually changes, so the
+// per-tick wide flag sweep does not thrash it.
+static std::unordered_map<uint32_t, FootpathTileNodes> _footpathNodeCache;
+static uint32_t _footpathNodeCacheGeneration;
+
+// Count value for tiles with more stacked paths than a FootpathTileNodes holds
+constexpr uint8_t kFootpathNodeCountOverflowed = 0xFF;
+
+bool FootpathNode::IsValidZAndDirection(int32_t currentZ, Direction currentDirection) const
+{
+    if (SlopeDirection != kFootpathNodeNoSlope)
+    {
+        if (SlopeDirection == currentDirection)
+            return currentZ == BaseHeight;
+        if (DirectionReverse(SlopeDirection) != currentDirection)
+            return false;
+        return currentZ == BaseHeight + 2;
+    }
+    return currentZ == BaseHeight;
+}
+
+const FootpathTileNodes* FootpathGetTileNodes(const TileCoordsXY& coords)
+{
+    const auto generation = MapGetTileElementGeneration();
+    if (_footpathNodeCacheGeneration != generation)
+    {
+        _footpathNodeCache.clear();
+        _footpathNodeCacheGeneration = generation;
+    }
+
+    const uint32_t key = static_cast<uint16_t>(coords.x) | (static_cast<uint32_t>(static_cast<uint16_t>(coords.y)) << 16);
+    auto it = _footpathNodeCache.find(key);
+    if (it == _footpathNodeCache.end())
+    {
+        FootpathTileNodes entry{};
+        auto* element = MapGetFirstElementAt(coords);
+        if (element != nullptr)
+        {
+            do
+            {
+                if (element->IsGhost())
+                    continue;
+                auto* pathElement = element->AsPath();
+                if (pathElement == nullptr)
+                    continue;
+                if (entry.Count >= entry.Nodes.size())
+                {
+                    entry.Count = kFootpathNodeCountOverflowed;
+                    break;
+                }
+                auto& node = entry.Nodes[entry.Count++];
+                node.BaseHeight = pathElement->BaseHeight;
+                node.SlopeDirection = pathElement->IsSloped() ? pathElement->GetSlopeDirection() : kFootpathNodeNoSlope;
+                node.Edges = pathElement->GetEdges();
+                node.Flags = 0;
+                if (pathElement->IsWide())
+                    node.Flags |= kFootpathNodeFlagWide;
+                if (pathElement->IsQueue())
+                {
+                    node.Flags |= kFootpathNodeFlagQueue;
+                    if (!pathElement->GetRideIndex().IsNull())
+                        node.Flags |= kFootpathNodeFlagQueueHasRide;
+                }
+            } while (!(element++)->IsLastForTile());
+        }
+        it = _footpathNodeCache.emplace(key, entry).first;
+    }
+    return it->second.Count == kFootpathNodeCountOverflowed ? nullptr : &it->second;
+}
+
+// Connected components over the footpath graph. Mechanic dispatch needs to
+// know whether a member of staff can reach a broken down ride's exit at all,
+// and trial pathfinding answers "no" slowly and repeatedly. A flood fill over
+// the cached footpath nodes stamps every path level of every tile with a
+// component id, so the reachability test collapses to comparing two ids.
+// Rebuilt lazily against the tile element generation, like the node cache.
+struct FootpathComponentTile
+{
+    uint8_t Count;
+    std::array<uint16_t, 4> Components;
+};
+static std::unordered_map<uint32_t, FootpathComponentTile> _footpathComponentMap;
+static uint32_t _footpathComponentGeneration;
+static bool _footpathComponentsBuilt;
+
+static uint32_t FootpathComponentKey(const TileCoordsXY& coords)
+{
+    return static_cast<uint16_t>(coords.x) | (static_cast<uint32_t>(static_cast<uint16_t>(coords.y)) << 16);
+}
+
+// Returns the component entry for a tile, or nullptr for tiles the node cache
+// cannot summarise. The entry's node indices line up with FootpathGetTileNodes
+// for the same tile, as both scan the element list in the same order.
+static FootpathComponentTile* FootpathGetComponentTile(const TileCoordsXY& coords, const FootpathTileNodes* nodes)
+{
+    if (nodes == nullptr)
+        return nullptr;
+
+    auto [it, inserted] = _footpathComponentMap.try_emplace(FootpathComponentKey(coords));
+    if (inserted)
+    {
+        it->second.Count = nodes->Count;
+        it->second.Components.fill(kFootpathComponentNone);
+    }
+    return &it->second;
+}
+
+static void FootpathFloodFillComponent(const TileCoordsXY& startCoords, uint8_t startIndex, uint16_t component)
+{
+    std::vector<std::pair<TileCoordsXY, uint8_t>> stack;
+    stack.emplace_back(startCoords, startIndex);
+    while (!stack.empty())
+    {
+        auto [coords, index] = stack.back();
+        stack.pop_back();
+
+        const auto* nodes = FootpathGetTileNodes(coords);
+        if (nodes == nullptr)
+            continue;
+        const auto& node = nodes->Nodes[index];
+        for (Direction direction : ALL_DIRECTIONS)
+        {
+            if (!(node.Edges & (1 << direction)))
+                continue;
+
+            // Walking up a slope raises the arrival height by one path level
+            int32_t arrivalZ = node.BaseHeight;
+            if (node.SlopeDirection == direction)
+                arrivalZ += 2;
+
+            auto nextCoords = coords + TileDirectionDelta[direction];
+            const auto* nextNodes = FootpathGetTileNodes(nextCoords);
+            auto* nextComponents = FootpathGetComponentTile(nextCoords, nextNodes);
+            if (nextComponents == nullptr)
+                continue;
+
+            for (uint8_t i = 0; i < nextNodes->Count; i++)
+            {
+                if (nextComponents->Components[i] != kFootpathComponentNone)
+                    continue;
+                if (!nextNodes->Nodes[i].IsValidZAndDirection(arrivalZ, direction))
+                    continue;
+                nextComponents->Components[i] = component;
+                stack.emplace_back(nextCoords, i);
+            }
+        }
+    }
+}
+
+static void FootpathRebuildComponents()
+{
+    _footpathComponentMap.clear();
+
+    uint16_t nextComponent = kFootpathComponentNone;
+    TileElementIterator it;
+    TileElementIteratorBegin(&it);
+    while (TileElementIteratorNext(&it))
+    {
+        if (it.element->GetType() != TileElementType::Path || it.element->IsGhost())
+            continue;
+
+        TileCoordsXY coords{ it.x, it.y };
+        auto* components = FootpathGetComponentTile(coords, FootpathGetTileNodes(coords));
+        if (components == nullptr)
+            continue;
+
+        for (uint8_t i = 0; i < components->Count; i++)
+        {
+            if (components->Components[i] != kFootpathComponentNone)
+                continue;
+            components->Components[i] = ++nextComponent;
+            FootpathFloodFillComponent(coords, i, nextComponent);
+        }
+    }
+}
+
+uint16_t FootpathGetConnectedComponent(const CoordsXYZ& coords)
+{
+    const auto generation = MapGetTileElementGeneration();
+    if (!_footpathComponentsBuilt || _footpathComponentGeneration != generation)
+    {
+        FootpathRebuildComponents();
+        _footpathComponentGeneration = generation;
+        _footpathComponentsBuilt = true;
+    }
+
+    TileCoordsXYZ tileCoords{ coords };
+    auto it = _footpathComponentMap.find(FootpathComponentKey(TileCoordsXY{ tileCoords.x, tileCoords.y }));
+    if (it == _footpathComponentMap.end())
+        return kFootpathComponentNone;
+
+    const auto* nodes = FootpathGetTileNodes(TileCoordsXY{ tileCoords.x, tileCoords.y });
+    if (nodes == nullptr)
+        return kFootpathComponentNone;
+
+    // Pick the path level nearest the queried height; positions come from
+    // peeps and ride exits, which can sit a step above or below the path.
+    uint16_t component = kFootpathComponentNone;
+    int32_t closestDelta = std::numeric_limits<int32_t>::max();
+    for (uint8_t i = 0; i < nodes->Count; i++)
+    {
+        int32_t delta = std::abs(nodes->Nodes[i].BaseHeight - tileCoords.z);
+        if (delta <= 4 && delta < closestDelta)
+        {
+            closestDelta = delta;
+            component = it->second.Components[i];
+        }
+    }
+    return component;
+}
+
 PathElement* MapGetFootpathElement(const CoordsXYZ& coords)
 {
     TileElement* tileElement = MapGetFirstElementAt(coords);
@@ -1512,6 +1730,8 @@ bool PathElement::IsSloped() const
 
 void PathElement::SetSloped(bool isSloped)
 {
+    if (IsSloped() != isSloped)
+        MapInvalidateCompactElementIndex();
     Flags2 &= ~FOOTPATH_ELEMENT_FLAGS2_IS_SLOPED;
     if (isSloped)
         Flags2 |= FOOTPATH_ELEMENT_FLAGS2_IS_SLOPED;
@@ -1536,6 +1756,8 @@ Direction PathElement::GetSlopeDirection() const
 
 void PathElement::SetSlopeDirection(Direction newSlope)
 {
+    if (SlopeDirection != newSlope)
+        MapInvalidateCompactElementIndex();
     SlopeDirection = newSlope;
 }
 
@@ -1546,6 +1768,8 @@ bool PathElement::IsQueue() const
 
 void PathElement::SetIsQueue(bool isQueue)
 {
+    if (IsQueue() != isQueue)
+        MapInvalidateCompactElementIndex();
     Type &= ~FOOTPATH_ELEMENT_TYPE_FLAG_IS_QUEUE;
     if (isQueue)
         Type |= FOOTPATH_ELEMENT_TYPE_FLAG_IS_QUEUE;
@@ -1614,6 +1838,8 @@ bool PathElement::IsWide() const
 
 void PathElement::SetWide(bool isWide)
 {
+    if (IsWide() != isWide)
+        MapInvalidateCompactElementIndex();
     Type &= ~FOOTPATH_ELEMENT_TYPE_FLAG_IS_WIDE;
     if (isWide)
         Type |= FOOTPATH_ELEMENT_TYPE_FLAG_IS_WIDE;
@@ -2526,6 +2752,8 @@ RideId PathElement::GetRideIndex() const
 
 void PathElement::SetRideIndex(RideId newRideIndex)
 {
+    if (rideIndex != newRideIndex)
+        MapInvalidateCompactElementIndex();
     rideIndex = newRideIndex;
 }
 
@@ -2546,6 +2774,8 @@ uint8_t PathElement::GetEdges() const
 
 void PathElement::SetEdges(uint8_t newEdges)
 {
+    if (GetEdges() != (newEdges & FOOTPATH_PROPERTIES_EDGES_EDGES_MASK))
+        MapInvalidateCompactElementIndex();
     EdgesAndCorners &= ~FOOTPATH_PROPERTIES_EDGES_EDGES_MASK;
     EdgesAndCorners |= (newEdges & FOOTPATH_PROPERTIES_EDGES_EDGES_MASK);
 }
@@ -2568,6 +2798,8 @@ uint8_t PathElement::GetEdgesAndCorners() const
 
 void PathElement::SetEdgesAndCorners(uint8_t newEdgesAndCorners)
 {
+    if (EdgesAndCorners != newEdgesAndCorners)
+        MapInvalidateCompactElementIndex();
     EdgesAndCorners = newEdgesAndCorners;
 }
 
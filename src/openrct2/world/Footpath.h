@@ -184,6 +184,47 @@ extern const std::array<CoordsXY, kNumOrthogonalDirections> DirectionOffsets;
 extern const std::array<CoordsXY, kNumOrthogonalDirections> BinUseOffsets;
 extern const std::array<CoordsXY, kNumOrthogonalDirections * 2> BenchUseOffsets;
 
+constexpr uint8_t kFootpathNodeNoSlope = 0xFF;
+constexpr uint8_t kFootpathNodeFlagWide = (1 << 0);
+constexpr uint8_t kFootpathNodeFlagQueue = (1 << 1);
+constexpr uint8_t kFootpathNodeFlagQueueHasRide = (1 << 2);
+
+/**
+ * Summary of one path element for the footpath connectivity cache. Holds
+ * just the fields pathfinding needs to classify a neighbouring tile, so a
+ * connection test is array indexing rather than a tile element scan.
+ */
+struct FootpathNode
+{
+    uint8_t BaseHeight;
+    uint8_t SlopeDirection; // kFootpathNodeNoSlope when flat
+    uint8_t Edges;
+    uint8_t Flags;
+
+    bool IsValidZAndDirection(int32_t currentZ, Direction currentDirection) const;
+};
+
+struct FootpathTileNodes
+{
+    uint8_t Count;
+    std::array<FootpathNode, 4> Nodes;
+};
+
+// Returns the cached path nodes for a tile, or nullptr for tiles the cache
+// cannot summarise (more stacked paths than fit); callers fall back to
+// scanning the element list. Entries are rebuilt lazily against the tile
+// element generation, so queries against an unchanged map are cache hits.
+const FootpathTileNodes* FootpathGetTileNodes(const TileCoordsXY& coords);
+
+constexpr uint16_t kFootpathComponentNone = 0;
+
+// Returns the connected-component id of the footpath network at the given
+// position, or kFootpathComponentNone when no path is there. Two positions
+// with the same (non-none) id are joined by walkable path, so a reachability
+// test is an integer compare. Components are flood-filled lazily over the
+// cached footpath nodes and dropped when the tile element generation changes.
+uint16_t FootpathGetConnectedComponent(const CoordsXYZ& coords);
+
 PathElement* MapGetFootpathElement(const CoordsXYZ& coords);
 void FootpathInterruptPeeps(const CoordsXYZ& footpathPos);
 money64 FootpathProvisionalSet(
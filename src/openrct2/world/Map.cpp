@@ -21,6 +21,7 @@
 #include "../actions/ParkEntranceRemoveAction.h"
 #include "../actions/WallRemoveAction.h"
 #include "../audio/audio.h"
+#include "../core/BitSet.hpp"
 #include "../core/Guard.hpp"
 #include "../entity/Duck.h"
 #include "../entity/EntityTweener.h"
@@ -37,6 +38,7 @@
 #include "../object/ObjectManager.h"
 #include "../object/SmallSceneryEntry.h"
 #include "../object/TerrainSurfaceObject.h"
+#include "../paint/Painter.h"
 #include "../profiling/Profiling.h"
 #include "../ride/RideConstruction.h"
 #include "../ride/RideData.h"
@@ -60,6 +62,7 @@
 #include "TileInspector.h"
 #include "Wall.h"
 
+#include <algorithm>
 #include <iterator>
 #include <memory>
 
@@ -109,6 +112,12 @@ bool gMapLandRightsUpdateSuccess;
 
 static TilePointerIndex<TileElement> _tileIndex;
 static TilePointerIndex<TileElement> _tileIndexStash;
+
+// Tiles outside the playable map all share this canonical, read only surface
+// element, so the element storage only has to cover the playable rectangle
+// rather than the full technical map. It must never be written through; code
+// that grows the map has to materialise the affected tiles first.
+static TileElement _canonicalEmptyTile;
 static std::vector<TileElement> _tileElementsStash;
 static size_t _tileElementsInUse;
 static size_t _tileElementsInUseStash;
@@ -153,13 +162,66 @@ const std::vector<TileElement>& GetTileElements()
     return GetGameState().TileElements;
 }
 
-void SetTileElements(std::vector<TileElement>&& tileElements)
+static std::vector<CompactTileElement> _compactElementIndex;
+static bool _compactElementIndexDirty = true;
+static uint32_t _tileElementsGeneration;
+
+void MapInvalidateCompactElementIndex()
+{
+    _compactElementIndexDirty = true;
+    _tileElementsGeneration++;
+}
+
+uint32_t MapGetTileElementGeneration()
+{
+    return _tileElementsGeneration;
+}
+
+const std::vector<CompactTileElement>& MapGetCompactElementIndex()
+{
+    auto& tileElements = GetGameState().TileElements;
+    if (_compactElementIndexDirty || _compactElementIndex.size() != tileElements.size())
+    {
+        _compactElementIndex.resize(tileElements.size());
+        for (size_t i = 0; i < tileElements.size(); i++)
+        {
+            const auto& src = tileElements[i];
+            _compactElementIndex[i] = { src.Type, src.Flags, src.BaseHeight, src.ClearanceHeight };
+        }
+        _compactElementIndexDirty = false;
+    }
+    return _compactElementIndex;
+}
+
+// Cached paint columns hold pointers into the tile element storage, they must
+// not outlive a reallocation of it.
+static void FlushPaintColumnCache()
+{
+    auto* context = GetContext();
+    if (context != nullptr)
+    {
+        auto* painter = context->GetPainter();
+        if (painter != nullptr)
+        {
+            painter->ClearPaintColumnCache();
+        }
+    }
+}
+
+static TileElement GetDefaultSurfaceElement();
+
+void SetTileElements(std::vector<TileElement>&& tileElements, const TileCoordsXY& populatedSize)
 {
+    FlushPaintColumnCache();
+
     auto& gameState = GetGameState();
     gameState.TileElements = std::move(tileElements);
+    _canonicalEmptyTile = GetDefaultSurfaceElement();
     _tileIndex = TilePointerIndex<TileElement>(
-        kMaximumMapSizeTechnical, gameState.TileElements.data(), gameState.TileElements.size());
+        kMaximumMapSizeTechnical, populatedSize, gameState.TileElements.data(), gameState.TileElements.size(),
+        &_canonicalEmptyTile);
     _tileElementsInUse = gameState.TileElements.size();
+    MapInvalidateCompactElementIndex();
 }
 
 static TileElement GetDefaultSurfaceElement()
@@ -221,11 +283,14 @@ static void ReorganiseTileElements(size_t capacity)
 {
     ContextSetCurrentCursor(CursorID::ZZZ);
 
+    // Only the playable map keeps its own elements; everything outside it is
+    // dematerialised onto the canonical empty tile by SetTileElements.
+    const auto mapSize = GetGameState().MapSize;
     std::vector<TileElement> newElements;
     newElements.reserve(std::max(MIN_TILE_ELEMENTS, capacity));
-    for (int32_t y = 0; y < kMaximumMapSizeTechnical; y++)
+    for (int32_t y = 0; y < mapSize.y; y++)
     {
-        for (int32_t x = 0; x < kMaximumMapSizeTechnical; x++)
+        for (int32_t x = 0; x < mapSize.x; x++)
         {
             const auto* element = MapGetFirstElementAt(TileCoordsXY{ x, y });
             if (element == nullptr)
@@ -242,7 +307,7 @@ static void ReorganiseTileElements(size_t capacity)
         }
     }
 
-    SetTileElements(std::move(newElements));
+    SetTileElements(std::move(newElements), mapSize);
 }
 
 void ReorganiseTileElements()
@@ -292,6 +357,170 @@ bool MapCheckCapacityAndReorganise(const CoordsXY& loc, size_t numElements)
     return MapCheckFreeElementsAndReorganise(numElementsOnTile, numElements);
 }
 
+// Incremental compaction of the tile element storage. Removals leave dead
+// slots behind that fragment the vector on long uptimes until a
+// stop-the-world reorganisation is forced. Instead slide a bounded number of
+// tile element runs towards the front of the vector each tick, updating the
+// tile index as each run moves, so the storage is always coherent and no
+// copies can go stale. A structural change while a pass is in progress
+// restarts it.
+constexpr size_t kCompactionTriggerFreeElements = 4096;
+constexpr size_t kCompactionRunsPerTick = 1024;
+
+struct CompactionRun
+{
+    uint32_t Offset;    // first element of the run within the storage
+    uint32_t TileIndex; // x + y * kMaximumMapSizeTechnical
+};
+
+static std::vector<CompactionRun> _compactionRuns;
+static size_t _compactionRunCursor;
+static size_t _compactionWriteOffset;
+static bool _compactionActive;
+static uint32_t _compactionGeneration;
+
+static bool MapShouldCompact()
+{
+    return GetGameState().TileElements.size() > _tileElementsInUse + kCompactionTriggerFreeElements;
+}
+
+static void MapCompactionBegin()
+{
+    auto* base = GetGameState().TileElements.data();
+    _compactionRuns.clear();
+    _compactionRuns.reserve(static_cast<size_t>(kMaximumMapSizeTechnical) * kMaximumMapSizeTechnical);
+    for (int32_t y = 0; y < kMaximumMapSizeTechnical; y++)
+    {
+        for (int32_t x = 0; x < kMaximumMapSizeTechnical; x++)
+        {
+            auto* element = _tileIndex.GetFirstElementAt(TileCoordsXY{ x, y });
+            if (element == &_canonicalEmptyTile)
+                continue;
+            _compactionRuns.push_back({ static_cast<uint32_t>(element - base),
+                                        static_cast<uint32_t>(x + y * kMaximumMapSizeTechnical) });
+        }
+    }
+    std::sort(_compactionRuns.begin(), _compactionRuns.end(), [](const CompactionRun& a, const CompactionRun& b) {
+        return a.Offset < b.Offset;
+    });
+    _compactionRunCursor = 0;
+    _compactionWriteOffset = 0;
+    _compactionActive = true;
+    _compactionGeneration = MapGetTileElementGeneration();
+}
+
+void MapIncrementalCompaction()
+{
+    if (!_compactionActive)
+    {
+        if (!MapShouldCompact())
+        {
+            return;
+        }
+        MapCompactionBegin();
+    }
+    else if (_compactionGeneration != MapGetTileElementGeneration())
+    {
+        // The storage changed structurally under the pass, start over
+        _compactionActive = false;
+        return;
+    }
+
+    auto& tileElements = GetGameState().TileElements;
+    auto* base = tileElements.data();
+    bool movedAnything = false;
+
+    const auto lastRun = std::min(_compactionRunCursor + kCompactionRunsPerTick, _compactionRuns.size());
+    for (; _compactionRunCursor < lastRun; _compactionRunCursor++)
+    {
+        const auto& run = _compactionRuns[_compactionRunCursor];
+        auto* element = base + run.Offset;
+        size_t length = 1;
+        while (!element[length - 1].IsLastForTile())
+        {
+            length++;
+        }
+
+        if (run.Offset != _compactionWriteOffset)
+        {
+            // Runs are processed in address order, so the destination is
+            // always at or below the source and a forward copy is safe
+            std::copy(element, element + length, base + _compactionWriteOffset);
+            _tileIndex.SetTile(
+                TileCoordsXY{ static_cast<int32_t>(run.TileIndex % kMaximumMapSizeTechnical),
+                              static_cast<int32_t>(run.TileIndex / kMaximumMapSizeTechnical) },
+                base + _compactionWriteOffset);
+            movedAnything = true;
+        }
+        _compactionWriteOffset += length;
+    }
+
+    if (movedAnything)
+    {
+        // Element addresses changed, drop caches that hold pointers and
+        // re-snapshot the generation so our own bump does not abort the pass
+        FlushPaintColumnCache();
+        MapInvalidateCompactElementIndex();
+        _compactionGeneration = MapGetTileElementGeneration();
+    }
+
+    if (_compactionRunCursor >= _compactionRuns.size())
+    {
+        tileElements.resize(_compactionWriteOffset);
+        MapInvalidateCompactElementIndex();
+        _compactionActive = false;
+        _compactionRuns = {};
+    }
+}
+
+// One occupancy summary per tile, allocated on first query. A summary whose
+// generation stamp does not match the current tile element generation is
+// rebuilt by walking the tile, which is no more work than the query it
+// serves; subsequent queries against an unchanged map hit the cache.
+static std::vector<TileOccupancySummary> _tileOccupancy;
+
+const TileOccupancySummary& MapGetTileOccupancy(const TileCoordsXY& coords)
+{
+    constexpr size_t numTiles = static_cast<size_t>(kMaximumMapSizeTechnical) * kMaximumMapSizeTechnical;
+    if (_tileOccupancy.size() != numTiles)
+    {
+        // Stamp every summary one generation behind so all start out stale
+        _tileOccupancy.assign(numTiles, TileOccupancySummary{ _tileElementsGeneration - 1, 0, 0, 0 });
+    }
+
+    auto& summary = _tileOccupancy[coords.x + (coords.y * kMaximumMapSizeTechnical)];
+    if (summary.Generation != _tileElementsGeneration)
+    {
+        summary.MinBaseHeight = 0xFF;
+        summary.MaxClearanceHeight = 0;
+        summary.TypeMask = 0;
+        for (auto* element = MapGetFirstElementAt(coords); element != nullptr; element++)
+        {
+            summary.TypeMask |= 1u << static_cast<uint8_t>(element->GetType());
+            if (element->GetType() != TileElementType::Surface)
+            {
+                summary.MinBaseHeight = std::min(summary.MinBaseHeight, element->BaseHeight);
+                summary.MaxClearanceHeight = std::max(summary.MaxClearanceHeight, element->ClearanceHeight);
+            }
+            if (element->IsLastForTile())
+                break;
+        }
+        summary.Generation = _tileElementsGeneration;
+    }
+    return summary;
+}
+
+bool MapTileOccupancyMayIntersect(const CoordsXYRangedZ& pos)
+{
+    const auto& summary = MapGetTileOccupancy(TileCoordsXY(pos));
+    if (summary.MinBaseHeight == 0xFF)
+    {
+        // Nothing but the surface on this tile
+        return false;
+    }
+    return pos.baseZ < summary.MaxClearanceHeight * COORDS_Z_STEP && pos.clearanceZ > summary.MinBaseHeight * COORDS_Z_STEP;
+}
+
 static void ClearElementsAt(const CoordsXY& loc);
 
 void TileElementIteratorBegin(TileElementIterator* it)
@@ -459,8 +688,10 @@ BannerElement* MapGetBannerElementAt(const CoordsXYZ& bannerPos, uint8_t positio
  */
 void MapInit(const TileCoordsXY& size)
 {
-    auto numTiles = kMaximumMapSizeTechnical * kMaximumMapSizeTechnical;
-    SetTileElements(std::vector<TileElement>(numTiles, GetDefaultSurfaceElement()));
+    // Only the playable rectangle is materialised; the rest of the technical
+    // map shares the canonical empty tile
+    auto numTiles = size.x * size.y;
+    SetTileElements(std::vector<TileElement>(numTiles, GetDefaultSurfaceElement()), size);
 
     auto& gameState = GetGameState();
 
@@ -829,6 +1060,49 @@ bool MapCanBuildAt(const CoordsXYZ& loc)
     return false;
 }
 
+// Ownership and construction rights mirrored into flat bitsets so the
+// MapIsLocation* checks on hot paths (guest behaviour, construction
+// validation, peep spawning) are bit probes instead of surface element
+// lookups. SurfaceElement::SetOwnership bumps the tile element generation on
+// change, so the mirror follows the same lazy rebuild protocol as the other
+// derived tile caches.
+static OpenRCT2::BitSet<static_cast<size_t>(kMaximumMapSizeTechnical) * kMaximumMapSizeTechnical> _landOwnedBits;
+static OpenRCT2::BitSet<static_cast<size_t>(kMaximumMapSizeTechnical) * kMaximumMapSizeTechnical> _landRightsBits;
+static uint32_t _landOwnershipGeneration;
+static bool _landOwnershipValid;
+
+static size_t LandOwnershipIndex(const TileCoordsXY& coords)
+{
+    return static_cast<size_t>(coords.x) + (static_cast<size_t>(coords.y) * kMaximumMapSizeTechnical);
+}
+
+static void EnsureLandOwnershipBits()
+{
+    if (_landOwnershipValid && _landOwnershipGeneration == _tileElementsGeneration)
+        return;
+
+    _landOwnedBits.reset();
+    _landRightsBits.reset();
+    const auto& mapSize = GetGameState().MapSize;
+    for (int32_t y = 0; y < mapSize.y; y++)
+    {
+        for (int32_t x = 0; x < mapSize.x; x++)
+        {
+            const auto tileCoords = TileCoordsXY{ x, y };
+            auto* surfaceElement = MapGetSurfaceElementAt(tileCoords);
+            if (surfaceElement == nullptr)
+                continue;
+            const auto ownership = surfaceElement->GetOwnership();
+            if (ownership & OWNERSHIP_OWNED)
+                _landOwnedBits.set(LandOwnershipIndex(tileCoords), true);
+            if (ownership & OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED)
+                _landRightsBits.set(LandOwnershipIndex(tileCoords), true);
+        }
+    }
+    _landOwnershipGeneration = _tileElementsGeneration;
+    _landOwnershipValid = true;
+}
+
 /**
  *
  *  rct2: 0x00664F72
@@ -838,17 +1112,18 @@ bool MapIsLocationOwned(const CoordsXYZ& loc)
     // This check is to avoid throwing lots of messages in logs.
     if (MapIsLocationValid(loc))
     {
-        auto* surfaceElement = MapGetSurfaceElementAt(loc);
-        if (surfaceElement != nullptr)
+        EnsureLandOwnershipBits();
+        const auto index = LandOwnershipIndex(TileCoordsXY(loc));
+        if (_landOwnedBits[index])
+            return true;
+
+        if (_landRightsBits[index])
         {
-            if (surfaceElement->GetOwnership() & OWNERSHIP_OWNED)
+            // Construction rights depend on height; consult the surface element.
+            auto* surfaceElement = MapGetSurfaceElementAt(loc);
+            if (surfaceElement != nullptr
+                && (loc.z < surfaceElement->GetBaseZ() || loc.z >= surfaceElement->GetBaseZ() + ConstructionRightsClearanceBig))
                 return true;
-
-            if (surfaceElement->GetOwnership() & OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED)
-            {
-                if (loc.z < surfaceElement->GetBaseZ() || loc.z >= surfaceElement->GetBaseZ() + ConstructionRightsClearanceBig)
-                    return true;
-            }
         }
     }
     return false;
@@ -862,11 +1137,8 @@ bool MapIsLocationInPark(const CoordsXY& coords)
 {
     if (MapIsLocationValid(coords))
     {
-        auto surfaceElement = MapGetSurfaceElementAt(coords);
-        if (surfaceElement == nullptr)
-            return false;
-        if (surfaceElement->GetOwnership() & OWNERSHIP_OWNED)
-            return true;
+        EnsureLandOwnershipBits();
+        return _landOwnedBits[LandOwnershipIndex(TileCoordsXY(coords))];
     }
     return false;
 }
@@ -875,15 +1147,9 @@ bool MapIsLocationOwnedOrHasRights(const CoordsXY& loc)
 {
     if (MapIsLocationValid(loc))
     {
-        auto surfaceElement = MapGetSurfaceElementAt(loc);
-        if (surfaceElement == nullptr)
-        {
-            return false;
-        }
-        if (surfaceElement->GetOwnership() & OWNERSHIP_OWNED)
-            return true;
-        if (surfaceElement->GetOwnership() & OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED)
-            return true;
+        EnsureLandOwnershipBits();
+        const auto index = LandOwnershipIndex(TileCoordsXY(loc));
+        return _landOwnedBits[index] || _landRightsBits[index];
     }
     return false;
 }
@@ -1039,6 +1305,7 @@ void TileElementRemove(TileElement* tileElement)
     {
         gameState.TileElements.pop_back();
     }
+    MapInvalidateCompactElementIndex();
 }
 
 /**
@@ -1166,6 +1433,7 @@ static TileElement* AllocateTileElements(size_t numElementsOnTile, size_t numNew
     auto oldSize = gameState.TileElements.size();
     gameState.TileElements.resize(gameState.TileElements.size() + numElementsOnTile + numNewElements);
     _tileElementsInUse += numNewElements;
+    FlushPaintColumnCache();
     return &gameState.TileElements[oldSize];
 }
 
@@ -1241,6 +1509,7 @@ TileElement* TileElementInsert(const CoordsXYZ& loc, int32_t occupiedQuadrants,
         } while (!((newTileElement - 1)->IsLastForTile()));
     }
 
+    MapInvalidateCompactElementIndex();
     return insertedElement;
 }
 
@@ -1257,6 +1526,8 @@ void MapUpdateTiles()
     if (gScreenFlags & ignoreScreenFlags)
         return;
 
+    MapIncrementalCompaction();
+
     auto& gameState = GetGameState();
 
     // Update 43 more tiles (for each 256x256 block)
@@ -1366,6 +1637,11 @@ void MapRemoveOutOfRangeElements()
         {
             if (x == 0 || y == 0 || x >= mapSizeMax.x || y >= mapSizeMax.y)
             {
+                if (_tileIndex.GetFirstElementAt(TileCoordsXY{ CoordsXY{ x, y } }) == &_canonicalEmptyTile)
+                {
+                    // Dematerialised tiles have nothing to clear
+                    continue;
+                }
                 // Note this purposely does not use LandSetRightsAction as X Y coordinates are outside of normal range.
                 auto surfaceElement = MapGetSurfaceElementAt(CoordsXY{ x, y });
                 if (surfaceElement != nullptr)
@@ -1425,7 +1701,7 @@ static void MapExtendBoundarySurfaceExtendTile(const SurfaceElement& sourceTile,
 void MapExtendBoundarySurfaceY()
 {
     auto y = GetGameState().MapSize.y - 2;
-    for (auto x = 0; x < kMaximumMapSizeTechnical; x++)
+    for (auto x = 0; x < GetGameState().MapSize.x; x++)
     {
         auto existingTileElement = MapGetSurfaceElementAt(TileCoordsXY{ x, y - 1 });
         auto newTileElement = MapGetSurfaceElementAt(TileCoordsXY{ x, y });
@@ -1445,7 +1721,7 @@ void MapExtendBoundarySurfaceY()
 void MapExtendBoundarySurfaceX()
 {
     auto x = GetGameState().MapSize.x - 2;
-    for (auto y = 0; y < kMaximumMapSizeTechnical; y++)
+    for (auto y = 0; y < GetGameState().MapSize.y; y++)
     {
         auto existingTileElement = MapGetSurfaceElementAt(TileCoordsXY{ x - 1, y });
         auto newTileElement = MapGetSurfaceElementAt(TileCoordsXY{ x, y });
@@ -1776,11 +2052,55 @@ bool MapLargeScenerySignSetColour(const CoordsXYZD& signPos, int32_t sequence, u
     return true;
 }
 
+static int32_t _invalidationBatchDepth;
+static bool _invalidationBatchEmpty = true;
+static CoordsXY _invalidationBatchMin;
+static CoordsXY _invalidationBatchMax;
+
+void MapInvalidateBatchBegin()
+{
+    _invalidationBatchDepth++;
+}
+
+void MapInvalidateBatchEnd()
+{
+    Guard::Assert(_invalidationBatchDepth > 0);
+    if (--_invalidationBatchDepth > 0)
+        return;
+
+    if (!_invalidationBatchEmpty)
+    {
+        _invalidationBatchEmpty = true;
+        MapInvalidateRegion(_invalidationBatchMin, _invalidationBatchMax);
+    }
+}
+
 static void MapInvalidateTileUnderZoom(int32_t x, int32_t y, int32_t z0, int32_t z1, ZoomLevel maxZoom)
 {
     if (gOpenRCT2Headless)
         return;
 
+    if (_invalidationBatchDepth > 0)
+    {
+        // Coalesce into a single bounding rectangle flushed when the batch
+        // closes. The zoom restriction and z-range are dropped, which can only
+        // over-invalidate.
+        if (_invalidationBatchEmpty)
+        {
+            _invalidationBatchEmpty = false;
+            _invalidationBatchMin = { x, y };
+            _invalidationBatchMax = { x, y };
+        }
+        else
+        {
+            _invalidationBatchMin.x = std::min(_invalidationBatchMin.x, x);
+            _invalidationBatchMin.y = std::min(_invalidationBatchMin.y, y);
+            _invalidationBatchMax.x = std::max(_invalidationBatchMax.x, x);
+            _invalidationBatchMax.y = std::max(_invalidationBatchMax.y, y);
+        }
+        return;
+    }
+
     ViewportsInvalidate(x, y, z0, z1, maxZoom);
 }
 
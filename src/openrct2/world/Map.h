@@ -122,11 +122,76 @@ extern bool gMapLandRightsUpdateSuccess;
 
 void ReorganiseTileElements();
 const std::vector<TileElement>& GetTileElements();
-void SetTileElements(std::vector<TileElement>&& tileElements);
+void SetTileElements(
+    std::vector<TileElement>&& tileElements,
+    const TileCoordsXY& populatedSize = { kMaximumMapSizeTechnical, kMaximumMapSizeTechnical });
 void StashMap();
 void UnstashMap();
 std::vector<TileElement> GetReorganisedTileElementsWithoutGhosts();
 
+/**
+ * Compact mirror of a tile element's header (type, flags, base and clearance
+ * height), 4 bytes per element, so whole-map type-filtered scans touch a
+ * quarter of the memory of walking the elements themselves. Entry i mirrors
+ * element i of GetTileElements().
+ */
+struct CompactTileElement
+{
+    uint8_t Type;
+    uint8_t Flags;
+    uint8_t BaseHeight;
+    uint8_t ClearanceHeight;
+
+    TileElementType GetType() const
+    {
+        return static_cast<TileElementType>((Type & kTileElementTypeMask) >> 2);
+    }
+
+    bool IsLastForTile() const
+    {
+        return (Flags & TILE_ELEMENT_FLAG_LAST_TILE) != 0;
+    }
+};
+
+// The mirror is rebuilt lazily after structural map changes (load, insert,
+// remove, reorganise). In-place edits of flags or heights are not tracked,
+// so treat those fields as hints and re-check the authoritative element.
+const std::vector<CompactTileElement>& MapGetCompactElementIndex();
+void MapInvalidateCompactElementIndex();
+
+// Incremented on every structural change to the tile element storage (load,
+// insert, remove, reorganise, compaction moves). Holders of cached
+// TileElement pointers can snapshot this and re-resolve when it changes.
+uint32_t MapGetTileElementGeneration();
+
+// Moves a bounded number of tile element runs towards the front of the
+// storage each tick, reclaiming dead slots left behind by removals without
+// the cost of a full reorganisation. Called once per tick.
+void MapIncrementalCompaction();
+
+/**
+ * Per-tile occupancy summary used as a broadphase for construction clearance
+ * queries: the combined z-range and type mask of the tile's non-surface
+ * elements. Summaries are stamped with the tile element generation and
+ * rebuilt lazily, so repeated queries against an unchanged map (e.g. ghost
+ * placement preview) can reject overlaps without walking the element list.
+ */
+struct TileOccupancySummary
+{
+    uint32_t Generation;
+    uint8_t MinBaseHeight;      // minimum base height over non-surface elements
+    uint8_t MaxClearanceHeight; // maximum clearance height over non-surface elements
+    uint16_t TypeMask;          // bit per TileElementType present on the tile
+
+    bool HasType(TileElementType type) const
+    {
+        return (TypeMask & (1u << static_cast<uint8_t>(type))) != 0;
+    }
+};
+
+const TileOccupancySummary& MapGetTileOccupancy(const TileCoordsXY& coords);
+bool MapTileOccupancyMayIntersect(const CoordsXYRangedZ& pos);
+
 void MapInit(const TileCoordsXY& size);
 
 void MapCountRemainingLandRights();
@@ -216,6 +281,28 @@ void MapInvalidateTileZoom0(const CoordsXYRangedZ& tilePos);
 void MapInvalidateTileFull(const CoordsXY& tilePos);
 void MapInvalidateElement(const CoordsXY& elementPos, TileElement* tileElement);
 void MapInvalidateRegion(const CoordsXY& mins, const CoordsXY& maxs);
+void MapInvalidateBatchBegin();
+void MapInvalidateBatchEnd();
+
+/**
+ * Coalesces all tile invalidations issued while the scope is alive into a
+ * single region invalidated when the outermost scope closes. Used by actions
+ * that mutate many tiles so each nested edit does not raise its own dirty
+ * rectangle. Scopes may nest.
+ */
+struct MapInvalidationBatch
+{
+    MapInvalidationBatch()
+    {
+        MapInvalidateBatchBegin();
+    }
+    ~MapInvalidationBatch()
+    {
+        MapInvalidateBatchEnd();
+    }
+    MapInvalidationBatch(const MapInvalidationBatch&) = delete;
+    MapInvalidationBatch& operator=(const MapInvalidationBatch&) = delete;
+};
 
 int32_t MapGetTileSide(const CoordsXY& mapPos);
 int32_t MapGetTileQuadrant(const CoordsXY& mapPos);
@@ -32,13 +32,63 @@
 
 using namespace OpenRCT2;
 
-using map_animation_invalidate_event_handler = bool (*)(const CoordsXYZ& loc);
+using map_animation_invalidate_event_handler = bool (*)(MapAnimation& a);
 
 static std::vector<MapAnimation> _mapAnimations;
 
 constexpr size_t MAX_ANIMATED_OBJECTS = 2000;
 
-static bool InvalidateMapAnimation(const MapAnimation& obj);
+/**
+ * Update interval in ticks for each animation type. Wall doors only advance
+ * their frame on even ticks; everything else invalidates every tick.
+ */
+static constexpr uint8_t _animationUpdateIntervals[MAP_ANIMATION_TYPE_COUNT] = {
+    1, // MAP_ANIMATION_TYPE_RIDE_ENTRANCE
+    1, // MAP_ANIMATION_TYPE_QUEUE_BANNER
+    1, // MAP_ANIMATION_TYPE_SMALL_SCENERY
+    1, // MAP_ANIMATION_TYPE_PARK_ENTRANCE
+    1, // MAP_ANIMATION_TYPE_TRACK_WATERFALL
+    1, // MAP_ANIMATION_TYPE_TRACK_RAPIDS
+    1, // MAP_ANIMATION_TYPE_TRACK_ONRIDEPHOTO
+    1, // MAP_ANIMATION_TYPE_TRACK_WHIRLPOOL
+    1, // MAP_ANIMATION_TYPE_TRACK_SPINNINGTUNNEL
+    1, // MAP_ANIMATION_TYPE_REMOVE
+    1, // MAP_ANIMATION_TYPE_BANNER
+    1, // MAP_ANIMATION_TYPE_LARGE_SCENERY
+    2, // MAP_ANIMATION_TYPE_WALL_DOOR
+    1, // MAP_ANIMATION_TYPE_WALL
+};
+
+static bool InvalidateMapAnimation(MapAnimation& obj);
+
+/**
+ * Returns the element this animation targets. The reference cached on the
+ * entry is reused while the tile element generation is unchanged and the
+ * element still satisfies the predicate; otherwise the tile is re-scanned.
+ * Returns nullptr when no matching element remains.
+ */
+template<typename TPredicate>
+static TileElement* MapAnimationGetElement(MapAnimation& a, TPredicate&& predicate)
+{
+    const auto generation = MapGetTileElementGeneration();
+    if (a.cachedElement != nullptr && a.cachedGeneration == generation && predicate(a.cachedElement))
+        return a.cachedElement;
+
+    a.cachedElement = nullptr;
+    a.cachedGeneration = generation;
+    auto* tileElement = MapGetFirstElementAt(a.location);
+    if (tileElement == nullptr)
+        return nullptr;
+    do
+    {
+        if (predicate(tileElement))
+        {
+            a.cachedElement = tileElement;
+            return tileElement;
+        }
+    } while (!(tileElement++)->IsLastForTile());
+    return nullptr;
+}
 
 static bool DoesAnimationExist(int32_t type, const CoordsXYZ& location)
 {
@@ -77,277 +127,214 @@ void MapAnimationInvalidateAll()
 {
     PROFILED_FUNCTION();
 
-    auto it = _mapAnimations.begin();
-    while (it != _mapAnimations.end())
+    const auto currentTicks = GetGameState().CurrentTicks;
+    size_t writeIndex = 0;
+    for (size_t i = 0; i < _mapAnimations.size(); i++)
     {
-        if (InvalidateMapAnimation(*it))
+        auto& a = _mapAnimations[i];
+        bool finished = false;
+        const auto interval = a.type < MAP_ANIMATION_TYPE_COUNT ? _animationUpdateIntervals[a.type] : 1;
+        if (interval <= 1 || (currentTicks % interval) == 0)
         {
-            // Map animation has finished, remove it
-            it = _mapAnimations.erase(it);
+            finished = InvalidateMapAnimation(a);
         }
-        else
+        if (!finished)
         {
-            it++;
+            // Keep the animation, compacting the vector as we go
+            if (writeIndex != i)
+                _mapAnimations[writeIndex] = a;
+            writeIndex++;
         }
     }
+    _mapAnimations.resize(writeIndex);
 }
 
 /**
  *
  *  rct2: 0x00666670
  */
-static bool MapAnimationInvalidateRideEntrance(const CoordsXYZ& loc)
+static bool MapAnimationInvalidateRideEntrance(MapAnimation& a)
 {
+    const auto& loc = a.location;
     TileCoordsXYZ tileLoc{ loc };
-    auto tileElement = MapGetFirstElementAt(loc);
+    auto* tileElement = MapAnimationGetElement(a, [&tileLoc](TileElement* el) {
+        return el->BaseHeight == tileLoc.z && el->GetType() == TileElementType::Entrance
+            && el->AsEntrance()->GetEntranceType() == ENTRANCE_TYPE_RIDE_ENTRANCE;
+    });
     if (tileElement == nullptr)
         return true;
-    do
-    {
-        if (tileElement->BaseHeight != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TileElementType::Entrance)
-            continue;
-        if (tileElement->AsEntrance()->GetEntranceType() != ENTRANCE_TYPE_RIDE_ENTRANCE)
-            continue;
 
-        auto ride = GetRide(tileElement->AsEntrance()->GetRideIndex());
-        if (ride != nullptr)
+    auto ride = GetRide(tileElement->AsEntrance()->GetRideIndex());
+    if (ride != nullptr)
+    {
+        auto stationObj = ride->GetStationObject();
+        if (stationObj != nullptr)
         {
-            auto stationObj = ride->GetStationObject();
-            if (stationObj != nullptr)
-            {
-                int32_t height = loc.z + stationObj->Height + 8;
-                MapInvalidateTileZoom1({ loc, height, height + 16 });
-            }
+            int32_t height = loc.z + stationObj->Height + 8;
+            MapInvalidateTileZoom1({ loc, height, height + 16 });
         }
-        return false;
-    } while (!(tileElement++)->IsLastForTile());
-
-    return true;
+    }
+    return false;
 }
 
 /**
  *
  *  rct2: 0x006A7BD4
  */
-static bool MapAnimationInvalidateQueueBanner(const CoordsXYZ& loc)
+static bool MapAnimationInvalidateQueueBanner(MapAnimation& a)
 {
+    const auto& loc = a.location;
     TileCoordsXYZ tileLoc{ loc };
-    TileElement* tileElement;
-
-    tileElement = MapGetFirstElementAt(loc);
+    auto* tileElement = MapAnimationGetElement(a, [&tileLoc](TileElement* el) {
+        return el->BaseHeight == tileLoc.z && el->GetType() == TileElementType::Path && el->AsPath()->IsQueue()
+            && el->AsPath()->HasQueueBanner();
+    });
     if (tileElement == nullptr)
         return true;
-    do
-    {
-        if (tileElement->BaseHeight != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TileElementType::Path)
-            continue;
-        if (!(tileElement->AsPath()->IsQueue()))
-            continue;
-        if (!tileElement->AsPath()->HasQueueBanner())
-            continue;
-
-        int32_t direction = (tileElement->AsPath()->GetQueueBannerDirection() + GetCurrentRotation()) & 3;
-        if (direction == TILE_ELEMENT_DIRECTION_NORTH || direction == TILE_ELEMENT_DIRECTION_EAST)
-        {
-            MapInvalidateTileZoom1({ loc, loc.z + 16, loc.z + 30 });
-        }
-        return false;
-    } while (!(tileElement++)->IsLastForTile());
 
-    return true;
+    int32_t direction = (tileElement->AsPath()->GetQueueBannerDirection() + GetCurrentRotation()) & 3;
+    if (direction == TILE_ELEMENT_DIRECTION_NORTH || direction == TILE_ELEMENT_DIRECTION_EAST)
+    {
+        MapInvalidateTileZoom1({ loc, loc.z + 16, loc.z + 30 });
+    }
+    return false;
 }
 
 /**
  *
  *  rct2: 0x006E32C9
  */
-static bool MapAnimationInvalidateSmallScenery(const CoordsXYZ& loc)
+static bool MapAnimationInvalidateSmallScenery(MapAnimation& a)
 {
+    const auto& loc = a.location;
     TileCoordsXYZ tileLoc{ loc };
-
-    auto tileElement = MapGetFirstElementAt(loc);
+    auto* tileElement = MapAnimationGetElement(a, [&tileLoc](TileElement* el) {
+        if (el->BaseHeight != tileLoc.z || el->GetType() != TileElementType::SmallScenery || el->IsGhost())
+            return false;
+        auto* entry = el->AsSmallScenery()->GetEntry();
+        return entry != nullptr
+            && entry->HasFlag(
+                SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_1 | SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_4 | SMALL_SCENERY_FLAG_SWAMP_GOO
+                | SMALL_SCENERY_FLAG_HAS_FRAME_OFFSETS | SMALL_SCENERY_FLAG_IS_CLOCK);
+    });
     if (tileElement == nullptr)
         return true;
-    do
-    {
-        if (tileElement->BaseHeight != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TileElementType::SmallScenery)
-            continue;
-        if (tileElement->IsGhost())
-            continue;
-
-        auto* sceneryEntry = tileElement->AsSmallScenery()->GetEntry();
-        if (sceneryEntry == nullptr)
-            continue;
-
-        if (sceneryEntry->HasFlag(
-                SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_1 | SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_4 | SMALL_SCENERY_FLAG_SWAMP_GOO
-                | SMALL_SCENERY_FLAG_HAS_FRAME_OFFSETS))
-        {
-            MapInvalidateTileZoom1({ loc, loc.z, tileElement->GetClearanceZ() });
-            return false;
-        }
 
-        if (sceneryEntry->HasFlag(SMALL_SCENERY_FLAG_IS_CLOCK))
+    auto* sceneryEntry = tileElement->AsSmallScenery()->GetEntry();
+    if (sceneryEntry->HasFlag(SMALL_SCENERY_FLAG_IS_CLOCK)
+        && !sceneryEntry->HasFlag(
+            SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_1 | SMALL_SCENERY_FLAG_FOUNTAIN_SPRAY_4 | SMALL_SCENERY_FLAG_SWAMP_GOO
+            | SMALL_SCENERY_FLAG_HAS_FRAME_OFFSETS))
+    {
+        // Peep, looking at scenery
+        if (!(GetGameState().CurrentTicks & 0x3FF) && GameIsNotPaused())
         {
-            // Peep, looking at scenery
-            if (!(GetGameState().CurrentTicks & 0x3FF) && GameIsNotPaused())
+            int32_t direction = tileElement->GetDirection();
+            auto quad = EntityTileList<Peep>(CoordsXY{ loc } - CoordsDirectionDelta[direction]);
+            for (auto peep : quad)
             {
-                int32_t direction = tileElement->GetDirection();
-                auto quad = EntityTileList<Peep>(CoordsXY{ loc } - CoordsDirectionDelta[direction]);
-                for (auto peep : quad)
-                {
-                    if (peep->State != PeepState::Walking)
-                        continue;
-                    if (peep->z != loc.z)
-                        continue;
-                    if (peep->Action < PeepActionType::Idle)
-                        continue;
-
-                    peep->Action = PeepActionType::CheckTime;
-                    peep->ActionFrame = 0;
-                    peep->ActionSpriteImageOffset = 0;
-                    peep->UpdateCurrentActionSpriteType();
-                    peep->Invalidate();
-                    break;
-                }
+                if (peep->State != PeepState::Walking)
+                    continue;
+                if (peep->z != loc.z)
+                    continue;
+                if (peep->Action < PeepActionType::Idle)
+                    continue;
+
+                peep->Action = PeepActionType::CheckTime;
+                peep->ActionFrame = 0;
+                peep->ActionSpriteImageOffset = 0;
+                peep->UpdateCurrentActionSpriteType();
+                peep->Invalidate();
+                break;
             }
-            MapInvalidateTileZoom1({ loc, loc.z, tileElement->GetClearanceZ() });
-            return false;
         }
-
-    } while (!(tileElement++)->IsLastForTile());
-    return true;
+    }
+    MapInvalidateTileZoom1({ loc, loc.z, tileElement->GetClearanceZ() });
+    return false;
 }
 
 /**
  *
  *  rct2: 0x00666C63
  */
-static bool MapAnimationInvalidateParkEntrance(const CoordsXYZ& loc)
+static bool MapAnimationInvalidateParkEntrance(MapAnimation& a)
 {
+    const auto& loc = a.location;
     TileCoordsXYZ tileLoc{ loc };
-    TileElement* tileElement;
-
-    tileElement = MapGetFirstElementAt(loc);
+    auto* tileElement = MapAnimationGetElement(a, [&tileLoc](TileElement* el) {
+        return el->BaseHeight == tileLoc.z && el->GetType() == TileElementType::Entrance
+            && el->AsEntrance()->GetEntranceType() == ENTRANCE_TYPE_PARK_ENTRANCE && !el->AsEntrance()->GetSequenceIndex();
+    });
     if (tileElement == nullptr)
         return true;
-    do
-    {
-        if (tileElement->BaseHeight != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TileElementType::Entrance)
-            continue;
-        if (tileElement->AsEntrance()->GetEntranceType() != ENTRANCE_TYPE_PARK_ENTRANCE)
-            continue;
-        if (tileElement->AsEntrance()->GetSequenceIndex())
-            continue;
 
-        MapInvalidateTileZoom1({ loc, loc.z + 32, loc.z + 64 });
-        return false;
-    } while (!(tileElement++)->IsLastForTile());
-
-    return true;
+    MapInvalidateTileZoom1({ loc, loc.z + 32, loc.z + 64 });
+    return false;
 }
 
 /**
  *
  *  rct2: 0x006CE29E
  */
-static bool MapAnimationInvalidateTrackWaterfall(const CoordsXYZ& loc)
+static bool MapAnimationInvalidateTrackWaterfall(MapAnimation& a)
 {
+    const auto& loc = a.location;
     TileCoordsXYZ tileLoc{ loc };
-    TileElement* tileElement;
-
-    tileElement = MapGetFirstElementAt(loc);
+    auto* tileElement = MapAnimationGetElement(a, [&tileLoc](TileElement* el) {
+        return el->BaseHeight == tileLoc.z && el->GetType() == TileElementType::Track
+            && el->AsTrack()->GetTrackType() == TrackElemType::Waterfall;
+    });
     if (tileElement == nullptr)
         return true;
-    do
-    {
-        if (tileElement->BaseHeight != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TileElementType::Track)
-            continue;
 
-        if (tileElement->AsTrack()->GetTrackType() == TrackElemType::Waterfall)
-        {
-            MapInvalidateTileZoom1({ loc, loc.z + 14, loc.z + 46 });
-            return false;
-        }
-    } while (!(tileElement++)->IsLastForTile());
-
-    return true;
+    MapInvalidateTileZoom1({ loc, loc.z + 14, loc.z + 46 });
+    return false;
 }
 
 /**
  *
  *  rct2: 0x006CE2F3
  */
-static bool MapAnimationInvalidateTrackRapids(const CoordsXYZ& loc)
+static bool MapAnimationInvalidateTrackRapids(MapAnimation& a)
 {
+    const auto& loc = a.location;
     TileCoordsXYZ tileLoc{ loc };
-    TileElement* tileElement;
-
-    tileElement = MapGetFirstElementAt(loc);
+    auto* tileElement = MapAnimationGetElement(a, [&tileLoc](TileElement* el) {
+        return el->BaseHeight == tileLoc.z && el->GetType() == TileElementType::Track
+            && el->AsTrack()->GetTrackType() == TrackElemType::Rapids;
+    });
     if (tileElement == nullptr)
         return true;
-    do
-    {
-        if (tileElement->BaseHeight != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TileElementType::Track)
-            continue;
 
-        if (tileElement->AsTrack()->GetTrackType() == TrackElemType::Rapids)
-        {
-            MapInvalidateTileZoom1({ loc, loc.z + 14, loc.z + 18 });
-            return false;
-        }
-    } while (!(tileElement++)->IsLastForTile());
-
-    return true;
+    MapInvalidateTileZoom1({ loc, loc.z + 14, loc.z + 18 });
+    return false;
 }
 
 /**
  *
  *  rct2: 0x006CE39D
  */
-static bool MapAnimationInvalidateTrackOnRidePhoto(const CoordsXYZ& loc)
+static bool MapAnimationInvalidateTrackOnRidePhoto(MapAnimation& a)
 {
+    const auto& loc = a.location;
     TileCoordsXYZ tileLoc{ loc };
-    TileElement* tileElement;
-
-    tileElement = MapGetFirstElementAt(loc);
+    auto* tileElement = MapAnimationGetElement(a, [&tileLoc](TileElement* el) {
+        return el->BaseHeight == tileLoc.z && el->GetType() == TileElementType::Track
+            && el->AsTrack()->GetTrackType() == TrackElemType::OnRidePhoto;
+    });
     if (tileElement == nullptr)
         return true;
-    do
-    {
-        if (tileElement->BaseHeight != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TileElementType::Track)
-            continue;
 
-        if (tileElement->AsTrack()->GetTrackType() == TrackElemType::OnRidePhoto)
-        {
-            MapInvalidateTileZoom1({ loc, loc.z, tileElement->GetClearanceZ() });
-            if (GameIsPaused())
-            {
-                return false;
-            }
-            if (tileElement->AsTrack()->IsTakingPhoto())
-            {
-                tileElement->AsTrack()->DecrementPhotoTimeout();
-                return false;
-            }
-
-            return true;
-        }
-    } while (!(tileElement++)->IsLastForTile());
+    MapInvalidateTileZoom1({ loc, loc.z, tileElement->GetClearanceZ() });
+    if (GameIsPaused())
+    {
+        return false;
+    }
+    if (tileElement->AsTrack()->IsTakingPhoto())
+    {
+        tileElement->AsTrack()->DecrementPhotoTimeout();
+        return false;
+    }
 
     return true;
 }
@@ -356,65 +343,45 @@ static bool MapAnimationInvalidateTrackOnRidePhoto(const CoordsXYZ& loc)
  *
  *  rct2: 0x006CE348
  */
-static bool MapAnimationInvalidateTrackWhirlpool(const CoordsXYZ& loc)
+static bool MapAnimationInvalidateTrackWhirlpool(MapAnimation& a)
 {
+    const auto& loc = a.location;
     TileCoordsXYZ tileLoc{ loc };
-    TileElement* tileElement;
-
-    tileElement = MapGetFirstElementAt(loc);
+    auto* tileElement = MapAnimationGetElement(a, [&tileLoc](TileElement* el) {
+        return el->BaseHeight == tileLoc.z && el->GetType() == TileElementType::Track
+            && el->AsTrack()->GetTrackType() == TrackElemType::Whirlpool;
+    });
     if (tileElement == nullptr)
         return true;
-    do
-    {
-        if (tileElement->BaseHeight != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TileElementType::Track)
-            continue;
 
-        if (tileElement->AsTrack()->GetTrackType() == TrackElemType::Whirlpool)
-        {
-            MapInvalidateTileZoom1({ loc, loc.z + 14, loc.z + 18 });
-            return false;
-        }
-    } while (!(tileElement++)->IsLastForTile());
-
-    return true;
+    MapInvalidateTileZoom1({ loc, loc.z + 14, loc.z + 18 });
+    return false;
 }
 
 /**
  *
  *  rct2: 0x006CE3FA
  */
-static bool MapAnimationInvalidateTrackSpinningTunnel(const CoordsXYZ& loc)
+static bool MapAnimationInvalidateTrackSpinningTunnel(MapAnimation& a)
 {
+    const auto& loc = a.location;
     TileCoordsXYZ tileLoc{ loc };
-    TileElement* tileElement;
-
-    tileElement = MapGetFirstElementAt(loc);
+    auto* tileElement = MapAnimationGetElement(a, [&tileLoc](TileElement* el) {
+        return el->BaseHeight == tileLoc.z && el->GetType() == TileElementType::Track
+            && el->AsTrack()->GetTrackType() == TrackElemType::SpinningTunnel;
+    });
     if (tileElement == nullptr)
         return true;
-    do
-    {
-        if (tileElement->BaseHeight != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TileElementType::Track)
-            continue;
-
-        if (tileElement->AsTrack()->GetTrackType() == TrackElemType::SpinningTunnel)
-        {
-            MapInvalidateTileZoom1({ loc, loc.z + 14, loc.z + 32 });
-            return false;
-        }
-    } while (!(tileElement++)->IsLastForTile());
 
-    return true;
+    MapInvalidateTileZoom1({ loc, loc.z + 14, loc.z + 32 });
+    return false;
 }
 
 /**
  *
  *  rct2: 0x0068DF8F
  */
-static bool MapAnimationInvalidateRemove([[maybe_unused]] const CoordsXYZ& loc)
+static bool MapAnimationInvalidateRemove([[maybe_unused]] MapAnimation& a)
 {
     return true;
 }
@@ -423,33 +390,26 @@ static bool MapAnimationInvalidateRemove([[maybe_unused]] const CoordsXYZ& loc)
  *
  *  rct2: 0x006BA2BB
  */
-static bool MapAnimationInvalidateBanner(const CoordsXYZ& loc)
+static bool MapAnimationInvalidateBanner(MapAnimation& a)
 {
+    const auto& loc = a.location;
     TileCoordsXYZ tileLoc{ loc };
-    TileElement* tileElement;
-
-    tileElement = MapGetFirstElementAt(loc);
+    auto* tileElement = MapAnimationGetElement(
+        a, [&tileLoc](TileElement* el) { return el->BaseHeight == tileLoc.z && el->GetType() == TileElementType::Banner; });
     if (tileElement == nullptr)
         return true;
-    do
-    {
-        if (tileElement->BaseHeight != tileLoc.z)
-            continue;
-        if (tileElement->GetType() != TileElementType::Banner)
-            continue;
-        MapInvalidateTileZoom1({ loc, loc.z, loc.z + 16 });
-        return false;
-    } while (!(tileElement++)->IsLastForTile());
 
-    return true;
+    MapInvalidateTileZoom1({ loc, loc.z, loc.z + 16 });
+    return false;
 }
 
 /**
  *
  *  rct2: 0x006B94EB
  */
-static bool MapAnimationInvalidateLargeScenery(const CoordsXYZ& loc)
+static bool MapAnimationInvalidateLargeScenery(MapAnimation& a)
 {
+    const auto& loc = a.location;
     TileCoordsXYZ tileLoc{ loc };
     TileElement* tileElement;
 
@@ -479,8 +439,9 @@ static bool MapAnimationInvalidateLargeScenery(const CoordsXYZ& loc)
  *
  *  rct2: 0x006E5B50
  */
-static bool MapAnimationInvalidateWallDoor(const CoordsXYZ& loc)
+static bool MapAnimationInvalidateWallDoor(MapAnimation& a)
 {
+    const auto& loc = a.location;
     TileCoordsXYZ tileLoc{ loc };
     TileElement* tileElement;
 
@@ -543,8 +504,9 @@ static bool MapAnimationInvalidateWallDoor(const CoordsXYZ& loc)
  *
  *  rct2: 0x006E5EE4
  */
-static bool MapAnimationInvalidateWall(const CoordsXYZ& loc)
+static bool MapAnimationInvalidateWall(MapAnimation& a)
 {
+    const auto& loc = a.location;
     TileCoordsXYZ tileLoc{ loc };
     TileElement* tileElement;
 
@@ -587,11 +549,11 @@ static constexpr map_animation_invalidate_event_handler _animatedObjectEventHand
 /**
  * @returns true if the animation should be removed.
  */
-static bool InvalidateMapAnimation(const MapAnimation& a)
+static bool InvalidateMapAnimation(MapAnimation& a)
 {
     if (a.type < std::size(_animatedObjectEventHandlers))
     {
-        return _animatedObjectEventHandlers[a.type](a.location);
+        return _animatedObjectEventHandlers[a.type](a);
     }
     return true;
 }
@@ -20,6 +20,12 @@ struct MapAnimation
 {
     uint8_t type{};
     CoordsXYZ location{};
+
+    // Transient reference to the element this animation targets, valid while
+    // cachedGeneration matches the tile element generation. Not persisted;
+    // rebuilt on demand by the per-type handlers.
+    TileElement* cachedElement{};
+    uint32_t cachedGeneration{};
 };
 
 enum
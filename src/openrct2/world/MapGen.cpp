@@ -13,8 +13,10 @@
 #include "../Diagnostic.h"
 #include "../Game.h"
 #include "../GameState.h"
+#include "../config/Config.h"
 #include "../core/Guard.hpp"
 #include "../core/Imaging.h"
+#include "../core/JobPool.h"
 #include "../core/String.hpp"
 #include "../localisation/StringIds.h"
 #include "../object/ObjectEntryManager.h"
@@ -33,7 +35,9 @@
 
 #include <cmath>
 #include <cstring>
+#include <functional>
 #include <iterator>
+#include <memory>
 #include <vector>
 
 #pragma region Height map struct
@@ -96,6 +100,50 @@ static void MapGenSetWaterLevel(int32_t waterLevel);
 static void MapGenSmoothHeight(int32_t iterations);
 static void MapGenSetHeight(MapGenSettings* settings);
 
+#pragma region Parallel passes
+
+static std::unique_ptr<JobPool> _mapGenJobs;
+
+static JobPool* MapGenGetJobPool()
+{
+    bool useMultithreading = OpenRCT2::Config::Get().general.MultiThreading;
+    if (useMultithreading && _mapGenJobs == nullptr)
+    {
+        _mapGenJobs = std::make_unique<JobPool>();
+    }
+    else if (useMultithreading == false && _mapGenJobs != nullptr)
+    {
+        _mapGenJobs.reset();
+    }
+    return _mapGenJobs.get();
+}
+
+/**
+ * Runs rowFn over [minY, maxY) split into contiguous row bands across the
+ * worker threads, blocking until all bands are done. Each row only depends on
+ * its input snapshot, so the output is identical to a serial pass regardless
+ * of thread count.
+ */
+static void MapGenParallelRows(int32_t minY, int32_t maxY, const std::function<void(int32_t, int32_t)>& rowFn)
+{
+    auto* jobPool = MapGenGetJobPool();
+    const auto numRows = maxY - minY;
+    if (jobPool == nullptr || numRows < 64)
+    {
+        rowFn(minY, maxY);
+        return;
+    }
+
+    // Several bands per thread so that uneven rows self balance.
+    const auto numBands = static_cast<int32_t>(jobPool->GetThreadCount()) * 4;
+    const auto grainSize = std::max(16, (numRows + numBands - 1) / numBands);
+    jobPool->ParallelFor(static_cast<size_t>(numRows), static_cast<size_t>(grainSize), [&](size_t begin, size_t end) {
+        rowFn(minY + static_cast<int32_t>(begin), minY + static_cast<int32_t>(end));
+    });
+}
+
+#pragma endregion
+
 static float FractalNoise(int32_t x, int32_t y, float frequency, int32_t octaves, float lacunarity, float persistence);
 static void MapGenSimplex(MapGenSettings* settings);
 
@@ -433,29 +481,32 @@ static void MapGenSetWaterLevel(int32_t waterLevel)
  */
 static void MapGenSmoothHeight(int32_t iterations)
 {
-    int32_t i, x, y, xx, yy, avg;
     int32_t arraySize = _heightSize.y * _heightSize.x * sizeof(uint8_t);
     uint8_t* copyHeight = new uint8_t[arraySize];
 
-    for (i = 0; i < iterations; i++)
+    for (int32_t i = 0; i < iterations; i++)
     {
+        // Each iteration reads the snapshot and writes the height map, so the
+        // rows within it are independent and can run in parallel
         std::memcpy(copyHeight, _height, arraySize);
-        for (y = 1; y < _heightSize.y - 1; y++)
-        {
-            for (x = 1; x < _heightSize.x - 1; x++)
+        MapGenParallelRows(1, _heightSize.y - 1, [copyHeight](int32_t startY, int32_t endY) {
+            for (int32_t y = startY; y < endY; y++)
             {
-                avg = 0;
-                for (yy = -1; yy <= 1; yy++)
+                for (int32_t x = 1; x < _heightSize.x - 1; x++)
                 {
-                    for (xx = -1; xx <= 1; xx++)
+                    int32_t avg = 0;
+                    for (int32_t yy = -1; yy <= 1; yy++)
                     {
-                        avg += copyHeight[(y + yy) * _heightSize.x + (x + xx)];
+                        for (int32_t xx = -1; xx <= 1; xx++)
+                        {
+                            avg += copyHeight[(y + yy) * _heightSize.x + (x + xx)];
+                        }
                     }
+                    avg /= 9;
+                    SetHeight(x, y, avg);
                 }
-                avg /= 9;
-                SetHeight(x, y, avg);
             }
-        }
+        });
     }
 
     delete[] copyHeight;
@@ -646,8 +697,6 @@ static float Grad(int32_t hash, float x, float y)
 
 static void MapGenSimplex(MapGenSettings* settings)
 {
-    int32_t x, y;
-
     float freq = settings->simplex_base_freq * (1.0f / _heightSize.x);
     int32_t octaves = settings->simplex_octaves;
 
@@ -655,16 +704,20 @@ static void MapGenSimplex(MapGenSettings* settings)
     int32_t high = settings->simplex_high;
 
     NoiseRand();
-    for (y = 0; y < _heightSize.y; y++)
-    {
-        for (x = 0; x < _heightSize.x; x++)
+    // Each cell is a pure function of its coordinates and the permutation
+    // table, so the map can be filled in parallel bands deterministically
+    MapGenParallelRows(0, _heightSize.y, [freq, octaves, low, high](int32_t startY, int32_t endY) {
+        for (int32_t y = startY; y < endY; y++)
         {
-            float noiseValue = std::clamp(FractalNoise(x, y, freq, octaves, 2.0f, 0.65f), -1.0f, 1.0f);
-            float normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
+            for (int32_t x = 0; x < _heightSize.x; x++)
+            {
+                float noiseValue = std::clamp(FractalNoise(x, y, freq, octaves, 2.0f, 0.65f), -1.0f, 1.0f);
+                float normalisedNoiseValue = (noiseValue + 1.0f) / 2.0f;
 
-            SetHeight(x, y, low + static_cast<int32_t>(normalisedNoiseValue * high));
+                SetHeight(x, y, low + static_cast<int32_t>(normalisedNoiseValue * high));
+            }
         }
-    }
+    });
 }
 
 #pragma endregion
@@ -758,30 +811,33 @@ static void MapGenSmoothHeightmap(std::vector<uint8_t>& src, int32_t strength)
 
     for (int32_t i = 0; i < strength; i++)
     {
-        // Calculate box blur value to all pixels of the surface
-        for (uint32_t y = 0; y < _heightMapData.height; y++)
-        {
-            for (uint32_t x = 0; x < _heightMapData.width; x++)
+        // Calculate box blur value to all pixels of the surface, in parallel
+        // bands of rows; each pixel only reads the source snapshot
+        MapGenParallelRows(0, _heightMapData.height, [&src, &dest](int32_t startY, int32_t endY) {
+            for (uint32_t y = startY; y < static_cast<uint32_t>(endY); y++)
             {
-                uint32_t heightSum = 0;
-
-                // Loop over neighbour pixels, all of them have the same weight
-                for (int8_t offsetX = -1; offsetX <= 1; offsetX++)
+                for (uint32_t x = 0; x < _heightMapData.width; x++)
                 {
-                    for (int8_t offsetY = -1; offsetY <= 1; offsetY++)
+                    uint32_t heightSum = 0;
+
+                    // Loop over neighbour pixels, all of them have the same weight
+                    for (int8_t offsetX = -1; offsetX <= 1; offsetX++)
                     {
-                        // Clamp x and y so they stay within the image
-                        // This assumes the height map is not tiled, and increases the weight of the edges
-                        const int32_t readX = std::clamp<int32_t>(x + offsetX, 0, _heightMapData.width - 1);
-                        const int32_t readY = std::clamp<int32_t>(y + offsetY, 0, _heightMapData.height - 1);
-                        heightSum += src[readX + readY * _heightMapData.width];
+                        for (int8_t offsetY = -1; offsetY <= 1; offsetY++)
+                        {
+                            // Clamp x and y so they stay within the image
+                            // This assumes the height map is not tiled, and increases the weight of the edges
+                            const int32_t readX = std::clamp<int32_t>(x + offsetX, 0, _heightMapData.width - 1);
+                            const int32_t readY = std::clamp<int32_t>(y + offsetY, 0, _heightMapData.height - 1);
+                            heightSum += src[readX + readY * _heightMapData.width];
+                        }
                     }
-                }
 
-                // Take average
-                dest[x + y * _heightMapData.width] = heightSum / 9;
+                    // Take average
+                    dest[x + y * _heightMapData.width] = heightSum / 9;
+                }
             }
-        }
+        });
 
         // Now apply the blur to the source pixels
         for (uint32_t y = 0; y < _heightMapData.height; y++)
@@ -49,9 +49,25 @@ namespace OpenRCT2::Park
     // If this value is more than or equal to 0, the park rating is forced to this value. Used for cheat
     static int32_t _forcedParkRating = -1;
 
+    // Per-ride statistics needed by the periodic park updates, collected in a
+    // single pass over the ride manager so that the 512-tick update does not
+    // walk the ride list once per derived value.
+    struct RideAggregates
+    {
+        int32_t RideCount{};
+        int32_t ExcitingRideCount{};
+        int32_t TotalRideUptime{};
+        int32_t TotalRideIntensity{};
+        int32_t TotalRideExcitement{};
+        money64 TotalRideValue{};
+        money64 TotalRideValueForMoney{};
+        uint32_t SuggestedMaxGuests{};
+    };
+
     static money64 calculateRideValue(const Ride& ride);
-    static money64 calculateTotalRideValueForMoney();
-    static uint32_t calculateSuggestedMaxGuests();
+    static RideAggregates aggregateRides();
+    static int32_t calculateParkRating(const RideAggregates& rides);
+    static money64 calculateParkValue(const RideAggregates& rides);
     static uint32_t calculateGuestGenerationProbability();
 
     static void generateGuests(GameState_t& gameState);
@@ -82,12 +98,28 @@ namespace OpenRCT2::Park
         return result;
     }
 
-    static money64 calculateTotalRideValueForMoney()
+    static RideAggregates aggregateRides()
     {
-        money64 totalRideValue = 0;
-        bool ridePricesUnlocked = RidePricesUnlocked() && !(GetGameState().Park.Flags & PARK_FLAGS_NO_MONEY);
+        RideAggregates result{};
+        uint32_t difficultGenerationBonus = 0;
+
+        auto& gameState = GetGameState();
+        bool ridePricesUnlocked = RidePricesUnlocked() && !(gameState.Park.Flags & PARK_FLAGS_NO_MONEY);
+
         for (auto& ride : GetRideManager())
         {
+            // Park rating and park value consider every ride
+            result.TotalRideUptime += 100 - ride.downtime;
+            if (RideHasRatings(ride))
+            {
+                result.TotalRideExcitement += ride.ratings.excitement / 8;
+                result.TotalRideIntensity += ride.ratings.intensity / 8;
+                result.ExcitingRideCount++;
+            }
+            result.RideCount++;
+            result.TotalRideValue += calculateRideValue(ride);
+
+            // The remaining aggregates only consider open, working rides
             if (ride.status != RideStatus::Open)
                 continue;
             if (ride.lifecycle_flags & RIDE_LIFECYCLE_BROKEN_DOWN)
@@ -105,31 +137,12 @@ namespace OpenRCT2::Park
                 }
                 if (rideValue > 0)
                 {
-                    totalRideValue += rideValue * 2;
+                    result.TotalRideValueForMoney += rideValue * 2;
                 }
             }
-        }
-        return totalRideValue;
-    }
-
-    static uint32_t calculateSuggestedMaxGuests()
-    {
-        uint32_t suggestedMaxGuests = 0;
-        uint32_t difficultGenerationBonus = 0;
-
-        auto& gameState = GetGameState();
-
-        for (auto& ride : GetRideManager())
-        {
-            if (ride.status != RideStatus::Open)
-                continue;
-            if (ride.lifecycle_flags & RIDE_LIFECYCLE_BROKEN_DOWN)
-                continue;
-            if (ride.lifecycle_flags & RIDE_LIFECYCLE_CRASHED)
-                continue;
 
             // Add guest score for ride type
-            suggestedMaxGuests += ride.GetRideTypeDescriptor().BonusValue;
+            result.SuggestedMaxGuests += ride.GetRideTypeDescriptor().BonusValue;
 
             // If difficult guest generation, extra guests are available for good rides
             if (gameState.Park.Flags & PARK_FLAGS_DIFFICULT_GUEST_GENERATION)
@@ -152,12 +165,12 @@ namespace OpenRCT2::Park
 
         if (gameState.Park.Flags & PARK_FLAGS_DIFFICULT_GUEST_GENERATION)
         {
-            suggestedMaxGuests = std::min<uint32_t>(suggestedMaxGuests, 1000);
-            suggestedMaxGuests += difficultGenerationBonus;
+            result.SuggestedMaxGuests = std::min<uint32_t>(result.SuggestedMaxGuests, 1000);
+            result.SuggestedMaxGuests += difficultGenerationBonus;
         }
 
-        suggestedMaxGuests = std::min<uint32_t>(suggestedMaxGuests, 65535);
-        return suggestedMaxGuests;
+        result.SuggestedMaxGuests = std::min<uint32_t>(result.SuggestedMaxGuests, 65535);
+        return result;
     }
 
     static uint32_t calculateGuestGenerationProbability()
@@ -326,11 +339,14 @@ namespace OpenRCT2::Park
         // Every ~13 seconds
         if (currentTicks % 512 == 0)
         {
-            gameState.Park.Rating = CalculateParkRating();
-            gameState.Park.Value = Park::CalculateParkValue();
+            // Collect the ride statistics once; the rating, park value, value
+            // for money and suggested guest maximum all derive from them.
+            const auto rideStats = aggregateRides();
+            gameState.Park.Rating = calculateParkRating(rideStats);
+            gameState.Park.Value = calculateParkValue(rideStats);
             gameState.CompanyValue = CalculateCompanyValue();
-            gameState.TotalRideValueForMoney = calculateTotalRideValueForMoney();
-            gameState.SuggestedGuestMaximum = calculateSuggestedMaxGuests();
+            gameState.TotalRideValueForMoney = rideStats.TotalRideValueForMoney;
+            gameState.SuggestedGuestMaximum = rideStats.SuggestedMaxGuests;
             gameState.GuestGenerationProbability = calculateGuestGenerationProbability();
 
             WindowInvalidateByClass(WindowClass::Finances);
@@ -351,18 +367,21 @@ namespace OpenRCT2::Park
     uint32_t CalculateParkSize()
     {
         uint32_t tiles = 0;
-        TileElementIterator it;
-        TileElementIteratorBegin(&it);
-        do
-        {
-            if (it.element->GetType() == TileElementType::Surface)
+        // Filter on the compact element index so the scan only touches the
+        // full elements of surfaces, not of everything on the map
+        const auto& compactElements = MapGetCompactElementIndex();
+        const auto& tileElements = GetTileElements();
+        for (size_t i = 0; i < compactElements.size(); i++)
+        {
+            const auto& entry = compactElements[i];
+            if (entry.GetType() == TileElementType::Surface && entry.BaseHeight != MAX_ELEMENT_HEIGHT)
             {
-                if (it.element->AsSurface()->GetOwnership() & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED))
+                if (tileElements[i].AsSurface()->GetOwnership() & (OWNERSHIP_CONSTRUCTION_RIGHTS_OWNED | OWNERSHIP_OWNED))
                 {
                     tiles++;
                 }
             }
-        } while (TileElementIteratorNext(&it));
+        }
 
         auto& gameState = GetGameState();
         if (tiles != gameState.Park.Size)
@@ -374,7 +393,7 @@ namespace OpenRCT2::Park
         return tiles;
     }
 
-    int32_t CalculateParkRating()
+    static int32_t calculateParkRating(const RideAggregates& rides)
     {
         if (_forcedParkRating >= 0)
         {
@@ -427,32 +446,16 @@ namespace OpenRCT2::Park
 
         // Rides
         {
-            int32_t rideCount = 0;
-            int32_t excitingRideCount = 0;
-            int32_t totalRideUptime = 0;
-            int32_t totalRideIntensity = 0;
-            int32_t totalRideExcitement = 0;
-            for (auto& ride : GetRideManager())
-            {
-                totalRideUptime += 100 - ride.downtime;
-                if (RideHasRatings(ride))
-                {
-                    totalRideExcitement += ride.ratings.excitement / 8;
-                    totalRideIntensity += ride.ratings.intensity / 8;
-                    excitingRideCount++;
-                }
-                rideCount++;
-            }
             result -= 200;
-            if (rideCount > 0)
+            if (rides.RideCount > 0)
             {
-                result += (totalRideUptime / rideCount) * 2;
+                result += (rides.TotalRideUptime / rides.RideCount) * 2;
             }
             result -= 100;
-            if (excitingRideCount > 0)
+            if (rides.ExcitingRideCount > 0)
             {
-                int32_t averageExcitement = totalRideExcitement / excitingRideCount;
-                int32_t averageIntensity = totalRideIntensity / excitingRideCount;
+                int32_t averageExcitement = rides.TotalRideExcitement / rides.ExcitingRideCount;
+                int32_t averageIntensity = rides.TotalRideIntensity / rides.ExcitingRideCount;
 
                 averageExcitement -= 46;
                 if (averageExcitement < 0)
@@ -471,8 +474,8 @@ namespace OpenRCT2::Park
                 result += 100 - averageExcitement - averageIntensity;
             }
 
-            totalRideExcitement = std::min<int32_t>(1000, totalRideExcitement);
-            totalRideIntensity = std::min<int32_t>(1000, totalRideIntensity);
+            const auto totalRideExcitement = std::min<int32_t>(1000, rides.TotalRideExcitement);
+            const auto totalRideIntensity = std::min<int32_t>(1000, rides.TotalRideIntensity);
             result -= 200 - ((totalRideExcitement + totalRideIntensity) / 10);
         }
 
@@ -491,19 +494,20 @@ namespace OpenRCT2::Park
         return result;
     }
 
-    money64 CalculateParkValue()
+    static money64 calculateParkValue(const RideAggregates& rides)
     {
-        // Sum ride values
-        money64 result = 0;
-        for (const auto& ride : GetRideManager())
-        {
-            result += calculateRideValue(ride);
-        }
+        // Sum ride values, +7.00 per guest
+        return rides.TotalRideValue + static_cast<money64>(GetGameState().NumGuestsInPark) * 7.00_GBP;
+    }
 
-        // +7.00 per guest
-        result += static_cast<money64>(GetGameState().NumGuestsInPark) * 7.00_GBP;
+    int32_t CalculateParkRating()
+    {
+        return calculateParkRating(aggregateRides());
+    }
 
-        return result;
+    money64 CalculateParkValue()
+    {
+        return calculateParkValue(aggregateRides());
     }
 
     money64 CalculateCompanyValue()
@@ -540,14 +544,14 @@ namespace OpenRCT2::Park
         return 40;
     }
 
-    Guest* GenerateGuest()
+    static Guest* generateGuestWithParams(const Guest::GenerationParams& params)
     {
         Guest* peep = nullptr;
         const auto spawn = GetRandomPeepSpawn();
         if (spawn != nullptr)
         {
             auto direction = DirectionReverse(spawn->direction);
-            peep = Guest::Generate({ spawn->x, spawn->y, spawn->z });
+            peep = Guest::Generate({ spawn->x, spawn->y, spawn->z }, params);
             if (peep != nullptr)
             {
                 peep->Orientation = direction << 3;
@@ -562,6 +566,23 @@ namespace OpenRCT2::Park
         return peep;
     }
 
+    Guest* GenerateGuest()
+    {
+        return generateGuestWithParams(Guest::GetGenerationParams());
+    }
+
+    void GenerateGuests(int32_t count)
+    {
+        const auto params = Guest::GetGenerationParams();
+        for (int32_t i = 0; i < count; i++)
+        {
+            if (generateGuestWithParams(params) == nullptr)
+            {
+                break;
+            }
+        }
+    }
+
     void ResetHistories(GameState_t& gameState)
     {
         std::fill(std::begin(gameState.Park.RatingHistory), std::end(gameState.Park.RatingHistory), ParkRatingHistoryUndefined);
@@ -80,6 +80,10 @@ namespace OpenRCT2
 
         Guest* GenerateGuest();
 
+        // Spawns up to count guests, resolving the park-derived generation
+        // parameters once for the whole batch.
+        void GenerateGuests(int32_t count);
+
         void ResetHistories(OpenRCT2::GameState_t& gameState);
         void UpdateHistories(OpenRCT2::GameState_t& gameState);
         void SetForcedRating(int32_t rating);
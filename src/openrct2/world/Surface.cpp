@@ -42,11 +42,15 @@ TerrainEdgeObject* SurfaceElement::GetEdgeObject() const
 
 void SurfaceElement::SetSurfaceObjectIndex(ObjectEntryIndex newStyle)
 {
+    if (SurfaceStyle != newStyle)
+        MapInvalidateCompactElementIndex();
     SurfaceStyle = static_cast<ObjectEntryIndex>(newStyle);
 }
 
 void SurfaceElement::SetEdgeObjectIndex(ObjectEntryIndex newIndex)
 {
+    if (EdgeObjectIndex != newIndex)
+        MapInvalidateCompactElementIndex();
     EdgeObjectIndex = static_cast<ObjectEntryIndex>(newIndex);
 }
 
@@ -198,8 +202,11 @@ uint8_t SurfaceElement::GetOwnership() const
 
 void SurfaceElement::SetOwnership(uint8_t newOwnership)
 {
-    Ownership &= ~kTileElementSurfaceOwnershipMask;
-    Ownership |= (newOwnership & kTileElementSurfaceOwnershipMask);
+    const auto newValue = static_cast<uint8_t>(
+        (Ownership & ~kTileElementSurfaceOwnershipMask) | (newOwnership & kTileElementSurfaceOwnershipMask));
+    if (Ownership != newValue)
+        MapInvalidateCompactElementIndex();
+    Ownership = newValue;
 }
 
 uint8_t SurfaceElement::GetParkFences() const
@@ -483,6 +483,7 @@ namespace OpenRCT2::TileInspector
 
             tileElement->BaseHeight += heightOffset;
             tileElement->ClearanceHeight += heightOffset;
+            MapInvalidateCompactElementIndex();
         }
 
         return GameActions::Result();
@@ -765,6 +766,7 @@ namespace OpenRCT2::TileInspector
                 nextTrackElement->BaseHeight += offset;
                 nextTrackElement->ClearanceHeight += offset;
             }
+            MapInvalidateCompactElementIndex();
         }
 
         return GameActions::Result();
@@ -43,6 +43,40 @@ public:
         }
     }
 
+    /**
+     * Builds an index where only the tiles inside populatedSize have their own
+     * elements; every tile outside that rectangle points at the shared, read
+     * only emptyTile, so the element storage does not have to cover the full
+     * technical map.
+     */
+    explicit TilePointerIndex(
+        const uint16_t mapSize, const TileCoordsXY populatedSize, T* tileElements, size_t count, T* emptyTile)
+    {
+        MapSize = mapSize;
+        TilePointers.reserve(MapSize * MapSize);
+
+        size_t index = 0;
+        for (size_t y = 0; y < MapSize; y++)
+        {
+            for (size_t x = 0; x < MapSize; x++)
+            {
+                if (x < static_cast<size_t>(populatedSize.x) && y < static_cast<size_t>(populatedSize.y))
+                {
+                    assert(index < count);
+                    TilePointers.emplace_back(&tileElements[index]);
+                    do
+                    {
+                        index++;
+                    } while (!tileElements[index - 1].IsLastForTile());
+                }
+                else
+                {
+                    TilePointers.emplace_back(emptyTile);
+                }
+            }
+        }
+    }
+
     T* GetFirstElementAt(TileCoordsXY coords)
     {
         return TilePointers[coords.x + (coords.y * MapSize)];
@@ -0,0 +1,148 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <openrct2/core/ArenaAllocator.hpp>
+#include <set>
+
+using namespace OpenRCT2;
+
+TEST(ArenaAllocatorTest, allocateAndAlign)
+{
+    ArenaAllocator arena(1024);
+
+    auto* a = arena.Allocate(1);
+    auto* b = arena.Allocate(16, 16);
+    ASSERT_NE(a, nullptr);
+    ASSERT_NE(b, nullptr);
+    ASSERT_NE(a, b);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(b) % 16, 0u);
+
+    // Oversized requests get their own block rather than failing.
+    auto* big = arena.Allocate(4096);
+    ASSERT_NE(big, nullptr);
+    ASSERT_GE(arena.GetCapacity(), size_t(4096));
+}
+
+TEST(ArenaAllocatorTest, resetRetainsBlocks)
+{
+    ArenaAllocator arena(1024);
+
+    auto* first = arena.Allocate(64);
+    const auto capacity = arena.GetCapacity();
+    arena.Reset();
+
+    // A steady-state workload must not grow the arena: after a reset the
+    // same storage is handed out again.
+    ASSERT_EQ(arena.Allocate(64), first);
+    ASSERT_EQ(arena.GetCapacity(), capacity);
+}
+
+TEST(ArenaAllocatorTest, createAndAllocateArray)
+{
+    struct Trivial
+    {
+        int32_t x;
+        int32_t y;
+    };
+
+    ArenaAllocator arena(1024);
+    auto* value = arena.Create<Trivial>(Trivial{ 3, 7 });
+    ASSERT_EQ(value->x, 3);
+    ASSERT_EQ(value->y, 7);
+
+    auto* values = arena.AllocateArray<uint32_t>(100);
+    ASSERT_NE(values, nullptr);
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        values[i] = i;
+    }
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        ASSERT_EQ(values[i], i);
+    }
+}
+
+TEST(ArenaAllocatorTest, scopeUnwinds)
+{
+    ArenaAllocator arena(1024);
+    auto* outer = arena.Allocate(32);
+
+    void* inner = nullptr;
+    {
+        ArenaAllocator::Scope scope(arena);
+        inner = arena.Allocate(32);
+        ASSERT_NE(inner, outer);
+    }
+
+    // Everything allocated inside the scope is released; the next allocation
+    // reuses its storage while the outer allocation is untouched.
+    ASSERT_EQ(arena.Allocate(32), inner);
+}
+
+namespace
+{
+    struct Counted
+    {
+        static inline int32_t Alive;
+        int32_t Value;
+
+        explicit Counted(int32_t value)
+            : Value(value)
+        {
+            Alive++;
+        }
+        ~Counted()
+        {
+            Alive--;
+        }
+    };
+} // namespace
+
+TEST(ObjectPoolTest, allocateFreeReuse)
+{
+    Counted::Alive = 0;
+    ObjectPool<Counted> pool;
+
+    auto* a = pool.Allocate(1);
+    auto* b = pool.Allocate(2);
+    ASSERT_EQ(Counted::Alive, 2);
+    ASSERT_EQ(a->Value, 1);
+    ASSERT_EQ(b->Value, 2);
+
+    // Free runs the destructor and the slot goes straight back out.
+    pool.Free(b);
+    ASSERT_EQ(Counted::Alive, 1);
+    auto* c = pool.Allocate(3);
+    ASSERT_EQ(c, b);
+    ASSERT_EQ(c->Value, 3);
+
+    pool.Free(a);
+    pool.Free(c);
+    ASSERT_EQ(Counted::Alive, 0);
+}
+
+TEST(ObjectPoolTest, manyDistinctAllocations)
+{
+    ObjectPool<uint64_t> pool;
+
+    // Force the pool through several growth blocks and check every live
+    // object has distinct storage.
+    std::set<uint64_t*> allocations;
+    for (uint64_t i = 0; i < 1000; i++)
+    {
+        auto* value = pool.Allocate(i);
+        ASSERT_TRUE(allocations.insert(value).second);
+        ASSERT_EQ(*value, i);
+    }
+    for (auto* value : allocations)
+    {
+        pool.Free(value);
+    }
+}
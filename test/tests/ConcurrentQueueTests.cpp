@@ -0,0 +1,205 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <openrct2/core/ConcurrentQueue.hpp>
+#include <thread>
+#include <vector>
+
+using namespace OpenRCT2;
+
+// Small capacity so single-threaded tests wrap the indices many times over.
+constexpr size_t kTestCapacity = 8;
+
+TEST(SPSCQueueTest, emptyAndFullBoundaries)
+{
+    SPSCQueue<uint32_t, kTestCapacity> queue;
+    ASSERT_TRUE(queue.IsEmpty());
+
+    uint32_t value{};
+    ASSERT_FALSE(queue.TryPop(value));
+
+    for (uint32_t i = 0; i < kTestCapacity; i++)
+    {
+        ASSERT_TRUE(queue.TryPush(i));
+    }
+    ASSERT_FALSE(queue.TryPush(kTestCapacity));
+
+    // Draining one slot makes exactly one push possible again.
+    ASSERT_TRUE(queue.TryPop(value));
+    ASSERT_EQ(value, 0u);
+    ASSERT_TRUE(queue.TryPush(kTestCapacity));
+    ASSERT_FALSE(queue.TryPush(kTestCapacity + 1));
+}
+
+TEST(SPSCQueueTest, wraparound)
+{
+    SPSCQueue<uint32_t, kTestCapacity> queue;
+
+    // Push/pop far more elements than the capacity so head and tail wrap the
+    // ring repeatedly; FIFO order must survive every wrap.
+    constexpr uint32_t numElements = kTestCapacity * 64;
+    uint32_t next = 0;
+    for (uint32_t i = 0; i < numElements; i++)
+    {
+        ASSERT_TRUE(queue.TryPush(i));
+        if (i % 3 == 2)
+        {
+            // Pop in bursts so the indices drift out of phase.
+            for (int j = 0; j < 3; j++)
+            {
+                uint32_t value{};
+                ASSERT_TRUE(queue.TryPop(value));
+                ASSERT_EQ(value, next++);
+            }
+        }
+    }
+    uint32_t value{};
+    while (queue.TryPop(value))
+    {
+        ASSERT_EQ(value, next++);
+    }
+    ASSERT_EQ(next, numElements);
+    ASSERT_TRUE(queue.IsEmpty());
+}
+
+TEST(SPSCQueueTest, batchPushPop)
+{
+    SPSCQueue<uint32_t, kTestCapacity> queue;
+
+    const uint32_t values[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+    // Batch push is allowed to fit only part of the input.
+    ASSERT_EQ(queue.PushBatch(values, std::size(values)), kTestCapacity);
+    ASSERT_EQ(queue.PushBatch(values, std::size(values)), 0u);
+
+    uint32_t out[std::size(values)]{};
+    ASSERT_EQ(queue.PopBatch(out, std::size(out)), kTestCapacity);
+    for (uint32_t i = 0; i < kTestCapacity; i++)
+    {
+        ASSERT_EQ(out[i], i);
+    }
+    ASSERT_EQ(queue.PopBatch(out, std::size(out)), 0u);
+    ASSERT_TRUE(queue.IsEmpty());
+}
+
+TEST(SPSCQueueTest, twoThreadStress)
+{
+    SPSCQueue<uint32_t, 256> queue;
+    constexpr uint32_t numElements = 100000;
+
+    std::thread producer([&queue]() {
+        for (uint32_t i = 0; i < numElements;)
+        {
+            if (queue.TryPush(i))
+            {
+                i++;
+            }
+        }
+    });
+
+    // Values must arrive in order with nothing lost or duplicated.
+    uint32_t expected = 0;
+    while (expected < numElements)
+    {
+        uint32_t value{};
+        if (queue.TryPop(value))
+        {
+            ASSERT_EQ(value, expected);
+            expected++;
+        }
+    }
+    producer.join();
+    ASSERT_TRUE(queue.IsEmpty());
+}
+
+TEST(MPSCQueueTest, emptyAndFullBoundaries)
+{
+    MPSCQueue<uint32_t, kTestCapacity> queue;
+    ASSERT_TRUE(queue.IsEmpty());
+
+    uint32_t value{};
+    ASSERT_FALSE(queue.TryPop(value));
+
+    for (uint32_t i = 0; i < kTestCapacity; i++)
+    {
+        ASSERT_TRUE(queue.TryPush(i));
+    }
+    ASSERT_FALSE(queue.TryPush(kTestCapacity));
+
+    ASSERT_TRUE(queue.TryPop(value));
+    ASSERT_EQ(value, 0u);
+    ASSERT_TRUE(queue.TryPush(kTestCapacity));
+    ASSERT_FALSE(queue.TryPush(kTestCapacity + 1));
+}
+
+TEST(MPSCQueueTest, wraparound)
+{
+    MPSCQueue<uint32_t, kTestCapacity> queue;
+
+    constexpr uint32_t numElements = kTestCapacity * 64;
+    uint32_t next = 0;
+    for (uint32_t i = 0; i < numElements; i++)
+    {
+        ASSERT_TRUE(queue.TryPush(i));
+        uint32_t value{};
+        ASSERT_TRUE(queue.TryPop(value));
+        ASSERT_EQ(value, next++);
+    }
+    ASSERT_TRUE(queue.IsEmpty());
+}
+
+TEST(MPSCQueueTest, multiProducerStress)
+{
+    MPSCQueue<uint32_t, 256> queue;
+    constexpr uint32_t numProducers = 4;
+    constexpr uint32_t numPerProducer = 25000;
+
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < numProducers; p++)
+    {
+        producers.emplace_back([&queue, p]() {
+            // Tag each value with its producer so per-producer FIFO order can
+            // be verified on the consumer side.
+            for (uint32_t i = 0; i < numPerProducer;)
+            {
+                if (queue.TryPush((p << 24) | i))
+                {
+                    i++;
+                }
+            }
+        });
+    }
+
+    uint32_t nextPerProducer[numProducers]{};
+    uint32_t numPopped = 0;
+    while (numPopped < numProducers * numPerProducer)
+    {
+        uint32_t buffer[64];
+        const auto count = queue.PopBatch(buffer, std::size(buffer));
+        for (size_t i = 0; i < count; i++)
+        {
+            const auto producer = buffer[i] >> 24;
+            const auto sequence = buffer[i] & 0xFFFFFF;
+            ASSERT_LT(producer, numProducers);
+            ASSERT_EQ(sequence, nextPerProducer[producer]++);
+        }
+        numPopped += static_cast<uint32_t>(count);
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    ASSERT_TRUE(queue.IsEmpty());
+    for (uint32_t p = 0; p < numProducers; p++)
+    {
+        ASSERT_EQ(nextPerProducer[p], numPerProducer);
+    }
+}
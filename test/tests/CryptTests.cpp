@@ -11,6 +11,7 @@
 #include "helpers/StringHelpers.hpp"
 
 #include <gtest/gtest.h>
+#include <openrct2/config/Config.h>
 #include <openrct2/core/Crypt.h>
 #include <openrct2/core/File.h>
 #include <openrct2/core/Path.hpp>
@@ -120,6 +121,65 @@ TEST_F(CryptTests, SHA1_Many)
     AssertHash("ac46948f97d69fa766706e932ce82562b4f73aa7", alg->Finish());
 }
 
+TEST_F(CryptTests, SHA1_Batch_MatchesSingle)
+{
+    std::string input[] = {
+        "Merry-go-round 2 looks too intense for me",
+        "",
+        "This park is really clean and tidy",
+        "This balloon from Balloon Stall 1 is really good value",
+    };
+
+    std::vector<Crypt::HashInput> inputs;
+    for (const auto& s : input)
+    {
+        inputs.push_back({ s.data(), s.size() });
+    }
+
+    auto results = Crypt::SHA1Batch(inputs);
+    ASSERT_EQ(results.size(), std::size(input));
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        ASSERT_EQ(results[i], Crypt::SHA1(input[i].data(), input[i].size()));
+    }
+
+    ASSERT_TRUE(Crypt::SHA1Batch({}).empty());
+}
+
+TEST_F(CryptTests, SHA256_Batch_MatchesSingle)
+{
+    // Enough buffers of varying sizes to exercise the job pool path as well
+    // as the sequential fallback; results must be identical either way.
+    std::vector<std::string> input;
+    for (size_t i = 0; i < 100; i++)
+    {
+        input.emplace_back(i * 13, static_cast<char>('a' + (i % 26)));
+    }
+
+    std::vector<Crypt::HashInput> inputs;
+    for (const auto& s : input)
+    {
+        inputs.push_back({ s.data(), s.size() });
+    }
+
+    auto& config = OpenRCT2::Config::Get();
+    const bool oldMultiThreading = config.general.MultiThreading;
+    config.general.MultiThreading = true;
+    auto parallelResults = Crypt::SHA256Batch(inputs);
+    config.general.MultiThreading = false;
+    auto sequentialResults = Crypt::SHA256Batch(inputs);
+    config.general.MultiThreading = oldMultiThreading;
+
+    ASSERT_EQ(parallelResults.size(), input.size());
+    ASSERT_EQ(sequentialResults.size(), input.size());
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        auto expected = Crypt::SHA256(input[i].data(), input[i].size());
+        ASSERT_EQ(parallelResults[i], expected);
+        ASSERT_EQ(sequentialResults[i], expected);
+    }
+}
+
 TEST_F(CryptTests, RSA_Basic)
 {
     std::vector<uint8_t> data = { 0, 1, 2, 3, 4, 5, 6, 7 };
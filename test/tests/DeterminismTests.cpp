@@ -0,0 +1,112 @@
+/*****************************************************************************
+ * Copyright (c) 2014-2024 OpenRCT2 developers
+ *
+ * For a complete list of all authors, please refer to contributors.md
+ * Interested in contributing? Visit https://github.com/OpenRCT2/OpenRCT2
+ *
+ * OpenRCT2 is licensed under the GNU General Public License version 3.
+ *****************************************************************************/
+
+#include "TestData.h"
+
+#include <gtest/gtest.h>
+#include <openrct2/Context.h>
+#include <openrct2/Game.h>
+#include <openrct2/GameState.h>
+#include <openrct2/OpenRCT2.h>
+#include <openrct2/config/Config.h>
+#include <openrct2/entity/EntityRegistry.h>
+#include <string>
+#include <vector>
+
+using namespace OpenRCT2;
+
+// The simulation must produce identical state regardless of how many threads
+// the update is sharded across, otherwise multiplayer desyncs. These tests
+// run the same park twice, once single threaded and once with the job pool
+// enabled, and compare rolling per-subsystem checksums so a divergence is
+// pinned to the first bad tick and the subsystem that caused it.
+
+constexpr uint32_t kTicksToRun = 400;
+constexpr uint32_t kChecksumInterval = 16;
+
+namespace
+{
+    struct ChecksumSample
+    {
+        uint32_t Tick;
+        std::string Peeps;
+        std::string Vehicles;
+        std::string Litter;
+        std::string All;
+    };
+} // namespace
+
+static std::vector<ChecksumSample> RunSimulation(const std::string& parkPath, bool multiThreaded)
+{
+    gOpenRCT2Headless = true;
+    gOpenRCT2NoGraphics = true;
+
+    auto context = CreateContext();
+    EXPECT_TRUE(context->Initialise());
+
+    Config::Get().general.MultiThreading = multiThreaded;
+
+    context->LoadParkFromFile(parkPath);
+    GameLoadInit();
+
+    std::vector<ChecksumSample> samples;
+    for (uint32_t tick = 1; tick <= kTicksToRun; tick++)
+    {
+        gameStateUpdateLogic();
+        if (tick % kChecksumInterval == 0)
+        {
+            samples.push_back({
+                tick,
+                GetPeepEntitiesChecksum().ToString(),
+                GetVehicleEntitiesChecksum().ToString(),
+                GetLitterEntitiesChecksum().ToString(),
+                GetAllEntitiesChecksum().ToString(),
+            });
+        }
+    }
+    return samples;
+}
+
+TEST(DeterminismTests, MultiThreadingMatchesSingleThreaded)
+{
+    std::string path = TestData::GetParkPath("bpb.sv6");
+
+    auto baseline = RunSimulation(path, false);
+    auto parallel = RunSimulation(path, true);
+    ASSERT_EQ(baseline.size(), parallel.size());
+
+    for (size_t i = 0; i < baseline.size(); i++)
+    {
+        const auto& expected = baseline[i];
+        const auto& actual = parallel[i];
+
+        // The narrower subsystem checksums are compared first so the failure
+        // message names the subsystem that diverged, not just the tick.
+        ASSERT_EQ(expected.Peeps, actual.Peeps) << "Peep state diverged by tick " << expected.Tick;
+        ASSERT_EQ(expected.Vehicles, actual.Vehicles) << "Vehicle state diverged by tick " << expected.Tick;
+        ASSERT_EQ(expected.Litter, actual.Litter) << "Litter state diverged by tick " << expected.Tick;
+        ASSERT_EQ(expected.All, actual.All) << "Entity state diverged by tick " << expected.Tick;
+    }
+}
+
+TEST(DeterminismTests, RepeatedSingleThreadedRunsMatch)
+{
+    std::string path = TestData::GetParkPath("bpb.sv6");
+
+    // Guards the harness itself: if a fresh context does not reproduce its
+    // own checksums, the multithreading comparison above is meaningless.
+    auto first = RunSimulation(path, false);
+    auto second = RunSimulation(path, false);
+    ASSERT_EQ(first.size(), second.size());
+
+    for (size_t i = 0; i < first.size(); i++)
+    {
+        ASSERT_EQ(first[i].All, second[i].All) << "Entity state diverged by tick " << first[i].Tick;
+    }
+}